@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/objectregistry.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::game;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr int kNumObjects = 20000;
+static constexpr int kNumLookups = 1000000;
+
+namespace {
+
+struct BenchObject {
+    uint32_t value {0};
+};
+
+} // namespace
+
+void benchObjectRegistry() {
+    // Mimics a module after a few area transitions: every fourth object has
+    // been destroyed, and its ID still circulates in scripts
+    auto registry = ObjectRegistry<BenchObject>();
+    auto map = std::map<uint32_t, std::shared_ptr<BenchObject>>();
+    std::vector<uint32_t> ids;
+    for (int i = 0; i < kNumObjects; ++i) {
+        auto object = std::make_shared<BenchObject>();
+        object->value = i;
+        auto id = registry.reserve();
+        registry.insert(id, object, ObjectType::Creature);
+        map[id] = std::move(object);
+        ids.push_back(id);
+    }
+    for (int i = 0; i < kNumObjects; i += 4) {
+        registry.remove(ids[i]);
+        map.erase(ids[i]);
+    }
+
+    std::vector<uint32_t> lookups;
+    lookups.reserve(kNumLookups);
+    uint32_t state = 0x12345678;
+    for (int i = 0; i < kNumLookups; ++i) {
+        state = state * 1664525 + 1013904223;
+        lookups.push_back(ids[(state >> 8) % ids.size()]);
+    }
+
+    double registryMillis = measureMillis([&registry, &lookups]() {
+        uint64_t sum = 0;
+        for (auto id : lookups) {
+            auto object = registry.get(id);
+            if (object) {
+                sum += object->value;
+            }
+        }
+        consume(sum);
+    });
+    reportRate("ObjectRegistry::get, 20k objects, 1M lookups", registryMillis, kNumLookups, "lookups");
+
+    double mapMillis = measureMillis([&map, &lookups]() {
+        uint64_t sum = 0;
+        for (auto id : lookups) {
+            auto it = map.find(id);
+            if (it != map.end()) {
+                sum += it->second->value;
+            }
+        }
+        consume(sum);
+    });
+    reportRate("std::map::find, 20k objects, 1M lookups", mapMillis, kNumLookups, "lookups");
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/pathfinder.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::game;
+using namespace reone::resource;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr int kGridSize = 100;
+static constexpr float kPointSpacing = 2.0f;
+static constexpr int kNumRounds = 5;
+static constexpr int kQueriesPerRound = 200;
+
+void benchPathfinder() {
+    // Grid of 10k points, each connected to its four neighbours
+    std::vector<Path::Point> points;
+    std::unordered_map<int, float> pointZ;
+    for (int y = 0; y < kGridSize; ++y) {
+        for (int x = 0; x < kGridSize; ++x) {
+            auto point = Path::Point();
+            point.x = kPointSpacing * x;
+            point.y = kPointSpacing * y;
+            int index = y * kGridSize + x;
+            if (x > 0) {
+                point.adjPoints.push_back(index - 1);
+            }
+            if (x < kGridSize - 1) {
+                point.adjPoints.push_back(index + 1);
+            }
+            if (y > 0) {
+                point.adjPoints.push_back(index - kGridSize);
+            }
+            if (y < kGridSize - 1) {
+                point.adjPoints.push_back(index + kGridSize);
+            }
+            points.push_back(std::move(point));
+            pointZ[index] = 0.0f;
+        }
+    }
+    auto pathfinder = Pathfinder();
+    double loadMillis = measureMillis([&]() {
+        pathfinder.load(points, pointZ);
+    });
+    reportTime("Pathfinder::load, 10k points", loadMillis);
+
+    uint32_t state = 0x12345678;
+    auto randomPosition = [&state]() {
+        state = state * 1664525 + 1013904223;
+        float x = kPointSpacing * (kGridSize - 1) * (state >> 8) / static_cast<float>(1 << 24);
+        state = state * 1664525 + 1013904223;
+        float y = kPointSpacing * (kGridSize - 1) * (state >> 8) / static_cast<float>(1 << 24);
+        return glm::vec3(x, y, 0.0f);
+    };
+    std::vector<std::pair<glm::vec3, glm::vec3>> queries;
+    for (int i = 0; i < kNumRounds * kQueriesPerRound; ++i) {
+        auto from = randomPosition();
+        auto to = randomPosition();
+        queries.push_back(std::make_pair(from, to));
+    }
+
+    // Every round takes fresh queries, so that every query runs a search
+    int round = 0;
+    auto searchFresh = [&]() {
+        uint64_t numVertices = 0;
+        for (int i = 0; i < kQueriesPerRound; ++i) {
+            auto &query = queries[round * kQueriesPerRound + i];
+            numVertices += pathfinder.findPath(query.first, query.second).size();
+        }
+        consume(numVertices);
+        ++round;
+    };
+    double searchMillis = measureMillis(searchFresh, kNumRounds);
+    reportRate("Pathfinder::findPath, uncached", searchMillis, kQueriesPerRound, "paths");
+
+    // By now, all of the queries are in the path cache
+    double cachedMillis = measureMillis([&]() {
+        uint64_t numVertices = 0;
+        for (auto &query : queries) {
+            numVertices += pathfinder.findPath(query.first, query.second).size();
+        }
+        consume(numVertices);
+    });
+    reportRate("Pathfinder::findPath, cached", cachedMillis, static_cast<double>(queries.size()), "paths");
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/spatialgrid.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::game;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr int kNumObjects = 5000;
+static constexpr int kNumQueries = 100000;
+static constexpr float kAreaSize = 400.0f;
+static constexpr int kNearestCount = 5;
+static constexpr float kQueryRadius = 10.0f;
+
+static float randomCoord(uint32_t &state) {
+    state = state * 1664525 + 1013904223;
+    return kAreaSize * (state >> 8) / static_cast<float>(1 << 24);
+}
+
+void benchSpatialGrid() {
+    uint32_t state = 0x12345678;
+    std::vector<glm::vec3> positions;
+    auto grid = SpatialGrid<uint32_t>();
+    for (int i = 0; i < kNumObjects; ++i) {
+        glm::vec3 position(randomCoord(state), randomCoord(state), 0.0f);
+        grid.add(i, i, position);
+        positions.push_back(position);
+    }
+    std::vector<glm::vec3> origins;
+    for (int i = 0; i < kNumQueries; ++i) {
+        origins.emplace_back(randomCoord(state), randomCoord(state), 0.0f);
+    }
+    auto isEven = [](const uint32_t &value) { return value % 2 == 0; };
+
+    double nearestMillis = measureMillis([&]() {
+        std::vector<std::pair<uint32_t, float>> values;
+        uint64_t sum = 0;
+        for (auto &origin : origins) {
+            grid.findNearest(origin, kNearestCount, isEven, values);
+            sum += values.front().first;
+        }
+        consume(sum);
+    });
+    reportRate("SpatialGrid::findNearest, 5k objects, k=5", nearestMillis, kNumQueries, "queries");
+
+    double radiusMillis = measureMillis([&]() {
+        std::vector<uint32_t> values;
+        uint64_t sum = 0;
+        for (auto &origin : origins) {
+            grid.findInRadius(origin, kQueryRadius, isEven, values);
+            sum += values.size();
+        }
+        consume(sum);
+    });
+    reportRate("SpatialGrid::findInRadius, 5k objects, r=10", radiusMillis, kNumQueries, "queries");
+
+    // Baseline: linear scan over all objects, as Area did before the grid
+    double linearMillis = measureMillis([&]() {
+        std::vector<std::pair<uint32_t, float>> values;
+        uint64_t sum = 0;
+        for (auto &origin : origins) {
+            values.clear();
+            for (int i = 0; i < kNumObjects; ++i) {
+                if (isEven(i)) {
+                    values.push_back(std::make_pair(i, glm::distance2(positions[i], origin)));
+                }
+            }
+            std::partial_sort(values.begin(), values.begin() + kNearestCount, values.end(), [](auto &left, auto &right) {
+                return left.second < right.second;
+            });
+            sum += values.front().first;
+        }
+        consume(sum);
+    });
+    reportRate("Linear scan nearest, 5k objects, k=5", linearMillis, kNumQueries, "queries");
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/dxtutil.h"
+#include "reone/system/threadpool.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::graphics;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr uint32_t kTextureSize = 2048;
+
+static std::vector<uint8_t> makeRandomBlocks(uint32_t width, uint32_t height, int blockSize) {
+    std::vector<uint8_t> blocks(((width + 3) / 4) * ((height + 3) / 4) * blockSize);
+    uint32_t state = 0x12345678;
+    for (auto &byte : blocks) {
+        state = state * 1664525 + 1013904223;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return blocks;
+}
+
+void benchDxt() {
+    // Throughput is measured in decompressed bytes
+    auto dxt1Blocks = makeRandomBlocks(kTextureSize, kTextureSize, 8);
+    auto dxt5Blocks = makeRandomBlocks(kTextureSize, kTextureSize, 16);
+    std::vector<uint32_t> image(kTextureSize * kTextureSize);
+    double numBytes = sizeof(uint32_t) * image.size();
+
+    auto threadPool = ThreadPool();
+    threadPool.init();
+
+    for (auto pool : {static_cast<IThreadPool *>(nullptr), static_cast<IThreadPool *>(&threadPool)}) {
+        std::string suffix(pool ? ", thread pool" : "");
+        double dxt1Millis = measureMillis([&]() {
+            decompressDXT1(kTextureSize, kTextureSize, dxt1Blocks.data(), image.data(), pool);
+            consume(image[image.size() / 2]);
+        });
+        reportThroughput("decompressDXT1, 2048x2048" + suffix, dxt1Millis, numBytes);
+        double dxt5Millis = measureMillis([&]() {
+            decompressDXT5(kTextureSize, kTextureSize, dxt5Blocks.data(), image.data(), pool);
+            consume(image[image.size() / 2]);
+        });
+        reportThroughput("decompressDXT5, 2048x2048" + suffix, dxt5Millis, numBytes);
+    }
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/threadutil.h"
+
+#include "benchmarks.h"
+
+using namespace reone;
+using namespace reone::bench;
+
+struct Benchmark {
+    std::string name;
+    std::function<void()> func;
+};
+
+static const std::vector<Benchmark> kBenchmarks {
+    {"resources", &benchResources},
+    {"dxt", &benchDxt},
+    {"spatialgrid", &benchSpatialGrid},
+    {"binaryreader", &benchBinaryReader},
+    {"gff", &benchGff},
+    {"pathfinder", &benchPathfinder},
+    {"objectregistry", &benchObjectRegistry},
+    {"collisions", &benchCollisions}};
+
+int main(int argc, char **argv) {
+    markMainThread();
+
+    try {
+        boost::program_options::options_description description;
+        description.add_options()                                                        //
+            ("help", "print usage")                                                      //
+            ("filter", boost::program_options::value<std::string>()->default_value("")); //
+
+        boost::program_options::positional_options_description positionalDesc;
+        positionalDesc.add("filter", 1);
+
+        auto options = boost::program_options::command_line_parser(argc, argv)
+                           .options(description)
+                           .positional(positionalDesc)
+                           .run();
+
+        boost::program_options::variables_map vars;
+        boost::program_options::store(options, vars);
+        boost::program_options::notify(vars);
+
+        if (vars.count("help") > 0) {
+            std::cout << "Usage: benchmarks [filter]" << std::endl
+                      << "Runs benchmarks whose names contain filter:" << std::endl;
+            for (auto &benchmark : kBenchmarks) {
+                std::cout << "  " << benchmark.name << std::endl;
+            }
+            return 0;
+        }
+
+        auto &filter = vars["filter"].as<std::string>();
+        for (auto &benchmark : kBenchmarks) {
+            if (benchmark.name.find(filter) == std::string::npos) {
+                continue;
+            }
+            std::cout << "[" << benchmark.name << "]" << std::endl;
+            benchmark.func();
+        }
+
+        return 0;
+
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "measure.h"
+
+namespace reone {
+
+namespace bench {
+
+static volatile uint64_t g_sink = 0;
+
+double measureMillis(const std::function<void()> &func, int numRounds) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < numRounds; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+void consume(uint64_t value) {
+    g_sink = g_sink + value;
+}
+
+void reportTime(const std::string &name, double millis) {
+    std::cout << boost::format("%-48s %10.3f ms") % name % millis << std::endl;
+}
+
+void reportRate(const std::string &name, double millis, double count, const std::string &unit) {
+    double perSecond = count / (millis / 1000.0);
+    std::cout << boost::format("%-48s %10.3f ms %12.2f M%s/s") % name % millis % (perSecond / 1e6) % unit << std::endl;
+}
+
+void reportThroughput(const std::string &name, double millis, double numBytes) {
+    double megabytesPerSecond = numBytes / (1024.0 * 1024.0) / (millis / 1000.0);
+    std::cout << boost::format("%-48s %10.3f ms %12.2f MB/s") % name % millis % megabytesPerSecond << std::endl;
+}
+
+} // namespace bench
+
+} // namespace reone
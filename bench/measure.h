@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace bench {
+
+/**
+ * Runs func numRounds times.
+ *
+ * @return wall time of the fastest round in milliseconds
+ */
+double measureMillis(const std::function<void()> &func, int numRounds = 5);
+
+/**
+ * Keeps a computed value observable, so that the compiler cannot elide the
+ * code that produced it.
+ */
+void consume(uint64_t value);
+
+void reportTime(const std::string &name, double millis);
+void reportRate(const std::string &name, double millis, double count, const std::string &unit);
+void reportThroughput(const std::string &name, double millis, double numBytes);
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/container/memory.h"
+#include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
+#include "reone/resource/parser/gff/git.h"
+#include "reone/resource/parser/gff/utc.h"
+#include "reone/resource/provider/gffs.h"
+#include "reone/resource/resources.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::resource;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr int kNumCreatures = 2000;
+static constexpr int kNumPlaceables = 2000;
+static constexpr int kNumWaypoints = 1000;
+static constexpr int kNumBlueprints = 500;
+static constexpr int kItemsPerBlueprint = 10;
+
+static std::shared_ptr<Gff> makeGIT() {
+    std::vector<std::shared_ptr<Gff>> creatures;
+    for (int i = 0; i < kNumCreatures; ++i) {
+        creatures.push_back(Gff::Builder()
+                                .type(4)
+                                .field(Gff::Field::newResRef("TemplateResRef", str(boost::format("n_creature%04d") % i)))
+                                .field(Gff::Field::newFloat("XOrientation", 1.0f))
+                                .field(Gff::Field::newFloat("XPosition", static_cast<float>(i)))
+                                .field(Gff::Field::newFloat("YOrientation", 0.0f))
+                                .field(Gff::Field::newFloat("YPosition", 2.0f * i))
+                                .field(Gff::Field::newFloat("ZPosition", 0.5f))
+                                .build());
+    }
+    std::vector<std::shared_ptr<Gff>> placeables;
+    for (int i = 0; i < kNumPlaceables; ++i) {
+        placeables.push_back(Gff::Builder()
+                                 .type(9)
+                                 .field(Gff::Field::newFloat("Bearing", 0.25f))
+                                 .field(Gff::Field::newResRef("TemplateResRef", str(boost::format("plc_crate%04d") % i)))
+                                 .field(Gff::Field::newDword("TweakColor", 0))
+                                 .field(Gff::Field::newByte("UseTweakColor", 0))
+                                 .field(Gff::Field::newFloat("X", static_cast<float>(i)))
+                                 .field(Gff::Field::newFloat("Y", 3.0f * i))
+                                 .field(Gff::Field::newFloat("Z", 0.0f))
+                                 .build());
+    }
+    std::vector<std::shared_ptr<Gff>> waypoints;
+    for (int i = 0; i < kNumWaypoints; ++i) {
+        auto tag = str(boost::format("wp_%04d") % i);
+        waypoints.push_back(Gff::Builder()
+                                .type(5)
+                                .field(Gff::Field::newByte("Appearance", 1))
+                                .field(Gff::Field::newCExoLocString("LocalizedName", 1000 + i, ""))
+                                .field(Gff::Field::newCExoString("Tag", tag))
+                                .field(Gff::Field::newResRef("TemplateResRef", tag))
+                                .field(Gff::Field::newFloat("XOrientation", 0.0f))
+                                .field(Gff::Field::newFloat("XPosition", static_cast<float>(i)))
+                                .field(Gff::Field::newFloat("YOrientation", 1.0f))
+                                .field(Gff::Field::newFloat("YPosition", 4.0f * i))
+                                .field(Gff::Field::newFloat("ZPosition", 0.0f))
+                                .build());
+    }
+    return Gff::Builder()
+        .type(0xffffffff)
+        .field(Gff::Field::newList("Creature List", creatures))
+        .field(Gff::Field::newList("Placeable List", placeables))
+        .field(Gff::Field::newList("WaypointList", waypoints))
+        .build();
+}
+
+static std::shared_ptr<Gff> makeUTC(int index) {
+    std::vector<std::shared_ptr<Gff>> knownList;
+    for (int i = 0; i < 3; ++i) {
+        knownList.push_back(Gff::Builder()
+                                .field(Gff::Field::newWord("Spell", 10 + i))
+                                .field(Gff::Field::newByte("SpellFlags", 1))
+                                .build());
+    }
+    auto classList = std::vector<std::shared_ptr<Gff>> {
+        Gff::Builder()
+            .type(2)
+            .field(Gff::Field::newInt("Class", 4))
+            .field(Gff::Field::newShort("ClassLevel", 7))
+            .field(Gff::Field::newList("KnownList0", knownList))
+            .build()};
+    std::vector<std::shared_ptr<Gff>> itemList;
+    for (int i = 0; i < kItemsPerBlueprint; ++i) {
+        itemList.push_back(Gff::Builder()
+                               .type(i)
+                               .field(Gff::Field::newByte("Dropable", i % 2))
+                               .field(Gff::Field::newResRef("InventoryRes", str(boost::format("g_i_item%03d") % i)))
+                               .field(Gff::Field::newWord("Repos_PosX", i))
+                               .field(Gff::Field::newWord("Repos_Posy", 0))
+                               .build());
+    }
+    auto tag = str(boost::format("n_creature%04d") % index);
+    return Gff::Builder()
+        .type(0xffffffff)
+        .field(Gff::Field::newWord("Appearance_Type", 123))
+        .field(Gff::Field::newFloat("ChallengeRating", 1.5f))
+        .field(Gff::Field::newList("ClassList", classList))
+        .field(Gff::Field::newResRef("Conversation", "n_commoner"))
+        .field(Gff::Field::newCExoLocString("FirstName", 1234, ""))
+        .field(Gff::Field::newShort("HitPoints", 20))
+        .field(Gff::Field::newList("ItemList", itemList))
+        .field(Gff::Field::newWord("PortraitId", 5))
+        .field(Gff::Field::newResRef("ScriptHeartbeat", "k_def_heartbt01"))
+        .field(Gff::Field::newCExoString("Tag", tag))
+        .field(Gff::Field::newResRef("TemplateResRef", tag))
+        .build();
+}
+
+static void benchBlueprints() {
+    // Loads every blueprint from a cold cache, as an area does on load
+    auto resources = Resources();
+    auto container = std::make_unique<MemoryResourceContainer>();
+    std::vector<std::string> resRefs;
+    for (int i = 0; i < kNumBlueprints; ++i) {
+        auto bytes = ByteBuffer();
+        auto out = MemoryOutputStream(bytes);
+        GffWriter(ResType::Utc, *makeUTC(i)).save(out);
+        auto resRef = str(boost::format("n_creature%04d") % i);
+        container->add(ResourceId(resRef, ResType::Utc), std::move(bytes));
+        resRefs.push_back(std::move(resRef));
+    }
+    resources.add(std::move(container));
+    auto gffs = Gffs(resources);
+
+    auto gffMillis = measureMillis([&gffs, &resRefs]() {
+        gffs.clear();
+        uint64_t numItems = 0;
+        for (auto &resRef : resRefs) {
+            auto utc = gffs.get(resRef, ResType::Utc);
+            numItems += generated::parseUTC(*utc).ItemList.size();
+        }
+        consume(numItems);
+    });
+    reportRate("Gffs::get + parseUTC(Gff), 500 blueprints", gffMillis, kNumBlueprints, "blueprints");
+
+    auto viewMillis = measureMillis([&gffs, &resRefs]() {
+        gffs.clear();
+        uint64_t numItems = 0;
+        for (auto &resRef : resRefs) {
+            auto utc = gffs.getView(resRef, ResType::Utc);
+            numItems += generated::parseUTC(*utc).ItemList.size();
+        }
+        consume(numItems);
+    });
+    reportRate("Gffs::getView + parseUTC(GffView), 500 blueprints", viewMillis, kNumBlueprints, "blueprints");
+}
+
+void benchGff() {
+    auto bytes = std::make_shared<ByteBuffer>();
+    auto out = MemoryOutputStream(*bytes);
+    GffWriter(ResType::Git, *makeGIT()).save(out);
+    double numBytes = static_cast<double>(bytes->size());
+
+    auto readerMillis = measureMillis([&bytes]() {
+        auto stream = MemoryInputStream(*bytes);
+        auto reader = GffReader(stream);
+        reader.load();
+        auto git = generated::parseGIT(*reader.root());
+        consume(git.Creature_List.size() + git.Placeable_List.size() + git.WaypointList.size());
+    });
+    reportThroughput("GffReader + parseGIT(Gff)", readerMillis, numBytes);
+
+    auto viewMillis = measureMillis([&bytes]() {
+        auto git = generated::parseGIT(GffView::load(bytes));
+        consume(git.Creature_List.size() + git.Placeable_List.size() + git.WaypointList.size());
+    });
+    reportThroughput("GffView + parseGIT(GffView)", viewMillis, numBytes);
+
+    benchBlueprints();
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/container/memory.h"
+#include "reone/resource/resources.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::resource;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr int kNumContainers = 40;
+static constexpr int kResourcesPerContainer = 2500;
+static constexpr int kNumLookups = 1000000;
+
+void benchResources() {
+    // Mimics a KEY/BIF install with overrides: many containers, each
+    // indexing a few thousand small resources
+    auto resources = Resources();
+    std::vector<ResourceId> ids;
+    for (int i = 0; i < kNumContainers; ++i) {
+        auto container = std::make_unique<MemoryResourceContainer>();
+        for (int j = 0; j < kResourcesPerContainer; ++j) {
+            auto id = ResourceId(str(boost::format("res_%02d_%04d") % i % j), ResType::Gff);
+            container->add(id, ByteBuffer(16, '\0'));
+            ids.push_back(std::move(id));
+        }
+        resources.add(std::move(container));
+    }
+
+    // Every tenth lookup misses
+    std::vector<ResourceId> lookups;
+    lookups.reserve(kNumLookups);
+    uint32_t state = 0x12345678;
+    for (int i = 0; i < kNumLookups; ++i) {
+        state = state * 1664525 + 1013904223;
+        if (i % 10 == 9) {
+            lookups.emplace_back(str(boost::format("missing_%d") % (state % 10000)), ResType::Gff);
+        } else {
+            lookups.push_back(ids[state % ids.size()]);
+        }
+    }
+
+    double millis = measureMillis([&resources, &lookups]() {
+        uint64_t numFound = 0;
+        for (auto &id : lookups) {
+            numFound += resources.findView(id) ? 1 : 0;
+        }
+        consume(numFound);
+    });
+    reportRate("Resources::findView, 100k resources, 1M lookups", millis, kNumLookups, "lookups");
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/audio/context.h"
+#include "reone/audio/di/services.h"
+#include "reone/audio/mixer.h"
+#include "reone/audio/options.h"
+#include "reone/graphics/context.h"
+#include "reone/graphics/di/services.h"
+#include "reone/graphics/meshregistry.h"
+#include "reone/graphics/options.h"
+#include "reone/graphics/pbrtextures.h"
+#include "reone/graphics/shaderregistry.h"
+#include "reone/graphics/statistic.h"
+#include "reone/graphics/textureregistry.h"
+#include "reone/graphics/uniforms.h"
+#include "reone/graphics/walkmesh.h"
+#include "reone/resource/di/services.h"
+#include "reone/resource/director.h"
+#include "reone/resource/provider/2das.h"
+#include "reone/resource/provider/audioclips.h"
+#include "reone/resource/provider/cursors.h"
+#include "reone/resource/provider/dialogs.h"
+#include "reone/resource/provider/fonts.h"
+#include "reone/resource/provider/gffs.h"
+#include "reone/resource/provider/layouts.h"
+#include "reone/resource/provider/lips.h"
+#include "reone/resource/provider/ltrs.h"
+#include "reone/resource/provider/models.h"
+#include "reone/resource/provider/movies.h"
+#include "reone/resource/provider/paths.h"
+#include "reone/resource/provider/scripts.h"
+#include "reone/resource/provider/shaders.h"
+#include "reone/resource/provider/soundsets.h"
+#include "reone/resource/provider/textures.h"
+#include "reone/resource/provider/visibilities.h"
+#include "reone/resource/provider/walkmeshes.h"
+#include "reone/resource/resources.h"
+#include "reone/resource/strings.h"
+#include "reone/scene/collision.h"
+#include "reone/scene/graph.h"
+#include "reone/scene/node/walkmesh.h"
+#include "reone/scene/render/pipeline.h"
+#include "reone/script/di/services.h"
+#include "reone/system/threadpool.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+using namespace reone::audio;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::scene;
+
+namespace reone {
+
+namespace bench {
+
+static constexpr uint32_t kFloorMaterial = 1;
+static constexpr uint32_t kWallMaterial = 2;
+
+static constexpr int kGridSize = 24;
+static constexpr float kGridSpacing = 4.0f;
+static constexpr int kNumQueries = 10000;
+
+namespace {
+
+struct BenchUser : IUser {
+};
+
+/**
+ * Engine services, constructed but not initialized, so that neither a
+ * graphics nor an audio context is required. Collision tests do not use
+ * them, but scene graphs and scene nodes hold references to them.
+ */
+class HeadlessServices : boost::noncopyable {
+public:
+    HeadlessServices() :
+        _graphicsContext(_graphicsOpt),
+        _meshRegistry(_statistic),
+        _uniforms(_graphicsContext),
+        _pbrTextures(_graphicsContext, _meshRegistry, _shaderRegistry, _statistic, _uniforms),
+        _pipelineFactory(_graphicsOpt, _graphicsContext, _meshRegistry, _pbrTextures, _shaderRegistry, _statistic, _textureRegistry, _uniforms),
+        _graphicsSvc(_graphicsContext, _meshRegistry, _pbrTextures, _shaderRegistry, _statistic, _textureRegistry, _uniforms),
+        _audioMixer(_audioOpt),
+        _audioSvc(_audioContext, _audioMixer),
+        _twoDas(_resources),
+        _gffs(_resources),
+        _shaders(_graphicsOpt, _shaderRegistry, _resources),
+        _textures(_graphicsOpt, _resources),
+        _models(_textures, _resources, _statistic),
+        _walkmeshes(_resources),
+        _lips(_resources),
+        _fonts(_graphicsContext, _meshRegistry, _shaderRegistry, _statistic, _textures, _uniforms),
+        _cursors(_graphicsContext, _meshRegistry, _shaderRegistry, _textures, _uniforms, _statistic, _resources),
+        _audioClips(_resources),
+        _movies(std::filesystem::path(), _graphicsSvc, _audioMixer),
+        _scripts(_resources),
+        _dialogs(_gffs, _strings),
+        _layouts(_resources),
+        _paths(_gffs),
+        _soundSets(_audioClips, _resources, _strings),
+        _visibilities(_resources),
+        _ltrs(_resources),
+        _director(GameID::KotOR, std::filesystem::path(), _graphicsOpt, _graphicsSvc, _scriptSvc, _dialogs, _gffs, _lips, _paths, _resources, _scripts),
+        _resourceSvc(_gffs, _resources, _strings, _twoDas, _scripts, _movies, _audioClips, _cursors, _fonts, _lips, _models, _textures, _walkmeshes, _dialogs, _layouts, _paths, _soundSets, _visibilities, _ltrs, _shaders, _director) {
+    }
+
+    GraphicsOptions &graphicsOpt() { return _graphicsOpt; }
+    IRenderPipelineFactory &pipelineFactory() { return _pipelineFactory; }
+    GraphicsServices &graphics() { return _graphicsSvc; }
+    AudioServices &audio() { return _audioSvc; }
+    ResourceServices &resource() { return _resourceSvc; }
+
+private:
+    GraphicsOptions _graphicsOpt;
+    graphics::Context _graphicsContext;
+    Statistic _statistic;
+    MeshRegistry _meshRegistry;
+    ShaderRegistry _shaderRegistry;
+    TextureRegistry _textureRegistry;
+    Uniforms _uniforms;
+    PBRTextures _pbrTextures;
+    RenderPipelineFactory _pipelineFactory;
+    GraphicsServices _graphicsSvc;
+
+    AudioOptions _audioOpt;
+    audio::Context _audioContext;
+    AudioMixer _audioMixer;
+    AudioServices _audioSvc;
+
+    script::ScriptServices _scriptSvc;
+
+    Resources _resources;
+    Strings _strings;
+    TwoDAs _twoDas;
+    Gffs _gffs;
+    Shaders _shaders;
+    resource::Textures _textures;
+    Models _models;
+    Walkmeshes _walkmeshes;
+    Lips _lips;
+    Fonts _fonts;
+    Cursors _cursors;
+    AudioClips _audioClips;
+    Movies _movies;
+    Scripts _scripts;
+    Dialogs _dialogs;
+    Layouts _layouts;
+    Paths _paths;
+    SoundSets _soundSets;
+    Visibilities _visibilities;
+    Ltrs _ltrs;
+    ResourceDirector _director;
+    ResourceServices _resourceSvc;
+};
+
+} // namespace
+
+static std::unique_ptr<Walkmesh> makeFloorAndWall() {
+    auto walkmesh = std::make_unique<Walkmesh>();
+    walkmesh->add(Walkmesh::Face {0, kFloorMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh->add(Walkmesh::Face {1, kFloorMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh->add(Walkmesh::Face {2, kWallMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 2.0f)}, glm::vec3(0.0f, -1.0f, 0.0f)});
+    walkmesh->add(Walkmesh::Face {3, kWallMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 2.0f), glm::vec3(-1.0f, 0.0f, 2.0f)}, glm::vec3(0.0f, -1.0f, 0.0f)});
+    auto rootAabb = std::make_shared<Walkmesh::AABB>();
+    rootAabb->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 2.0f));
+    rootAabb->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
+    rootAabb->left->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->left->faceIdx = 0;
+    rootAabb->left->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->right->faceIdx = 1;
+    rootAabb->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->value = AABB(glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 2.0f));
+    rootAabb->right->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->left->faceIdx = 2;
+    rootAabb->right->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->right->faceIdx = 3;
+    walkmesh->setRootAABB(rootAabb);
+    return walkmesh;
+}
+
+static std::vector<CollisionQuery> makeQueries(const std::vector<BenchUser> &users) {
+    auto random = std::mt19937(1234);
+    auto extent = std::uniform_real_distribution<float>(-2.0f, kGridSize * kGridSpacing + 2.0f);
+    auto offset = std::uniform_real_distribution<float>(-10.0f, 10.0f);
+    auto userIdx = std::uniform_int_distribution<int>(0, static_cast<int>(users.size()) - 1);
+
+    std::vector<CollisionQuery> queries;
+    for (int i = 0; i < kNumQueries; ++i) {
+        CollisionQuery query;
+        query.type = static_cast<CollisionTestType>(i % 3);
+        query.origin = glm::vec3(extent(random), extent(random), 1.0f);
+        query.dest = query.origin + glm::vec3(offset(random), offset(random), 0.0f);
+        if (query.type == CollisionTestType::Walk && i % 2 == 0) {
+            query.excludeUser = &users[userIdx(random)];
+        }
+        queries.push_back(query);
+    }
+    return queries;
+}
+
+void benchCollisions() {
+    auto services = HeadlessServices();
+    auto scene = SceneGraph("bench", services.pipelineFactory(), services.graphicsOpt(), services.graphics(), services.audio(), services.resource());
+    scene.setWalkableSurfaces(std::set<uint32_t> {kFloorMaterial});
+    scene.setWalkcheckSurfaces(std::set<uint32_t> {kFloorMaterial, kWallMaterial});
+    scene.setLineOfSightSurfaces(std::set<uint32_t> {kWallMaterial});
+
+    auto walkmesh = makeFloorAndWall();
+    auto users = std::vector<BenchUser>(kGridSize * kGridSize);
+    for (int y = 0; y < kGridSize; ++y) {
+        for (int x = 0; x < kGridSize; ++x) {
+            int idx = y * kGridSize + x;
+            auto node = std::make_shared<WalkmeshSceneNode>(*walkmesh, scene, services.graphics(), services.audio(), services.resource());
+            auto transform = glm::translate(glm::vec3(x * kGridSpacing, y * kGridSpacing, 0.0f));
+            transform *= glm::rotate(0.1f * idx, glm::vec3(0.0f, 0.0f, 1.0f));
+            node->setLocalTransform(transform);
+            node->setUser(users[idx]);
+            scene.addRoot(node);
+        }
+    }
+    auto queries = makeQueries(users);
+
+    double oneByOneMillis = measureMillis([&scene, &queries]() {
+        uint64_t numCollided = 0;
+        for (auto &query : queries) {
+            Collision collision;
+            switch (query.type) {
+            case CollisionTestType::Elevation:
+                numCollided += scene.testElevation(glm::vec2(query.origin), collision) ? 1 : 0;
+                break;
+            case CollisionTestType::LineOfSight:
+                numCollided += scene.testLineOfSight(query.origin, query.dest, collision) ? 1 : 0;
+                break;
+            case CollisionTestType::Walk:
+                numCollided += scene.testWalk(query.origin, query.dest, query.excludeUser, collision) ? 1 : 0;
+                break;
+            }
+        }
+        consume(numCollided);
+    });
+    reportRate("Collision tests one by one, 576 walkmeshes", oneByOneMillis, kNumQueries, "queries");
+
+    auto threadPool = ThreadPool();
+    threadPool.init();
+
+    for (auto pool : {static_cast<IThreadPool *>(nullptr), static_cast<IThreadPool *>(&threadPool)}) {
+        std::string suffix(pool ? ", thread pool" : "");
+        std::vector<CollisionResult> results;
+        double batchMillis = measureMillis([&]() {
+            scene.testCollisions(queries, results, pool);
+            consume(results.size());
+        });
+        reportRate("SceneGraph::testCollisions, 576 walkmeshes" + suffix, batchMillis, kNumQueries, "queries");
+    }
+}
+
+} // namespace bench
+
+} // namespace reone
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/binaryreader.h"
+#include "reone/system/stream/memoryinput.h"
+
+#include "../benchmarks.h"
+#include "../measure.h"
+
+namespace reone {
+
+namespace bench {
+
+static constexpr int kNumValues = 4 * 1024 * 1024;
+
+/**
+ * Hides a MemoryInputStream from BinaryReader, so that it goes through
+ * virtual stream reads, like it does for file streams.
+ */
+class OpaqueInputStream : public IInputStream {
+public:
+    OpaqueInputStream(IInputStream &stream) :
+        _stream(stream) {
+    }
+
+    void seek(int64_t offset, SeekOrigin origin) override { _stream.seek(offset, origin); }
+    int readByte() override { return _stream.readByte(); }
+    int read(char *buf, int len) override { return _stream.read(buf, len); }
+    size_t position() override { return _stream.position(); }
+    size_t length() override { return _stream.length(); }
+
+private:
+    IInputStream &_stream;
+};
+
+static void benchArrays(const std::string &streamName, IInputStream &stream, double numBytes) {
+    auto littleMillis = measureMillis([&]() {
+        stream.seek(0, SeekOrigin::Begin);
+        auto reader = BinaryReader(stream);
+        auto values = reader.readFloatArray(kNumValues);
+        consume(static_cast<uint64_t>(values.back()));
+    });
+    reportThroughput("readFloatArray, little endian, " + streamName, littleMillis, numBytes);
+
+    auto bigMillis = measureMillis([&]() {
+        stream.seek(0, SeekOrigin::Begin);
+        auto reader = BinaryReader(stream, boost::endian::order::big);
+        auto values = reader.readUint32Array(kNumValues);
+        consume(values.back());
+    });
+    reportThroughput("readUint32Array, big endian, " + streamName, bigMillis, numBytes);
+
+    auto valueMillis = measureMillis([&]() {
+        stream.seek(0, SeekOrigin::Begin);
+        auto reader = BinaryReader(stream);
+        uint64_t sum = 0;
+        for (int i = 0; i < kNumValues; ++i) {
+            sum += reader.readUint32();
+        }
+        consume(sum);
+    });
+    reportThroughput("readUint32 per value, " + streamName, valueMillis, numBytes);
+}
+
+void benchBinaryReader() {
+    auto bytes = ByteBuffer(sizeof(uint32_t) * kNumValues, '\0');
+    uint32_t state = 0x12345678;
+    for (auto &byte : bytes) {
+        state = state * 1664525 + 1013904223;
+        byte = static_cast<char>(state >> 24);
+    }
+    double numBytes = static_cast<double>(bytes.size());
+
+    auto memory = MemoryInputStream(bytes);
+    benchArrays("memory stream", memory, numBytes);
+
+    auto opaqueMemory = MemoryInputStream(bytes);
+    auto opaque = OpaqueInputStream(opaqueMemory);
+    benchArrays("opaque stream", opaque, numBytes);
+}
+
+} // namespace bench
+
+} // namespace reone
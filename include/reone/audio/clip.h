@@ -25,8 +25,12 @@ namespace reone {
 
 namespace audio {
 
+class IAudioDecoder;
+
 class AudioClip : boost::noncopyable {
 public:
+    using DecoderFactory = std::function<std::unique_ptr<IAudioDecoder>()>;
+
     struct Frame {
         AudioFormat format {AudioFormat::Mono8};
         int sampleRate {0};
@@ -46,10 +50,28 @@ public:
                 throw std::logic_error("Unsupported audio format" + std::to_string(static_cast<int>(format)));
             }
         }
+
+        float duration() const {
+            return samples.size() / stride() / static_cast<float>(sampleRate);
+        }
     };
 
+    AudioClip() = default;
+
+    /**
+     * Creates a streaming clip. Samples are not held by the clip: every
+     * consumer opens its own decoder and pulls PCM from it incrementally.
+     */
+    AudioClip(DecoderFactory decoderFactory, float duration) :
+        _duration(duration),
+        _decoderFactory(std::move(decoderFactory)) {
+    }
+
     void add(Frame &&frame);
 
+    bool isStreaming() const { return static_cast<bool>(_decoderFactory); }
+    std::unique_ptr<IAudioDecoder> openDecoder() const;
+
     int getFrameCount() const;
     const Frame &getFrame(int index) const;
     float duration() const { return _duration; }
@@ -57,10 +79,31 @@ public:
 private:
     float _duration {0};
     std::vector<Frame> _frames;
+    DecoderFactory _decoderFactory;
 
     int getALAudioFormat(AudioFormat format) const;
 };
 
+class IAudioDecoder {
+public:
+    virtual ~IAudioDecoder() = default;
+
+    /**
+     * Replaces contents of frame with the next chunk of approximately
+     * sampleCount samples per channel.
+     *
+     * @return false when the end of the stream has been reached
+     */
+    virtual bool decode(AudioClip::Frame &frame, int sampleCount) = 0;
+
+    /**
+     * Positions decoder so that the next decoded sample is the one at time
+     * (in seconds). Seeking past the end of the stream leaves decoder
+     * exhausted.
+     */
+    virtual void seek(float time) = 0;
+};
+
 } // namespace audio
 
 } // namespace reone
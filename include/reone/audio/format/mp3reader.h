@@ -31,15 +31,27 @@ class AudioClip;
 
 class Mp3Reader : boost::noncopyable {
 public:
+    /**
+     * @param streaming whether to produce a streaming clip, decoded as it is
+     *                  played, instead of decoding the whole input upfront
+     */
+    Mp3Reader(bool streaming = false) :
+        _streaming(streaming) {
+    }
+
     virtual void load(IInputStream &stream);
 
     std::shared_ptr<AudioClip> stream() const { return _stream; }
 
 private:
+    bool _streaming;
+
     ByteBuffer _input;
     std::shared_ptr<AudioClip> _stream;
     bool _done {false};
 
+    void loadStreaming(ByteBuffer data);
+
     static mad_flow inputFunc(void *playbuf, mad_stream *stream);
     static mad_flow headerFunc(void *playbuf, mad_header const *header);
     static mad_flow outputFunc(void *playbuf, mad_header const *header, mad_pcm *pcm);
@@ -52,9 +64,16 @@ public:
 
 class Mp3ReaderFactory : public IMp3ReaderFactory {
 public:
+    Mp3ReaderFactory(bool streaming = false) :
+        _streaming(streaming) {
+    }
+
     std::shared_ptr<Mp3Reader> create() override {
-        return std::make_shared<Mp3Reader>();
+        return std::make_shared<Mp3Reader>(_streaming);
     }
+
+private:
+    bool _streaming;
 };
 
 } // namespace audio
@@ -37,9 +37,16 @@ class IMp3ReaderFactory;
 
 class WavReader : public boost::noncopyable {
 public:
-    WavReader(IInputStream &wav, IMp3ReaderFactory &mp3ReaderFactory) :
+    /**
+     * @param streaming whether to produce a streaming clip from compressed
+     *                  audio, decoded as it is played. Embedded MP3 streams
+     *                  according to mp3ReaderFactory, uncompressed PCM is
+     *                  always loaded upfront.
+     */
+    WavReader(IInputStream &wav, IMp3ReaderFactory &mp3ReaderFactory, bool streaming = false) :
         _wav(BinaryReader(wav)),
-        _mp3ReaderFactory(mp3ReaderFactory) {
+        _mp3ReaderFactory(mp3ReaderFactory),
+        _streaming(streaming) {
     }
 
     void load();
@@ -52,13 +59,9 @@ private:
         uint32_t size {0};
     };
 
-    struct IMA {
-        int16_t lastSample {0};
-        int16_t stepIndex {0};
-    };
-
     BinaryReader _wav;
     IMp3ReaderFactory &_mp3ReaderFactory;
+    bool _streaming;
 
     size_t _wavLength {0};
 
@@ -67,12 +70,9 @@ private:
     uint32_t _sampleRate {0};
     uint16_t _blockAlign {0};
     uint16_t _bitsPerSample {0};
-    IMA _ima[2];
 
     std::shared_ptr<AudioClip> _stream;
 
-    int16_t getIMASample(int channel, uint8_t nibble);
-    void getIMASamples(int channel, uint8_t nibbles, int16_t &sample1, int16_t &sample2);
     void loadData(ChunkHeader chunk);
     void loadFormat(ChunkHeader chunk);
     void loadIMAADPCM(uint32_t chunkSize);
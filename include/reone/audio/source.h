@@ -17,12 +17,12 @@
 
 #pragma once
 
+#include "clip.h"
+
 namespace reone {
 
 namespace audio {
 
-class AudioClip;
-
 class AudioSource : boost::noncopyable {
 public:
     AudioSource(std::shared_ptr<AudioClip> clip,
@@ -43,6 +43,11 @@ public:
     void play();
     void stop();
 
+    /**
+     * Moves playback position to time (in seconds) from the start of the clip.
+     */
+    void seek(float time);
+
     void setPosition(glm::vec3 position);
 
     bool isPlaying() const { return _playing; }
@@ -64,10 +69,16 @@ private:
     int _nextFrame {0};
     int _nextBuffer {0};
 
+    std::unique_ptr<IAudioDecoder> _decoder;
+    AudioClip::Frame _decoded;
+
     bool _playingDirty {false};
     bool _positionDirty {false};
 
     void deinit();
+
+    void queueBuffers();
+    bool fillNextBuffer(uint32_t buffer);
 };
 
 } // namespace audio
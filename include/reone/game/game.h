@@ -58,10 +58,12 @@
 #include "object/store.h"
 #include "object/trigger.h"
 #include "object/waypoint.h"
+#include "objectregistry.h"
 #include "options.h"
 #include "party.h"
 #include "script/runner.h"
 #include "talent.h"
+#include "timerwheel.h"
 
 namespace reone {
 
@@ -73,6 +75,70 @@ class GUI;
 
 namespace game {
 
+/**
+ * Maps classes of game objects to their object type. Objects of classes
+ * without a unique object type, e.g. cameras, are looked up using RTTI.
+ */
+template <class T>
+struct ObjectTypeOf {
+    static constexpr ObjectType value = ObjectType::Invalid;
+};
+
+template <>
+struct ObjectTypeOf<Area> {
+    static constexpr ObjectType value = ObjectType::Area;
+};
+
+template <>
+struct ObjectTypeOf<Creature> {
+    static constexpr ObjectType value = ObjectType::Creature;
+};
+
+template <>
+struct ObjectTypeOf<Door> {
+    static constexpr ObjectType value = ObjectType::Door;
+};
+
+template <>
+struct ObjectTypeOf<Encounter> {
+    static constexpr ObjectType value = ObjectType::Encounter;
+};
+
+template <>
+struct ObjectTypeOf<Item> {
+    static constexpr ObjectType value = ObjectType::Item;
+};
+
+template <>
+struct ObjectTypeOf<Module> {
+    static constexpr ObjectType value = ObjectType::Module;
+};
+
+template <>
+struct ObjectTypeOf<Placeable> {
+    static constexpr ObjectType value = ObjectType::Placeable;
+};
+
+template <>
+struct ObjectTypeOf<Sound> {
+    static constexpr ObjectType value = ObjectType::Sound;
+};
+
+template <>
+struct ObjectTypeOf<Store> {
+    static constexpr ObjectType value = ObjectType::Store;
+};
+
+template <>
+struct ObjectTypeOf<Trigger> {
+    static constexpr ObjectType value = ObjectType::Trigger;
+};
+
+template <>
+struct ObjectTypeOf<Waypoint> {
+    static constexpr ObjectType value = ObjectType::Waypoint;
+};
+
 class Game : boost::noncopyable {
 public:
     enum class Screen {
@@ -120,6 +186,7 @@ public:
     const OptionsView &options() const { return _options; }
     Party &party() { return _party; }
     Combat &combat() { return _combat; }
+    TimerWheel &timers() { return _timers; }
     ScriptRunner &scriptRunner() { return *_scriptRunner; }
     Map &map() { return *_map; }
     script::IRoutines &routines() { return *_routines; }
@@ -190,6 +257,16 @@ public:
 
     std::shared_ptr<Object> getObjectById(uint32_t id) const;
 
+    /**
+     * @return non-owning pointer to object, or nullptr when object does not exist
+     */
+    Object *getObjectPtr(uint32_t id) const;
+
+    /**
+     * Removes object from the registry, so that its ID becomes stale.
+     */
+    void destroyObject(uint32_t id);
+
     inline std::shared_ptr<Module> newModule() {
         return newObject<Module>(*this, _services);
     }
@@ -255,14 +332,36 @@ public:
 
     template <class T>
     inline std::shared_ptr<T> getObjectById(uint32_t id) const {
-        return std::dynamic_pointer_cast<T>(getObjectById(id));
+        if constexpr (ObjectTypeOf<T>::value != ObjectType::Invalid) {
+            throwIfObjectSelf(id);
+            return std::static_pointer_cast<T>(_objects.getShared(id, ObjectTypeOf<T>::value));
+        } else {
+            return std::dynamic_pointer_cast<T>(getObjectById(id));
+        }
+    }
+
+    template <class T>
+    inline T *getObjectPtr(uint32_t id) const {
+        if constexpr (ObjectTypeOf<T>::value != ObjectType::Invalid) {
+            throwIfObjectSelf(id);
+            return static_cast<T *>(_objects.get(id, ObjectTypeOf<T>::value));
+        } else {
+            return dynamic_cast<T *>(getObjectPtr(id));
+        }
     }
 
     template <class T, class... Args>
     inline std::shared_ptr<T> newObject(Args &&...args) {
-        auto object = std::make_shared<T>(_nextObjectId++, std::forward<Args>(args)...);
-        auto [inserted, _] = _objectById.insert(std::make_pair(object->id(), std::move(object)));
-        return std::static_pointer_cast<T>(inserted->second);
+        uint32_t id = _objects.reserve();
+        std::shared_ptr<T> object;
+        try {
+            object = std::make_shared<T>(id, std::forward<Args>(args)...);
+        } catch (...) {
+            _objects.remove(id);
+            throw;
+        }
+        _objects.insert(id, object, object->type());
+        return object;
     }
 
     template <class T, class... Args>
@@ -330,13 +429,13 @@ private:
     bool _quitRequested {false};
     bool _relativeMouseMode {false};
 
-    uint32_t _nextObjectId {2}; // ids 0 and 1 are reserved
-    std::map<uint32_t, std::shared_ptr<Object>> _objectById;
+    ObjectRegistry<Object> _objects;
 
     // Services
 
     Party _party;
     Combat _combat;
+    TimerWheel _timers;
 
     std::unique_ptr<script::IRoutines> _routines;
     std::unique_ptr<ScriptRunner> _scriptRunner;
@@ -421,6 +520,16 @@ private:
 
     // END Rendering
 
+    // Objects
+
+    void throwIfObjectSelf(uint32_t id) const {
+        if (id == script::kObjectSelf) {
+            throw std::invalid_argument("Invalid id: " + std::to_string(id));
+        }
+    }
+
+    // END Objects
+
     // GUI
 
     void loadInGameMenus();
@@ -26,6 +26,7 @@
 #include "action.h"
 #include "action/playanimation.h"
 #include "effect.h"
+#include "spatialgrid.h"
 #include "types.h"
 
 namespace reone {
@@ -89,6 +90,7 @@ public:
     void setCommandable(bool commandable) { _commandable = commandable; }
 
     void setRoom(Room *room);
+    void setSpatialGrid(SpatialGrid<std::shared_ptr<Object>> *grid) { _spatialGrid = grid; }
     void setPosition(const glm::vec3 &position);
     void setFacing(float facing);
     void setVisible(bool visible);
@@ -197,15 +199,9 @@ public:
     // END Scripts
 
 protected:
-    struct DelayedAction {
-        std::shared_ptr<Action> action;
-        std::unique_ptr<Timer> timer;
-    };
-
     struct AppliedEffect {
         std::shared_ptr<Effect> effect;
         DurationType durationType {DurationType::Instant};
-        float duration {0.0f};
     };
 
     uint32_t _id;
@@ -233,6 +229,7 @@ protected:
     glm::mat4 _transform {1.0f};
     bool _visible {true};
     Room *_room {nullptr};
+    SpatialGrid<std::shared_ptr<Object>> *_spatialGrid {nullptr};
     std::vector<std::shared_ptr<Item>> _items;
     std::deque<AppliedEffect> _effects;
     bool _open {false};
@@ -247,7 +244,6 @@ protected:
     // Actions
 
     std::deque<std::shared_ptr<Action>> _actions;
-    std::vector<DelayedAction> _delayed;
 
     // END Actions
 
@@ -285,7 +281,6 @@ protected:
 
     void updateActions(float dt);
     void removeCompletedActions();
-    void updateDelayedActions(float dt);
 
     void executeActions(float dt);
 
@@ -293,8 +288,8 @@ protected:
 
     // Effects
 
-    void updateEffects(float dt);
     void applyInstantEffect(Effect &effect);
+    void expireEffect(Effect &effect);
 
     // END Effects
 };
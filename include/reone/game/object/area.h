@@ -33,6 +33,7 @@
 #include "../object/camera/static.h"
 #include "../object/camera/thirdperson.h"
 #include "../pathfinder.h"
+#include "../scheduler.h"
 #include "../types.h"
 
 namespace reone {
@@ -68,6 +69,8 @@ public:
         Game &game,
         ServicesView &services);
 
+    ~Area();
+
     void load(std::string name, const resource::Gff &are, const resource::Gff &git, bool fromSave = false);
 
     bool handle(const input::Event &event);
@@ -165,6 +168,13 @@ public:
 
     // END Perception
 
+    // Scheduling
+
+    const SlicedScheduler::Stats &heartbeatStats() const { return _heartbeatScheduler.stats(); }
+    const SlicedScheduler::Stats &perceptionStats() const { return _perceptionScheduler.stats(); }
+
+    // END Scheduling
+
     // Object Selection
 
     void hilightObject(std::shared_ptr<Object> object);
@@ -217,11 +227,11 @@ private:
     CameraStyle _camStyleDefault;
     CameraStyle _camStyleCombat;
     std::string _music;
-    Timer _heartbeatTimer;
+    SlicedScheduler _heartbeatScheduler;
     bool _unescapable {false};
     Grass _grass;
     glm::vec3 _ambientColor {0.0f};
-    Timer _perceptionTimer;
+    SlicedScheduler _perceptionScheduler;
     std::shared_ptr<Object> _hilightedObject;
     std::shared_ptr<Object> _selectedObject;
 
@@ -250,6 +260,7 @@ private:
     std::unordered_map<ObjectType, ObjectList> _objectsByType;
     std::unordered_map<std::string, ObjectList> _objectsByTag;
     std::set<uint32_t> _objectsToDestroy;
+    SpatialGrid<std::shared_ptr<Object>> _spatialGrid;
 
     // END Objects
 
@@ -279,11 +290,15 @@ private:
 
     void add(const std::shared_ptr<Object> &object);
     void doDestroyObject(uint32_t objectId);
+    void removeObject(uint32_t objectId);
     void doDestroyObjects();
     void updateVisibility();
     void updateHeartbeat(float dt);
 
-    void doUpdatePerception();
+    void doUpdatePerception(Creature &creature);
+
+    scene::CollisionQuery getLineOfSightQuery(const Creature &subject, const Object &object) const;
+    bool isObjectSeen(const Creature &subject, const Object &object, const scene::CollisionQuery &query, const scene::CollisionResult &result) const;
     void updateObjectSelection();
 
     bool matchesCriterias(const Creature &creature, const SearchCriteriaList &criterias, std::shared_ptr<Object> target = nullptr) const;
@@ -315,6 +330,7 @@ private:
     // Loading GIT
 
     void loadGIT(const resource::generated::GIT &git);
+    void prefetchBlueprints(const resource::generated::GIT &git);
 
     void loadProperties(const resource::generated::GIT &git);
     void loadCreatures(const resource::generated::GIT &git);
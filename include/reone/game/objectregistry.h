@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Generational slot map of game objects, indexed by object ID.
+ *
+ * Object IDs are handles, that combine a slot index with the generation of
+ * that slot. Removing an object frees its slot for reuse and advances its
+ * generation, so that IDs of removed objects are detected as stale, rather
+ * than resolving to whichever object occupies the slot next. Handles never
+ * collide with reserved IDs kObjectSelf and kObjectInvalid.
+ */
+template <class T>
+class ObjectRegistry : boost::noncopyable {
+public:
+    static constexpr int kIndexBits = 20;
+    static constexpr uint32_t kIndexMask = (1 << kIndexBits) - 1;
+    static constexpr uint32_t kMaxGeneration = (1 << (32 - kIndexBits)) - 1;
+
+    /**
+     * Reserves a slot for a new object.
+     *
+     * @return ID of the new object, to be passed to insert
+     */
+    uint32_t reserve() {
+        uint32_t index;
+        if (!_freeIndices.empty()) {
+            index = _freeIndices.back();
+            _freeIndices.pop_back();
+        } else {
+            if (_slots.size() > kIndexMask) {
+                throw std::overflow_error("Object registry is full");
+            }
+            index = static_cast<uint32_t>(_slots.size());
+            _slots.push_back(Slot());
+        }
+        auto &slot = _slots[index];
+        slot.reserved = true;
+        return makeId(index, slot.generation);
+    }
+
+    /**
+     * Inserts an object into a slot, previously reserved for its ID.
+     */
+    void insert(uint32_t id, std::shared_ptr<T> object, ObjectType type) {
+        auto slot = getSlot(id);
+        if (!slot || !slot->reserved || slot->object) {
+            throw std::invalid_argument("Object slot not reserved: " + std::to_string(id));
+        }
+        slot->ptr = object.get();
+        slot->object = std::move(object);
+        slot->type = type;
+        ++_size;
+    }
+
+    /**
+     * Removes an object, or releases a reserved slot. IDs of removed objects
+     * become stale.
+     *
+     * @return true if ID was not stale, false otherwise
+     */
+    bool remove(uint32_t id) {
+        auto slot = getSlot(id);
+        if (!slot || !slot->reserved) {
+            return false;
+        }
+        if (slot->object) {
+            --_size;
+        }
+        slot->object.reset();
+        slot->ptr = nullptr;
+        slot->type = ObjectType::Invalid;
+        slot->reserved = false;
+        slot->generation = slot->generation == kMaxGeneration ? 1 : slot->generation + 1;
+        _freeIndices.push_back(id & kIndexMask);
+        return true;
+    }
+
+    void clear() {
+        for (uint32_t i = 0; i < _slots.size(); ++i) {
+            if (_slots[i].reserved) {
+                remove(makeId(i, _slots[i].generation));
+            }
+        }
+    }
+
+    /**
+     * @return non-owning pointer to object, or nullptr when ID is stale
+     */
+    T *get(uint32_t id) const {
+        auto slot = getSlot(id);
+        return slot ? slot->ptr : nullptr;
+    }
+
+    /**
+     * @return non-owning pointer to object, or nullptr when ID is stale or object type does not match
+     */
+    T *get(uint32_t id, ObjectType type) const {
+        auto slot = getSlot(id);
+        return slot && slot->type == type ? slot->ptr : nullptr;
+    }
+
+    std::shared_ptr<T> getShared(uint32_t id) const {
+        auto slot = getSlot(id);
+        return slot ? slot->object : nullptr;
+    }
+
+    std::shared_ptr<T> getShared(uint32_t id, ObjectType type) const {
+        auto slot = getSlot(id);
+        return slot && slot->type == type ? slot->object : nullptr;
+    }
+
+    int size() const { return _size; }
+
+private:
+    struct Slot {
+        T *ptr {nullptr};
+        ObjectType type {ObjectType::Invalid};
+        uint32_t generation {1};
+        bool reserved {false};
+        std::shared_ptr<T> object;
+    };
+
+    std::vector<Slot> _slots;
+    std::vector<uint32_t> _freeIndices;
+    int _size {0};
+
+    uint32_t makeId(uint32_t index, uint32_t generation) const {
+        return (generation << kIndexBits) | index;
+    }
+
+    const Slot *getSlot(uint32_t id) const {
+        uint32_t index = id & kIndexMask;
+        if (index >= _slots.size()) {
+            return nullptr;
+        }
+        auto &slot = _slots[index];
+        return slot.generation == (id >> kIndexBits) ? &slot : nullptr;
+    }
+
+    Slot *getSlot(uint32_t id) {
+        return const_cast<Slot *>(static_cast<const ObjectRegistry &>(*this).getSlot(id));
+    }
+};
+
+} // namespace game
+
+} // namespace reone
@@ -19,12 +19,18 @@
 
 #include "reone/resource/path.h"
 
+#include "spatialgrid.h"
+
 namespace reone {
 
 namespace game {
 
 /**
- * A* pathfinding.
+ * A* pathfinding over points of an area path.
+ *
+ * Adjacency lists are stored contiguously, vertices nearest to start and end
+ * points are looked up in a spatial grid, and found paths are cached by their
+ * start and end vertices. Unreachable pairs are cached too.
  */
 class Pathfinder : boost::noncopyable {
 public:
@@ -32,27 +38,58 @@ public:
 
     const std::vector<glm::vec3> findPath(const glm::vec3 &from, const glm::vec3 &to) const;
 
+    /**
+     * @return number of A* searches run, i.e. path cache misses
+     */
+    int numSearches() const { return _numSearches; }
+
 private:
-    struct ContextVertex {
-        uint16_t index {0};
-        uint16_t parentIndex {0xffff};
-        float distance {0.0f};
-        float heuristic {0.0f};
-        float totalCost {0.0f};
-    };
+    /**
+     * Binary min-heap of open vertices, ordered by total cost, then by index.
+     * Keeps positions of vertices in the heap, so that their costs can be
+     * decreased in place.
+     */
+    class OpenHeap {
+    public:
+        OpenHeap(const std::vector<float> &totalCosts, size_t numVertices) :
+            _totalCosts(totalCosts),
+            _positions(numVertices, kNotInHeap) {
+        }
+
+        bool empty() const { return _heap.empty(); }
+        bool contains(uint16_t index) const { return _positions[index] != kNotInHeap; }
+
+        void push(uint16_t index);
+        void decreaseKey(uint16_t index);
+        uint16_t pop();
 
-    struct Context {
-        std::unordered_map<uint16_t, ContextVertex> vertices;
-        std::set<uint16_t> open;
-        std::set<uint16_t> closed;
+    private:
+        static constexpr uint32_t kNotInHeap = 0xffffffff;
 
-        const ContextVertex &getVertexWithLeastTotalCostFromOpen() const;
+        const std::vector<float> &_totalCosts;
+        std::vector<uint16_t> _heap;
+        std::vector<uint32_t> _positions;
+
+        bool isLess(uint16_t left, uint16_t right) const;
+
+        void siftUp(uint32_t pos);
+        void siftDown(uint32_t pos);
+        void place(uint16_t index, uint32_t pos);
     };
 
     std::vector<glm::vec3> _vertices;
-    std::unordered_map<uint16_t, std::vector<uint16_t>> _adjacentVertices;
+    std::vector<uint32_t> _adjacencyOffsets; // adjacent vertices of vertex i are in [offsets[i], offsets[i + 1])
+    std::vector<uint16_t> _adjacentVertices;
+
+    std::unique_ptr<SpatialGrid<uint16_t>> _vertexGrid;
+
+    mutable std::unordered_map<uint32_t, std::vector<uint16_t>> _pathCache;
+    mutable std::mutex _pathCacheMutex;
+    mutable std::atomic_int _numSearches {0};
 
     uint16_t getNearestVertex(const glm::vec3 &point) const;
+
+    std::vector<uint16_t> findVertexPath(uint16_t fromIdx, uint16_t toIdx) const;
 };
 
 } // namespace game
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/timer.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Spreads periodic per-object work, e.g. heartbeats, across frames.
+ *
+ * When the interval elapses, object IDs are collected into a queue, which is
+ * then serviced in round-robin slices over the following interval. Each slice
+ * runs until the per-frame budget is exhausted, but never services fewer
+ * objects than required to drain the queue before the interval ends, so that
+ * every object is serviced once per interval.
+ */
+class SlicedScheduler : boost::noncopyable {
+public:
+    struct Stats {
+        int queueDepth {0};
+        int lastSliceCount {0};
+        std::chrono::microseconds lastSlice {0};
+        std::chrono::microseconds worstSlice {0}; /**< since start of the current interval */
+    };
+
+    using CollectFunc = std::function<void(std::vector<uint32_t> &)>;
+    using ServiceFunc = std::function<void(uint32_t)>;
+
+    SlicedScheduler(float interval, std::chrono::microseconds budget) :
+        _interval(interval),
+        _budget(budget) {
+    }
+
+    void update(float dt, const CollectFunc &collect, const ServiceFunc &service);
+
+    /**
+     * Drops queued objects and postpones the next collection by delay seconds.
+     */
+    void reset(float delay);
+
+    const Stats &stats() const { return _stats; }
+
+private:
+    float _interval;
+    std::chrono::microseconds _budget;
+
+    Timer _timer;
+    float _timeLeft {0.0f};
+    std::deque<uint32_t> _queue;
+    Stats _stats;
+};
+
+} // namespace game
+
+} // namespace reone
@@ -19,6 +19,7 @@
 
 #include "reone/script/types.h"
 #include "reone/script/variable.h"
+#include "reone/system/span.h"
 
 namespace reone {
 
@@ -47,23 +48,23 @@ class Talent;
 std::shared_ptr<Object> getCaller(const RoutineContext &ctx);
 std::shared_ptr<Object> getTriggerrer(const RoutineContext &ctx);
 
-int getInt(const std::vector<script::Variable> &args, int index);
-float getFloat(const std::vector<script::Variable> &args, int index);
-std::string getString(const std::vector<script::Variable> &args, int index);
-glm::vec3 getVector(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Object> getObject(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-std::shared_ptr<Effect> getEffect(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Event> getEvent(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Location> getLocationArgument(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<Talent> getTalent(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<script::ExecutionContext> getAction(const std::vector<script::Variable> &args, int index);
+int getInt(Span<const script::Variable> args, int index);
+float getFloat(Span<const script::Variable> args, int index);
+std::string getString(Span<const script::Variable> args, int index);
+glm::vec3 getVector(Span<const script::Variable> args, int index);
+std::shared_ptr<Object> getObject(Span<const script::Variable> args, int index, const RoutineContext &ctx);
+std::shared_ptr<Effect> getEffect(Span<const script::Variable> args, int index);
+std::shared_ptr<Event> getEvent(Span<const script::Variable> args, int index);
+std::shared_ptr<Location> getLocationArgument(Span<const script::Variable> args, int index);
+std::shared_ptr<Talent> getTalent(Span<const script::Variable> args, int index);
+std::shared_ptr<script::ExecutionContext> getAction(Span<const script::Variable> args, int index);
 
-int getIntOrElse(const std::vector<script::Variable> &args, int index, int defValue);
-float getFloatOrElse(const std::vector<script::Variable> &args, int index, float defValue);
-std::string getStringOrElse(const std::vector<script::Variable> &args, int index, std::string defValue);
-glm::vec3 getVectorOrElse(const std::vector<script::Variable> &args, int index, glm::vec3 defValue);
-std::shared_ptr<Object> getObjectOrNull(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-std::shared_ptr<Object> getObjectOrCaller(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+int getIntOrElse(Span<const script::Variable> args, int index, int defValue);
+float getFloatOrElse(Span<const script::Variable> args, int index, float defValue);
+std::string getStringOrElse(Span<const script::Variable> args, int index, std::string defValue);
+glm::vec3 getVectorOrElse(Span<const script::Variable> args, int index, glm::vec3 defValue);
+std::shared_ptr<Object> getObjectOrNull(Span<const script::Variable> args, int index, const RoutineContext &ctx);
+std::shared_ptr<Object> getObjectOrCaller(Span<const script::Variable> args, int index, const RoutineContext &ctx);
 
 std::shared_ptr<Creature> checkCreature(const std::shared_ptr<Object> &object);
 std::shared_ptr<Door> checkDoor(const std::shared_ptr<Object> &object);
@@ -47,7 +47,7 @@ public:
         std::string name,
         script::VariableType retType,
         std::vector<script::VariableType> argTypes,
-        script::Variable (*fn)(const std::vector<script::Variable> &args, const RoutineContext &ctx));
+        script::Variable (*fn)(Span<const script::Variable> args, const RoutineContext &ctx));
 
     script::Routine &get(int index) override;
 
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Uniform grid over XY positions of area objects, supporting k-nearest and
+ * radius queries.
+ *
+ * Values are indexed by an ID, so that their positions can be updated without
+ * the values themselves, e.g. from Object::setPosition.
+ */
+template <class T>
+class SpatialGrid : boost::noncopyable {
+public:
+    using Predicate = std::function<bool(const T &)>;
+
+    SpatialGrid(float cellSize = 8.0f) :
+        _cellSize(cellSize) {
+    }
+
+    void clear() {
+        _cells.clear();
+        _entries.clear();
+    }
+
+    void add(uint32_t id, T value, const glm::vec3 &position) {
+        remove(id);
+        auto cell = getCell(position);
+        _cells[getCellKey(cell)].push_back(Entry {id, std::move(value), position});
+        _entries[id] = cell;
+        if (_entries.size() == 1) {
+            _minCell = cell;
+            _maxCell = cell;
+        } else {
+            _minCell = glm::min(_minCell, cell);
+            _maxCell = glm::max(_maxCell, cell);
+        }
+    }
+
+    void update(uint32_t id, const glm::vec3 &position) {
+        auto maybeEntry = _entries.find(id);
+        if (maybeEntry == _entries.end()) {
+            return;
+        }
+        auto cell = getCell(position);
+        if (cell == maybeEntry->second) {
+            for (auto &entry : _cells[getCellKey(cell)]) {
+                if (entry.id == id) {
+                    entry.position = position;
+                    break;
+                }
+            }
+            return;
+        }
+        auto value = removeFromCell(id, maybeEntry->second);
+        _entries.erase(maybeEntry);
+        add(id, std::move(value), position);
+    }
+
+    void remove(uint32_t id) {
+        auto maybeEntry = _entries.find(id);
+        if (maybeEntry == _entries.end()) {
+            return;
+        }
+        removeFromCell(id, maybeEntry->second);
+        _entries.erase(maybeEntry);
+    }
+
+    /**
+     * Finds up to count values nearest to origin, that match the predicate.
+     *
+     * @param values output vector of values and square distances to origin, sorted by distance
+     */
+    void findNearest(const glm::vec3 &origin, int count, const Predicate &predicate, std::vector<std::pair<T, float>> &values) const {
+        values.clear();
+        if (_entries.empty() || count <= 0) {
+            return;
+        }
+        auto originCell = getCell(origin);
+        int minRing = getRingDistance(originCell, glm::clamp(originCell, _minCell, _maxCell));
+        int maxRing = std::max(getRingDistance(originCell, _minCell), getRingDistance(originCell, _maxCell));
+
+        for (int ring = minRing; ring <= maxRing; ++ring) {
+            forEachCellInRing(originCell, ring, [&](const std::vector<Entry> &entries) {
+                for (auto &entry : entries) {
+                    if (predicate(entry.value)) {
+                        values.push_back(std::make_pair(entry.value, glm::distance2(entry.position, origin)));
+                    }
+                }
+            });
+            // Values outside of visited cells are at least ring * cellSize away from origin
+            float covered = ring * _cellSize;
+            float covered2 = covered * covered;
+            int numCovered = static_cast<int>(std::count_if(values.begin(), values.end(), [&covered2](auto &value) {
+                return value.second <= covered2;
+            }));
+            if (numCovered >= count) {
+                break;
+            }
+        }
+
+        auto numValues = std::min(count, static_cast<int>(values.size()));
+        std::partial_sort(values.begin(), values.begin() + numValues, values.end(), [](auto &left, auto &right) {
+            return left.second < right.second;
+        });
+        values.resize(numValues);
+    }
+
+    /**
+     * Finds values within radius of origin, that match the predicate.
+     */
+    void findInRadius(const glm::vec3 &origin, float radius, const Predicate &predicate, std::vector<T> &values) const {
+        values.clear();
+        if (_entries.empty()) {
+            return;
+        }
+        float radius2 = radius * radius;
+        auto minCell = glm::max(getCell(origin - glm::vec3(radius)), _minCell);
+        auto maxCell = glm::min(getCell(origin + glm::vec3(radius)), _maxCell);
+        for (int y = minCell.y; y <= maxCell.y; ++y) {
+            for (int x = minCell.x; x <= maxCell.x; ++x) {
+                auto maybeCell = _cells.find(getCellKey(glm::ivec2(x, y)));
+                if (maybeCell == _cells.end()) {
+                    continue;
+                }
+                for (auto &entry : maybeCell->second) {
+                    if (glm::distance2(entry.position, origin) <= radius2 && predicate(entry.value)) {
+                        values.push_back(entry.value);
+                    }
+                }
+            }
+        }
+    }
+
+    int size() const { return static_cast<int>(_entries.size()); }
+
+private:
+    struct Entry {
+        uint32_t id {0};
+        T value;
+        glm::vec3 position {0.0f};
+    };
+
+    float _cellSize;
+
+    std::unordered_map<uint64_t, std::vector<Entry>> _cells;
+    std::unordered_map<uint32_t, glm::ivec2> _entries;
+    glm::ivec2 _minCell {0};
+    glm::ivec2 _maxCell {0};
+
+    glm::ivec2 getCell(const glm::vec3 &position) const {
+        return glm::ivec2(
+            static_cast<int>(std::floor(position.x / _cellSize)),
+            static_cast<int>(std::floor(position.y / _cellSize)));
+    }
+
+    uint64_t getCellKey(const glm::ivec2 &cell) const {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32) | static_cast<uint32_t>(cell.y);
+    }
+
+    int getRingDistance(const glm::ivec2 &left, const glm::ivec2 &right) const {
+        return std::max(std::abs(left.x - right.x), std::abs(left.y - right.y));
+    }
+
+    T removeFromCell(uint32_t id, const glm::ivec2 &cell) {
+        auto maybeCell = _cells.find(getCellKey(cell));
+        auto &entries = maybeCell->second;
+        auto maybeEntry = std::find_if(entries.begin(), entries.end(), [&id](auto &entry) { return entry.id == id; });
+        T value(std::move(maybeEntry->value));
+        *maybeEntry = std::move(entries.back());
+        entries.pop_back();
+        if (entries.empty()) {
+            _cells.erase(maybeCell);
+        }
+        return value;
+    }
+
+    template <class F>
+    void forEachCellInRing(const glm::ivec2 &center, int ring, F &&block) const {
+        auto visit = [this, &block](int x, int y) {
+            if (x < _minCell.x || x > _maxCell.x || y < _minCell.y || y > _maxCell.y) {
+                return;
+            }
+            auto maybeCell = _cells.find(getCellKey(glm::ivec2(x, y)));
+            if (maybeCell != _cells.end()) {
+                block(maybeCell->second);
+            }
+        };
+        if (ring == 0) {
+            visit(center.x, center.y);
+            return;
+        }
+        int minX = std::max(center.x - ring, _minCell.x);
+        int maxX = std::min(center.x + ring, _maxCell.x);
+        for (int x = minX; x <= maxX; ++x) {
+            visit(x, center.y - ring);
+            visit(x, center.y + ring);
+        }
+        int minY = std::max(center.y - ring + 1, _minCell.y);
+        int maxY = std::min(center.y + ring - 1, _maxCell.y);
+        for (int y = minY; y <= maxY; ++y) {
+            visit(center.x - ring, y);
+            visit(center.x + ring, y);
+        }
+    }
+};
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Hierarchical timer wheel for game deadlines, e.g. delayed actions and
+ * temporary effects.
+ *
+ * Time is divided into ticks of kTickLength seconds. Timers are placed into
+ * slots of one of several wheels, by how far in the future they are due, and
+ * cascade into finer wheels as their deadline approaches. Updating the wheel
+ * only touches timers that are due or about to cascade.
+ *
+ * Timers fire in order of deadlines. Timers with equal deadlines fire in
+ * order of scheduling.
+ */
+class TimerWheel : boost::noncopyable {
+public:
+    using Callback = std::function<void()>;
+
+    static constexpr float kTickLength = 0.001f;
+
+    /**
+     * Schedules a callback to be invoked after delay seconds. A timer
+     * scheduled from a callback never fires within the same update.
+     *
+     * @param owner opaque tag of the timer, e.g. an object id, for cancelIf
+     */
+    void schedule(float delay, Callback callback, uint32_t owner = 0);
+
+    void update(float dt);
+
+    /**
+     * Cancels timers whose owners satisfy the predicate.
+     */
+    void cancelIf(const std::function<bool(uint32_t)> &predicate);
+
+    void clear();
+
+    int size() const { return _size; }
+
+private:
+    static constexpr int kSlotBits = 8;
+    static constexpr int kNumSlots = 1 << kSlotBits;
+    static constexpr int kNumLevels = 4;
+    static constexpr uint64_t kMaxDelayTicks = (1ull << (kSlotBits * kNumLevels)) - 1;
+
+    struct Entry {
+        uint64_t deadline {0};
+        uint64_t sequence {0};
+        uint32_t owner {0};
+        Callback callback;
+    };
+
+    std::vector<Entry> _slots[kNumLevels][kNumSlots];
+    uint64_t _currentTick {0};
+    uint64_t _targetTick {0}; // tick that the current update advances to
+    bool _updating {false};
+    float _timeSinceTick {0.0f};
+    uint64_t _nextSequence {0};
+    int _size {0};
+
+    void insert(Entry entry);
+    void cascade(int level);
+    void advance();
+};
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "keyframetrack.h"
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Keyframe tracks of an animation, resolved against nodes of a particular
+ * model. Nodes are referenced by their indices in Model::nodes().
+ */
+struct AnimationBinding {
+    struct Node {
+        int index {0};
+        glm::vec3 restPosition {0.0f};
+        glm::quat restOrientation {1.0f, 0.0f, 0.0f, 0.0f};
+
+        const KeyframeTrack<glm::vec3> *position {nullptr};
+        const KeyframeTrack<glm::quat> *orientation {nullptr};
+        const KeyframeTrack<float> *scale {nullptr};
+        const KeyframeTrack<float> *alpha {nullptr};
+        const KeyframeTrack<glm::vec3> *selfIllumColor {nullptr};
+        const KeyframeTrack<glm::vec3> *color {nullptr};
+    };
+
+    /**
+     * Per-playback keyframe cursors of a bound node.
+     */
+    struct Cursors {
+        int position {0};
+        int orientation {0};
+        int scale {0};
+        int alpha {0};
+        int selfIllumColor {0};
+        int color {0};
+    };
+
+    std::vector<Node> nodes;
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -19,10 +19,16 @@
 
 namespace reone {
 
+class IThreadPool;
+
 namespace graphics {
 
-void decompressDXT1(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image);
-void decompressDXT5(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image);
+/**
+ * Decompresses DXT blocks into RGBA pixels. Given a thread pool, rows of
+ * blocks are decoded in chunks by the calling thread and pool workers.
+ */
+void decompressDXT1(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image, IThreadPool *threadPool = nullptr);
+void decompressDXT5(uint32_t width, uint32_t height, const uint8_t *blockStorage, uint32_t *image, IThreadPool *threadPool = nullptr);
 
 } // namespace graphics
 
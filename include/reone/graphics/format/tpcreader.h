@@ -36,7 +36,15 @@ public:
 
     void load();
 
+    /**
+     * Reads the header and trailing TXI without copying pixel data.
+     */
+    void loadHeaderAndFeatures();
+
+    bool isCubeMap() const { return _numLayers == kNumCubeFaces; }
+
     std::shared_ptr<Texture> texture() const { return _texture; }
+    const Texture::Features &features() const { return _features; }
     const ByteBuffer &txiData() const { return _txiData; }
 
 private:
@@ -64,7 +72,9 @@ private:
     std::shared_ptr<Texture> _texture;
     ByteBuffer _txiData;
 
+    void loadHeader();
     void loadLayers();
+    void skipLayers();
     void loadFeatures();
 
     void loadTexture();
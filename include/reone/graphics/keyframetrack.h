@@ -43,6 +43,18 @@ public:
     }
 
     bool valueAtTime(float time, Value &value) const {
+        int cursor = 0;
+        return valueAtTime(time, value, cursor);
+    }
+
+    /**
+     * Samples this track, using and updating a keyframe cursor. When time
+     * advances monotonically, as it does during playback, the next keyframe
+     * is found in constant time. Otherwise, falls back to binary search.
+     *
+     * @param cursor index of the right keyframe from previous lookup
+     */
+    bool valueAtTime(float time, Value &value, int &cursor) const {
         if (_keyframes.empty()) {
             return false;
         }
@@ -50,13 +62,8 @@ public:
             value = _keyframes[0].value;
             return true;
         }
-        int rightKfIdx;
-        for (int i = 1; i < _keyframes.size(); ++i) {
-            rightKfIdx = i;
-            if (_keyframes[i].time >= time) {
-                break;
-            }
-        }
+        int rightKfIdx = findRightKeyframe(time, cursor);
+        cursor = rightKfIdx;
         int leftKfIdx = rightKfIdx - 1;
         const auto &leftKeyframe = _keyframes[leftKfIdx];
         const auto &rightKeyframe = _keyframes[rightKfIdx];
@@ -76,6 +83,31 @@ public:
 private:
     std::vector<Keyframe> _keyframes;
 
+    /**
+     * @return index of the first keyframe, other than the first one, whose time
+     *         is not less than time, or index of the last keyframe
+     */
+    int findRightKeyframe(float time, int hint) const {
+        int numKeyframes = static_cast<int>(_keyframes.size());
+        auto first = _keyframes.begin() + 1;
+        if (hint >= 1 && hint < numKeyframes && (hint == 1 || _keyframes[hint - 1].time < time)) {
+            if (_keyframes[hint].time >= time || hint == numKeyframes - 1) {
+                return hint;
+            }
+            if (_keyframes[hint + 1].time >= time) {
+                return hint + 1;
+            }
+            first = _keyframes.begin() + hint + 2;
+        }
+        auto it = std::lower_bound(first, _keyframes.end(), time, [](const auto &kf, float time) {
+            return kf.time < time;
+        });
+        if (it == _keyframes.end()) {
+            return numKeyframes - 1;
+        }
+        return static_cast<int>(std::distance(_keyframes.begin(), it));
+    }
+
     Value interpolateKeyframes(const Keyframe &lhs, const Keyframe &rhs, float factor) const {
         if (lhs.time == rhs.time) {
             return lhs.value;
@@ -26,6 +26,8 @@ namespace graphics {
 class Animation;
 class ModelNode;
 
+struct AnimationBinding;
+
 class Model : boost::noncopyable {
 public:
     Model(
@@ -61,6 +63,11 @@ public:
     std::shared_ptr<ModelNode> getNodeByNameRecursive(const std::string &name) const;
     std::shared_ptr<ModelNode> getAABBNode() const;
 
+    /**
+     * @return all nodes of this model in depth-first order
+     */
+    const std::vector<ModelNode *> &nodes() const { return _nodes; }
+
     // END Nodes
 
     // Animations
@@ -68,6 +75,12 @@ public:
     std::vector<std::string> getAnimationNames() const;
     std::shared_ptr<Animation> getAnimation(const std::string &name) const;
 
+    /**
+     * Resolves keyframe tracks of the animation against nodes of this model.
+     * Bindings are computed once per animation and cached. Thread-safe.
+     */
+    const AnimationBinding &bindAnimation(const Animation &anim);
+
     const std::unordered_map<std::string, std::shared_ptr<Animation>> &animations() const {
         return _animations;
     }
@@ -88,6 +101,10 @@ private:
 
     std::unordered_map<uint16_t, std::shared_ptr<ModelNode>> _nodeByNumber;
     std::unordered_map<std::string, std::shared_ptr<ModelNode>> _nodeByName;
+    std::vector<ModelNode *> _nodes;
+
+    std::unordered_map<const Animation *, std::shared_ptr<AnimationBinding>> _animBindings;
+    std::mutex _animBindingsMutex;
 
     void fillLookups(const std::shared_ptr<ModelNode> &node);
     void computeAABB();
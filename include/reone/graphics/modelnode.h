@@ -235,6 +235,10 @@ public:
     bool vectorValueAtTime(ControllerType type, float time, glm::vec3 &value) const;
     bool quaternionValueAt(ControllerType type, float time, glm::quat &value) const;
 
+    const KeyframeTrack<float> *floatTrack(ControllerType type) const;
+    const KeyframeTrack<glm::vec3> *vectorTrack(ControllerType type) const;
+    const KeyframeTrack<glm::quat> *quaternionTrack(ControllerType type) const;
+
     KeyframeTrackMap<float> &floatTracks() { return _floatTracks; }
     KeyframeTrackMap<glm::vec3> &vectorTracks() { return _vectorTracks; }
     KeyframeTrackMap<glm::quat> &quaternionTracks() { return _quaternionTracks; }
@@ -38,6 +38,7 @@ struct GraphicsOptions {
     TextureQuality textureQuality {TextureQuality::High};
     int shadowResolution {2048};
     int anisotropicFiltering {2};
+    int textureUploadBudget {4}; /**< milliseconds per frame */
     float drawDistance {kDefaultObjectDrawDistance};
 };
 
@@ -21,9 +21,11 @@
 
 namespace reone {
 
+class IThreadPool;
+
 namespace graphics {
 
-void convertGridTextureToArray(Texture &texture, int numX, int numY);
+void convertGridTextureToArray(Texture &texture, int numX, int numY, IThreadPool *threadPool = nullptr);
 
 Texture::Properties getTextureProperties(TextureUsage usage);
 
@@ -33,6 +33,10 @@ public:
         glm::vec3 normal {0.0f};
     };
 
+    /**
+     * Node of AABB tree, as stored in BWM files. Only used to build a
+     * walkmesh: see setRootAABB.
+     */
     struct AABB {
         graphics::AABB value;
         int faceIdx {-1};
@@ -41,15 +45,33 @@ public:
     };
 
     /**
+     * @return bitmask of surface materials, for use in raycast
+     */
+    static uint64_t surfaceMask(const std::set<uint32_t> &surfaces);
+
+    /**
+     * Finds the nearest face of one of the specified surface materials
+     * intersected by a ray.
+     *
+     * @param surfaceMask bitmask of surface materials, see surfaceMask
      * @return pointer to intersected face or nullptr when no intersection
      */
     const Walkmesh::Face *raycast(
-        std::set<uint32_t> walkcheckSurfaces,
+        uint64_t surfaceMask,
         const glm::vec3 &origin,
         const glm::vec3 &dir,
         float maxDistance,
         float &outDistance) const;
 
+    const Walkmesh::Face *raycast(
+        const std::set<uint32_t> &surfaces,
+        const glm::vec3 &origin,
+        const glm::vec3 &dir,
+        float maxDistance,
+        float &outDistance) const {
+        return raycast(surfaceMask(surfaces), origin, dir, maxDistance, outDistance);
+    }
+
     bool contains(const glm::vec2 &point) const;
 
     bool isAreaWalkmesh() const { return _area; }
@@ -60,25 +82,52 @@ public:
         _faces.push_back(face);
     }
 
-    void setRootAABB(std::shared_ptr<AABB> aabb) {
-        _rootAabb = std::move(aabb);
-    }
+    /**
+     * Builds a flattened AABB tree from the specified tree. Faces must be
+     * added beforehand.
+     */
+    void setRootAABB(const std::shared_ptr<AABB> &aabb);
 
 private:
+    /**
+     * Node of a flattened AABB tree. Left child of an interior node
+     * immediately follows it, leaf nodes refer to a contiguous range of
+     * triangles.
+     */
+    struct AABBNode {
+        glm::vec3 min {0.0f};
+        uint32_t offset {0}; // leaf: first triangle, interior: right child or 0 if none
+        glm::vec3 max {0.0f};
+        uint32_t triangleCount {0};
+    };
+
+    static_assert(sizeof(AABBNode) == 32, "AABB tree node must be 32 bytes");
+
+    struct Triangle {
+        glm::vec3 vertices[3];
+        uint64_t surfaceBit {0};
+        int faceIdx {0};
+    };
+
     std::vector<Face> _faces;
-    std::shared_ptr<AABB> _rootAabb;
+
+    std::vector<AABBNode> _nodes;
+    std::vector<Triangle> _triangles;
+    graphics::AABB _bounds;
 
     bool _area {false};
 
+    uint32_t appendAABB(const AABB &aabb, int depth);
+
     const Walkmesh::Face *raycastAABB(
-        std::set<uint32_t> surfaces,
+        uint64_t surfaceMask,
         const glm::vec3 &origin,
         const glm::vec3 &dir,
         float maxDistance,
         float &outDistance) const;
 
     bool raycastFace(
-        std::set<uint32_t> surfaces,
+        uint64_t surfaceMask,
         const Walkmesh::Face &face,
         const glm::vec3 &origin,
         const glm::vec3 &dir,
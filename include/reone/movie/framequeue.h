@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+namespace reone {
+
+namespace movie {
+
+/**
+ * Bounded queue of decoded video frames, shared between a decoding thread and
+ * the presentation clock. Pixel buffers are pooled: at most capacity frames
+ * are queued ahead, and buffers of presented or skipped frames are recycled.
+ */
+class VideoFrameQueue : boost::noncopyable {
+public:
+    VideoFrameQueue(int capacity, size_t frameSize) :
+        _capacity(capacity),
+        _frameSize(frameSize) {
+        if (capacity < 1) {
+            throw std::invalid_argument("capacity");
+        }
+    }
+
+    // Producer
+
+    /**
+     * Blocks until a pixel buffer is available for decoding into.
+     *
+     * @return pixel buffer, or nullptr if queue has been closed
+     */
+    std::shared_ptr<ByteBuffer> acquire();
+
+    void push(float time, std::shared_ptr<ByteBuffer> pixels);
+
+    /**
+     * Signals that no more frames will be pushed.
+     */
+    void finish();
+
+    // END Producer
+
+    // Consumer
+
+    /**
+     * Dequeues the latest frame that is due at time, recycling frames that
+     * are superseded.
+     *
+     * @return pixels of the frame, or nullptr if no new frame is due
+     */
+    std::shared_ptr<ByteBuffer> pickDue(float time);
+
+    /**
+     * @return true if producer has finished and all frames have been picked
+     */
+    bool isDrained() const;
+
+    /**
+     * Wakes up and stops producer.
+     */
+    void close();
+
+    // END Consumer
+
+private:
+    struct Frame {
+        float time {0.0f};
+        std::shared_ptr<ByteBuffer> pixels;
+    };
+
+    int _capacity;
+    size_t _frameSize;
+
+    std::deque<Frame> _frames;
+    std::vector<std::shared_ptr<ByteBuffer>> _free;
+    std::shared_ptr<ByteBuffer> _current;
+    int _allocated {0};
+    bool _finished {false};
+    bool _closed {false};
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condVar;
+};
+
+} // namespace movie
+
+} // namespace reone
@@ -52,17 +52,13 @@ public:
         std::vector<Row> _rows;
     };
 
-    TwoDA(std::vector<std::string> columns, std::vector<Row> rows) :
-        _columns(std::move(columns)),
-        _rows(std::move(rows)) {
-        size_t numColumns = _columns.size();
-        for (size_t row = 0; row < _rows.size(); ++row) {
-            size_t numValues = _rows[row].values.size();
-            if (numValues != numColumns) {
-                throw ValidationException(str(boost::format("Expected %d columns in 2DA row %d, was %d") % numColumns % row % numValues));
-            }
-        }
-    }
+    /**
+     * Transposes rows into columns. Typed values and value indexes of columns
+     * are built lazily, on first access.
+     *
+     * @throws ValidationException if a row has an unexpected number of values
+     */
+    TwoDA(std::vector<std::string> columns, std::vector<Row> rows);
 
     /**
      * @return row index or -1 when not found
@@ -74,8 +70,8 @@ public:
      */
     int indexByCellValues(const std::vector<std::pair<std::string, std::string>> &values) const;
 
-    int getColumnCount() const { return static_cast<int>(_columns.size()); }
-    int getRowCount() const { return static_cast<int>(_rows.size()); }
+    int getColumnCount() const { return static_cast<int>(_columnNames.size()); }
+    int getRowCount() const { return _rowCount; }
 
     std::string getString(int row, const std::string &column, std::string defValue = "") const;
     int getInt(int row, const std::string &column, int defValue = 0) const;
@@ -89,8 +85,14 @@ public:
     std::optional<float> getFloatOpt(int row, const std::string &column) const;
     std::optional<bool> getBoolOpt(int row, const std::string &column) const;
 
-    const std::vector<std::string> &columns() const { return _columns; }
-    const std::vector<Row> &rows() const { return _rows; }
+    /**
+     * @return raw value of the cell, including deleted ("****") values
+     */
+    const std::string &getCell(int row, int column) const {
+        return _columns[column]->values[row];
+    }
+
+    const std::vector<std::string> &columns() const { return _columnNames; }
 
     static Row newRow(std::vector<std::string> values) {
         auto row = Row();
@@ -99,11 +101,55 @@ public:
     }
 
 private:
-    std::vector<std::string> _columns;
-    std::vector<Row> _rows;
+    enum class CellState : uint8_t {
+        Empty,
+        Deleted,
+        Valid,
+        Invalid /**< value could not be parsed, parsing is repeated on access to throw */
+    };
+
+    template <class T>
+    struct TypedColumn {
+        std::vector<T> values;
+        std::vector<CellState> states;
+    };
+
+    struct Column {
+        std::vector<std::string> values;
+
+        mutable std::once_flag intsFlag;
+        mutable std::once_flag hexIntsFlag;
+        mutable std::once_flag floatsFlag;
+        mutable std::once_flag indexFlag;
+
+        mutable TypedColumn<int> ints;
+        mutable TypedColumn<uint32_t> hexInts;
+        mutable TypedColumn<float> floats;
+
+        mutable std::unordered_map<std::string, std::vector<int>> index; /**< value to ascending row indices */
+    };
+
+    std::vector<std::string> _columnNames;
+    std::vector<std::unique_ptr<Column>> _columns;
+    int _rowCount {0};
+
+    std::unordered_map<std::string, int> _columnIndices;
 
     int getColumnIndex(const std::string &column) const;
     std::vector<int> getColumnIndices(const std::vector<std::string> &columns) const;
+
+    const Column *getCellColumn(int row, const std::string &column) const;
+
+    const TypedColumn<int> &getInts(const Column &column) const;
+    const TypedColumn<uint32_t> &getHexInts(const Column &column) const;
+    const TypedColumn<float> &getFloats(const Column &column) const;
+    const std::unordered_map<std::string, std::vector<int>> &getIndex(const Column &column) const;
+
+    template <class T, class Parse>
+    static void parseColumn(const std::vector<std::string> &values, TypedColumn<T> &typed, Parse parse);
+
+    template <class T, class Parse>
+    static std::optional<T> getTypedValue(const TypedColumn<T> &typed, const std::string &value, int row, const std::string &column, Parse parse);
 };
 
 } // namespace resource
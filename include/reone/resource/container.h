@@ -20,6 +20,7 @@
 #include "reone/system/types.h"
 
 #include "id.h"
+#include "resource.h"
 
 namespace reone {
 
@@ -32,6 +33,15 @@ public:
 
     virtual std::optional<ByteBuffer> findResourceData(const ResourceId &id) = 0;
 
+    virtual std::optional<ResourceView> findResourceView(const ResourceId &id) {
+        auto data = findResourceData(id);
+        if (!data) {
+            return std::nullopt;
+        }
+        auto buffer = std::make_shared<ByteBuffer>(std::move(*data));
+        return ResourceView {buffer->data(), buffer->size(), buffer};
+    }
+
     virtual const std::unordered_set<ResourceId> &resourceIds() const = 0;
 };
 
@@ -17,7 +17,7 @@
 
 #pragma once
 
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/memorymappedfile.h"
 
 #include "../container.h"
 
@@ -48,7 +48,7 @@ private:
     };
 
     std::filesystem::path _path;
-    std::unique_ptr<FileInputStream> _exe;
+    std::shared_ptr<MemoryMappedFile> _exe;
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
@@ -17,7 +17,7 @@
 
 #pragma once
 
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/memorymappedfile.h"
 
 #include "../container.h"
 
@@ -38,6 +38,7 @@ public:
     // IResourceContainer
 
     std::optional<ByteBuffer> findResourceData(const ResourceId &id) override;
+    std::optional<ResourceView> findResourceView(const ResourceId &id) override;
 
     const std::unordered_set<ResourceId> &resourceIds() const override { return _resourceIds; }
 
@@ -52,7 +53,7 @@ private:
 
     std::filesystem::path _keyPath;
 
-    std::vector<std::unique_ptr<FileInputStream>> _bifs;
+    std::vector<std::shared_ptr<MemoryMappedFile>> _bifs;
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
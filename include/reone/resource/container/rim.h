@@ -17,7 +17,7 @@
 
 #pragma once
 
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/memorymappedfile.h"
 
 #include "../container.h"
 
@@ -36,6 +36,7 @@ public:
     // IResourceContainer
 
     std::optional<ByteBuffer> findResourceData(const ResourceId &id) override;
+    std::optional<ResourceView> findResourceView(const ResourceId &id) override;
 
     const std::unordered_set<ResourceId> &resourceIds() const override { return _resourceIds; }
 
@@ -49,7 +50,7 @@ private:
     };
 
     std::filesystem::path _path;
-    std::unique_ptr<FileInputStream> _rim;
+    std::shared_ptr<MemoryMappedFile> _rim;
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
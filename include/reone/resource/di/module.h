@@ -43,6 +43,8 @@
 
 namespace reone {
 
+class SystemModule;
+
 namespace audio {
 
 class AudioModule;
@@ -71,6 +73,7 @@ public:
                    std::filesystem::path gamePath,
                    graphics::GraphicsOptions &graphicsOpt,
                    audio::AudioOptions &audioOpt,
+                   SystemModule &system,
                    graphics::GraphicsModule &graphics,
                    audio::AudioModule &audio,
                    script::ScriptModule &script) :
@@ -78,6 +81,7 @@ public:
         _gamePath(std::move(gamePath)),
         _graphicsOpt(graphicsOpt),
         _audioOpt(audioOpt),
+        _system(system),
         _graphics(graphics),
         _audio(audio),
         _script(script) {
@@ -120,6 +124,7 @@ private:
     std::filesystem::path _gamePath;
     graphics::GraphicsOptions &_graphicsOpt;
     audio::AudioOptions &_audioOpt;
+    SystemModule &_system;
     graphics::GraphicsModule &_graphics;
     audio::AudioModule &_audio;
     script::ScriptModule &_script;
@@ -19,6 +19,7 @@
 
 #include "reone/system/binaryreader.h"
 #include "reone/system/stream/input.h"
+#include "reone/system/stream/memoryinput.h"
 
 namespace reone {
 
@@ -32,18 +33,38 @@ public:
         _tlk(tlk) {
     }
 
+    /**
+     * Reads the TLK from the buffer lazily: load only validates the header and
+     * the entry table, and strings are decoded by the talk table on access.
+     *
+     * @param owner keeps the buffer alive for as long as the talk table exists
+     */
+    TlkReader(const char *data, size_t size, std::shared_ptr<const void> owner) :
+        _memory(std::make_unique<MemoryInputStream>(data, size)),
+        _tlk(*_memory),
+        _data(data),
+        _size(size),
+        _owner(std::move(owner)) {
+    }
+
     void load();
 
     std::shared_ptr<TalkTable> table() const { return _table; }
 
 private:
+    std::unique_ptr<MemoryInputStream> _memory;
     BinaryReader _tlk;
 
+    const char *_data {nullptr};
+    size_t _size {0};
+    std::shared_ptr<const void> _owner;
+
     uint32_t _stringCount {0};
     uint32_t _stringsOffset {0};
     std::shared_ptr<TalkTable> _table;
 
     void loadStrings();
+    void loadStringsLazy();
 };
 
 } // namespace resource
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "gff.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Labels of fields of a generated struct, in member order.
+ *
+ * Every schema gets a sequential id. Documents resolve a schema to label
+ * indices once, on first use, and keep the result in a slot for that id, so
+ * schemas must have static storage duration.
+ */
+class GffSchema : boost::noncopyable {
+public:
+    static constexpr int kMaxSchemas = 128;
+
+    GffSchema(std::initializer_list<std::string_view> labels) :
+        _labels(labels),
+        _id(nextId()) {
+    }
+
+    int id() const { return _id; }
+    const std::vector<std::string_view> &labels() const { return _labels; }
+
+private:
+    std::vector<std::string_view> _labels;
+    int _id;
+
+    static int nextId() {
+        static std::atomic_int next {0};
+        int id = next++;
+        if (id >= kMaxSchemas) {
+            throw std::logic_error("GFF: too many schemas");
+        }
+        return id;
+    }
+};
+
+/**
+ * Read-only view of a GFF struct, decoded on access from the binary buffer.
+ *
+ * Labels are resolved to label table indices once per lookup, and fields of
+ * every struct are indexed by label index when the document is loaded, so
+ * that lookups do not compare or allocate strings.
+ *
+ * Views are nullable handles: findStruct returns an invalid view when the
+ * field is not found. operator* and operator-> return the view itself, so
+ * that views can be used in place of std::shared_ptr<Gff>, e.g. in generated
+ * parsers.
+ */
+class GffView {
+public:
+    class Document;
+
+    struct Field {
+        Gff::FieldType type {Gff::FieldType::Int};
+        uint32_t dataOrDataOffset {0};
+    };
+
+    /**
+     * Value of a field of a struct, decoded on access.
+     */
+    class FieldValue {
+    public:
+        FieldValue(const GffView &owner, Field field) :
+            _owner(owner),
+            _field(std::move(field)) {
+        }
+
+        Gff::FieldType type() const { return _field.type; }
+
+        bool getBool() const;
+        int getInt() const;
+        int64_t readInt64() const;
+        uint32_t getUint() const;
+        uint64_t readUint64() const;
+        glm::vec3 getColor() const;
+        float getFloat() const;
+        double getDouble() const;
+        std::string getString() const;
+        glm::vec3 getVector() const;
+        glm::quat getOrientation() const;
+        GffView getStruct() const;
+        std::vector<GffView> getList() const;
+        ByteBuffer getData() const;
+
+    private:
+        const GffView &_owner;
+        Field _field;
+
+        uint64_t getRawValue() const;
+    };
+
+    GffView() = default;
+
+    GffView(std::shared_ptr<const Document> document, uint32_t structIdx) :
+        _document(std::move(document)),
+        _structIdx(structIdx) {
+    }
+
+    /**
+     * Loads a GFF document from the buffer and returns a view of its root
+     * struct.
+     *
+     * @param owner keeps the buffer alive for as long as views exist
+     * @throws ValidationException if the buffer is not a valid GFF
+     */
+    static GffView load(const char *data, size_t size, std::shared_ptr<const void> owner);
+
+    static GffView load(std::shared_ptr<const ByteBuffer> bytes) {
+        return load(bytes->data(), bytes->size(), bytes);
+    }
+
+    explicit operator bool() const { return static_cast<bool>(_document); }
+
+    const GffView &operator*() const { return *this; }
+    const GffView *operator->() const { return this; }
+
+    uint32_t type() const;
+
+    bool getBool(const std::string &name, bool defValue = false) const;
+    int getInt(const std::string &name, int defValue = 0) const;
+    int64_t readInt64(const std::string &name, int64_t defValue = 0) const;
+    uint32_t getUint(const std::string &name, uint32_t defValue = 0) const;
+    uint64_t readUint64(const std::string &name, uint64_t defValue = 0) const;
+    glm::vec3 getColor(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    float getFloat(const std::string &name, float defValue = 0.0f) const;
+    double getDouble(const std::string &name, double defValue = 0.0) const;
+    std::string getString(const std::string &name, std::string defValue = "") const;
+    glm::vec3 getVector(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    glm::quat getOrientation(const std::string &name, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
+    GffView findStruct(const std::string &name) const;
+    std::vector<GffView> getList(const std::string &name) const;
+    ByteBuffer getData(const std::string &name) const;
+
+    template <class T>
+    T getEnum(const std::string &name, T defValue) const {
+        return static_cast<T>(getInt(name, static_cast<int>(defValue)));
+    }
+
+    /**
+     * Calls visitor for every field of this struct whose label is in schema,
+     * passing the index of the label within schema and the field value.
+     * Where a struct contains several fields with the same label, only the
+     * first one is visited, consistent with lookups by name.
+     */
+    template <class Visitor>
+    void visitFields(const GffSchema &schema, Visitor &&visitor) const {
+        const std::vector<int> &members = resolveSchema(schema);
+        uint32_t count = fieldCount();
+        uint32_t prevLabelIdx = std::numeric_limits<uint32_t>::max();
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t labelIdx;
+            Field field = fieldAt(i, labelIdx);
+            if (labelIdx == prevLabelIdx) {
+                continue;
+            }
+            prevLabelIdx = labelIdx;
+            int member = members[labelIdx];
+            if (member != -1) {
+                visitor(member, FieldValue(*this, std::move(field)));
+            }
+        }
+    }
+
+private:
+    std::shared_ptr<const Document> _document;
+    uint32_t _structIdx {0};
+
+    std::optional<FieldValue> get(const std::string &name) const;
+
+    /**
+     * @return index of schema label by label index of this document, or -1
+     */
+    const std::vector<int> &resolveSchema(const GffSchema &schema) const;
+
+    uint32_t fieldCount() const;
+
+    /**
+     * @param i index of the field within this struct, in label order
+     */
+    Field fieldAt(uint32_t i, uint32_t &labelIdx) const;
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -141,6 +142,7 @@ struct DLG {
 };
 
 DLG parseDLG(const Gff &gff);
+DLG parseDLG(const GffView &gff);
 
 } // namespace generated
 
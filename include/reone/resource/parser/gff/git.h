@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -175,6 +176,7 @@ struct GIT {
 };
 
 GIT parseGIT(const Gff &gff);
+GIT parseGIT(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -120,6 +121,7 @@ struct GUI : public GUI_BASECONTROL {
 };
 
 GUI parseGUI(const Gff &gff);
+GUI parseGUI(const GffView &gff);
 
 } // namespace generated
 
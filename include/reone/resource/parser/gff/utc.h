@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -142,6 +143,7 @@ struct UTC {
 };
 
 UTC parseUTC(const Gff &gff);
+UTC parseUTC(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -97,6 +98,7 @@ struct UTP {
 };
 
 UTP parseUTP(const Gff &gff);
+UTP parseUTP(const GffView &gff);
 
 } // namespace generated
 
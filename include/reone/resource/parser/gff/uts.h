@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -58,6 +59,7 @@ struct UTS {
 };
 
 UTS parseUTS(const Gff &gff);
+UTS parseUTS(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -40,6 +41,7 @@ struct UTW {
 };
 
 UTW parseUTW(const Gff &gff);
+UTW parseUTW(const GffView &gff);
 
 } // namespace generated
 
@@ -20,11 +20,14 @@
 #include "reone/system/cache.h"
 
 #include "../gff.h"
+#include "../gffview.h"
 #include "../id.h"
 #include "../types.h"
 
 namespace reone {
 
+class IThreadPool;
+
 namespace resource {
 
 class Resources;
@@ -36,6 +39,9 @@ public:
     virtual void clear() = 0;
 
     virtual std::shared_ptr<Gff> get(const std::string &resRef, ResType type) = 0;
+    virtual GffView getView(const std::string &resRef, ResType type) = 0;
+
+    virtual void prefetch(const std::vector<ResourceId> &ids) = 0;
 };
 
 class Gffs : public IGffs, boost::noncopyable {
@@ -44,16 +50,38 @@ public:
         _resources(resources) {
     }
 
+    Gffs(Resources &resources, IThreadPool &threadPool) :
+        _resources(resources),
+        _threadPool(&threadPool) {
+    }
+
     void clear() override {
         _cache.clear();
+        _viewCache.clear();
     }
 
     std::shared_ptr<Gff> get(const std::string &resRef, ResType type) override;
 
+    /**
+     * Returns a lazily decoded view of the specified GFF, or an invalid view
+     * if the resource is not found. Views reference resource data directly
+     * and are preferable to get for read-only access, e.g. to blueprints.
+     */
+    GffView getView(const std::string &resRef, ResType type) override;
+
+    /**
+     * Fetches and parses the specified GFFs on the thread pool, if any, and
+     * caches views of them, so that subsequent calls to getView do not hit
+     * Resources.
+     */
+    void prefetch(const std::vector<ResourceId> &ids) override;
+
 private:
     Resources &_resources;
+    IThreadPool *_threadPool {nullptr};
 
     Cache<ResourceId, Gff> _cache;
+    Cache<ResourceId, GffView> _viewCache;
 };
 
 } // namespace resource
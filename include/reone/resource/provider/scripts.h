@@ -23,6 +23,12 @@
 
 namespace reone {
 
+namespace script {
+
+class IRoutines;
+
+}
+
 namespace resource {
 
 class IScripts {
@@ -31,6 +37,12 @@ public:
 
     virtual void clear() = 0;
 
+    /**
+     * Sets routines used to verify loaded script programs. Clears cached
+     * programs, as they may have been verified against other routines.
+     */
+    virtual void setRoutines(script::IRoutines &routines) = 0;
+
     virtual std::shared_ptr<script::ScriptProgram> get(const std::string &key) = 0;
 };
 
@@ -44,6 +56,11 @@ public:
         _objects.clear();
     }
 
+    void setRoutines(script::IRoutines &routines) override {
+        _routines = &routines;
+        _objects.clear();
+    }
+
     std::shared_ptr<script::ScriptProgram> get(const std::string &key) override {
         auto maybeObject = _objects.find(key);
         if (maybeObject != _objects.end()) {
@@ -56,6 +73,8 @@ public:
 private:
     Resources &_resources;
 
+    script::IRoutines *_routines {nullptr};
+
     std::unordered_map<std::string, std::shared_ptr<script::ScriptProgram>> _objects;
 
     std::shared_ptr<script::ScriptProgram> doGet(std::string resRef);
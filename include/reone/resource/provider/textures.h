@@ -21,6 +21,8 @@
 
 namespace reone {
 
+class IThreadPool;
+
 namespace graphics {
 
 class GraphicsOptions;
@@ -40,6 +42,9 @@ public:
     virtual void clear() = 0;
 
     virtual std::shared_ptr<graphics::Texture> get(const std::string &resRef, graphics::TextureUsage usage = graphics::TextureUsage::Default) = 0;
+    virtual std::shared_ptr<graphics::Texture> getAsync(const std::string &resRef, graphics::TextureUsage usage = graphics::TextureUsage::Default) = 0;
+
+    virtual void uploadPending() = 0;
 };
 
 class Textures : public ITextures, boost::noncopyable {
@@ -49,21 +54,53 @@ public:
         _resources(resources) {
     }
 
+    Textures(graphics::GraphicsOptions &options, Resources &resources, IThreadPool &threadPool) :
+        _options(options),
+        _resources(resources),
+        _threadPool(&threadPool) {
+    }
+
     void init();
 
     void clear() override;
 
     std::shared_ptr<graphics::Texture> get(const std::string &resRef, graphics::TextureUsage usage = graphics::TextureUsage::Default) override;
 
+    /**
+     * Returns a placeholder texture immediately and decodes pixels on the
+     * thread pool. Placeholder has final type and features, and is refreshed
+     * in place by uploadPending once decoding completes.
+     */
+    std::shared_ptr<graphics::Texture> getAsync(const std::string &resRef, graphics::TextureUsage usage = graphics::TextureUsage::Default) override;
+
+    /**
+     * Uploads decoded textures to the GPU until per-frame budget, as set in
+     * graphics options, is exhausted. Must be called from the main thread.
+     */
+    void uploadPending() override;
+
+    size_t numPending() const { return _pending.size(); }
+
 private:
+    struct PendingTexture {
+        std::shared_ptr<graphics::Texture> placeholder;
+        std::future<std::shared_ptr<graphics::Texture>> decoded;
+    };
+
     int _activeUnit {0};
 
     graphics::GraphicsOptions &_options;
     Resources &_resources;
+    IThreadPool *_threadPool {nullptr};
 
     std::unordered_map<std::string, std::shared_ptr<graphics::Texture>> _cache;
+    std::list<PendingTexture> _pending;
 
     std::shared_ptr<graphics::Texture> doGet(const std::string &resRef, graphics::TextureUsage usage);
+    std::shared_ptr<graphics::Texture> doGetAsync(const std::string &resRef, graphics::TextureUsage usage);
+
+    void finishPending(const std::shared_ptr<graphics::Texture> &texture);
+    void upload(PendingTexture &pending);
 };
 
 } // namespace resource
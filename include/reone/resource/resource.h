@@ -28,6 +28,13 @@ struct Resource {
     bool local {false};
 };
 
+struct ResourceView {
+    const char *data {nullptr};
+    size_t size {0};
+    std::shared_ptr<const void> owner;
+    bool local {false};
+};
+
 } // namespace resource
 
 } // namespace reone
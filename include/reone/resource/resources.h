@@ -49,24 +49,28 @@ public:
 
     virtual Resource get(const ResourceId &id) = 0;
     virtual std::optional<Resource> find(const ResourceId &id) = 0;
+
+    virtual ResourceView getView(const ResourceId &id) = 0;
+    virtual std::optional<ResourceView> findView(const ResourceId &id) = 0;
 };
 
 class Resources : public IResources, boost::noncopyable {
 public:
+    Resources() = default;
+
     void clear() override {
+        std::unique_lock<std::shared_mutex> lock(_mutex);
         _containers.clear();
+        _index.clear();
     }
 
-    void clearLocal() override {
-        auto toErase = std::remove_if(_containers.begin(), _containers.end(), [](auto &pair) {
-            return pair.local;
-        });
-        _containers.erase(toErase, _containers.end());
-    }
+    void clearLocal() override;
 
-    void add(std::unique_ptr<IResourceContainer> provider, bool local = false) {
-        _containers.push_front(ResourceContainerLocalPair {std::move(provider), local});
-    }
+    /**
+     * Registers an initialized container. Resource IDs of the container are
+     * indexed once, so containers must not change their contents afterwards.
+     */
+    void add(std::unique_ptr<IResourceContainer> provider, bool local = false);
 
     void addKEY(const std::filesystem::path &path) override;
     void addERF(const std::filesystem::path &path, bool local = false) override;
@@ -77,10 +81,24 @@ public:
     Resource get(const ResourceId &id) override;
     std::optional<Resource> find(const ResourceId &id) override;
 
+    ResourceView getView(const ResourceId &id) override;
+    std::optional<ResourceView> findView(const ResourceId &id) override;
+
     const ResourceContainerList &containers() const { return _containers; }
 
+    size_t numHits() const { return _numHits; }
+    size_t numMisses() const { return _numMisses; }
+
 private:
+
     ResourceContainerList _containers;
+    std::unordered_map<ResourceId, const ResourceContainerLocalPair *> _index;
+    std::shared_mutex _mutex;
+
+    std::atomic_size_t _numHits {0};
+    std::atomic_size_t _numMisses {0};
+
+    const ResourceContainerLocalPair *findContainer(const ResourceId &id);
 };
 
 } // namespace resource
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "reone/system/lrucache.h"
+
 namespace reone {
 
 namespace resource {
@@ -43,15 +45,45 @@ public:
         std::vector<String> _strings;
     };
 
+    using Decoder = std::function<String(int index)>;
+
+    static constexpr size_t kDefaultCacheCapacity = 4096;
+
     TalkTable(std::vector<String> strings) :
-        _strings(std::move(strings)) {
+        _strings(std::move(strings)),
+        _stringCount(static_cast<int>(_strings.size())) {
+    }
+
+    /**
+     * Creates a talk table whose strings are decoded on first access and
+     * kept in a bounded LRU cache.
+     *
+     * @param decoder decodes string at the specified index, must be thread-safe
+     */
+    TalkTable(int stringCount, Decoder decoder, size_t cacheCapacity = kDefaultCacheCapacity) :
+        _stringCount(stringCount),
+        _decoder(std::move(decoder)),
+        _cache(cacheCapacity) {
     }
 
     int getStringCount() const;
-    const String &getString(int index) const;
+
+    /**
+     * @throws std::out_of_range if index is out of range
+     */
+    String getString(int index) const;
 
 private:
     std::vector<String> _strings;
+    int _stringCount {0};
+
+    // Lazy loading
+
+    Decoder _decoder;
+    mutable LruCache<int, String> _cache {0};
+    mutable std::mutex _cacheMutex;
+
+    // END Lazy loading
 };
 
 } // namespace resource
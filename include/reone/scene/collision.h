@@ -30,6 +30,28 @@ struct Collision {
     int material {-1};
 };
 
+enum class CollisionTestType {
+    Elevation,
+    LineOfSight,
+    Walk
+};
+
+/**
+ * Single query of a batched collision test, see ISceneGraph::testCollisions.
+ * Arguments mirror those of testElevation, testLineOfSight and testWalk.
+ */
+struct CollisionQuery {
+    CollisionTestType type {CollisionTestType::LineOfSight};
+    glm::vec3 origin {0.0f}; // only X and Y are used for elevation tests
+    glm::vec3 dest {0.0f};   // unused for elevation tests
+    const IUser *excludeUser {nullptr};
+};
+
+struct CollisionResult {
+    bool collided {false};
+    Collision collision;
+};
+
 } // namespace scene
 
 } // namespace reone
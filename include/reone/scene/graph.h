@@ -34,6 +34,8 @@
 
 namespace reone {
 
+class IThreadPool;
+
 namespace graphics {
 
 struct GraphicsOptions;
@@ -58,6 +60,8 @@ struct ResourceServices;
 namespace scene {
 
 struct Collision;
+struct CollisionQuery;
+struct CollisionResult;
 
 class IAnimationEventListener;
 class IRenderPass;
@@ -67,7 +71,11 @@ class ISceneGraph {
 public:
     virtual ~ISceneGraph() = default;
 
-    virtual void update(float dt) = 0;
+    /**
+     * @param threadPool if not null, model roots are updated concurrently on
+     *                   worker threads of this pool
+     */
+    virtual void update(float dt, IThreadPool *threadPool = nullptr) = 0;
     virtual graphics::Texture &render(const glm::ivec2 &dim) = 0;
 
     virtual void clear() = 0;
@@ -76,6 +84,19 @@ public:
     virtual bool testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest, Collision &outCollision) const = 0;
     virtual bool testWalk(const glm::vec3 &origin, const glm::vec3 &dest, const IUser *excludeUser, Collision &outCollision) const = 0;
 
+    /**
+     * Runs many collision tests at once. Walkmeshes are culled once per batch
+     * and every walkmesh is tested against all queries near it in turn.
+     *
+     * @param outResults receives one result per query, in order of queries
+     * @param threadPool if not null, large batches are split between
+     *                   worker threads of this pool
+     */
+    virtual void testCollisions(
+        const std::vector<CollisionQuery> &queries,
+        std::vector<CollisionResult> &outResults,
+        IThreadPool *threadPool = nullptr) const = 0;
+
     virtual ModelSceneNode *pickModelAt(int x, int y, IUser *except = nullptr) const = 0;
     virtual std::optional<std::reference_wrapper<ModelSceneNode>> pickModelRay(const glm::vec3 &origin, const glm::vec3 &dir) const = 0;
 
@@ -127,7 +148,6 @@ public:
     virtual std::shared_ptr<MeshSceneNode> newMesh(ModelSceneNode &model, graphics::ModelNode &modelNode) = 0;
     virtual std::shared_ptr<LightSceneNode> newLight(ModelSceneNode &model, graphics::ModelNode &modelNode) = 0;
     virtual std::shared_ptr<EmitterSceneNode> newEmitter(graphics::ModelNode &modelNode) = 0;
-    virtual std::shared_ptr<ParticleSceneNode> newParticle(EmitterSceneNode &emitter) = 0;
     virtual std::shared_ptr<GrassSceneNode> newGrass(GrassProperties properties, graphics::ModelNode &aabbNode) = 0;
     virtual std::shared_ptr<GrassClusterSceneNode> newGrassCluster(GrassSceneNode &grass) = 0;
 
@@ -151,7 +171,7 @@ public:
         _resourceSvc(resourceSvc) {
     }
 
-    void update(float dt) override;
+    void update(float dt, IThreadPool *threadPool = nullptr) override;
     graphics::Texture &render(const glm::ivec2 &dim) override;
 
     void renderShadows(IRenderPass &pass);
@@ -244,12 +264,17 @@ public:
     bool testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest, Collision &outCollision) const override;
     bool testWalk(const glm::vec3 &origin, const glm::vec3 &dest, const IUser *excludeUser, Collision &outCollision) const override;
 
+    void testCollisions(
+        const std::vector<CollisionQuery> &queries,
+        std::vector<CollisionResult> &outResults,
+        IThreadPool *threadPool = nullptr) const override;
+
     ModelSceneNode *pickModelAt(int x, int y, IUser *except = nullptr) const override;
     std::optional<std::reference_wrapper<ModelSceneNode>> pickModelRay(const glm::vec3 &origin, const glm::vec3 &dir) const override;
 
     void setWalkableSurfaces(std::set<uint32_t> surfaces) override { _walkableSurfaces = std::move(surfaces); }
-    void setWalkcheckSurfaces(std::set<uint32_t> surfaces) override { _walkcheckSurfaces = std::move(surfaces); }
-    void setLineOfSightSurfaces(std::set<uint32_t> surfaces) override { _lineOfSightSurfaces = std::move(surfaces); }
+    void setWalkcheckSurfaces(std::set<uint32_t> surfaces) override { _walkcheckSurfaceMask = graphics::Walkmesh::surfaceMask(surfaces); }
+    void setLineOfSightSurfaces(std::set<uint32_t> surfaces) override { _lineOfSightSurfaceMask = graphics::Walkmesh::surfaceMask(surfaces); }
 
     // END Collision detection and object picking
 
@@ -266,7 +291,6 @@ public:
     std::shared_ptr<LightSceneNode> newLight(ModelSceneNode &model, graphics::ModelNode &modelNode) override;
 
     std::shared_ptr<EmitterSceneNode> newEmitter(graphics::ModelNode &modelNode) override;
-    std::shared_ptr<ParticleSceneNode> newParticle(EmitterSceneNode &emitter) override;
 
     std::shared_ptr<GrassSceneNode> newGrass(GrassProperties properties, graphics::ModelNode &aabbNode) override;
     std::shared_ptr<GrassClusterSceneNode> newGrassCluster(GrassSceneNode &grass) override;
@@ -346,11 +370,30 @@ private:
     // Surfaces
 
     std::set<uint32_t> _walkableSurfaces;
-    std::set<uint32_t> _walkcheckSurfaces;
-    std::set<uint32_t> _lineOfSightSurfaces;
+    uint64_t _walkcheckSurfaceMask {0};
+    uint64_t _lineOfSightSurfaceMask {0};
 
     // END Surfaces
 
+    // Collision detection
+
+    struct RayTest {
+        const CollisionQuery *query {nullptr};
+        glm::vec3 origin {0.0f};
+        glm::vec3 dir {0.0f};
+        float maxDistance {0.0f};
+        float minDistance {std::numeric_limits<float>::max()};
+        bool walkable {false};
+    };
+
+    RayTest prepareRayTest(const CollisionQuery &query) const;
+
+    void testWalkmesh(WalkmeshSceneNode &root, RayTest &test, Collision &outCollision) const;
+    bool isRayTestCollided(const RayTest &test) const;
+
+    // END Collision detection
+
+    void updateModelRoots(float dt, IThreadPool *threadPool);
     void cullRoots();
 
     void refresh();
@@ -19,6 +19,7 @@
 
 #include "reone/system/timer.h"
 
+#include "../render/pass.h"
 #include "modelnode.h"
 
 namespace reone {
@@ -26,7 +27,6 @@ namespace reone {
 namespace scene {
 
 class ModelSceneNode;
-class ParticleSceneNode;
 
 class EmitterSceneNode : public ModelNodeSceneNode {
 public:
@@ -53,6 +53,13 @@ public:
 
     void detonate();
 
+    int numParticles() const { return static_cast<int>(_particles.size()); }
+
+    /**
+     * @return particle position in emitter space
+     */
+    const glm::vec3 &particlePosition(int index) const { return _particles.positions[index]; }
+
     float getParticleSize(float time) const { return _particleSize.get(time); };
     glm::vec3 getColor(float time) const { return _color.get(time); };
     float getAlpha(float time) const { return _alpha.get(time); };
@@ -98,16 +105,44 @@ private:
     float _lightningScale {0.0f};
     int _lightningSubDiv {0};
 
+    /**
+     * Emitter particles, stored as a structure of arrays. Expired particles
+     * are replaced with the last particle.
+     */
+    struct Particles {
+        std::vector<glm::vec3> positions; /**< emitter space */
+        std::vector<glm::vec3> velocities;
+        std::vector<glm::vec3> dirs; /**< world space, used in Linked render mode */
+        std::vector<glm::vec2> sizes;
+        std::vector<glm::vec4> colors; /**< RGB and alpha */
+        std::vector<float> lifetimes;
+        std::vector<float> animLengths;
+        std::vector<int> frames;
+
+        size_t size() const { return positions.size(); }
+        bool empty() const { return positions.empty(); }
+
+        void reserve(size_t capacity);
+        void clear();
+        void push(const glm::vec3 &position, const glm::vec3 &velocity, float animLength, int frame);
+        void swapRemove(size_t index);
+    };
+
     float _birthInterval {0.0f};
     Timer _birthTimer;
     bool _spawned {false};
 
-    std::deque<ParticleSceneNode *> _particlePool; /**< pre-allocated pool of particles */
+    size_t _maxParticles {0};
+    Particles _particles;
+    std::vector<ParticleInstance> _instances; /**< reused between frames */
 
     void spawnParticles(float dt);
-    void removeExpiredParticles(float dt);
+    void removeExpiredParticles();
     void doSpawnParticle();
     void spawnLightningParticles();
+
+    void updateParticles(float dt);
+    void updateParticleAnimation(size_t index);
 };
 
 } // namespace scene
@@ -56,6 +56,13 @@ public:
 
     bool isTransparent() const;
 
+    /**
+     * Computes bone matrices of this skin mesh from current transforms of
+     * bone nodes. Bone matrices are recomputed on render only when transform
+     * of this node has since changed.
+     */
+    void prepareBones();
+
     ModelSceneNode &model() { return _model; }
     const ModelSceneNode &model() const { return _model; }
 
@@ -103,6 +110,9 @@ private:
 
     float _windTime {0.0f};
 
+    std::vector<glm::mat4> _bones;
+    bool _bonesPrepared {false};
+
     void initTextures();
     void initDanglyMesh();
 
@@ -110,6 +120,8 @@ private:
 
     bool isLightingEnabled() const;
 
+    void onAbsoluteTransformChanged() override;
+
     // Animation
 
     void updateUVAnimation(float dt, const graphics::ModelNode::TriangleMesh &mesh);
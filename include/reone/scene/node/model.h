@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "reone/graphics/animationbinding.h"
 #include "reone/graphics/lipanimation.h"
 #include "reone/graphics/model.h"
 #include "reone/graphics/types.h"
@@ -70,7 +71,9 @@ public:
         graphics::LipAnimation *lipAnim;
         AnimationProperties properties;
         float time {0.0f};
-        std::unordered_map<uint16_t, AnimationState> stateByNodeNumber;
+        const graphics::AnimationBinding *binding {nullptr};
+        std::vector<graphics::AnimationBinding::Cursors> cursors; /**< keyframe cursors per bound node */
+        std::vector<AnimationState> states;                       /**< animation states per model node index */
         bool freeze {false};     /**< channel time is not to be updated */
         bool transition {false}; /**< when computing states, use animation transition time as channel time */
         bool finished {false};   /**< finished channels will be erased from the queue */
@@ -103,6 +106,20 @@ public:
 
     void update(float dt) override;
 
+    /**
+     * Same as update, except that animation events of this model and of models
+     * attached to it are queued instead of being signalled. Only touches state
+     * of this model and its attachments, so that different model roots can be
+     * updated concurrently.
+     */
+    void updateDeferringEvents(float dt);
+
+    /**
+     * Signals animation events queued by updateDeferringEvents, including
+     * those of attached models.
+     */
+    void signalPendingEvents();
+
     void renderLeafs(IRenderPass &pass, const std::vector<SceneNode *> &leafs) override;
     void renderAABB(IRenderPass &pass);
 
@@ -123,6 +140,7 @@ public:
     void setMainTexture(graphics::Texture *texture);
     void setEnvironmentMap(graphics::Texture *texture);
     void setPickable(bool pickable) { _pickable = pickable; }
+    void setAnimationEventListener(IAnimationEventListener *listener) { _animEventListener = listener; }
 
     // Animation
 
@@ -163,6 +181,8 @@ private:
     std::unordered_map<uint16_t, ModelNodeSceneNode *> _nodeByNumber;
     std::unordered_map<std::string, ModelNodeSceneNode *> _nodeByName;
     std::unordered_map<std::string, SceneNode *> _attachments;
+    std::vector<ModelNodeSceneNode *> _nodeByIndex; /**< scene nodes per model node index */
+    std::vector<MeshSceneNode *> _skinMeshes;
 
     // END Lookups
 
@@ -170,6 +190,8 @@ private:
 
     std::deque<AnimationChannel> _animChannels;
     AnimationBlendMode _animBlendMode {AnimationBlendMode::Single};
+    std::vector<std::string> _pendingEvents;
+    std::vector<ModelSceneNode *> _nestedWithEvents; /**< nested models with queued events */
 
     // END Animation
 
@@ -180,13 +202,15 @@ private:
     // END Flags
 
     void buildNodeTree(graphics::ModelNode &node, SceneNode &parent);
+    void indexNodes();
 
     // Animation
 
     void updateAnimations(float dt);
+    void bindAnimationChannel(AnimationChannel &channel);
     void updateAnimationChannel(AnimationChannel &channel, float dt);
-    void computeAnimationStates(AnimationChannel &channel, float time, const graphics::ModelNode &modelNode);
-    void applyAnimationStates(const graphics::ModelNode &modelNode);
+    void computeAnimationStates(AnimationChannel &channel, float time);
+    void applyAnimationStates();
 
     static AnimationBlendMode getAnimationBlendMode(int flags);
 
@@ -29,7 +29,6 @@ enum class SceneNodeType {
     Mesh,
     Light,
     Emitter,
-    Particle,
     Grass,
     GrassCluster,
     Walkmesh,
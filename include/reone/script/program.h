@@ -29,6 +29,19 @@ struct Instruction {
     uint32_t nextOffset {0xffffffff};
     std::string strValue;
 
+    // Resolved by ScriptProgram::link
+
+    int nextIdx {-1};
+    int jumpIdx {-1};
+
+    // END Resolved by ScriptProgram::link
+
+    // Resolved by ScriptVerifier
+
+    bool typesVerified {false};
+
+    // END Resolved by ScriptVerifier
+
     union {
         int jumpOffset {0};
         int stackOffset;
@@ -86,11 +99,28 @@ public:
 
     void add(Instruction instr);
 
+    /**
+     * Resolves successors and jump targets of all instructions into indices,
+     * so that programs can be executed without offset lookups.
+     */
+    void link();
+
+    bool isLinked() const { return _linked; }
+    bool isVerified() const { return _verified; }
+
     const std::string &name() const { return _name; }
     uint32_t length() const { return _length; }
-    const std::vector<Instruction> instructions() const { return _instructions; }
+
+    /**
+     * Maximum stack size of a verified program, including frames of nested
+     * subroutine calls along the deepest call chain, or 0 if not verified.
+     */
+    int maxStackSize() const { return _maxStackSize; }
+
+    const std::vector<Instruction> &instructions() const { return _instructions; }
 
     const Instruction &getInstruction(uint32_t offset) const;
+    int getInstructionIndex(uint32_t offset) const;
 
     void setLength(uint32_t length) { _length = length; }
 
@@ -100,6 +130,11 @@ private:
     uint32_t _length {13};
     std::vector<Instruction> _instructions;
     std::unordered_map<uint32_t, int> _insIdxByOffset;
+    bool _linked {false};
+    bool _verified {false};
+    int _maxStackSize {0};
+
+    friend class ScriptVerifier;
 };
 
 } // namespace script
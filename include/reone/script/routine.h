@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "reone/system/span.h"
+
 #include "types.h"
 #include "variable.h"
 
@@ -35,7 +37,7 @@ public:
         VariableType retType,
         Variable defRetValue,
         std::vector<VariableType> argTypes,
-        std::function<Variable(const std::vector<Variable> &, ExecutionContext &ctx)> fn) :
+        std::function<Variable(Span<const Variable>, ExecutionContext &ctx)> fn) :
         _name(std::move(name)),
         _returnType(retType),
         _defaultReturnValue(std::move(defRetValue)),
@@ -43,7 +45,7 @@ public:
         _func(std::move(fn)) {
     }
 
-    virtual Variable invoke(const std::vector<Variable> &args, ExecutionContext &ctx);
+    virtual Variable invoke(Span<const Variable> args, ExecutionContext &ctx);
 
     int getArgumentCount() const;
     VariableType getArgumentType(int index) const;
@@ -56,7 +58,7 @@ private:
     VariableType _returnType {VariableType::Void};
     Variable _defaultReturnValue;
     std::vector<VariableType> _argumentTypes;
-    std::function<Variable(const std::vector<Variable> &, ExecutionContext &ctx)> _func;
+    std::function<Variable(Span<const Variable>, ExecutionContext &ctx)> _func;
 
     Variable onException(const std::string &msg, const std::exception &ex) const;
 };
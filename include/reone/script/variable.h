@@ -30,12 +30,13 @@ struct ExecutionContext;
 class EngineType;
 class ScriptObject;
 
+/**
+ * Tagged script value. Ints, floats and objects are stored inline, whereas
+ * strings, vectors, engine types and actions live in a shared immutable
+ * payload, which keeps stack copies down to 16 bytes and a reference count.
+ */
 struct Variable {
     VariableType type {VariableType::Void};
-    std::string strValue;
-    glm::vec3 vecValue {0.0f};
-    std::shared_ptr<EngineType> engineType;
-    std::shared_ptr<ExecutionContext> context;
 
     union {
         int32_t intValue {0};
@@ -43,15 +44,24 @@ struct Variable {
         float floatValue;
     };
 
+    const std::string &strValue() const;
+    glm::vec3 vecValue() const;
+    const std::shared_ptr<EngineType> &engineType() const;
+    const std::shared_ptr<ExecutionContext> &context() const;
+
     const std::string toString() const;
 
     bool operator==(const Variable &other) const {
-        return type == other.type &&
-               strValue == other.strValue &&
-               vecValue == other.vecValue &&
-               engineType == other.engineType &&
-               context == other.context &&
-               intValue == other.intValue;
+        if (type != other.type || intValue != other.intValue) {
+            return false;
+        }
+        if (_payload == other._payload) {
+            return true;
+        }
+        return strValue() == other.strValue() &&
+               vecValue() == other.vecValue() &&
+               engineType() == other.engineType() &&
+               context() == other.context();
     }
 
     bool operator!=(const Variable &other) const {
@@ -80,8 +90,22 @@ struct Variable {
     static Variable ofLocation(std::shared_ptr<EngineType> engineType);
     static Variable ofTalent(std::shared_ptr<EngineType> engineType);
     static Variable ofAction(std::shared_ptr<ExecutionContext> context);
+
+private:
+    struct Payload : boost::intrusive_ref_counter<Payload> {
+        std::string strValue;
+        glm::vec3 vecValue {0.0f};
+        std::shared_ptr<EngineType> engineType;
+        std::shared_ptr<ExecutionContext> context;
+    };
+
+    boost::intrusive_ptr<Payload> _payload;
+
+    static Variable ofPayload(VariableType type, Payload payload);
 };
 
+static_assert(sizeof(Variable) <= 16, "Variable must fit into 16 bytes");
+
 } // namespace script
 
 } // namespace reone
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace script {
+
+class IRoutines;
+class ScriptProgram;
+
+/**
+ * Verifies bytecode of a linked script program ahead of execution.
+ *
+ * Simulates every subroutine once, tracking stack depth and types of stack
+ * slots. Validates jump targets and stack bounds, computes the maximum stack
+ * size of the program and marks instructions whose operand types are known
+ * to be correct, so that the virtual machine can skip checking them.
+ */
+class ScriptVerifier {
+public:
+    ScriptVerifier(IRoutines &routines) :
+        _routines(routines) {
+    }
+
+    /**
+     * @throws ValidationException if program cannot be verified
+     */
+    void verify(ScriptProgram &program);
+
+private:
+    struct Frame {
+        int depth {0};         /**< stack size relative to subroutine entry */
+        int bottom {0};        /**< relative index of the first slot with a tracked type */
+        std::optional<int> bp; /**< relative index of the base pointer, if set in this subroutine */
+        std::vector<VariableType> slots;
+    };
+
+    struct Subroutine {
+        bool analyzing {false};
+        bool done {false};
+        bool returns {false};
+        bool ambiguousReturn {false};
+        int returnDepth {0};
+        int minDepth {0};
+        int maxDepth {0};
+        bool writesGlobals {false};
+        std::map<int, VariableType> writesBelowEntry;
+    };
+
+    IRoutines &_routines;
+
+    ScriptProgram *_program {nullptr};
+    std::vector<int> _owners;
+    std::vector<bool> _joins;
+    std::vector<bool> _typesVerified;
+    std::unordered_map<int, Subroutine> _subroutines;
+    std::unordered_map<int, Frame> _joinFrames;
+    std::vector<std::pair<int, int>> _resumeEntries;
+
+    const Subroutine &analyze(int entryIdx);
+    bool step(int entryIdx, int &insIdx, Frame &frame, Subroutine &sub, std::vector<std::pair<int, Frame>> &pending);
+
+    bool merge(int insIdx, Frame &frame);
+    void ret(const Frame &frame, Subroutine &sub);
+
+    VariableType peek(const Frame &frame, int index) const;
+    void poke(Frame &frame, Subroutine &sub, int index, VariableType type);
+    void push(Frame &frame, Subroutine &sub, VariableType type);
+    VariableType pop(Frame &frame, Subroutine &sub);
+    bool pop(Frame &frame, Subroutine &sub, VariableType expected);
+    void write(Subroutine &sub, int index, VariableType type);
+    void touch(Subroutine &sub, int index);
+};
+
+} // namespace script
+
+} // namespace reone
@@ -35,6 +35,7 @@ class ScriptProgram;
 class VirtualMachine : boost::noncopyable {
 public:
     VirtualMachine(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context);
+    ~VirtualMachine();
 
     int run();
 
@@ -48,16 +49,15 @@ public:
 private:
     std::shared_ptr<ScriptProgram> _program;
     std::unique_ptr<ExecutionContext> _context;
-    std::unordered_map<InstructionType, std::function<void(const Instruction &)>> _handlers;
     std::vector<Variable> _stack;
-    std::vector<uint32_t> _returnOffsets;
-    uint32_t _nextInstruction {0};
+    std::vector<int> _returnIndices;
+    std::vector<Variable> _args; /**< reused between ACTION instructions */
+    int _nextInstruction {0};
     int _globalCount {0};
+    bool _checkTypes {true};
     ExecutionState _savedState;
 
-    void registerHandler(InstructionType type, std::function<void(VirtualMachine *, const Instruction &)> handler) {
-        _handlers.insert(std::make_pair(type, std::bind(handler, this, std::placeholders::_1)));
-    }
+    void execute(const Instruction &ins);
 
     int getIntFromStack();
     float getFloatFromStack();
@@ -18,16 +18,24 @@
 #pragma once
 
 #include "reone/system/stream/input.h"
+#include "reone/system/stream/memoryinput.h"
 #include "reone/system/types.h"
 
 namespace reone {
 
+/**
+ * Reads primitive values and arrays of them from an input stream.
+ *
+ * When the stream is a MemoryInputStream, values are loaded directly from its
+ * buffer, bypassing virtual stream reads.
+ */
 class BinaryReader : boost::noncopyable {
 public:
     BinaryReader(
         IInputStream &stream,
         boost::endian::order endianess = boost::endian::order::little) :
         _stream(stream),
+        _memory(dynamic_cast<MemoryInputStream *>(&stream)),
         _endianess(endianess) {
     }
 
@@ -53,6 +61,14 @@ public:
     std::string readCString(int maxlen);
     ByteBuffer readBytes(int count);
 
+    /**
+     * Reads a string of fixed length without copying it, truncated at the
+     * first null character. Only supported for MemoryInputStream.
+     *
+     * @return view into the stream buffer
+     */
+    std::string_view readStringView(int len);
+
     std::string readStringAt(size_t off, int len) {
         return readAt<std::string>(off, [this, &len]() {
             return readString(len);
@@ -71,42 +87,20 @@ public:
         });
     }
 
-    std::vector<uint16_t> readUint16Array(int size) {
-        std::vector<uint16_t> elems;
-        elems.reserve(size);
-        for (int i = 0; i < size; ++i) {
-            elems.push_back(readUint16());
-        }
-        return elems;
-    }
-
-    std::vector<uint32_t> readUint32Array(int size) {
-        return readArray<uint32_t>(size, [this]() {
-            return readUint32();
-        });
-    }
+    std::vector<uint16_t> readUint16Array(int count);
+    std::vector<uint32_t> readUint32Array(int count);
+    std::vector<int32_t> readInt32Array(int count);
+    std::vector<float> readFloatArray(int count);
 
     std::vector<uint32_t> readUint32ArrayAt(size_t off, int count) {
-        return readArrayAt<uint32_t>(off, count, [this]() {
-            return readUint32();
-        });
-    }
-
-    std::vector<int32_t> readInt32Array(int count) {
-        return readArray<int32_t>(count, [this]() {
-            return readInt32();
-        });
-    }
-
-    std::vector<float> readFloatArray(int count) {
-        return readArray<float>(count, [this]() {
-            return readFloat();
+        return readAt<std::vector<uint32_t>>(off, [this, &count]() {
+            return readUint32Array(count);
         });
     }
 
     std::vector<float> readFloatArrayAt(size_t off, int count) {
-        return readArrayAt<float>(off, count, [this]() {
-            return readFloat();
+        return readAt<std::vector<float>>(off, [this, &count]() {
+            return readFloatArray(count);
         });
     }
 
@@ -118,8 +112,8 @@ public:
         return _stream.length();
     }
 
-    template <class T>
-    T readAt(size_t offset, std::function<T()> read) {
+    template <class T, class F>
+    T readAt(size_t offset, F &&read) {
         size_t pos = _stream.position();
         seek(offset);
         auto retval = read();
@@ -127,8 +121,8 @@ public:
         return retval;
     }
 
-    template <class T>
-    std::vector<T> readArray(int size, std::function<T()> read) {
+    template <class T, class F>
+    std::vector<T> readArray(int size, F &&read) {
         std::vector<T> array;
         array.reserve(size);
         for (int i = 0; i < size; ++i) {
@@ -137,8 +131,8 @@ public:
         return array;
     }
 
-    template <class T>
-    std::vector<T> readArrayAt(size_t off, int size, std::function<T()> read) {
+    template <class T, class F>
+    std::vector<T> readArrayAt(size_t off, int size, F &&read) {
         return readAt<std::vector<T>>(off, [this, &size, &read]() {
             return readArray<T>(size, read);
         });
@@ -146,7 +140,16 @@ public:
 
 private:
     IInputStream &_stream;
+    MemoryInputStream *_memory; /**< same as stream if it is a MemoryInputStream, nullptr otherwise */
     boost::endian::order _endianess;
+
+    void read(char *data, int len);
+
+    template <class T>
+    T readValue();
+
+    template <class T>
+    std::vector<T> readValueArray(int count);
 };
 
 } // namespace reone
@@ -26,6 +26,10 @@ public:
         _items.clear();
     }
 
+    bool contains(const Key &key) const {
+        return _items.count(key) > 0;
+    }
+
     std::shared_ptr<Value> getOrAdd(Key key, std::function<std::shared_ptr<Value>()> valueFactory) {
         auto it = _items.find(key);
         if (it != _items.end()) {
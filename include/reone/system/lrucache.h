@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Cache that holds at most the specified number of items, evicting least
+ * recently used items first. Not thread-safe.
+ */
+template <class Key, class Value>
+class LruCache : boost::noncopyable {
+public:
+    LruCache(size_t capacity) :
+        _capacity(capacity) {
+    }
+
+    void clear() {
+        _items.clear();
+        _itemByKey.clear();
+    }
+
+    bool contains(const Key &key) const {
+        return _itemByKey.count(key) > 0;
+    }
+
+    /**
+     * @return copy of the cached value, or of the value created by valueFactory
+     */
+    Value getOrAdd(const Key &key, std::function<Value()> valueFactory) {
+        auto it = _itemByKey.find(key);
+        if (it != _itemByKey.end()) {
+            _items.splice(_items.begin(), _items, it->second);
+            return it->second->second;
+        }
+        Value value = valueFactory();
+        if (_capacity == 0) {
+            return value;
+        }
+        if (_items.size() >= _capacity) {
+            _itemByKey.erase(_items.back().first);
+            _items.pop_back();
+        }
+        _items.emplace_front(key, value);
+        _itemByKey.emplace(key, _items.begin());
+        return value;
+    }
+
+    size_t size() const { return _items.size(); }
+    size_t capacity() const { return _capacity; }
+
+private:
+    using ItemList = std::list<std::pair<Key, Value>>;
+
+    size_t _capacity;
+
+    ItemList _items; /**< most recently used first */
+    std::unordered_map<Key, typename ItemList::iterator> _itemByKey;
+};
+
+} // namespace reone
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+class MemoryMappedFile : boost::noncopyable {
+public:
+    MemoryMappedFile(std::filesystem::path path) :
+        _path(std::move(path)) {
+    }
+
+    void init();
+
+    const char *data() const { return _data; }
+    size_t size() const { return _size; }
+
+    const std::filesystem::path &path() const { return _path; }
+
+private:
+    std::filesystem::path _path;
+
+    boost::interprocess::file_mapping _mapping;
+    boost::interprocess::mapped_region _region;
+
+    const char *_data {nullptr};
+    size_t _size {0};
+};
+
+} // namespace reone
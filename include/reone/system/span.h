@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Non-owning view over a contiguous sequence of objects.
+ */
+template <class T>
+class Span {
+public:
+    Span() = default;
+
+    Span(T *data, size_t size) :
+        _data(data),
+        _size(size) {
+    }
+
+    /**
+     * Views an lvalue container, e.g. std::vector or std::array, whose data
+     * pointer converts to T *. Temporaries are rejected, so that the span
+     * cannot outlive its storage.
+     */
+    template <
+        class Container,
+        class = std::enable_if_t<
+            !std::is_same_v<std::remove_cv_t<Container>, Span> &&
+            std::is_convertible_v<decltype(std::data(std::declval<Container &>())), T *>>>
+    Span(Container &container) :
+        _data(std::data(container)),
+        _size(std::size(container)) {
+    }
+
+    T *data() const { return _data; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    T *begin() const { return _data; }
+    T *end() const { return _data + _size; }
+
+    T &front() const { return _data[0]; }
+    T &back() const { return _data[_size - 1]; }
+
+    T &operator[](size_t index) const { return _data[index]; }
+
+    Span<T> subspan(size_t offset, size_t count) const {
+        return Span<T>(_data + offset, count);
+    }
+
+private:
+    T *_data {nullptr};
+    size_t _size {0};
+};
+
+} // namespace reone
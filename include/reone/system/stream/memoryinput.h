@@ -21,7 +21,7 @@
 
 namespace reone {
 
-class MemoryInputStream : public IInputStream {
+class MemoryInputStream final : public IInputStream {
 public:
     MemoryInputStream(std::string &str) :
         _data(!str.empty() ? &str[0] : nullptr),
@@ -33,6 +33,11 @@ public:
         _length(bytes.size()) {
     }
 
+    MemoryInputStream(const char *data, size_t length) :
+        _data(data),
+        _length(length) {
+    }
+
     void seek(int64_t off, SeekOrigin origin) override {
         if (origin == SeekOrigin::Begin) {
             _position = off;
@@ -54,11 +59,32 @@ public:
 
     int read(char *buf, int length) override;
 
+    /**
+     * Advances position by length bytes without copying them.
+     *
+     * @return pointer to the skipped bytes, or nullptr if fewer than length bytes are available
+     */
+    const char *consume(size_t length) {
+        if (_position > _length || _length - _position < length) {
+            return nullptr;
+        }
+        const char *data = _data + _position;
+        _position += length;
+        return data;
+    }
+
+    /**
+     * @return number of bytes between current position and end of stream
+     */
+    size_t available() const {
+        return _position < _length ? _length - _position : 0;
+    }
+
     size_t position() override { return _position; }
     size_t length() override { return _length; }
 
 private:
-    char *_data;
+    const char *_data;
     size_t _length;
 
     size_t _position {0};
@@ -104,4 +104,21 @@ private:
     }
 };
 
+/**
+ * Calls func for consecutive ranges [begin, end) of up to chunkSize items,
+ * that together cover [0, count). Chunks are taken by whichever thread is
+ * free: up to maxTasks - 1 tasks are enqueued to the thread pool, and the
+ * calling thread takes chunks too, so that calling this from a worker
+ * thread of the same pool does not deadlock. Returns when all chunks are
+ * done.
+ *
+ * @param threadPool if null, or if there is only one chunk, all chunks
+ *                   are run on the calling thread
+ */
+void parallelFor(IThreadPool *threadPool,
+                 int count,
+                 int chunkSize,
+                 int maxTasks,
+                 const std::function<void(int begin, int end)> &func);
+
 } // namespace reone
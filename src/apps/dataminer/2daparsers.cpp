@@ -19,7 +19,6 @@
 
 #include "reone/resource/container/keybif.h"
 #include "reone/resource/format/2dareader.h"
-#include "reone/system/checkutil.h"
 #include "reone/system/fileutil.h"
 #include "reone/system/stream/fileoutput.h"
 #include "reone/system/stream/memoryinput.h"
@@ -283,11 +282,10 @@ void generate2DAParsers(const std::filesystem::path &k1dir,
         if (twoDA->getRowCount() == 0) {
             continue;
         }
-        for (const auto &row : twoDA->rows()) {
-            for (size_t col = 0; col < twoDA->getColumnCount(); ++col) {
+        for (int row = 0; row < twoDA->getRowCount(); ++row) {
+            for (int col = 0; col < twoDA->getColumnCount(); ++col) {
                 auto &column = nameToColumn.at(twoDA->columns()[col]);
-                checkGreater("row values count", row.values.size(), col);
-                const auto &value = row.values[col];
+                const auto &value = twoDA->getCell(row, col);
                 if (value.empty()) {
                     column.optional = true;
                     continue;
@@ -184,7 +184,8 @@ static void writeSchemaHeaderFile(const std::string &topStructName,
     writer.write("#pragma once\n\n");
     writer.write("namespace reone {\n\n");
     writer.write("namespace resource {\n\n");
-    writer.write("class Gff;\n\n");
+    writer.write("class Gff;\n");
+    writer.write("class GffView;\n\n");
     writer.write("namespace generated {\n\n");
     for (auto &[_, schemaStruct] : structs) {
         writeStruct(*schemaStruct, writer);
@@ -192,6 +193,7 @@ static void writeSchemaHeaderFile(const std::string &topStructName,
     for (auto &[_, schemaStruct] : structs) {
         if (schemaStruct->top) {
             writer.write(str(boost::format("%1% parse%1%(const Gff &gff);\n") % topStructName));
+            writer.write(str(boost::format("%1% parse%1%(const GffView &gff);\n") % topStructName));
         }
     }
     writer.write("\n");
@@ -270,6 +272,95 @@ static void writeParseFunction(const SchemaStruct &schemaStruct, TextWriter &wri
     writer.write("}\n\n");
 }
 
+static void writeViewParseFunction(const SchemaStruct &schemaStruct, TextWriter &writer) {
+    std::vector<const SchemaField *> fields;
+    for (auto &[_, field] : schemaStruct.fields) {
+        if (field.type != Gff::FieldType::List || field.subStruct) {
+            fields.push_back(&field);
+        }
+    }
+    if (schemaStruct.top) {
+        writer.write(str(boost::format("%1% parse%1%(const GffView &gff) {\n") % schemaStruct.name));
+    } else {
+        writer.write(str(boost::format("static %1% parse%1%(const GffView &gff) {\n") % schemaStruct.name));
+    }
+    writer.write(str(boost::format("%s%s strct;\n") % kIndent % schemaStruct.name));
+    if (!fields.empty()) {
+        // Labels are resolved to members once per document, then fields are
+        // visited in a single pass over the struct
+        writer.write(str(boost::format("%sstatic const GffSchema schema {\n") % kIndent));
+        for (auto &field : fields) {
+            writer.write(str(boost::format("%1%%1%\"%2%\",\n") % kIndent % field->name));
+        }
+        writer.write(str(boost::format("%s};\n") % kIndent));
+        writer.write(str(boost::format("%sgff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {\n") % kIndent));
+        writer.write(str(boost::format("%1%%1%switch (member) {\n") % kIndent));
+        auto caseIndent = kIndent + kIndent + kIndent;
+        for (size_t i = 0; i < fields.size(); ++i) {
+            auto &field = *fields[i];
+            writer.write(str(boost::format("%1%%1%case %2%:\n") % kIndent % i));
+            switch (field.type) {
+            case Gff::FieldType::Byte:
+            case Gff::FieldType::Word:
+            case Gff::FieldType::Dword:
+                writer.write(str(boost::format("%1%strct.%2% = field.getUint();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Char:
+            case Gff::FieldType::Short:
+            case Gff::FieldType::Int:
+            case Gff::FieldType::StrRef:
+                writer.write(str(boost::format("%1%strct.%2% = field.getInt();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Dword64:
+                writer.write(str(boost::format("%1%strct.%2% = field.readUint64();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Int64:
+                writer.write(str(boost::format("%1%strct.%2% = field.readInt64();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Float:
+                writer.write(str(boost::format("%1%strct.%2% = field.getFloat();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Double:
+                writer.write(str(boost::format("%1%strct.%2% = field.getDouble();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::CExoString:
+            case Gff::FieldType::ResRef:
+                writer.write(str(boost::format("%1%strct.%2% = field.getString();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::CExoLocString:
+                writer.write(str(boost::format("%1%strct.%2% = std::make_pair(field.getInt(), field.getString());\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Void:
+                writer.write(str(boost::format("%1%strct.%2% = field.getData();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Struct:
+                writer.write(str(boost::format("%1%if (auto item = field.getStruct()) {\n") % caseIndent));
+                writer.write(str(boost::format("%1%%2%strct.%3% = parse%4%(item);\n") % caseIndent % kIndent % field.cppName % field.subStruct->name));
+                writer.write(str(boost::format("%1%}\n") % caseIndent));
+                break;
+            case Gff::FieldType::List:
+                writer.write(str(boost::format("%1%for (auto &item : field.getList()) {\n") % caseIndent));
+                writer.write(str(boost::format("%1%%2%strct.%3%.push_back(parse%4%(item));\n") % caseIndent % kIndent % field.cppName % field.subStruct->name));
+                writer.write(str(boost::format("%1%}\n") % caseIndent));
+                break;
+            case Gff::FieldType::Orientation:
+                writer.write(str(boost::format("%1%strct.%2% = field.getOrientation();\n") % caseIndent % field.cppName));
+                break;
+            case Gff::FieldType::Vector:
+                writer.write(str(boost::format("%1%strct.%2% = field.getVector();\n") % caseIndent % field.cppName));
+                break;
+            default:
+                throw std::logic_error("Invalid field type: " + std::to_string(static_cast<int>(field.type)));
+            }
+            writer.write(str(boost::format("%1%break;\n") % caseIndent));
+        }
+        writer.write(str(boost::format("%1%%1%}\n") % kIndent));
+        writer.write(str(boost::format("%s});\n") % kIndent));
+    }
+    writer.write(str(boost::format("%sreturn strct;\n") % kIndent));
+    writer.write("}\n\n");
+}
+
 static void writeSchemaImplFile(const std::vector<std::pair<int, SchemaStruct *>> &structs,
                                 const std::string &schemaHeaderFilename,
                                 const std::filesystem::path &path) {
@@ -278,13 +369,17 @@ static void writeSchemaImplFile(const std::vector<std::pair<int, SchemaStruct *>
     writer.write(kCopyrightNotice);
     writer.write("\n\n");
     writer.write(str(boost::format(kIncludeFormat + "\n\n") % schemaHeaderFilename));
-    writer.write(str(boost::format(kIncludeFormat + "\n\n") % "reone/resource/gff.h"));
+    writer.write(str(boost::format(kIncludeFormat + "\n") % "reone/resource/gff.h"));
+    writer.write(str(boost::format(kIncludeFormat + "\n\n") % "reone/resource/gffview.h"));
     writer.write("namespace reone {\n\n");
     writer.write("namespace resource {\n\n");
     writer.write("namespace generated {\n\n");
     for (auto &[_, schemaStruct] : structs) {
         writeParseFunction(*schemaStruct, writer);
     }
+    for (auto &[_, schemaStruct] : structs) {
+        writeViewParseFunction(*schemaStruct, writer);
+    }
     writer.write("} // namespace generated\n\n");
     writer.write("} // namespace resource\n\n");
     writer.write("} // namespace reone\n");
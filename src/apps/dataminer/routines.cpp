@@ -249,7 +249,7 @@ static void writeReoneRoutineInitArgExpr(int idx,
 static void writeReoneRoutineImpl(const Function &func,
                                   const std::map<std::string, Constant> &constants,
                                   TextWriter &code) {
-    code.write(str(boost::format("static Variable %s(const std::vector<Variable> &args, const RoutineContext &ctx) {\n") % func.name));
+    code.write(str(boost::format("static Variable %s(Span<const Variable> args, const RoutineContext &ctx) {\n") % func.name));
     if (!func.args.empty()) {
         code.write(kIndent + "// Load\n");
     }
@@ -65,6 +65,7 @@ void Engine::init() {
         _options.game.path,
         _options.graphics,
         _options.audio,
+        *_systemModule,
         *_graphicsModule,
         *_audioModule,
         *_scriptModule);
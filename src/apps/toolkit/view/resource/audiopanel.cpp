@@ -23,6 +23,8 @@ using namespace reone::audio;
 
 namespace reone {
 
+static constexpr int kPositionSliderMax = 1000;
+
 AudioResourcePanel::AudioResourcePanel(AudioResourceViewModel &viewModel,
                                        wxWindow *parent) :
     wxPanel(parent),
@@ -35,14 +37,17 @@ AudioResourcePanel::AudioResourcePanel(AudioResourceViewModel &viewModel,
 
 void AudioResourcePanel::InitControls() {
     m_stopAudioBtn = new wxButton(this, wxID_ANY, "Stop");
+    m_positionSlider = new wxSlider(this, wxID_ANY, 0, 0, kPositionSliderMax);
 
     auto sizer = new wxBoxSizer(wxVERTICAL);
     sizer->Add(m_stopAudioBtn);
+    sizer->Add(m_positionSlider, wxSizerFlags(0).Expand());
     SetSizer(sizer);
 }
 
 void AudioResourcePanel::BindEvents() {
     m_stopAudioBtn->Bind(wxEVT_BUTTON, &AudioResourcePanel::OnStopAudioCommand, this);
+    m_positionSlider->Bind(wxEVT_SLIDER, &AudioResourcePanel::OnPositionSliderCommand, this);
 }
 
 void AudioResourcePanel::BindViewModel() {
@@ -51,6 +56,7 @@ void AudioResourcePanel::BindViewModel() {
             m_audioSource = std::make_unique<AudioSource>(stream);
             m_audioSource->init();
             m_audioSource->play();
+            m_positionSlider->SetValue(0);
             wxWakeUpIdle();
         } else {
             m_audioSource.reset();
@@ -65,4 +71,12 @@ void AudioResourcePanel::OnStopAudioCommand(wxCommandEvent &event) {
     }
 }
 
+void AudioResourcePanel::OnPositionSliderCommand(wxCommandEvent &event) {
+    if (m_audioSource) {
+        float position = event.GetInt() / static_cast<float>(kPositionSliderMax);
+        m_audioSource->seek(position * m_audioSource->duration());
+        wxWakeUpIdle();
+    }
+}
+
 } // namespace reone
@@ -47,6 +47,7 @@ private:
     AudioResourceViewModel &m_viewModel;
 
     wxButton *m_stopAudioBtn {nullptr};
+    wxSlider *m_positionSlider {nullptr};
 
     std::unique_ptr<audio::AudioSource> m_audioSource;
 
@@ -55,6 +56,7 @@ private:
     void BindViewModel();
 
     void OnStopAudioCommand(wxCommandEvent &event);
+    void OnPositionSliderCommand(wxCommandEvent &event);
 };
 
 } // namespace reone
@@ -110,7 +110,7 @@ ResourceExplorerViewModel::ResourceExplorerViewModel() {
     _graphicsModule = std::make_unique<GraphicsModule>(_graphicsOpt);
     _audioModule = std::make_unique<AudioModule>(_audioOpt);
     _scriptModule = std::make_unique<ScriptModule>();
-    _resourceModule = std::make_unique<ResourceModule>(_gameId, _resourcesPath, _graphicsOpt, _audioOpt, *_graphicsModule, *_audioModule, *_scriptModule);
+    _resourceModule = std::make_unique<ResourceModule>(_gameId, _resourcesPath, _graphicsOpt, _audioOpt, *_systemModule, *_graphicsModule, *_audioModule, *_scriptModule);
     _sceneModule = std::make_unique<SceneModule>(_graphicsOpt, *_resourceModule, *_graphicsModule, *_audioModule);
 
     _imageResViewModel = std::make_unique<ImageResourceViewModel>();
@@ -174,10 +174,9 @@ void ResourceExplorerViewModel::openResource(const ResourceId &id, IInputStream
         }
         auto rows = std::vector<std::vector<std::string>>();
         for (int i = 0; i < twoDa->getRowCount(); ++i) {
-            auto &row = twoDa->rows()[i];
             auto values = std::vector<std::string>();
-            for (auto &value : row.values) {
-                values.push_back(value);
+            for (int j = 0; j < twoDa->getColumnCount(); ++j) {
+                values.push_back(twoDa->getCell(i, j));
             }
             rows.push_back(std::move(values));
         }
@@ -207,7 +206,7 @@ void ResourceExplorerViewModel::openResource(const ResourceId &id, IInputStream
 
         auto rows = std::vector<std::vector<std::string>>();
         for (int i = 0; i < tlk->getStringCount(); ++i) {
-            auto &str = tlk->getString(i);
+            auto str = tlk->getString(i);
             auto cleanedText = boost::replace_all_copy(str.text, "\n", "\\n");
             auto values = std::vector<std::string>();
             values.push_back(cleanedText);
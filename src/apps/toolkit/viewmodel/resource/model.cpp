@@ -83,6 +83,8 @@ void ModelResourceViewModel::openModel(const ResourceId &id, IInputStream &mdl)
 }
 
 void ModelResourceViewModel::update3D() {
+    _resourceSvc.textures().uploadPending();
+
     auto ticks = _systemSvc.clock().millis();
     if (_lastTicks == 0) {
         _lastTicks = ticks;
@@ -22,10 +22,17 @@ namespace reone {
 namespace audio {
 
 void AudioClip::add(Frame &&frame) {
-    _duration += frame.samples.size() / frame.stride() / static_cast<float>(frame.sampleRate);
+    _duration += frame.duration();
     _frames.push_back(frame);
 }
 
+std::unique_ptr<IAudioDecoder> AudioClip::openDecoder() const {
+    if (!_decoderFactory) {
+        throw std::logic_error("Audio clip is not streaming");
+    }
+    return _decoderFactory();
+}
+
 int AudioClip::getFrameCount() const {
     return static_cast<int>(_frames.size());
 }
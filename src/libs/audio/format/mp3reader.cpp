@@ -24,21 +24,154 @@ namespace reone {
 
 namespace audio {
 
-static inline int scale(mad_fixed_t sample) {
-    // round
-    sample += (1L << (MAD_F_FRACBITS - 16));
-
-    // clip
-    if (sample >= MAD_F_ONE) {
-        sample = MAD_F_ONE - 1;
-    } else if (sample < -MAD_F_ONE) {
-        sample = -MAD_F_ONE;
-    }
+// Layer III bit reservoir may reference main data of preceding frames, so
+// decoding after a seek starts this many frames early
+static constexpr int kSeekPrerollFrames = 2;
+
+static constexpr mad_fixed_t kRound = 1L << (MAD_F_FRACBITS - 16);
+
+static inline int16_t scale(mad_fixed_t sample) {
+    // round and clip
+    sample = std::min(std::max(sample + kRound, -MAD_F_ONE), MAD_F_ONE - 1);
 
     // quantize
-    return sample >> (MAD_F_FRACBITS + 1 - 16);
+    return static_cast<int16_t>(sample >> (MAD_F_FRACBITS + 1 - 16));
+}
+
+// Branch-free, so that compilers vectorise the loops
+static void quantize(const mad_fixed_t *left, const mad_fixed_t *right, int count, int channelCount, int16_t *out) {
+    if (channelCount == 2) {
+        for (int i = 0; i < count; ++i) {
+            out[2 * i + 0] = scale(left[i]);
+            out[2 * i + 1] = scale(right[i]);
+        }
+    } else {
+        for (int i = 0; i < count; ++i) {
+            out[i] = scale(left[i]);
+        }
+    }
 }
 
+struct Mp3StreamInfo {
+    struct FrameInfo {
+        size_t offset {0};
+        int64_t firstSample {0};
+    };
+
+    ByteBuffer data;
+    AudioFormat format {AudioFormat::Mono16};
+    int sampleRate {0};
+    std::vector<FrameInfo> frames;
+    int64_t sampleCount {0};
+};
+
+class Mp3Decoder : public IAudioDecoder, boost::noncopyable {
+public:
+    Mp3Decoder(std::shared_ptr<const Mp3StreamInfo> info) :
+        _info(std::move(info)) {
+        mad_stream_init(&_stream);
+        mad_frame_init(&_frame);
+        mad_synth_init(&_synth);
+        restart(0);
+    }
+
+    ~Mp3Decoder() {
+        mad_synth_finish(&_synth);
+        mad_frame_finish(&_frame);
+        mad_stream_finish(&_stream);
+    }
+
+    bool decode(AudioClip::Frame &frame, int sampleCount) override {
+        int channelCount = _info->format == AudioFormat::Stereo16 ? 2 : 1;
+        frame.format = _info->format;
+        frame.sampleRate = _info->sampleRate;
+        frame.samples.resize(static_cast<size_t>(channelCount) * sampleCount * sizeof(int16_t));
+        auto out = reinterpret_cast<int16_t *>(frame.samples.data());
+
+        int produced = 0;
+        while (produced < sampleCount) {
+            if (_pcmOffset >= _pcmLength && !decodeFrame()) {
+                break;
+            }
+            int count = std::min(sampleCount - produced, _pcmLength - _pcmOffset);
+            const mad_fixed_t *left = &_synth.pcm.samples[0][_pcmOffset];
+            const mad_fixed_t *right = _synth.pcm.channels == 2 ? &_synth.pcm.samples[1][_pcmOffset] : left;
+            quantize(left, right, count, channelCount, out + channelCount * produced);
+            produced += count;
+            _pcmOffset += count;
+        }
+        frame.samples.resize(static_cast<size_t>(channelCount) * produced * sizeof(int16_t));
+
+        return produced > 0;
+    }
+
+    void seek(float time) override {
+        auto &frames = _info->frames;
+        auto target = static_cast<int64_t>(std::max(time, 0.0f) * _info->sampleRate);
+        if (target >= _info->sampleCount) {
+            _pcmOffset = _pcmLength = 0;
+            _exhausted = true;
+            return;
+        }
+        auto it = std::upper_bound(frames.begin(), frames.end(), target, [](int64_t sample, const auto &frame) {
+            return sample < frame.firstSample;
+        });
+        int index = std::max(0, static_cast<int>(std::distance(frames.begin(), it)) - 1);
+        int start = std::max(0, index - kSeekPrerollFrames);
+        restart(frames[start].offset);
+        for (int i = start; i < index; ++i) {
+            if (mad_frame_decode(&_frame, &_stream) == 0) {
+                mad_synth_frame(&_synth, &_frame);
+            } else if (!MAD_RECOVERABLE(_stream.error)) {
+                break;
+            }
+        }
+        if (decodeFrame()) {
+            _pcmOffset = static_cast<int>(std::min<int64_t>(target - frames[index].firstSample, _pcmLength));
+        }
+    }
+
+private:
+    std::shared_ptr<const Mp3StreamInfo> _info;
+
+    mad_stream _stream;
+    mad_frame _frame;
+    mad_synth _synth;
+
+    int _pcmOffset {0};
+    int _pcmLength {0};
+    bool _exhausted {false};
+
+    void restart(size_t offset) {
+        mad_stream_finish(&_stream);
+        mad_stream_init(&_stream);
+        mad_frame_mute(&_frame);
+        mad_synth_mute(&_synth);
+        mad_stream_buffer(
+            &_stream,
+            reinterpret_cast<const unsigned char *>(&_info->data[offset]),
+            static_cast<unsigned long>(_info->data.size() - offset));
+        _pcmOffset = _pcmLength = 0;
+        _exhausted = false;
+    }
+
+    bool decodeFrame() {
+        while (!_exhausted) {
+            if (mad_frame_decode(&_frame, &_stream) == -1) {
+                if (!MAD_RECOVERABLE(_stream.error)) {
+                    _exhausted = true;
+                }
+                continue;
+            }
+            mad_synth_frame(&_synth, &_frame);
+            _pcmOffset = 0;
+            _pcmLength = _synth.pcm.length;
+            return true;
+        }
+        return false;
+    }
+};
+
 void Mp3Reader::load(IInputStream &stream) {
     stream.seek(0, SeekOrigin::End);
     size_t size = stream.position();
@@ -47,6 +180,11 @@ void Mp3Reader::load(IInputStream &stream) {
     stream.seek(0, SeekOrigin::Begin);
     stream.read(&data[0], size);
 
+    if (_streaming) {
+        loadStreaming(std::move(data));
+        return;
+    }
+
     _input = data;
     _stream = std::make_shared<AudioClip>();
 
@@ -65,6 +203,53 @@ void Mp3Reader::load(IInputStream &stream) {
     mad_decoder_finish(&decoder);
 }
 
+void Mp3Reader::loadStreaming(ByteBuffer data) {
+    auto info = std::make_shared<Mp3StreamInfo>();
+    info->data = std::move(data);
+    info->data.resize(info->data.size() + MAD_BUFFER_GUARD, '\0');
+
+    // Only headers are decoded here, to index frames and compute duration
+
+    mad_stream stream;
+    mad_header header;
+    mad_stream_init(&stream);
+    mad_header_init(&header);
+    mad_stream_buffer(
+        &stream,
+        reinterpret_cast<const unsigned char *>(&info->data[0]),
+        static_cast<unsigned long>(info->data.size()));
+    while (true) {
+        if (mad_header_decode(&header, &stream) == -1) {
+            if (MAD_RECOVERABLE(stream.error)) {
+                continue;
+            }
+            break;
+        }
+        if (info->frames.empty()) {
+            info->format = MAD_NCHANNELS(&header) == 2 ? AudioFormat::Stereo16 : AudioFormat::Mono16;
+            info->sampleRate = header.samplerate;
+        }
+        Mp3StreamInfo::FrameInfo frame;
+        frame.offset = stream.this_frame - reinterpret_cast<const unsigned char *>(&info->data[0]);
+        frame.firstSample = info->sampleCount;
+        info->frames.push_back(std::move(frame));
+        info->sampleCount += 32 * MAD_NSBSAMPLES(&header);
+    }
+    mad_header_finish(&header);
+    mad_stream_finish(&stream);
+
+    if (info->frames.empty()) {
+        _stream = std::make_shared<AudioClip>();
+        return;
+    }
+    float duration = info->sampleCount / static_cast<float>(info->sampleRate);
+    _stream = std::make_shared<AudioClip>(
+        [info]() -> std::unique_ptr<IAudioDecoder> {
+            return std::make_unique<Mp3Decoder>(info);
+        },
+        duration);
+}
+
 mad_flow Mp3Reader::inputFunc(void *playbuf, mad_stream *stream) {
     Mp3Reader *mp3 = reinterpret_cast<Mp3Reader *>(playbuf);
     if (mp3->_done) {
@@ -82,26 +267,12 @@ mad_flow Mp3Reader::headerFunc(void *playbuf, mad_header const *header) {
 
 mad_flow Mp3Reader::outputFunc(void *playbuf, mad_header const *header, mad_pcm *pcm) {
     Mp3Reader *mp3 = reinterpret_cast<Mp3Reader *>(playbuf);
-    unsigned short sampleCount = pcm->length;
-    mad_fixed_t *chLeft = pcm->samples[0];
-    mad_fixed_t *chRight = pcm->samples[1];
 
     AudioClip::Frame frame;
     frame.format = pcm->channels == 2 ? AudioFormat::Stereo16 : AudioFormat::Mono16;
     frame.sampleRate = pcm->samplerate;
-    frame.samples.reserve(static_cast<uint64_t>(pcm->channels) * sampleCount * sizeof(int16_t));
-
-    while (sampleCount--) {
-        int sample = scale(*chLeft++);
-        frame.samples.push_back((sample >> 0) & 0xff);
-        frame.samples.push_back((sample >> 8) & 0xff);
-
-        if (pcm->channels == 2) {
-            sample = scale(*chRight++);
-            frame.samples.push_back((sample >> 0) & 0xff);
-            frame.samples.push_back((sample >> 8) & 0xff);
-        }
-    }
+    frame.samples.resize(static_cast<size_t>(pcm->channels) * pcm->length * sizeof(int16_t));
+    quantize(pcm->samples[0], pcm->samples[1], pcm->length, pcm->channels, reinterpret_cast<int16_t *>(frame.samples.data()));
 
     mp3->_stream->add(std::move(frame));
 
@@ -141,44 +141,161 @@ static constexpr int kIMAStepTable[] = {
     5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
     15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
 
-void WavReader::loadIMAADPCM(uint32_t chunkSize) {
-    ByteBuffer chunk(_wav.readBytes(chunkSize));
+struct IMAChannel {
+    int16_t lastSample {0};
+    int16_t stepIndex {0};
+};
 
-    AudioClip::Frame frame;
-    frame.format = getAudioFormat();
-    frame.sampleRate = _sampleRate;
-    frame.samples.reserve(2 * (chunkSize - 4 * _channelCount * chunkSize / _blockAlign));
+static int16_t getIMASample(IMAChannel &channel, uint8_t nibble) {
+    int step = (2 * (nibble & 0x7) + 1) * kIMAStepTable[channel.stepIndex] / 8;
+    int diff = nibble & 0x8 ? -step : step;
+    int sample = std::min(std::max(channel.lastSample + diff, -32768), 32767);
+
+    channel.lastSample = sample;
+    channel.stepIndex = std::min(std::max(channel.stepIndex + kIMAIndexTable[nibble & 0x7], 0), 88);
+
+    return sample;
+}
+
+static void getIMASamples(IMAChannel &channel, uint8_t nibbles, int16_t &sample1, int16_t &sample2) {
+    uint8_t n1 = (nibbles >> 0) & 0xf;
+    uint8_t n2 = (nibbles >> 4) & 0xf;
+
+    sample1 = getIMASample(channel, n1);
+    sample2 = getIMASample(channel, n2);
+}
 
+// Decodes IMA ADPCM blocks in [data, data + size), which must begin at a block
+// boundary, appending 16-bit samples to out
+static void decodeIMAADPCM(const char *data, uint32_t size, int channelCount, int blockAlign, ByteBuffer &out) {
+    IMAChannel ima[2];
+    uint32_t groupSize = 4 * channelCount;
     uint32_t off = 0;
-    while (off < chunkSize) {
-        if (off % _blockAlign == 0) {
-            for (int i = 0; i < _channelCount; ++i) {
-                _ima[i].lastSample = *reinterpret_cast<int16_t *>(&chunk[off + 0]);
-                _ima[i].stepIndex = *reinterpret_cast<int16_t *>(&chunk[off + 2]);
+    while (off + groupSize <= size) {
+        if (off % blockAlign == 0) {
+            for (int i = 0; i < channelCount; ++i) {
+                ima[i].lastSample = *reinterpret_cast<const int16_t *>(&data[off + 0]);
+                ima[i].stepIndex = *reinterpret_cast<const int16_t *>(&data[off + 2]);
                 off += 4;
             }
+            if (off + groupSize > size) {
+                break;
+            }
         }
         int16_t samples[16];
-        for (int i = 0; i < _channelCount; ++i) {
+        for (int i = 0; i < channelCount; ++i) {
             for (int j = 0; j < 4; ++j) {
                 int idx = 8 * i + 2 * j;
-                getIMASamples(i, chunk[off++], samples[idx + 0], samples[idx + 1]);
+                getIMASamples(ima[i], data[off++], samples[idx + 0], samples[idx + 1]);
             }
         }
-        if (_channelCount == 2) {
+        if (channelCount == 2) {
             for (int i = 0; i < 8; ++i) {
-                frame.samples.push_back((samples[i + 0] >> 0) & 0xff);
-                frame.samples.push_back((samples[i + 0] >> 8) & 0xff);
-                frame.samples.push_back((samples[i + 8] >> 0) & 0xff);
-                frame.samples.push_back((samples[i + 8] >> 8) & 0xff);
+                out.push_back((samples[i + 0] >> 0) & 0xff);
+                out.push_back((samples[i + 0] >> 8) & 0xff);
+                out.push_back((samples[i + 8] >> 0) & 0xff);
+                out.push_back((samples[i + 8] >> 8) & 0xff);
             }
         } else {
             for (int i = 0; i < 8; ++i) {
-                frame.samples.push_back((samples[i] >> 0) & 0xff);
-                frame.samples.push_back((samples[i] >> 8) & 0xff);
+                out.push_back((samples[i] >> 0) & 0xff);
+                out.push_back((samples[i] >> 8) & 0xff);
             }
         }
     }
+}
+
+static int getIMASampleCount(uint32_t size, int channelCount, int blockAlign) {
+    int groupSize = 4 * channelCount;
+    int samplesPerBlock = 8 * ((blockAlign - groupSize) / groupSize);
+    int remainder = size % blockAlign;
+    int samples = samplesPerBlock * static_cast<int>(size / blockAlign);
+    if (remainder > groupSize) {
+        samples += 8 * ((remainder - groupSize) / groupSize);
+    }
+    return samples;
+}
+
+class IMAADPCMDecoder : public IAudioDecoder, boost::noncopyable {
+public:
+    IMAADPCMDecoder(std::shared_ptr<const ByteBuffer> data,
+                    AudioFormat format,
+                    int sampleRate,
+                    int channelCount,
+                    int blockAlign) :
+        _data(std::move(data)),
+        _format(format),
+        _sampleRate(sampleRate),
+        _channelCount(channelCount),
+        _blockAlign(blockAlign),
+        _samplesPerBlock(getIMASampleCount(blockAlign, channelCount, blockAlign)) {
+    }
+
+    bool decode(AudioClip::Frame &frame, int sampleCount) override {
+        frame.format = _format;
+        frame.sampleRate = _sampleRate;
+        frame.samples.clear();
+
+        size_t stride = 2 * _channelCount;
+        size_t size = _data->size();
+        while (frame.samples.size() / stride < static_cast<size_t>(sampleCount + _skipSamples) && _offset < size) {
+            auto blockSize = static_cast<uint32_t>(std::min(static_cast<size_t>(_blockAlign), size - _offset));
+            decodeIMAADPCM(&(*_data)[_offset], blockSize, _channelCount, _blockAlign, frame.samples);
+            _offset += blockSize;
+        }
+        if (_skipSamples > 0) {
+            size_t skipBytes = std::min(_skipSamples * stride, frame.samples.size());
+            frame.samples.erase(frame.samples.begin(), frame.samples.begin() + skipBytes);
+            _skipSamples = 0;
+        }
+
+        return !frame.samples.empty();
+    }
+
+    void seek(float time) override {
+        auto target = static_cast<size_t>(std::max(time, 0.0f) * _sampleRate);
+        size_t block = target / _samplesPerBlock;
+        _offset = std::min(block * _blockAlign, _data->size());
+        _skipSamples = _offset < _data->size() ? target - block * _samplesPerBlock : 0;
+    }
+
+private:
+    std::shared_ptr<const ByteBuffer> _data;
+    AudioFormat _format;
+    int _sampleRate;
+    int _channelCount;
+    int _blockAlign;
+    int _samplesPerBlock;
+
+    size_t _offset {0};
+    size_t _skipSamples {0};
+};
+
+void WavReader::loadIMAADPCM(uint32_t chunkSize) {
+    if (_blockAlign <= 4 * _channelCount) {
+        throw ValidationException("WAV: IMA ADPCM: invalid block align: " + std::to_string(_blockAlign));
+    }
+    auto chunk = std::make_shared<ByteBuffer>(_wav.readBytes(chunkSize));
+
+    if (_streaming) {
+        auto format = getAudioFormat();
+        int sampleRate = _sampleRate;
+        int channelCount = _channelCount;
+        int blockAlign = _blockAlign;
+        float duration = getIMASampleCount(chunkSize, channelCount, blockAlign) / static_cast<float>(sampleRate);
+        _stream = std::make_shared<AudioClip>(
+            [=]() -> std::unique_ptr<IAudioDecoder> {
+                return std::make_unique<IMAADPCMDecoder>(chunk, format, sampleRate, channelCount, blockAlign);
+            },
+            duration);
+        return;
+    }
+
+    AudioClip::Frame frame;
+    frame.format = getAudioFormat();
+    frame.sampleRate = _sampleRate;
+    frame.samples.reserve(2 * (chunkSize - 4 * _channelCount * chunkSize / _blockAlign));
+    decodeIMAADPCM(chunk->data(), chunkSize, _channelCount, _blockAlign, frame.samples);
 
     _stream = std::make_shared<AudioClip>();
     _stream->add(std::move(frame));
@@ -205,25 +322,6 @@ AudioFormat WavReader::getAudioFormat() const {
     }
 }
 
-void WavReader::getIMASamples(int channel, uint8_t nibbles, int16_t &sample1, int16_t &sample2) {
-    uint8_t n1 = (nibbles >> 0) & 0xf;
-    uint8_t n2 = (nibbles >> 4) & 0xf;
-
-    sample1 = getIMASample(channel, n1);
-    sample2 = getIMASample(channel, n2);
-}
-
-int16_t WavReader::getIMASample(int channel, uint8_t nibble) {
-    int step = (2 * (nibble & 0x7) + 1) * kIMAStepTable[_ima[channel].stepIndex] / 8;
-    int diff = nibble & 0x8 ? -step : step;
-    int sample = std::min(std::max(_ima[channel].lastSample + diff, -32768), 32767);
-
-    _ima[channel].lastSample = sample;
-    _ima[channel].stepIndex = std::min(std::max(_ima[channel].stepIndex + kIMAIndexTable[nibble & 0x7], 0), 88);
-
-    return sample;
-}
-
 } // namespace audio
 
 } // namespace reone
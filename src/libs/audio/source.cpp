@@ -25,6 +25,7 @@ namespace reone {
 namespace audio {
 
 static constexpr int kMaxBufferCount = 8;
+static constexpr int kStreamingBufferSamples = 8192;
 
 static int getALFormat(AudioFormat format) {
     switch (format) {
@@ -56,8 +57,14 @@ void AudioSource::init() {
     }
     checkMainThread();
 
-    int frameCount = _stream->getFrameCount();
-    int bufferCount = std::min(std::max(frameCount, 1), kMaxBufferCount);
+    int bufferCount;
+    if (_stream->isStreaming()) {
+        _decoder = _stream->openDecoder();
+        bufferCount = kMaxBufferCount;
+    } else {
+        int frameCount = _stream->getFrameCount();
+        bufferCount = std::min(std::max(frameCount, 1), kMaxBufferCount);
+    }
 
     _buffers.resize(bufferCount);
     _streaming = bufferCount > 1;
@@ -72,11 +79,7 @@ void AudioSource::init() {
         alSourcei(_source, AL_SOURCE_RELATIVE, AL_TRUE);
     }
     if (_streaming) {
-        for (int i = 0; i < bufferCount; ++i) {
-            auto &frame = _stream->getFrame(_nextFrame++);
-            fillBuffer(frame, _buffers[i]);
-        }
-        alSourceQueueBuffers(_source, bufferCount, &_buffers[0]);
+        queueBuffers();
     } else {
         auto &frame = _stream->getFrame(0);
         fillBuffer(frame, _buffers[0]);
@@ -101,9 +104,46 @@ void AudioSource::deinit() {
         alDeleteBuffers(static_cast<int>(_buffers.size()), &_buffers[0]);
         _buffers.clear();
     }
+    _decoder.reset();
     _inited = false;
 }
 
+void AudioSource::queueBuffers() {
+    int bufferCount = static_cast<int>(_buffers.size());
+    int queued = 0;
+    while (queued < bufferCount && fillNextBuffer(_buffers[queued])) {
+        ++queued;
+    }
+    if (queued > 0) {
+        alSourceQueueBuffers(_source, queued, &_buffers[0]);
+    }
+    _nextBuffer = 0;
+}
+
+bool AudioSource::fillNextBuffer(uint32_t buffer) {
+    if (_decoder) {
+        if (!_decoder->decode(_decoded, kStreamingBufferSamples)) {
+            if (!_loop) {
+                return false;
+            }
+            _decoder->seek(0.0f);
+            if (!_decoder->decode(_decoded, kStreamingBufferSamples)) {
+                return false;
+            }
+        }
+        fillBuffer(_decoded, buffer);
+        return true;
+    }
+    if (_loop && _nextFrame == _stream->getFrameCount()) {
+        _nextFrame = 0;
+    }
+    if (_nextFrame >= _stream->getFrameCount()) {
+        return false;
+    }
+    fillBuffer(_stream->getFrame(_nextFrame++), buffer);
+    return true;
+}
+
 void AudioSource::render() {
     if (!_source) {
         return;
@@ -120,12 +160,7 @@ void AudioSource::render() {
     alGetSourcei(_source, AL_BUFFERS_PROCESSED, &processed);
     while (processed-- > 0) {
         alSourceUnqueueBuffers(_source, 1, &_buffers[_nextBuffer]);
-        if (_loop && _nextFrame == _stream->getFrameCount()) {
-            _nextFrame = 0;
-        }
-        if (_nextFrame < _stream->getFrameCount()) {
-            auto &frame = _stream->getFrame(_nextFrame++);
-            fillBuffer(frame, _buffers[_nextBuffer]);
+        if (fillNextBuffer(_buffers[_nextBuffer])) {
             alSourceQueueBuffers(_source, 1, &_buffers[_nextBuffer]);
         }
         _nextBuffer = (_nextBuffer + 1) % static_cast<int>(_buffers.size());
@@ -134,6 +169,15 @@ void AudioSource::render() {
     alGetSourcei(_source, AL_BUFFERS_QUEUED, &queued);
     if (queued == 0) {
         _playing = false;
+        return;
+    }
+    if (_playing) {
+        // Source stops when it runs out of queued buffers between renders
+        ALint state = 0;
+        alGetSourcei(_source, AL_SOURCE_STATE, &state);
+        if (state == AL_STOPPED) {
+            alSourcePlay(_source);
+        }
     }
 }
 
@@ -153,6 +197,40 @@ void AudioSource::stop() {
     alSourceStop(_source);
 }
 
+void AudioSource::seek(float time) {
+    if (!_source) {
+        return;
+    }
+    if (!_streaming) {
+        alSourcef(_source, AL_SEC_OFFSET, time);
+        return;
+    }
+    alSourceStop(_source);
+    alSourcei(_source, AL_BUFFER, 0);
+
+    float offset = 0.0f;
+    if (_decoder) {
+        _decoder->seek(time);
+    } else {
+        float frameStart = 0.0f;
+        for (_nextFrame = 0; _nextFrame < _stream->getFrameCount(); ++_nextFrame) {
+            float frameDuration = _stream->getFrame(_nextFrame).duration();
+            if (frameStart + frameDuration > time) {
+                break;
+            }
+            frameStart += frameDuration;
+        }
+        offset = std::max(0.0f, time - frameStart);
+    }
+    queueBuffers();
+    if (offset > 0.0f) {
+        alSourcef(_source, AL_SEC_OFFSET, offset);
+    }
+    if (_playing) {
+        alSourcePlay(_source);
+    }
+}
+
 float AudioSource::duration() const {
     return _stream->duration();
 }
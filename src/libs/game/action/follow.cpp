@@ -25,7 +25,11 @@ namespace reone {
 namespace game {
 
 void FollowAction::execute(std::shared_ptr<Action> self, Object &actor, float dt) {
-    auto creatureActor = _game.getObjectById<Creature>(actor.id());
+    auto creatureActor = _game.getObjectPtr<Creature>(actor.id());
+    if (!creatureActor) {
+        complete();
+        return;
+    }
     auto dest = _follow->position();
     float distance2 = creatureActor->getSquareDistanceTo(glm::vec2(dest));
     bool run = distance2 > kDistanceWalk * kDistanceWalk;
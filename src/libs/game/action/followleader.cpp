@@ -26,7 +26,11 @@ namespace reone {
 namespace game {
 
 void FollowLeaderAction::execute(std::shared_ptr<Action> self, Object &actor, float dt) {
-    auto creatureActor = _game.getObjectById<Creature>(actor.id());
+    auto creatureActor = _game.getObjectPtr<Creature>(actor.id());
+    if (!creatureActor) {
+        complete();
+        return;
+    }
     glm::vec3 destination(_game.party().getLeader()->position());
     float distance2 = creatureActor->getSquareDistanceTo(glm::vec2(destination));
     bool run = distance2 > kDistanceWalk;
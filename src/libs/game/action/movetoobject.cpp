@@ -27,7 +27,11 @@ namespace game {
 
 void MoveToObjectAction::execute(std::shared_ptr<Action> self, Object &actor, float dt) {
     auto dest = _moveTo->position();
-    auto creatureActor = _game.getObjectById<Creature>(actor.id());
+    auto creatureActor = _game.getObjectPtr<Creature>(actor.id());
+    if (!creatureActor) {
+        complete();
+        return;
+    }
 
     bool reached = creatureActor->navigateTo(dest, _run, _range, dt);
     if (reached) {
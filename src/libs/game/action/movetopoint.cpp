@@ -25,7 +25,11 @@ namespace reone {
 namespace game {
 
 void MoveToPointAction::execute(std::shared_ptr<Action> self, Object &actor, float dt) {
-    auto creatureActor = _game.getObjectById<Creature>(actor.id());
+    auto creatureActor = _game.getObjectPtr<Creature>(actor.id());
+    if (!creatureActor) {
+        complete();
+        return;
+    }
     bool reached = creatureActor->navigateTo(_point, true, 1.0f, dt);
     if (reached) {
         complete();
@@ -26,7 +26,11 @@ namespace reone {
 namespace game {
 
 void OpenContainerAction::execute(std::shared_ptr<Action> self, Object &actor, float dt) {
-    auto creatureActor = _game.getObjectById<Creature>(actor.id());
+    auto creatureActor = _game.getObjectPtr<Creature>(actor.id());
+    if (!creatureActor) {
+        complete();
+        return;
+    }
     auto placeable = std::static_pointer_cast<Placeable>(_object);
     bool reached = creatureActor->navigateTo(placeable->position(), true, kDefaultMaxObjectDistance, dt);
     if (reached) {
@@ -112,6 +112,7 @@ void Game::initLocalServices() {
     auto routines = std::make_unique<Routines>(_gameId, this, &_services);
     routines->init();
     _routines = std::move(routines);
+    _services.resource.scripts.setRoutines(*_routines);
 
     _scriptRunner = std::make_unique<ScriptRunner>(*_routines, _services.resource.scripts);
 
@@ -184,6 +185,8 @@ bool Game::handle(const input::Event &event) {
 }
 
 void Game::update(float frameTime) {
+    _services.resource.textures.uploadPending();
+
     float dt = frameTime * _gameSpeed;
     if (_movie) {
         updateMovie(dt);
@@ -198,6 +201,7 @@ void Game::update(float frameTime) {
 
     bool updModule = !_movie && _module && (_screen == Screen::InGame || _screen == Screen::Conversation);
     if (updModule && !_paused) {
+        _timers.update(dt);
         _module->update(dt);
         _combat.update(dt);
     }
@@ -288,6 +292,12 @@ void Game::loadModule(const std::string &name, std::string entry) {
                 _module->area()->unloadParty();
             }
 
+            // Only party members carry their timers into the next module
+            _timers.cancelIf([this](uint32_t owner) {
+                auto object = getObjectPtr(owner);
+                return !object || !_party.isMember(*object);
+            });
+
             _services.resource.director.onModuleLoad(name);
 
             if (_loadScreen) {
@@ -302,7 +312,6 @@ void Game::loadModule(const std::string &name, std::string entry) {
                 _module = maybeModule->second;
             } else {
                 _module = newModule();
-                _objectById.insert(std::make_pair(_module->id(), _module));
 
                 std::shared_ptr<Gff> ifo(_services.resource.gffs.get("module", ResType::Ifo));
                 if (!ifo) {
@@ -343,7 +352,6 @@ void Game::loadDefaultParty() {
 
     if (!member1.empty()) {
         std::shared_ptr<Creature> player = newCreature();
-        _objectById.insert(std::make_pair(player->id(), player));
         player->loadFromBlueprint(member1);
         player->setTag(kObjectTagPlayer);
         player->setImmortal(true);
@@ -352,7 +360,6 @@ void Game::loadDefaultParty() {
     }
     if (!member2.empty()) {
         std::shared_ptr<Creature> companion = newCreature();
-        _objectById.insert(std::make_pair(companion->id(), companion));
         companion->loadFromBlueprint(member2);
         companion->setImmortal(true);
         companion->equip("g_w_dblsbr001");
@@ -360,7 +367,6 @@ void Game::loadDefaultParty() {
     }
     if (!member3.empty()) {
         std::shared_ptr<Creature> companion = newCreature();
-        _objectById.insert(std::make_pair(companion->id(), companion));
         companion->loadFromBlueprint(member3);
         companion->setImmortal(true);
         _party.addMember(1, companion);
@@ -452,16 +458,17 @@ Camera *Game::getActiveCamera() const {
 }
 
 std::shared_ptr<Object> Game::getObjectById(uint32_t id) const {
-    switch (id) {
-    case kObjectSelf:
-        throw std::invalid_argument("Invalid id: " + std::to_string(id));
-    case kObjectInvalid:
-        return nullptr;
-    default: {
-        auto it = _objectById.find(id);
-        return it != _objectById.end() ? it->second : nullptr;
-    }
-    }
+    throwIfObjectSelf(id);
+    return _objects.getShared(id);
+}
+
+Object *Game::getObjectPtr(uint32_t id) const {
+    throwIfObjectSelf(id);
+    return _objects.get(id);
+}
+
+void Game::destroyObject(uint32_t id) {
+    _objects.remove(id);
 }
 
 void Game::renderGUI() {
@@ -580,7 +587,7 @@ void Game::updateSceneGraph(float dt) {
     sceneGraph.setRenderAABB(isShowAABBEnabled());
     sceneGraph.setRenderWalkmeshes(isShowWalkmeshEnabled());
     sceneGraph.setRenderTriggers(isShowTriggersEnabled());
-    sceneGraph.update(dt);
+    sceneGraph.update(dt, &_services.system.threadPool);
 }
 
 bool Game::getGlobalBoolean(const std::string &name) const {
@@ -650,6 +657,7 @@ void Game::openMainMenu() {
     if (!_saveLoad) {
         _saveLoad = tryLoadGUI<SaveLoad>();
     }
+    _timers.clear();
     playMusic(_mainMenu->musicResRef());
     changeScreen(Screen::MainMenu);
 }
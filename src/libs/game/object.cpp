@@ -37,7 +37,6 @@ static constexpr float kDistanceWalk = 4.0f;
 
 void Object::update(float dt) {
     updateActions(dt);
-    updateEffects(dt);
     if (!_dead) {
         executeActions(dt);
     }
@@ -79,15 +78,17 @@ void Object::addActionOnTop(std::shared_ptr<Action> action) {
 }
 
 void Object::delayAction(std::shared_ptr<Action> action, float seconds) {
-    DelayedAction delayed;
-    delayed.action = std::move(action);
-    delayed.timer = std::make_unique<Timer>(seconds);
-    _delayed.push_back(std::move(delayed));
+    auto callback = [&game = _game, id = _id, action = std::move(action)]() {
+        auto object = game.getObjectPtr(id);
+        if (object) {
+            object->addAction(action);
+        }
+    };
+    _game.timers().schedule(seconds, std::move(callback), _id);
 }
 
 void Object::updateActions(float dt) {
     removeCompletedActions();
-    updateDelayedActions(dt);
 }
 
 void Object::removeCompletedActions() {
@@ -100,21 +101,6 @@ void Object::removeCompletedActions() {
     }
 }
 
-void Object::updateDelayedActions(float dt) {
-    for (auto &delayed : _delayed) {
-        delayed.timer->update(dt);
-        if (delayed.timer->elapsed()) {
-            _actions.push_back(std::move(delayed.action));
-        }
-    }
-    auto delayedToRemove = std::remove_if(
-        _delayed.begin(),
-        _delayed.end(),
-        [](const DelayedAction &delayed) { return delayed.timer->elapsed(); });
-
-    _delayed.erase(delayedToRemove, _delayed.end());
-}
-
 void Object::executeActions(float dt) {
     if (_actions.empty()) {
         return;
@@ -261,8 +247,17 @@ void Object::applyEffect(const std::shared_ptr<Effect> &effect, DurationType dur
         AppliedEffect appliedEffect;
         appliedEffect.effect = effect;
         appliedEffect.durationType = durationType;
-        appliedEffect.duration = duration;
         _effects.push_back(std::move(appliedEffect));
+
+        if (durationType == DurationType::Temporary) {
+            auto callback = [&game = _game, id = _id, effect]() {
+                auto object = game.getObjectPtr(id);
+                if (object) {
+                    object->expireEffect(*effect);
+                }
+            };
+            _game.timers().schedule(duration, std::move(callback), _id);
+        }
     }
 }
 
@@ -270,20 +265,15 @@ void Object::applyInstantEffect(Effect &effect) {
     effect.applyTo(*this);
 }
 
-void Object::updateEffects(float dt) {
-    for (auto it = _effects.begin(); it != _effects.end();) {
-        AppliedEffect &effect = *it;
-        bool temporary = effect.durationType == DurationType::Temporary;
-        if (temporary) {
-            effect.duration = glm::max(0.0f, effect.duration - dt);
-        }
-        if (temporary && effect.duration == 0.0f) {
-            applyInstantEffect(*effect.effect);
-            it = _effects.erase(it);
-        } else {
-            ++it;
-        }
+void Object::expireEffect(Effect &effect) {
+    auto maybeEffect = std::find_if(_effects.begin(), _effects.end(), [&effect](auto &applied) {
+        return applied.effect.get() == &effect && applied.durationType == DurationType::Temporary;
+    });
+    if (maybeEffect == _effects.end()) {
+        return;
     }
+    _effects.erase(maybeEffect);
+    applyInstantEffect(effect);
 }
 
 void Object::playAnimation(AnimationType animation, AnimationProperties properties) {
@@ -312,6 +302,10 @@ void Object::setRoom(Room *room) {
 void Object::setPosition(const glm::vec3 &position) {
     _position = position;
     updateTransform();
+
+    if (_spatialGrid) {
+        _spatialGrid->update(_id, _position);
+    }
 }
 
 void Object::updateTransform() {
@@ -70,6 +70,8 @@ namespace game {
 
 static constexpr float kDefaultFieldOfView = 75.0f;
 static constexpr float kUpdatePerceptionInterval = 1.0f; // seconds
+static constexpr auto kHeartbeatBudget = std::chrono::microseconds(1000);
+static constexpr auto kUpdatePerceptionBudget = std::chrono::microseconds(1000);
 static constexpr float kLineOfSightHeight = 1.7f;        // TODO: make it appearance-based
 static constexpr float kLineOfSightFOV = glm::radians(60.0f);
 
@@ -90,10 +92,18 @@ Area::Area(
         "",
         game,
         services),
-    _sceneName(std::move(sceneName)) {
+    _sceneName(std::move(sceneName)),
+    _heartbeatScheduler(kHeartbeatInterval, kHeartbeatBudget),
+    _perceptionScheduler(kUpdatePerceptionInterval, kUpdatePerceptionBudget) {
 
     init();
-    _heartbeatTimer.reset(kHeartbeatInterval);
+    _heartbeatScheduler.reset(kHeartbeatInterval);
+}
+
+Area::~Area() {
+    for (auto &object : _objects) {
+        object->setSpatialGrid(nullptr);
+    }
 }
 
 void Area::init() {
@@ -211,6 +221,7 @@ void Area::loadFog(const resource::generated::ARE &are) {
 }
 
 void Area::loadGIT(const resource::generated::GIT &git) {
+    prefetchBlueprints(git);
     loadProperties(git);
     loadCreatures(git);
     loadDoors(git);
@@ -222,6 +233,32 @@ void Area::loadGIT(const resource::generated::GIT &git) {
     loadEncounters(git);
 }
 
+void Area::prefetchBlueprints(const resource::generated::GIT &git) {
+    std::vector<ResourceId> ids;
+    for (auto &creature : git.Creature_List) {
+        ids.push_back(ResourceId(creature.TemplateResRef, ResType::Utc));
+    }
+    for (auto &door : git.Door_List) {
+        ids.push_back(ResourceId(door.TemplateResRef, ResType::Utd));
+    }
+    for (auto &placeable : git.Placeable_List) {
+        ids.push_back(ResourceId(placeable.TemplateResRef, ResType::Utp));
+    }
+    for (auto &waypoint : git.WaypointList) {
+        ids.push_back(ResourceId(waypoint.TemplateResRef, ResType::Utw));
+    }
+    for (auto &trigger : git.TriggerList) {
+        ids.push_back(ResourceId(trigger.TemplateResRef, ResType::Utt));
+    }
+    for (auto &sound : git.SoundList) {
+        ids.push_back(ResourceId(sound.TemplateResRef, ResType::Uts));
+    }
+    for (auto &encounter : git.Encounter_List) {
+        ids.push_back(ResourceId(encounter.TemplateResRef, ResType::Ute));
+    }
+    _services.resource.gffs.prefetch(ids);
+}
+
 void Area::loadProperties(const resource::generated::GIT &git) {
     int musicIdx = git.AreaProperties.MusicDay;
     if (musicIdx) {
@@ -441,6 +478,8 @@ void Area::add(const std::shared_ptr<Object> &object) {
     _objects.push_back(object);
     _objectsByType[object->type()].push_back(object);
     _objectsByTag[object->tag()].push_back(object);
+    _spatialGrid.add(object->id(), object, object->position());
+    object->setSpatialGrid(&_spatialGrid);
 
     determineObjectRoom(*object);
 
@@ -498,6 +537,11 @@ void Area::doDestroyObjects() {
 }
 
 void Area::doDestroyObject(uint32_t objectId) {
+    removeObject(objectId);
+    _game.destroyObject(objectId);
+}
+
+void Area::removeObject(uint32_t objectId) {
     auto object = _game.getObjectById(objectId);
     if (!object) {
         return;
@@ -506,6 +550,8 @@ void Area::doDestroyObject(uint32_t objectId) {
     if (room) {
         room->removeTenant(object.get());
     }
+    _spatialGrid.remove(objectId);
+    object->setSpatialGrid(nullptr);
 
     auto &sceneGraph = _services.scene.graphs.get(_sceneName);
     auto sceneNode = object->sceneNode();
@@ -614,8 +660,9 @@ void Area::loadParty(const glm::vec3 &position, float facing, bool fromSave) {
 }
 
 void Area::unloadParty() {
+    // Party members outlive the area, so keep them registered in the game
     for (auto &member : _game.party().members()) {
-        doDestroyObject(member.creature->id());
+        removeObject(member.creature->id());
     }
 }
 
@@ -726,18 +773,31 @@ bool Area::isObjectSeen(const Creature &subject, const Object &object) const {
     }
     auto &sceneGraph = _services.scene.graphs.get(_sceneName);
 
-    glm::vec3 origin(subject.position());
-    origin.z += kLineOfSightHeight;
+    auto query = getLineOfSightQuery(subject, object);
+    CollisionResult result;
+    result.collided = sceneGraph.testLineOfSight(query.origin, query.dest, result.collision);
+
+    return isObjectSeen(subject, object, query, result);
+}
 
-    glm::vec3 dest(object.position());
-    dest.z += kLineOfSightHeight;
+CollisionQuery Area::getLineOfSightQuery(const Creature &subject, const Object &object) const {
+    CollisionQuery query;
+    query.type = CollisionTestType::LineOfSight;
 
-    Collision collision;
-    if (sceneGraph.testLineOfSight(origin, dest, collision)) {
-        return collision.user == &object ||
-               subject.getSquareDistanceTo(object) < glm::distance2(origin, collision.intersection);
-    }
+    query.origin = subject.position();
+    query.origin.z += kLineOfSightHeight;
+
+    query.dest = object.position();
+    query.dest.z += kLineOfSightHeight;
 
+    return query;
+}
+
+bool Area::isObjectSeen(const Creature &subject, const Object &object, const CollisionQuery &query, const CollisionResult &result) const {
+    if (result.collided) {
+        return result.collision.user == &object ||
+               subject.getSquareDistanceTo(object) < glm::distance2(query.origin, result.collision.intersection);
+    }
     return true;
 }
 
@@ -886,19 +946,31 @@ void Area::checkTriggersIntersection(const std::shared_ptr<Object> &triggerrer)
 }
 
 void Area::updateHeartbeat(float dt) {
-    _heartbeatTimer.update(dt);
-    if (_heartbeatTimer.elapsed()) {
-        if (!_onHeartbeat.empty()) {
-            _game.scriptRunner().run(_onHeartbeat, _id);
-        }
+    auto collect = [this](std::vector<uint32_t> &ids) {
+        ids.push_back(_id);
         for (auto &object : _objects) {
-            std::string heartbeat(object->getOnHeartbeat());
-            if (!heartbeat.empty()) {
-                _game.scriptRunner().run(heartbeat, object->id());
+            if (!object->getOnHeartbeat().empty()) {
+                ids.push_back(object->id());
             }
         }
-        _heartbeatTimer.reset(kHeartbeatInterval);
-    }
+    };
+    auto service = [this](uint32_t id) {
+        if (id == _id) {
+            if (!_onHeartbeat.empty()) {
+                _game.scriptRunner().run(_onHeartbeat, _id);
+            }
+            return;
+        }
+        auto object = _game.getObjectById(id);
+        if (!object) {
+            return;
+        }
+        std::string heartbeat(object->getOnHeartbeat());
+        if (!heartbeat.empty()) {
+            _game.scriptRunner().run(heartbeat, id);
+        }
+    };
+    _heartbeatScheduler.update(dt, collect, service);
 }
 
 Camera *Area::getCamera(CameraType type) {
@@ -1042,13 +1114,7 @@ void Area::selectObject(std::shared_ptr<Object> object) {
 
 std::shared_ptr<Object> Area::getNearestObject(const glm::vec3 &origin, int nth, const std::function<bool(const std::shared_ptr<Object> &)> &predicate) {
     std::vector<std::pair<std::shared_ptr<Object>, float>> candidates;
-
-    for (auto &object : _objects) {
-        if (predicate(object)) {
-            candidates.push_back(std::make_pair(object, object->getSquareDistanceTo(origin)));
-        }
-    }
-    sort(candidates.begin(), candidates.end(), [](auto &left, auto &right) { return left.second < right.second; });
+    _spatialGrid.findNearest(origin, nth + 1, predicate, candidates);
 
     int candidateCount = static_cast<int>(candidates.size());
     if (nth >= candidateCount) {
@@ -1060,21 +1126,13 @@ std::shared_ptr<Object> Area::getNearestObject(const glm::vec3 &origin, int nth,
 }
 
 std::shared_ptr<Creature> Area::getNearestCreature(const std::shared_ptr<Object> &target, const SearchCriteriaList &criterias, int nth) {
-    std::vector<std::pair<std::shared_ptr<Creature>, float>> candidates;
-
-    for (auto &object : getObjectsByType(ObjectType::Creature)) {
-        auto creature = std::static_pointer_cast<Creature>(object);
-        if (matchesCriterias(*creature, criterias, target)) {
-            float distance2 = creature->getSquareDistanceTo(*target);
-            candidates.push_back(std::make_pair(std::move(creature), distance2));
-        }
-    }
-
-    sort(candidates.begin(), candidates.end(), [](auto &left, auto &right) {
-        return left.second < right.second;
-    });
+    auto predicate = [this, &target, &criterias](auto &object) {
+        return object->type() == ObjectType::Creature && matchesCriterias(static_cast<Creature &>(*object), criterias, target);
+    };
+    std::vector<std::pair<std::shared_ptr<Object>, float>> candidates;
+    _spatialGrid.findNearest(target->position(), nth + 1, predicate, candidates);
 
-    return nth < candidates.size() ? candidates[nth].first : nullptr;
+    return nth < candidates.size() ? std::static_pointer_cast<Creature>(candidates[nth].first) : nullptr;
 }
 
 bool Area::matchesCriterias(const Creature &creature, const SearchCriteriaList &criterias, std::shared_ptr<Object> target) const {
@@ -1150,78 +1208,100 @@ bool Area::matchesCriterias(const Creature &creature, const SearchCriteriaList &
 }
 
 std::shared_ptr<Creature> Area::getNearestCreatureToLocation(const Location &location, const SearchCriteriaList &criterias, int nth) {
-    std::vector<std::pair<std::shared_ptr<Creature>, float>> candidates;
-
-    for (auto &object : getObjectsByType(ObjectType::Creature)) {
-        auto creature = std::static_pointer_cast<Creature>(object);
-        if (matchesCriterias(*creature, criterias)) {
-            float distance2 = creature->getSquareDistanceTo(location.position());
-            candidates.push_back(std::make_pair(std::move(creature), distance2));
-        }
-    }
-
-    std::sort(candidates.begin(), candidates.end(), [](auto &left, auto &right) {
-        return left.second < right.second;
-    });
+    auto predicate = [this, &criterias](auto &object) {
+        return object->type() == ObjectType::Creature && matchesCriterias(static_cast<Creature &>(*object), criterias);
+    };
+    std::vector<std::pair<std::shared_ptr<Object>, float>> candidates;
+    _spatialGrid.findNearest(location.position(), nth + 1, predicate, candidates);
 
-    return nth < candidates.size() ? candidates[nth].first : nullptr;
+    return nth < candidates.size() ? std::static_pointer_cast<Creature>(candidates[nth].first) : nullptr;
 }
 
 void Area::updatePerception(float dt) {
-    _perceptionTimer.update(dt);
-    if (_perceptionTimer.elapsed()) {
-        doUpdatePerception();
-        _perceptionTimer.reset(kUpdatePerceptionInterval);
+    auto collect = [this](std::vector<uint32_t> &ids) {
+        for (auto &object : getObjectsByType(ObjectType::Creature)) {
+            ids.push_back(object->id());
+        }
+    };
+    auto service = [this](uint32_t id) {
+        auto creature = _game.getObjectPtr<Creature>(id);
+        if (creature && !creature->isDead()) {
+            doUpdatePerception(*creature);
+        }
+    };
+    _perceptionScheduler.update(dt, collect, service);
+}
+
+void Area::doUpdatePerception(Creature &creature) {
+    // Determine a list of creatures the given creature sees
+    float hearingRange2 = creature.perception().hearingRange * creature.perception().hearingRange;
+    float sightRange2 = creature.perception().sightRange * creature.perception().sightRange;
+    float maxRange = std::max(creature.perception().hearingRange, creature.perception().sightRange);
+
+    auto predicate = [&creature](auto &object) {
+        return object->type() == ObjectType::Creature && object.get() != &creature;
+    };
+    std::vector<std::shared_ptr<Object>> others;
+    _spatialGrid.findInRadius(creature.position(), maxRange, predicate, others);
+
+    // Creatures perceived earlier might have moved out of range
+    for (auto perceived : {&creature.perception().heard, &creature.perception().seen}) {
+        for (auto &object : *perceived) {
+            if (std::find(others.begin(), others.end(), object) == others.end()) {
+                others.push_back(object);
+            }
+        }
     }
-}
-
-void Area::doUpdatePerception() {
-    // For each creature, determine a list of creatures it sees
-    ObjectList &creatures = getObjectsByType(ObjectType::Creature);
-    for (auto &object : creatures) {
-        // Skip dead creatures
-        if (object->isDead())
-            continue;
 
-        auto creature = std::static_pointer_cast<Creature>(object);
-        float hearingRange2 = creature->perception().hearingRange * creature->perception().hearingRange;
-        float sightRange2 = creature->perception().sightRange * creature->perception().sightRange;
-
-        for (auto &other : creatures) {
-            // Skip self
-            if (other == object)
-                continue;
+    // Test line of sight to all creatures in sight range at once
+    std::vector<int> queryIndices(others.size(), -1);
+    std::vector<CollisionQuery> queries;
+    for (size_t i = 0; i < others.size(); ++i) {
+        auto &other = others[i];
+        if (creature.getSquareDistanceTo(*other) <= sightRange2 &&
+            creature.isInLineOfSight(*other, kLineOfSightFOV)) {
+            queryIndices[i] = static_cast<int>(queries.size());
+            queries.push_back(getLineOfSightQuery(creature, *other));
+        }
+    }
+    std::vector<CollisionResult> results;
+    if (!queries.empty()) {
+        auto &sceneGraph = _services.scene.graphs.get(_sceneName);
+        sceneGraph.testCollisions(queries, results);
+    }
 
-            bool heard = false;
-            bool seen = false;
+    for (size_t i = 0; i < others.size(); ++i) {
+        auto &other = others[i];
+        bool heard = false;
+        bool seen = false;
 
-            float distance2 = creature->getSquareDistanceTo(*other);
-            if (distance2 <= hearingRange2) {
-                heard = true;
-            }
-            if (distance2 <= sightRange2) {
-                seen = isObjectSeen(*creature, *other);
-            }
+        float distance2 = creature.getSquareDistanceTo(*other);
+        if (distance2 <= hearingRange2) {
+            heard = true;
+        }
+        int queryIdx = queryIndices[i];
+        if (queryIdx != -1) {
+            seen = isObjectSeen(creature, *other, queries[queryIdx], results[queryIdx]);
+        }
 
-            // Hearing
-            bool wasHeard = creature->perception().heard.count(other) > 0;
-            if (!wasHeard && heard) {
-                debug(str(boost::format("%s heard by %s") % other->tag() % creature->tag()), LogChannel::Perception);
-                creature->onObjectHeard(other);
-            } else if (wasHeard && !heard) {
-                debug(str(boost::format("%s inaudible to %s") % other->tag() % creature->tag()), LogChannel::Perception);
-                creature->onObjectInaudible(other);
-            }
+        // Hearing
+        bool wasHeard = creature.perception().heard.count(other) > 0;
+        if (!wasHeard && heard) {
+            debug(str(boost::format("%s heard by %s") % other->tag() % creature.tag()), LogChannel::Perception);
+            creature.onObjectHeard(other);
+        } else if (wasHeard && !heard) {
+            debug(str(boost::format("%s inaudible to %s") % other->tag() % creature.tag()), LogChannel::Perception);
+            creature.onObjectInaudible(other);
+        }
 
-            // Sight
-            bool wasSeen = creature->perception().seen.count(other) > 0;
-            if (!wasSeen && seen) {
-                debug(str(boost::format("%s seen by %s") % other->tag() % creature->tag()), LogChannel::Perception);
-                creature->onObjectSeen(other);
-            } else if (wasSeen && !seen) {
-                debug(str(boost::format("%s vanished from %s") % other->tag() % creature->tag()), LogChannel::Perception);
-                creature->onObjectVanished(other);
-            }
+        // Sight
+        bool wasSeen = creature.perception().seen.count(other) > 0;
+        if (!wasSeen && seen) {
+            debug(str(boost::format("%s seen by %s") % other->tag() % creature.tag()), LogChannel::Perception);
+            creature.onObjectSeen(other);
+        } else if (wasSeen && !seen) {
+            debug(str(boost::format("%s vanished from %s") % other->tag() % creature.tag()), LogChannel::Perception);
+            creature.onObjectVanished(other);
         }
     }
 }
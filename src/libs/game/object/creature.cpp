@@ -86,7 +86,7 @@ void Creature::loadFromGIT(const resource::generated::GIT_Creature_List &git) {
 }
 
 void Creature::loadFromBlueprint(const std::string &resRef) {
-    auto utc = _services.resource.gffs.get(resRef, ResType::Utc);
+    auto utc = _services.resource.gffs.getView(resRef, ResType::Utc);
     if (!utc) {
         return;
     }
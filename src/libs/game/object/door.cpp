@@ -57,7 +57,7 @@ void Door::loadFromGIT(const resource::generated::GIT_Door_List &git) {
 }
 
 void Door::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utd(_services.resource.gffs.get(resRef, ResType::Utd));
+    auto utd = _services.resource.gffs.getView(resRef, ResType::Utd);
     if (!utd) {
         return;
     }
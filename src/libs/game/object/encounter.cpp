@@ -40,7 +40,7 @@ void Encounter::loadFromGIT(const resource::generated::GIT_Encounter_List &git)
 }
 
 void Encounter::loadFromBlueprint(const std::string &blueprintResRef) {
-    std::shared_ptr<Gff> ute(_services.resource.gffs.get(blueprintResRef, ResType::Ute));
+    auto ute = _services.resource.gffs.getView(blueprintResRef, ResType::Ute);
     if (ute) {
         auto uteParsed = resource::generated::parseUTE(*ute);
         loadUTE(uteParsed);
@@ -41,7 +41,7 @@ namespace reone {
 namespace game {
 
 void Item::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> uti(_services.resource.gffs.get(resRef, ResType::Uti));
+    auto uti = _services.resource.gffs.getView(resRef, ResType::Uti);
     if (uti) {
         auto utiParsed = resource::generated::parseUTI(*uti);
         loadUTI(utiParsed);
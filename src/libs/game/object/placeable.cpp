@@ -50,7 +50,7 @@ void Placeable::loadFromGIT(const resource::generated::GIT_Placeable_List &git)
 }
 
 void Placeable::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utp(_services.resource.gffs.get(resRef, ResType::Utp));
+    auto utp = _services.resource.gffs.getView(resRef, ResType::Utp);
     if (!utp) {
         return;
     }
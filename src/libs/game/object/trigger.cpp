@@ -75,7 +75,7 @@ void Trigger::loadGeometryFromGIT(const resource::generated::GIT_TriggerList &gi
 }
 
 void Trigger::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utt(_services.resource.gffs.get(resRef, ResType::Utt));
+    auto utt = _services.resource.gffs.getView(resRef, ResType::Utt);
     if (utt) {
         auto uttParsed = resource::generated::parseUTT(*utt);
         loadUTT(uttParsed);
@@ -46,7 +46,7 @@ void Waypoint::loadFromGIT(const resource::generated::GIT_WaypointList &git) {
 }
 
 void Waypoint::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utw(_services.resource.gffs.get(resRef, ResType::Utw));
+    auto utw = _services.resource.gffs.getView(resRef, ResType::Utw);
     if (utw) {
         auto utwParsed = resource::generated::parseUTW(*utw);
         loadUTW(utwParsed);
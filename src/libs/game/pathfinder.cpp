@@ -23,35 +23,125 @@ namespace reone {
 
 namespace game {
 
-const Pathfinder::ContextVertex &Pathfinder::Context::getVertexWithLeastTotalCostFromOpen() const {
-    uint16_t bestIdx = 0xffff;
-    float bestTotalCost = std::numeric_limits<float>().max();
-
-    for (uint16_t idx : open) {
-        const ContextVertex &vert = vertices.find(idx)->second;
-        if (bestIdx == 0xffff || vert.totalCost < bestTotalCost) {
-            bestIdx = idx;
-            bestTotalCost = vert.totalCost;
+static constexpr uint16_t kInvalidVertex = 0xffff;
+
+static constexpr float kVerticesPerGridCell = 4.0f;
+static constexpr size_t kMaxCachedPaths = 1024;
+
+void Pathfinder::OpenHeap::push(uint16_t index) {
+    _heap.push_back(index);
+    auto pos = static_cast<uint32_t>(_heap.size() - 1);
+    _positions[index] = pos;
+    siftUp(pos);
+}
+
+void Pathfinder::OpenHeap::decreaseKey(uint16_t index) {
+    siftUp(_positions[index]);
+}
+
+uint16_t Pathfinder::OpenHeap::pop() {
+    uint16_t top = _heap.front();
+    _positions[top] = kNotInHeap;
+    uint16_t last = _heap.back();
+    _heap.pop_back();
+    if (!_heap.empty()) {
+        place(last, 0);
+        siftDown(0);
+    }
+    return top;
+}
+
+bool Pathfinder::OpenHeap::isLess(uint16_t left, uint16_t right) const {
+    float leftCost = _totalCosts[left];
+    float rightCost = _totalCosts[right];
+    return leftCost < rightCost || (leftCost == rightCost && left < right);
+}
+
+void Pathfinder::OpenHeap::siftUp(uint32_t pos) {
+    uint16_t index = _heap[pos];
+    while (pos > 0) {
+        uint32_t parentPos = (pos - 1) / 2;
+        if (!isLess(index, _heap[parentPos])) {
+            break;
+        }
+        place(_heap[parentPos], pos);
+        pos = parentPos;
+    }
+    place(index, pos);
+}
+
+void Pathfinder::OpenHeap::siftDown(uint32_t pos) {
+    uint16_t index = _heap[pos];
+    auto size = static_cast<uint32_t>(_heap.size());
+    while (true) {
+        uint32_t childPos = 2 * pos + 1;
+        if (childPos >= size) {
+            break;
         }
+        if (childPos + 1 < size && isLess(_heap[childPos + 1], _heap[childPos])) {
+            ++childPos;
+        }
+        if (!isLess(_heap[childPos], index)) {
+            break;
+        }
+        place(_heap[childPos], pos);
+        pos = childPos;
     }
+    place(index, pos);
+}
 
-    return vertices.find(bestIdx)->second;
+void Pathfinder::OpenHeap::place(uint16_t index, uint32_t pos) {
+    _heap[pos] = index;
+    _positions[index] = pos;
 }
 
 void Pathfinder::load(const std::vector<Path::Point> &points, const std::unordered_map<int, float> &pointZ) {
+    if (points.size() >= kInvalidVertex) {
+        throw std::invalid_argument("Too many path points: " + std::to_string(points.size()));
+    }
+    _vertices.clear();
+    _adjacencyOffsets.clear();
+    _adjacentVertices.clear();
+    _vertexGrid.reset();
+    {
+        std::lock_guard<std::mutex> lock(_pathCacheMutex);
+        _pathCache.clear();
+    }
+    if (points.empty()) {
+        return;
+    }
+
+    glm::vec2 min {std::numeric_limits<float>::max()};
+    glm::vec2 max {std::numeric_limits<float>::lowest()};
+
+    _vertices.reserve(points.size());
+    _adjacencyOffsets.reserve(points.size() + 1);
     for (uint16_t i = 0; i < points.size(); ++i) {
-        float z = pointZ.count(i) > 0 ? pointZ.at(i) : 0.0f;
+        auto maybeZ = pointZ.find(i);
+        float z = maybeZ != pointZ.end() ? maybeZ->second : 0.0f;
 
         const auto &point = points[i];
-        glm::vec3 pointVec(point.x, point.y, z);
-        _vertices.push_back(pointVec);
+        _vertices.push_back(glm::vec3(point.x, point.y, z));
+        min = glm::min(min, glm::vec2(point.x, point.y));
+        max = glm::max(max, glm::vec2(point.x, point.y));
 
-        glm::vec3 adjPointVec;
+        _adjacencyOffsets.push_back(static_cast<uint32_t>(_adjacentVertices.size()));
         for (auto &adjPointIdx : point.adjPoints) {
-            const Path::Point &adjPoint = points[adjPointIdx];
-            _adjacentVertices[i].push_back(static_cast<uint16_t>(adjPointIdx));
+            if (adjPointIdx < 0 || adjPointIdx >= static_cast<int>(points.size())) {
+                continue;
+            }
+            _adjacentVertices.push_back(static_cast<uint16_t>(adjPointIdx));
         }
     }
+    _adjacencyOffsets.push_back(static_cast<uint32_t>(_adjacentVertices.size()));
+
+    // Size grid cells so that there are a few vertices per cell on average
+    auto extent = max - min;
+    float cellSize = std::sqrt(kVerticesPerGridCell * extent.x * extent.y / static_cast<float>(points.size()));
+    _vertexGrid = std::make_unique<SpatialGrid<uint16_t>>(std::max(1.0f, cellSize));
+    for (uint16_t i = 0; i < _vertices.size(); ++i) {
+        _vertexGrid->add(i, i, _vertices[i]);
+    }
 }
 
 const std::vector<glm::vec3> Pathfinder::findPath(const glm::vec3 &from, const glm::vec3 &to) const {
@@ -69,84 +159,108 @@ const std::vector<glm::vec3> Pathfinder::findPath(const glm::vec3 &from, const g
         return std::vector<glm::vec3> {from, to};
     }
 
-    Context ctx;
+    // Unreachable pairs are cached as empty paths, so look for the key itself
+    std::vector<uint16_t> vertexPath;
+    bool cached = false;
+    auto cacheKey = (static_cast<uint32_t>(fromIdx) << 16) | toIdx;
+    {
+        std::lock_guard<std::mutex> lock(_pathCacheMutex);
+        auto maybeCached = _pathCache.find(cacheKey);
+        if (maybeCached != _pathCache.end()) {
+            vertexPath = maybeCached->second;
+            cached = true;
+        }
+    }
+    if (!cached) {
+        vertexPath = findVertexPath(fromIdx, toIdx);
+        std::lock_guard<std::mutex> lock(_pathCacheMutex);
+        if (_pathCache.size() >= kMaxCachedPaths) {
+            _pathCache.clear();
+        }
+        _pathCache[cacheKey] = vertexPath;
+    }
+
+    // Return a path of start and end points when end vertex is unreachable
+    if (vertexPath.empty()) {
+        return std::vector<glm::vec3> {from, to};
+    }
+
+    std::vector<glm::vec3> path;
+    path.reserve(vertexPath.size());
+    for (auto idx : vertexPath) {
+        path.push_back(_vertices[idx]);
+    }
+    return path;
+}
+
+std::vector<uint16_t> Pathfinder::findVertexPath(uint16_t fromIdx, uint16_t toIdx) const {
+    ++_numSearches;
+
+    size_t numVertices = _vertices.size();
+    std::vector<float> distances(numVertices, std::numeric_limits<float>::max());
+    std::vector<float> totalCosts(numVertices, std::numeric_limits<float>::max());
+    std::vector<uint16_t> parents(numVertices, kInvalidVertex);
+    std::vector<bool> closed(numVertices, false);
+    OpenHeap open(totalCosts, numVertices);
 
     // Add vertex, nearest to start point, to open list
-    ContextVertex fromVert;
-    fromVert.index = fromIdx;
-    ctx.vertices.insert(std::make_pair(fromIdx, fromVert));
-    ctx.open.insert(fromIdx);
+    distances[fromIdx] = 0.0f;
+    totalCosts[fromIdx] = 0.0f;
+    open.push(fromIdx);
 
-    while (!ctx.open.empty()) {
-        // Extract vertex with least total cost from open list
-        const ContextVertex &current = ctx.getVertexWithLeastTotalCostFromOpen();
-        ctx.open.erase(current.index);
+    const auto &toVertex = _vertices[toIdx];
 
-        // Add current vertex to closed list
-        ctx.closed.insert(current.index);
+    while (!open.empty()) {
+        // Extract vertex with least total cost from open list and close it
+        uint16_t current = open.pop();
+        closed[current] = true;
 
         // Reconstruct path if current vertex is nearest to end point
-        if (current.index == toIdx) {
-            std::vector<glm::vec3> path;
-            uint16_t idx = current.index;
-            do {
-                const ContextVertex &vert = ctx.vertices.find(idx)->second;
-                path.push_back(_vertices[vert.index]);
-                idx = vert.parentIndex;
-            } while (idx != 0xffff);
-            reverse(path.begin(), path.end());
+        if (current == toIdx) {
+            std::vector<uint16_t> path;
+            for (uint16_t idx = current; idx != kInvalidVertex; idx = parents[idx]) {
+                path.push_back(idx);
+            }
+            std::reverse(path.begin(), path.end());
             return path;
         }
 
-        // Skip current vertex if it has no adjacent vertices
-        auto maybeAdjVerts = _adjacentVertices.find(current.index);
-        if (maybeAdjVerts == _adjacentVertices.end())
-            continue;
-
-        for (auto &adjVertIdx : maybeAdjVerts->second) {
-            // Skip adjacent vertex if it is present in closed list
-            if (ctx.closed.count(adjVertIdx) > 0)
+        const auto &currentVertex = _vertices[current];
+        for (uint32_t i = _adjacencyOffsets[current]; i < _adjacencyOffsets[current + 1]; ++i) {
+            uint16_t adjIdx = _adjacentVertices[i];
+            if (closed[adjIdx]) {
                 continue;
-
-            ContextVertex child;
-            child.index = adjVertIdx;
-            child.parentIndex = current.index;
-            child.distance = current.distance + glm::distance2(_vertices[current.index], _vertices[adjVertIdx]);
-            child.heuristic = glm::distance2(_vertices[child.index], _vertices[toIdx]);
-            child.totalCost = child.distance + child.heuristic;
+            }
+            float distance = distances[current] + glm::distance2(currentVertex, _vertices[adjIdx]);
 
             // Do nothing if adjacent vertex is present in open list and computed distance is greater
-            auto maybeOpenAdjVert = ctx.open.find(adjVertIdx);
-            if (maybeOpenAdjVert != ctx.open.end()) {
-                const ContextVertex &openAdjVert = ctx.vertices.find(*maybeOpenAdjVert)->second;
-                if (child.distance > openAdjVert.distance)
-                    continue;
+            bool inOpen = open.contains(adjIdx);
+            if (inOpen && distance > distances[adjIdx]) {
+                continue;
             }
 
             // Insert or update adjacent vertex in open list
-            ctx.vertices.insert(std::make_pair(adjVertIdx, child));
-            ctx.open.insert(adjVertIdx);
+            parents[adjIdx] = current;
+            distances[adjIdx] = distance;
+            totalCosts[adjIdx] = distance + glm::distance2(_vertices[adjIdx], toVertex);
+            if (inOpen) {
+                open.decreaseKey(adjIdx);
+            } else {
+                open.push(adjIdx);
+            }
         }
     }
 
-    // Return a path of start and end points by default
-    return std::vector<glm::vec3> {from, to};
+    return std::vector<uint16_t>();
 }
 
 uint16_t Pathfinder::getNearestVertex(const glm::vec3 &point) const {
-    uint16_t index = 0xffff;
-    float minDist = 0.0f;
+    static const SpatialGrid<uint16_t>::Predicate any = [](const uint16_t &) { return true; };
 
-    for (int i = 0; i < _vertices.size(); ++i) {
-        float dist = glm::distance2(point, _vertices[i]);
-
-        if (index == 0xffff || dist < minDist) {
-            index = i;
-            minDist = dist;
-        }
-    }
+    std::vector<std::pair<uint16_t, float>> nearest;
+    _vertexGrid->findNearest(point, 1, any, nearest);
 
-    return index;
+    return nearest.front().first;
 }
 
 } // namespace game
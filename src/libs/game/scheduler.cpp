@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/scheduler.h"
+
+namespace reone {
+
+namespace game {
+
+void SlicedScheduler::update(float dt, const CollectFunc &collect, const ServiceFunc &service) {
+    _timer.update(dt);
+    if (_timer.elapsed()) {
+        // Objects left over from the previous interval are serviced first
+        std::vector<uint32_t> ids;
+        collect(ids);
+        _queue.insert(_queue.end(), ids.begin(), ids.end());
+        _timer.reset(_interval);
+        _timeLeft = _interval;
+        _stats.worstSlice = std::chrono::microseconds(0);
+    }
+
+    // Minimum number of objects to service, so that the queue is drained by
+    // the end of the current interval
+    int minCount = static_cast<int>(_queue.size());
+    if (dt < _timeLeft) {
+        minCount = static_cast<int>(std::ceil(_queue.size() * dt / _timeLeft));
+    }
+    _timeLeft = std::max(0.0f, _timeLeft - dt);
+
+    auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::microseconds(0);
+    int count = 0;
+    while (!_queue.empty()) {
+        if (count >= minCount && elapsed >= _budget) {
+            break;
+        }
+        auto id = _queue.front();
+        _queue.pop_front();
+        service(id);
+        ++count;
+        elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    _stats.queueDepth = static_cast<int>(_queue.size());
+    _stats.lastSliceCount = count;
+    _stats.lastSlice = elapsed;
+    _stats.worstSlice = std::max(_stats.worstSlice, elapsed);
+}
+
+void SlicedScheduler::reset(float delay) {
+    _queue.clear();
+    _timer.reset(delay);
+    _timeLeft = 0.0f;
+    _stats = Stats();
+}
+
+} // namespace game
+
+} // namespace reone
@@ -36,7 +36,7 @@ namespace reone {
 
 namespace game {
 
-static void throwIfMissing(const std::vector<Variable> &args, int index) {
+static void throwIfMissing(Span<const Variable> args, int index) {
     if (index < 0 || index >= args.size()) {
         throw RoutineArgumentMissingException(str(boost::format("Argument index out of range: %d/%d") % index % static_cast<int>(args.size())));
     }
@@ -126,31 +126,31 @@ std::shared_ptr<Object> getTriggerrer(const RoutineContext &ctx) {
     return object;
 }
 
-int getInt(const std::vector<Variable> &args, int index) {
+int getInt(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Int, args[index].type);
     return args[index].intValue;
 }
 
-float getFloat(const std::vector<Variable> &args, int index) {
+float getFloat(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Float, args[index].type);
     return args[index].floatValue;
 }
 
-std::string getString(const std::vector<Variable> &args, int index) {
+std::string getString(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::String, args[index].type);
-    return args[index].strValue;
+    return args[index].strValue();
 }
 
-glm::vec3 getVector(const std::vector<Variable> &args, int index) {
+glm::vec3 getVector(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Vector, args[index].type);
-    return args[index].vecValue;
+    return args[index].vecValue();
 }
 
-std::shared_ptr<Object> getObject(const std::vector<Variable> &args, int index, const RoutineContext &ctx) {
+std::shared_ptr<Object> getObject(Span<const Variable> args, int index, const RoutineContext &ctx) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Object, args[index].type);
 
@@ -164,45 +164,45 @@ std::shared_ptr<Object> getObject(const std::vector<Variable> &args, int index,
     return object;
 }
 
-std::shared_ptr<Effect> getEffect(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Effect> getEffect(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Effect, args[index].type);
-    auto effect = std::static_pointer_cast<Effect>(args[index].engineType);
+    auto effect = std::static_pointer_cast<Effect>(args[index].engineType());
     throwIfInvalidEffect(effect);
     return effect;
 }
 
-std::shared_ptr<Event> getEvent(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Event> getEvent(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Event, args[index].type);
-    auto event = std::static_pointer_cast<Event>(args[index].engineType);
+    auto event = std::static_pointer_cast<Event>(args[index].engineType());
     throwIfInvalidEvent(event);
     return event;
 }
 
-std::shared_ptr<Location> getLocationArgument(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Location> getLocationArgument(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Location, args[index].type);
-    auto location = std::static_pointer_cast<Location>(args[index].engineType);
+    auto location = std::static_pointer_cast<Location>(args[index].engineType());
     throwIfInvalidLocation(location);
     return location;
 }
 
-std::shared_ptr<Talent> getTalent(const std::vector<Variable> &args, int index) {
+std::shared_ptr<Talent> getTalent(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Talent, args[index].type);
-    auto talent = std::static_pointer_cast<Talent>(args[index].engineType);
+    auto talent = std::static_pointer_cast<Talent>(args[index].engineType());
     throwIfInvalidTalent(talent);
     return talent;
 }
 
-std::shared_ptr<ExecutionContext> getAction(const std::vector<Variable> &args, int index) {
+std::shared_ptr<ExecutionContext> getAction(Span<const Variable> args, int index) {
     throwIfMissing(args, index);
     throwIfUnexpectedType(VariableType::Action, args[index].type);
-    return args[index].context;
+    return args[index].context();
 }
 
-int getIntOrElse(const std::vector<Variable> &args, int index, int defValue) {
+int getIntOrElse(Span<const Variable> args, int index, int defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
@@ -210,7 +210,7 @@ int getIntOrElse(const std::vector<Variable> &args, int index, int defValue) {
     return args[index].intValue;
 }
 
-float getFloatOrElse(const std::vector<Variable> &args, int index, float defValue) {
+float getFloatOrElse(Span<const Variable> args, int index, float defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
@@ -218,23 +218,23 @@ float getFloatOrElse(const std::vector<Variable> &args, int index, float defValu
     return args[index].floatValue;
 }
 
-std::string getStringOrElse(const std::vector<Variable> &args, int index, std::string defValue) {
+std::string getStringOrElse(Span<const Variable> args, int index, std::string defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
     throwIfUnexpectedType(VariableType::String, args[index].type);
-    return args[index].strValue;
+    return args[index].strValue();
 }
 
-glm::vec3 getVectorOrElse(const std::vector<Variable> &args, int index, glm::vec3 defValue) {
+glm::vec3 getVectorOrElse(Span<const Variable> args, int index, glm::vec3 defValue) {
     if (index < 0 || index >= args.size()) {
         return defValue;
     }
     throwIfUnexpectedType(VariableType::Vector, args[index].type);
-    return args[index].vecValue;
+    return args[index].vecValue();
 }
 
-std::shared_ptr<Object> getObjectOrNull(const std::vector<Variable> &args, int index, const RoutineContext &ctx) {
+std::shared_ptr<Object> getObjectOrNull(Span<const Variable> args, int index, const RoutineContext &ctx) {
     if (index < 0 || index >= args.size()) {
         return nullptr;
     } else {
@@ -242,7 +242,7 @@ std::shared_ptr<Object> getObjectOrNull(const std::vector<Variable> &args, int i
     }
 }
 
-std::shared_ptr<Object> getObjectOrCaller(const std::vector<Variable> &args, int index, const RoutineContext &ctx) {
+std::shared_ptr<Object> getObjectOrCaller(Span<const Variable> args, int index, const RoutineContext &ctx) {
     if (index < 0 || index >= args.size()) {
         return getCaller(ctx);
     } else {
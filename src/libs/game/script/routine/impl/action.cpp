@@ -87,14 +87,14 @@ namespace reone {
 
 namespace game {
 
-static Variable ActionRandomWalk(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionRandomWalk(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<RandomWalkAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionMoveToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveToLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lDestination = getLocationArgument(args, 0);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -108,7 +108,7 @@ static Variable ActionMoveToLocation(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable ActionMoveToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMoveTo = getObject(args, 0, ctx);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -123,7 +123,7 @@ static Variable ActionMoveToObject(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable ActionMoveAwayFromObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveAwayFromObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFleeFrom = getObject(args, 0, ctx);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -138,7 +138,7 @@ static Variable ActionMoveAwayFromObject(const std::vector<Variable> &args, cons
     return Variable::ofNull();
 }
 
-static Variable ActionEquipItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto nInventorySlot = getInt(args, 1);
@@ -154,7 +154,7 @@ static Variable ActionEquipItem(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable ActionUnequipItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUnequipItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto bInstant = getIntOrElse(args, 1, 0);
@@ -169,7 +169,7 @@ static Variable ActionUnequipItem(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionPickUpItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPickUpItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -182,7 +182,7 @@ static Variable ActionPickUpItem(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable ActionPutDownItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPutDownItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -195,7 +195,7 @@ static Variable ActionPutDownItem(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionAttack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionAttack(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttackee = getObject(args, 0, ctx);
     auto bPassive = getIntOrElse(args, 1, 0);
@@ -210,7 +210,7 @@ static Variable ActionAttack(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-static Variable ActionSpeakString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSpeakString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sStringToSpeak = getString(args, 0);
     auto nTalkVolume = getIntOrElse(args, 1, 0);
@@ -224,7 +224,7 @@ static Variable ActionSpeakString(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionPlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPlayAnimation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAnimation = getInt(args, 0);
     auto fSpeed = getFloatOrElse(args, 1, 1.0f);
@@ -239,7 +239,7 @@ static Variable ActionPlayAnimation(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable ActionOpenDoor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionOpenDoor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oDoor = getObject(args, 0, ctx);
 
@@ -251,7 +251,7 @@ static Variable ActionOpenDoor(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionCloseDoor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCloseDoor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oDoor = getObject(args, 0, ctx);
 
@@ -263,7 +263,7 @@ static Variable ActionCloseDoor(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable ActionCastSpellAtObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastSpellAtObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -285,7 +285,7 @@ static Variable ActionCastSpellAtObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionGiveItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionGiveItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto oGiveTo = getObject(args, 1, ctx);
@@ -299,7 +299,7 @@ static Variable ActionGiveItem(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionTakeItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionTakeItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto oTakeFrom = getObject(args, 1, ctx);
@@ -313,7 +313,7 @@ static Variable ActionTakeItem(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionForceFollowObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionForceFollowObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollow = getObject(args, 0, ctx);
     auto fFollowDistance = getFloatOrElse(args, 1, 0.0f);
@@ -327,7 +327,7 @@ static Variable ActionForceFollowObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionJumpToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionJumpToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oToJumpTo = getObject(args, 0, ctx);
     auto bWalkStraightLineToPoint = getIntOrElse(args, 1, 1);
@@ -341,7 +341,7 @@ static Variable ActionJumpToObject(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable ActionWait(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionWait(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fSeconds = getFloat(args, 0);
 
@@ -353,7 +353,7 @@ static Variable ActionWait(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-static Variable ActionStartConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionStartConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObjectToConverse = getObject(args, 0, ctx);
     auto sDialogResRef = getStringOrElse(args, 1, "");
@@ -407,21 +407,21 @@ static Variable ActionStartConversation(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionPauseConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionPauseConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<PauseConversationAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionResumeConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionResumeConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<ResumeConversationAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionJumpToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionJumpToLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lLocation = getLocationArgument(args, 0);
 
@@ -433,7 +433,7 @@ static Variable ActionJumpToLocation(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable ActionCastSpellAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastSpellAtLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto lTargetLocation = getLocationArgument(args, 1);
@@ -455,7 +455,7 @@ static Variable ActionCastSpellAtLocation(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionSpeakStringByStrRef(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSpeakStringByStrRef(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
     auto nTalkVolume = getIntOrElse(args, 1, 0);
@@ -469,7 +469,7 @@ static Variable ActionSpeakStringByStrRef(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionUseFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseFeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -484,7 +484,7 @@ static Variable ActionUseFeat(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable ActionUseSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseSkill(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -501,7 +501,7 @@ static Variable ActionUseSkill(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable ActionDoCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionDoCommand(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto aActionToDo = getAction(args, 0);
 
@@ -513,7 +513,7 @@ static Variable ActionDoCommand(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable ActionUseTalentOnObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseTalentOnObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto tChosenTalent = getTalent(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -527,7 +527,7 @@ static Variable ActionUseTalentOnObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionUseTalentAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUseTalentAtLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto tChosenTalent = getTalent(args, 0);
     auto lTargetLocation = getLocationArgument(args, 1);
@@ -541,7 +541,7 @@ static Variable ActionUseTalentAtLocation(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionInteractObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionInteractObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
 
@@ -554,7 +554,7 @@ static Variable ActionInteractObject(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable ActionMoveAwayFromLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionMoveAwayFromLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lMoveAwayFrom = getLocationArgument(args, 0);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -569,14 +569,14 @@ static Variable ActionMoveAwayFromLocation(const std::vector<Variable> &args, co
     return Variable::ofNull();
 }
 
-static Variable ActionSurrenderToEnemies(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSurrenderToEnemies(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<SurrenderToEnemiesAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionForceMoveToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionForceMoveToLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lDestination = getLocationArgument(args, 0);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -591,7 +591,7 @@ static Variable ActionForceMoveToLocation(const std::vector<Variable> &args, con
     return Variable::ofNull();
 }
 
-static Variable ActionForceMoveToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionForceMoveToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMoveTo = getObject(args, 0, ctx);
     auto bRun = getIntOrElse(args, 1, 0);
@@ -607,7 +607,7 @@ static Variable ActionForceMoveToObject(const std::vector<Variable> &args, const
     return Variable::ofNull();
 }
 
-static Variable ActionEquipMostDamagingMelee(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipMostDamagingMelee(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oVersus = getObjectOrNull(args, 0, ctx);
     auto bOffHand = getIntOrElse(args, 1, 0);
@@ -621,7 +621,7 @@ static Variable ActionEquipMostDamagingMelee(const std::vector<Variable> &args,
     return Variable::ofNull();
 }
 
-static Variable ActionEquipMostDamagingRanged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipMostDamagingRanged(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oVersus = getObjectOrNull(args, 0, ctx);
 
@@ -633,14 +633,14 @@ static Variable ActionEquipMostDamagingRanged(const std::vector<Variable> &args,
     return Variable::ofNull();
 }
 
-static Variable ActionEquipMostEffectiveArmor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionEquipMostEffectiveArmor(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<EquipMostEffectiveArmorAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionUnlockObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionUnlockObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -652,7 +652,7 @@ static Variable ActionUnlockObject(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable ActionLockObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionLockObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -664,7 +664,7 @@ static Variable ActionLockObject(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable ActionCastFakeSpellAtObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastFakeSpellAtObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -680,7 +680,7 @@ static Variable ActionCastFakeSpellAtObject(const std::vector<Variable> &args, c
     return Variable::ofNull();
 }
 
-static Variable ActionCastFakeSpellAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionCastFakeSpellAtLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto lTarget = getLocationArgument(args, 1);
@@ -696,7 +696,7 @@ static Variable ActionCastFakeSpellAtLocation(const std::vector<Variable> &args,
     return Variable::ofNull();
 }
 
-static Variable ActionBarkString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionBarkString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto strRef = getInt(args, 0);
 
@@ -708,14 +708,14 @@ static Variable ActionBarkString(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable ActionFollowLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionFollowLeader(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<FollowLeaderAction>();
     getCaller(ctx)->addAction(std::move(action));
     return Variable::ofNull();
 }
 
-static Variable ActionFollowOwner(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionFollowOwner(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fRange = getFloatOrElse(args, 0, 2.5f);
 
@@ -727,7 +727,7 @@ static Variable ActionFollowOwner(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable ActionSwitchWeapons(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ActionSwitchWeapons(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto action = ctx.game.newAction<SwitchWeaponsAction>();
     getCaller(ctx)->addAction(std::move(action));
@@ -129,13 +129,13 @@ namespace reone {
 
 namespace game {
 
-static Variable EffectAssuredHit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAssuredHit(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<AssuredHitEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHeal(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHeal(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageToHeal = getInt(args, 0);
 
@@ -146,7 +146,7 @@ static Variable EffectHeal(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageAmount = getInt(args, 0);
     auto nDamageType = getIntOrElse(args, 1, 8);
@@ -161,7 +161,7 @@ static Variable EffectDamage(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAbilityIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAbilityIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAbilityToIncrease = getInt(args, 0);
     auto nModifyBy = getInt(args, 1);
@@ -174,7 +174,7 @@ static Variable EffectAbilityIncrease(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageResistance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageResistance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
     auto nAmount = getInt(args, 1);
@@ -188,7 +188,7 @@ static Variable EffectDamageResistance(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectResurrection(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectResurrection(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nHPPercent = getIntOrElse(args, 0, 0);
 
@@ -199,7 +199,7 @@ static Variable EffectResurrection(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectACIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectACIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
     auto nModifyType = getIntOrElse(args, 1, 0);
@@ -213,7 +213,7 @@ static Variable EffectACIncrease(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSavingThrowIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSavingThrowIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSave = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -227,7 +227,7 @@ static Variable EffectSavingThrowIncrease(const std::vector<Variable> &args, con
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAttackIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAttackIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nBonus = getInt(args, 0);
     auto nModifierType = getIntOrElse(args, 1, 0);
@@ -240,7 +240,7 @@ static Variable EffectAttackIncrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageReduction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageReduction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAmount = getInt(args, 0);
     auto nDamagePower = getInt(args, 1);
@@ -254,7 +254,7 @@ static Variable EffectDamageReduction(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nBonus = getInt(args, 0);
     auto nDamageType = getIntOrElse(args, 1, 8);
@@ -267,13 +267,13 @@ static Variable EffectDamageIncrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectEntangle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectEntangle(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<EntangleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDeath(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDeath(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpectacularDeath = getIntOrElse(args, 0, 0);
     auto nDisplayFeedback = getIntOrElse(args, 1, 1);
@@ -289,19 +289,19 @@ static Variable EffectDeath(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectKnockdown(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectKnockdown(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<KnockdownEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectParalyze(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectParalyze(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ParalyzeEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSpellImmunity(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSpellImmunity(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nImmunityToSpell = getIntOrElse(args, 0, -1);
 
@@ -313,7 +313,7 @@ static Variable EffectSpellImmunity(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceJump(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceJump(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nAdvanced = getIntOrElse(args, 1, 0);
@@ -325,13 +325,13 @@ static Variable EffectForceJump(const std::vector<Variable> &args, const Routine
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSleep(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSleep(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<SleepEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTemporaryForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTemporaryForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nTempForce = getInt(args, 0);
 
@@ -342,31 +342,31 @@ static Variable EffectTemporaryForcePoints(const std::vector<Variable> &args, co
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectConfused(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectConfused(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ConfusedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFrightened(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFrightened(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<FrightenedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectChoke(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectChoke(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ChokeEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectStunned(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectStunned(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<StunnedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectRegenerate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectRegenerate(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAmount = getInt(args, 0);
     auto fIntervalSeconds = getFloat(args, 1);
@@ -378,7 +378,7 @@ static Variable EffectRegenerate(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMovementSpeedIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMovementSpeedIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNewSpeedPercent = getInt(args, 0);
 
@@ -389,7 +389,7 @@ static Variable EffectMovementSpeedIncrease(const std::vector<Variable> &args, c
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAreaOfEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAreaOfEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAreaEffectId = getInt(args, 0);
     auto sOnEnterScript = getStringOrElse(args, 1, "");
@@ -403,7 +403,7 @@ static Variable EffectAreaOfEffect(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectVisualEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectVisualEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nVisualEffectId = getInt(args, 0);
     auto nMissEffect = getIntOrElse(args, 1, 0);
@@ -416,7 +416,7 @@ static Variable EffectVisualEffect(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectLinkEffects(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectLinkEffects(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eChildEffect = getEffect(args, 0);
     auto eParentEffect = getEffect(args, 1);
@@ -428,7 +428,7 @@ static Variable EffectLinkEffects(const std::vector<Variable> &args, const Routi
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBeam(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBeam(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nBeamVisualEffect = getInt(args, 0);
     auto oEffector = getObject(args, 1, ctx);
@@ -444,7 +444,7 @@ static Variable EffectBeam(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceResistanceIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceResistanceIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
 
@@ -455,13 +455,13 @@ static Variable EffectForceResistanceIncrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBodyFuel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBodyFuel(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<BodyFuelEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectPoison(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectPoison(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPoisonType = getInt(args, 0);
 
@@ -473,7 +473,7 @@ static Variable EffectPoison(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAssuredDeflection(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAssuredDeflection(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nReturn = getIntOrElse(args, 0, 0);
 
@@ -484,7 +484,7 @@ static Variable EffectAssuredDeflection(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForcePushTargeted(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForcePushTargeted(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lCentre = getLocationArgument(args, 0);
     auto nIgnoreTestDirectLine = getIntOrElse(args, 1, 0);
@@ -497,13 +497,13 @@ static Variable EffectForcePushTargeted(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHaste(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHaste(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<HasteEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectImmunity(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectImmunity(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nImmunityType = getInt(args, 0);
 
@@ -515,7 +515,7 @@ static Variable EffectImmunity(const std::vector<Variable> &args, const RoutineC
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageImmunityIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageImmunityIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
     auto nPercentImmunity = getInt(args, 1);
@@ -528,7 +528,7 @@ static Variable EffectDamageImmunityIncrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTemporaryHitpoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTemporaryHitpoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nHitPoints = getInt(args, 0);
 
@@ -539,7 +539,7 @@ static Variable EffectTemporaryHitpoints(const std::vector<Variable> &args, cons
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSkillIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSkillIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -552,7 +552,7 @@ static Variable EffectSkillIncrease(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamage = getInt(args, 0);
 
@@ -563,7 +563,7 @@ static Variable EffectDamageForcePoints(const std::vector<Variable> &args, const
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHealForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHealForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nHeal = getInt(args, 0);
 
@@ -574,7 +574,7 @@ static Variable EffectHealForcePoints(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHitPointChangeWhenDying(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHitPointChangeWhenDying(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fHitPointChangePerRound = getFloat(args, 0);
 
@@ -585,19 +585,19 @@ static Variable EffectHitPointChangeWhenDying(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDroidStun(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDroidStun(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<DroidStunEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForcePushed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForcePushed(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ForcePushedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceResisted(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceResisted(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSource = getObject(args, 0, ctx);
 
@@ -608,13 +608,13 @@ static Variable EffectForceResisted(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceFizzle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceFizzle(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ForceFizzleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAbilityDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAbilityDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAbility = getInt(args, 0);
     auto nModifyBy = getInt(args, 1);
@@ -627,7 +627,7 @@ static Variable EffectAbilityDecrease(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectAttackDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectAttackDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPenalty = getInt(args, 0);
     auto nModifierType = getIntOrElse(args, 1, 0);
@@ -640,7 +640,7 @@ static Variable EffectAttackDecrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPenalty = getInt(args, 0);
     auto nDamageType = getIntOrElse(args, 1, 8);
@@ -653,7 +653,7 @@ static Variable EffectDamageDecrease(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageImmunityDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageImmunityDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
     auto nPercentImmunity = getInt(args, 1);
@@ -666,7 +666,7 @@ static Variable EffectDamageImmunityDecrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectACDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectACDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
     auto nModifyType = getIntOrElse(args, 1, 0);
@@ -680,7 +680,7 @@ static Variable EffectACDecrease(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMovementSpeedDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMovementSpeedDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPercentChange = getInt(args, 0);
 
@@ -691,7 +691,7 @@ static Variable EffectMovementSpeedDecrease(const std::vector<Variable> &args, c
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSavingThrowDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSavingThrowDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSave = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -705,7 +705,7 @@ static Variable EffectSavingThrowDecrease(const std::vector<Variable> &args, con
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSkillDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSkillDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto nValue = getInt(args, 1);
@@ -718,7 +718,7 @@ static Variable EffectSkillDecrease(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceResistanceDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceResistanceDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
 
@@ -729,7 +729,7 @@ static Variable EffectForceResistanceDecrease(const std::vector<Variable> &args,
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectInvisibility(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectInvisibility(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nInvisibilityType = getInt(args, 0);
 
@@ -741,7 +741,7 @@ static Variable EffectInvisibility(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectConcealment(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectConcealment(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPercentage = getInt(args, 0);
 
@@ -752,7 +752,7 @@ static Variable EffectConcealment(const std::vector<Variable> &args, const Routi
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceShield(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceShield(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nShield = getInt(args, 0);
 
@@ -763,7 +763,7 @@ static Variable EffectForceShield(const std::vector<Variable> &args, const Routi
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDispelMagicAll(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDispelMagicAll(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCasterLevel = getInt(args, 0);
 
@@ -774,7 +774,7 @@ static Variable EffectDispelMagicAll(const std::vector<Variable> &args, const Ro
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDisguise(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDisguise(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDisguiseAppearance = getInt(args, 0);
 
@@ -785,25 +785,25 @@ static Variable EffectDisguise(const std::vector<Variable> &args, const RoutineC
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTrueSeeing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTrueSeeing(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<TrueSeeingEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSeeInvisible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSeeInvisible(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<SeeInvisibleEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectTimeStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectTimeStop(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<TimeStopEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBlasterDeflectionIncrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBlasterDeflectionIncrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nChange = getInt(args, 0);
 
@@ -814,7 +814,7 @@ static Variable EffectBlasterDeflectionIncrease(const std::vector<Variable> &arg
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBlasterDeflectionDecrease(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBlasterDeflectionDecrease(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nChange = getInt(args, 0);
 
@@ -825,13 +825,13 @@ static Variable EffectBlasterDeflectionDecrease(const std::vector<Variable> &arg
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectHorrified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectHorrified(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<HorrifiedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectSpellLevelAbsorption(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectSpellLevelAbsorption(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nMaxSpellLevelAbsorbed = getInt(args, 0);
     auto nTotalSpellLevelsAbsorbed = getIntOrElse(args, 1, 0);
@@ -844,7 +844,7 @@ static Variable EffectSpellLevelAbsorption(const std::vector<Variable> &args, co
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDispelMagicBest(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDispelMagicBest(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCasterLevel = getInt(args, 0);
 
@@ -855,7 +855,7 @@ static Variable EffectDispelMagicBest(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMissChance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMissChance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPercentage = getInt(args, 0);
 
@@ -866,7 +866,7 @@ static Variable EffectMissChance(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectModifyAttacks(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectModifyAttacks(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAttacks = getInt(args, 0);
 
@@ -877,7 +877,7 @@ static Variable EffectModifyAttacks(const std::vector<Variable> &args, const Rou
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDamageShield(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDamageShield(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageAmount = getInt(args, 0);
     auto nRandomAmount = getInt(args, 1);
@@ -891,7 +891,7 @@ static Variable EffectDamageShield(const std::vector<Variable> &args, const Rout
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceDrain(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceDrain(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamage = getInt(args, 0);
 
@@ -902,13 +902,13 @@ static Variable EffectForceDrain(const std::vector<Variable> &args, const Routin
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectPsychicStatic(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectPsychicStatic(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<PsychicStaticEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectLightsaberThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectLightsaberThrow(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget1 = getObject(args, 0, ctx);
     auto oTarget2 = getObjectOrNull(args, 1, ctx);
@@ -926,31 +926,31 @@ static Variable EffectLightsaberThrow(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectWhirlWind(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectWhirlWind(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<WhirlWindEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCutSceneHorrified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCutSceneHorrified(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CutsceneHorrifiedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCutSceneParalyze(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCutSceneParalyze(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CutsceneParalyzeEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCutSceneStunned(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCutSceneStunned(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CutsceneStunnedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceBody(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceBody(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nLevel = getInt(args, 0);
 
@@ -961,19 +961,19 @@ static Variable EffectForceBody(const std::vector<Variable> &args, const Routine
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFury(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFury(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<FuryEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectBlind(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectBlind(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<BlindEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFPRegenModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFPRegenModifier(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPercent = getInt(args, 0);
 
@@ -984,7 +984,7 @@ static Variable EffectFPRegenModifier(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectVPRegenModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectVPRegenModifier(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPercent = getInt(args, 0);
 
@@ -995,31 +995,31 @@ static Variable EffectVPRegenModifier(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectCrush(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectCrush(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<CrushEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDroidConfused(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDroidConfused(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<DroidConfusedEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectForceSight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectForceSight(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<ForceSightEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectMindTrick(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectMindTrick(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<MindTrickEffect>();
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectFactionModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectFactionModifier(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNewFaction = getInt(args, 0);
 
@@ -1030,7 +1030,7 @@ static Variable EffectFactionModifier(const std::vector<Variable> &args, const R
     return Variable::ofEffect(std::move(effect));
 }
 
-static Variable EffectDroidScramble(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EffectDroidScramble(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto effect = ctx.game.newEffect<DroidScrambleEffect>();
     return Variable::ofEffect(std::move(effect));
@@ -59,7 +59,7 @@ namespace reone {
 
 namespace game {
 
-static Variable Random(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable Random(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nMaxInteger = getInt(args, 0);
     if (nMaxInteger <= 0) {
@@ -72,7 +72,7 @@ static Variable Random(const std::vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(randomInt(0, nMaxInteger - 1));
 }
 
-static Variable PrintString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -83,7 +83,7 @@ static Variable PrintString(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable PrintFloat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintFloat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fFloat = getFloat(args, 0);
     auto nWidth = getIntOrElse(args, 1, 18);
@@ -95,7 +95,7 @@ static Variable PrintFloat(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("PrintFloat");
 }
 
-static Variable FloatToString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatToString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fFloat = getFloat(args, 0);
     auto nWidth = getIntOrElse(args, 1, 18);
@@ -107,7 +107,7 @@ static Variable FloatToString(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofString(std::to_string(fFloat));
 }
 
-static Variable PrintInteger(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintInteger(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -117,7 +117,7 @@ static Variable PrintInteger(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("PrintInteger");
 }
 
-static Variable PrintObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -127,7 +127,7 @@ static Variable PrintObject(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("PrintObject");
 }
 
-static Variable AssignCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AssignCommand(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oActionSubject = getObject(args, 0, ctx);
     auto aActionToAssign = getAction(args, 1);
@@ -140,7 +140,7 @@ static Variable AssignCommand(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable DelayCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DelayCommand(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fSeconds = getFloat(args, 0);
     auto aActionToDelay = getAction(args, 1);
@@ -153,7 +153,7 @@ static Variable DelayCommand(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-static Variable ExecuteScript(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExecuteScript(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sScript = getString(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -166,13 +166,13 @@ static Variable ExecuteScript(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable ClearAllActions(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ClearAllActions(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     getCaller(ctx)->clearAllActions();
     return Variable::ofNull();
 }
 
-static Variable SetFacing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFacing(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fDirection = getFloat(args, 0);
 
@@ -184,7 +184,7 @@ static Variable SetFacing(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-static Variable SwitchPlayerCharacter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SwitchPlayerCharacter(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -194,7 +194,7 @@ static Variable SwitchPlayerCharacter(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SwitchPlayerCharacter");
 }
 
-static Variable SetTime(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTime(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nHour = getInt(args, 0);
     auto nMinute = getInt(args, 1);
@@ -207,7 +207,7 @@ static Variable SetTime(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("SetTime");
 }
 
-static Variable SetPartyLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPartyLeader(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -218,7 +218,7 @@ static Variable SetPartyLeader(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable SetAreaUnescapable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAreaUnescapable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bUnescapable = getInt(args, 0);
 
@@ -230,33 +230,33 @@ static Variable SetAreaUnescapable(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable GetAreaUnescapable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAreaUnescapable(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     bool unescapable = ctx.game.module()->area()->isUnescapable();
     return Variable::ofInt(static_cast<int>(unescapable));
 }
 
-static Variable GetTimeHour(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeHour(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeHour");
 }
 
-static Variable GetTimeMinute(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeMinute(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeMinute");
 }
 
-static Variable GetTimeSecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeSecond(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeSecond");
 }
 
-static Variable GetTimeMillisecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTimeMillisecond(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTimeMillisecond");
 }
 
-static Variable GetArea(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetArea(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -267,19 +267,19 @@ static Variable GetArea(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofObject(getObjectIdOrInvalid(area));
 }
 
-static Variable GetEnteringObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEnteringObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetExitingObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetExitingObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -289,7 +289,7 @@ static Variable GetPosition(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofVector(oTarget->position());
 }
 
-static Variable GetFacing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFacing(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -300,7 +300,7 @@ static Variable GetFacing(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofFloat(facing);
 }
 
-static Variable GetItemPossessor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemPossessor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -310,7 +310,7 @@ static Variable GetItemPossessor(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetItemPossessor");
 }
 
-static Variable GetItemPossessedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemPossessedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto sItemTag = getString(args, 1);
@@ -327,7 +327,7 @@ static Variable GetItemPossessedBy(const std::vector<Variable> &args, const Rout
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable CreateItemOnObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateItemOnObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sItemTemplate = getString(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -345,7 +345,7 @@ static Variable CreateItemOnObject(const std::vector<Variable> &args, const Rout
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable GetLastAttacker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttacker(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttackee = getObjectOrCaller(args, 0, ctx);
 
@@ -355,7 +355,7 @@ static Variable GetLastAttacker(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetLastAttacker");
 }
 
-static Variable GetNearestCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFirstCriteriaType = getInt(args, 0);
     auto nFirstCriteriaValue = getInt(args, 1);
@@ -384,7 +384,7 @@ static Variable GetNearestCreature(const std::vector<Variable> &args, const Rout
     return Variable::ofObject(getObjectIdOrInvalid(creature));
 }
 
-static Variable GetDistanceToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -395,7 +395,7 @@ static Variable GetDistanceToObject(const std::vector<Variable> &args, const Rou
     return Variable::ofFloat(caller->getDistanceTo(*oObject));
 }
 
-static Variable GetIsObjectValid(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsObjectValid(Span<const Variable> args, const RoutineContext &ctx) {
     bool valid;
     try {
         auto oObject = getObject(args, 0, ctx);
@@ -406,7 +406,7 @@ static Variable GetIsObjectValid(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<bool>(valid));
 }
 
-static Variable SetCameraFacing(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCameraFacing(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fDirection = getFloat(args, 0);
 
@@ -416,7 +416,7 @@ static Variable SetCameraFacing(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetCameraFacing");
 }
 
-static Variable PlaySound(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlaySound(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sSoundName = getString(args, 0);
 
@@ -426,12 +426,12 @@ static Variable PlaySound(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("PlaySound");
 }
 
-static Variable GetSpellTargetObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellTargetObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellTargetObject");
 }
 
-static Variable GetCurrentHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -442,7 +442,7 @@ static Variable GetCurrentHitPoints(const std::vector<Variable> &args, const Rou
     return Variable::ofInt(hitPoints);
 }
 
-static Variable GetMaxHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMaxHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -453,17 +453,17 @@ static Variable GetMaxHitPoints(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(hitPoints);
 }
 
-static Variable GetLastItemEquipped(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastItemEquipped(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastItemEquipped");
 }
 
-static Variable GetSubScreenID(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSubScreenID(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSubScreenID");
 }
 
-static Variable CancelCombat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CancelCombat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oidCreature = getObject(args, 0, ctx);
 
@@ -473,7 +473,7 @@ static Variable CancelCombat(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("CancelCombat");
 }
 
-static Variable GetCurrentForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -483,7 +483,7 @@ static Variable GetCurrentForcePoints(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetCurrentForcePoints");
 }
 
-static Variable GetMaxForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMaxForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -493,7 +493,7 @@ static Variable GetMaxForcePoints(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetMaxForcePoints");
 }
 
-static Variable PauseGame(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PauseGame(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bPause = getInt(args, 0);
 
@@ -503,7 +503,7 @@ static Variable PauseGame(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("PauseGame");
 }
 
-static Variable SetPlayerRestrictMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlayerRestrictMode(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bRestrict = getInt(args, 0);
 
@@ -515,7 +515,7 @@ static Variable SetPlayerRestrictMode(const std::vector<Variable> &args, const R
     return Variable::ofNull();
 }
 
-static Variable GetStringLength(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringLength(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -525,7 +525,7 @@ static Variable GetStringLength(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(static_cast<int>(sString.length()));
 }
 
-static Variable GetStringUpperCase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringUpperCase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -535,7 +535,7 @@ static Variable GetStringUpperCase(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetStringUpperCase");
 }
 
-static Variable GetStringLowerCase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringLowerCase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
 
@@ -545,7 +545,7 @@ static Variable GetStringLowerCase(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetStringLowerCase");
 }
 
-static Variable GetStringRight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringRight(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nCount = getInt(args, 1);
@@ -560,7 +560,7 @@ static Variable GetStringRight(const std::vector<Variable> &args, const RoutineC
     return Variable::ofString(std::move(right));
 }
 
-static Variable GetStringLeft(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringLeft(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nCount = getInt(args, 1);
@@ -575,7 +575,7 @@ static Variable GetStringLeft(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofString(std::move(left));
 }
 
-static Variable InsertString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable InsertString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sDestination = getString(args, 0);
     auto sString = getString(args, 1);
@@ -587,7 +587,7 @@ static Variable InsertString(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("InsertString");
 }
 
-static Variable GetSubString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSubString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nStart = getInt(args, 1);
@@ -599,7 +599,7 @@ static Variable GetSubString(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofString(sString.substr(nStart, nStart));
 }
 
-static Variable FindSubString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FindSubString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto sSubString = getString(args, 1);
@@ -611,7 +611,7 @@ static Variable FindSubString(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(pos != std::string::npos ? static_cast<int>(pos) : -1);
 }
 
-static Variable fabs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable fabs(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -621,7 +621,7 @@ static Variable fabs(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("fabs");
 }
 
-static Variable cos(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable cos(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -631,7 +631,7 @@ static Variable cos(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("cos");
 }
 
-static Variable sin(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable sin(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -641,7 +641,7 @@ static Variable sin(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("sin");
 }
 
-static Variable tan(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable tan(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -651,7 +651,7 @@ static Variable tan(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("tan");
 }
 
-static Variable acos(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable acos(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -661,7 +661,7 @@ static Variable acos(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("acos");
 }
 
-static Variable asin(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable asin(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -671,7 +671,7 @@ static Variable asin(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("asin");
 }
 
-static Variable atan(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable atan(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -681,7 +681,7 @@ static Variable atan(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("atan");
 }
 
-static Variable log(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable log(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -691,7 +691,7 @@ static Variable log(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("log");
 }
 
-static Variable pow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable pow(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
     auto fExponent = getFloat(args, 1);
@@ -702,7 +702,7 @@ static Variable pow(const std::vector<Variable> &args, const RoutineContext &ctx
     throw RoutineNotImplementedException("pow");
 }
 
-static Variable sqrt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable sqrt(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fValue = getFloat(args, 0);
 
@@ -712,7 +712,7 @@ static Variable sqrt(const std::vector<Variable> &args, const RoutineContext &ct
     throw RoutineNotImplementedException("sqrt");
 }
 
-static Variable abs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable abs(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nValue = getInt(args, 0);
 
@@ -722,7 +722,7 @@ static Variable abs(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(std::abs(nValue));
 }
 
-static Variable GetPlayerRestrictMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlayerRestrictMode(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -733,7 +733,7 @@ static Variable GetPlayerRestrictMode(const std::vector<Variable> &args, const R
     return Variable::ofInt(static_cast<int>(restrict));
 }
 
-static Variable GetCasterLevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCasterLevel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -743,7 +743,7 @@ static Variable GetCasterLevel(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetCasterLevel");
 }
 
-static Variable GetFirstEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -754,7 +754,7 @@ static Variable GetFirstEffect(const std::vector<Variable> &args, const RoutineC
     return Variable::ofEffect(creature->getFirstEffect());
 }
 
-static Variable GetNextEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -765,7 +765,7 @@ static Variable GetNextEffect(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofEffect(creature->getNextEffect());
 }
 
-static Variable RemoveEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto eEffect = getEffect(args, 1);
@@ -776,7 +776,7 @@ static Variable RemoveEffect(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("RemoveEffect");
 }
 
-static Variable GetIsEffectValid(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsEffectValid(Span<const Variable> args, const RoutineContext &ctx) {
     bool valid;
     try {
         auto eEffect = getEffect(args, 0);
@@ -787,7 +787,7 @@ static Variable GetIsEffectValid(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(valid));
 }
 
-static Variable GetEffectDurationType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectDurationType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -797,7 +797,7 @@ static Variable GetEffectDurationType(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetEffectDurationType");
 }
 
-static Variable GetEffectSubType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectSubType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -807,7 +807,7 @@ static Variable GetEffectSubType(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetEffectSubType");
 }
 
-static Variable GetEffectCreator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectCreator(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -817,7 +817,7 @@ static Variable GetEffectCreator(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetEffectCreator");
 }
 
-static Variable IntToString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IntToString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -827,7 +827,7 @@ static Variable IntToString(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofString(std::to_string(nInteger));
 }
 
-static Variable GetFirstObjectInArea(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstObjectInArea(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObjectOrNull(args, 0, ctx);
     auto nObjectFilter = getIntOrElse(args, 1, 1);
@@ -838,7 +838,7 @@ static Variable GetFirstObjectInArea(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetFirstObjectInArea");
 }
 
-static Variable GetNextObjectInArea(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextObjectInArea(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObjectOrNull(args, 0, ctx);
     auto nObjectFilter = getIntOrElse(args, 1, 1);
@@ -849,7 +849,7 @@ static Variable GetNextObjectInArea(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetNextObjectInArea");
 }
 
-static Variable d2(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d2(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -864,7 +864,7 @@ static Variable d2(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d3(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d3(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -879,7 +879,7 @@ static Variable d3(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d4(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d4(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -894,7 +894,7 @@ static Variable d4(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d6(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d6(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -909,7 +909,7 @@ static Variable d6(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d8(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d8(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -924,7 +924,7 @@ static Variable d8(const std::vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(total);
 }
 
-static Variable d10(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d10(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -939,7 +939,7 @@ static Variable d10(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(total);
 }
 
-static Variable d12(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d12(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -954,7 +954,7 @@ static Variable d12(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(total);
 }
 
-static Variable d20(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d20(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -969,7 +969,7 @@ static Variable d20(const std::vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(total);
 }
 
-static Variable d100(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable d100(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumDice = getIntOrElse(args, 0, 1);
 
@@ -984,7 +984,7 @@ static Variable d100(const std::vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(total);
 }
 
-static Variable VectorMagnitude(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VectorMagnitude(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
 
@@ -994,12 +994,12 @@ static Variable VectorMagnitude(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("VectorMagnitude");
 }
 
-static Variable GetMetaMagicFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMetaMagicFeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetMetaMagicFeat");
 }
 
-static Variable GetObjectType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -1009,7 +1009,7 @@ static Variable GetObjectType(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(oTarget->type()));
 }
 
-static Variable GetRacialType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRacialType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1020,7 +1020,7 @@ static Variable GetRacialType(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(creature->racialType()));
 }
 
-static Variable FortitudeSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FortitudeSave(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nDC = getInt(args, 1);
@@ -1033,7 +1033,7 @@ static Variable FortitudeSave(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("FortitudeSave");
 }
 
-static Variable ReflexSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ReflexSave(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nDC = getInt(args, 1);
@@ -1046,7 +1046,7 @@ static Variable ReflexSave(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("ReflexSave");
 }
 
-static Variable WillSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable WillSave(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nDC = getInt(args, 1);
@@ -1059,12 +1059,12 @@ static Variable WillSave(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("WillSave");
 }
 
-static Variable GetSpellSaveDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellSaveDC(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellSaveDC");
 }
 
-static Variable MagicalEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MagicalEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1074,7 +1074,7 @@ static Variable MagicalEffect(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("MagicalEffect");
 }
 
-static Variable SupernaturalEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SupernaturalEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1084,7 +1084,7 @@ static Variable SupernaturalEffect(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SupernaturalEffect");
 }
 
-static Variable ExtraordinaryEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExtraordinaryEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1094,7 +1094,7 @@ static Variable ExtraordinaryEffect(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("ExtraordinaryEffect");
 }
 
-static Variable GetAC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nForFutureUse = getIntOrElse(args, 1, 0);
@@ -1105,7 +1105,7 @@ static Variable GetAC(const std::vector<Variable> &args, const RoutineContext &c
     throw RoutineNotImplementedException("GetAC");
 }
 
-static Variable RoundsToSeconds(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RoundsToSeconds(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nRounds = getInt(args, 0);
 
@@ -1115,7 +1115,7 @@ static Variable RoundsToSeconds(const std::vector<Variable> &args, const Routine
     return Variable::ofFloat(nRounds / 6.0f);
 }
 
-static Variable HoursToSeconds(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable HoursToSeconds(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nHours = getInt(args, 0);
 
@@ -1125,7 +1125,7 @@ static Variable HoursToSeconds(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(nHours * 3600);
 }
 
-static Variable TurnsToSeconds(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TurnsToSeconds(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nTurns = getInt(args, 0);
 
@@ -1135,7 +1135,7 @@ static Variable TurnsToSeconds(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("TurnsToSeconds");
 }
 
-static Variable SoundObjectSetFixedVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetFixedVariance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto fFixedVariance = getFloat(args, 1);
@@ -1146,7 +1146,7 @@ static Variable SoundObjectSetFixedVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectSetFixedVariance");
 }
 
-static Variable GetGoodEvilValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGoodEvilValue(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1156,12 +1156,12 @@ static Variable GetGoodEvilValue(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetGoodEvilValue");
 }
 
-static Variable GetPartyMemberCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyMemberCount(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(ctx.game.party().getSize());
 }
 
-static Variable GetAlignmentGoodEvil(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAlignmentGoodEvil(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1171,7 +1171,7 @@ static Variable GetAlignmentGoodEvil(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetAlignmentGoodEvil");
 }
 
-static Variable GetFirstObjectInShape(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstObjectInShape(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nShape = getInt(args, 0);
     auto fSize = getFloat(args, 1);
@@ -1186,7 +1186,7 @@ static Variable GetFirstObjectInShape(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetFirstObjectInShape");
 }
 
-static Variable GetNextObjectInShape(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextObjectInShape(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nShape = getInt(args, 0);
     auto fSize = getFloat(args, 1);
@@ -1201,7 +1201,7 @@ static Variable GetNextObjectInShape(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetNextObjectInShape");
 }
 
-static Variable SignalEvent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SignalEvent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto evToRun = getEvent(args, 1);
@@ -1214,7 +1214,7 @@ static Variable SignalEvent(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable EventUserDefined(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventUserDefined(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nUserDefinedEventNumber = getInt(args, 0);
 
@@ -1225,7 +1225,7 @@ static Variable EventUserDefined(const std::vector<Variable> &args, const Routin
     return Variable::ofEvent(std::move(event));
 }
 
-static Variable VectorNormalize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VectorNormalize(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
 
@@ -1235,7 +1235,7 @@ static Variable VectorNormalize(const std::vector<Variable> &args, const Routine
     return Variable::ofVector(glm::normalize(vVector));
 }
 
-static Variable GetItemStackSize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemStackSize(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -1246,7 +1246,7 @@ static Variable GetItemStackSize(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(item->stackSize());
 }
 
-static Variable GetAbilityScore(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAbilityScore(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nAbilityType = getInt(args, 1);
@@ -1259,7 +1259,7 @@ static Variable GetAbilityScore(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(creature->attributes().getAbilityScore(ability));
 }
 
-static Variable GetIsDead(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDead(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1270,7 +1270,7 @@ static Variable GetIsDead(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(creature->isDead()));
 }
 
-static Variable PrintVector(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PrintVector(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
     auto bPrepend = getInt(args, 1);
@@ -1281,7 +1281,7 @@ static Variable PrintVector(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("PrintVector");
 }
 
-static Variable Vector(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable Vector(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto x = getFloatOrElse(args, 0, 0.0f);
     auto y = getFloatOrElse(args, 1, 0.0f);
@@ -1293,7 +1293,7 @@ static Variable Vector(const std::vector<Variable> &args, const RoutineContext &
     return Variable::ofVector(glm::vec3(x, y, z));
 }
 
-static Variable SetFacingPoint(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFacingPoint(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vTarget = getVector(args, 0);
 
@@ -1305,7 +1305,7 @@ static Variable SetFacingPoint(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable AngleToVector(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AngleToVector(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fAngle = getFloat(args, 0);
 
@@ -1316,7 +1316,7 @@ static Variable AngleToVector(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofVector(std::move(vector));
 }
 
-static Variable VectorToAngle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VectorToAngle(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vVector = getVector(args, 0);
 
@@ -1326,7 +1326,7 @@ static Variable VectorToAngle(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("VectorToAngle");
 }
 
-static Variable TouchAttackMelee(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TouchAttackMelee(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto bDisplayFeedback = getIntOrElse(args, 1, 1);
@@ -1337,7 +1337,7 @@ static Variable TouchAttackMelee(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("TouchAttackMelee");
 }
 
-static Variable TouchAttackRanged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TouchAttackRanged(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto bDisplayFeedback = getIntOrElse(args, 1, 1);
@@ -1348,7 +1348,7 @@ static Variable TouchAttackRanged(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("TouchAttackRanged");
 }
 
-static Variable SetItemStackSize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetItemStackSize(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto nStackSize = getInt(args, 1);
@@ -1361,7 +1361,7 @@ static Variable SetItemStackSize(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable GetDistanceBetween(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetween(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObjectA = getObject(args, 0, ctx);
     auto oObjectB = getObject(args, 1, ctx);
@@ -1372,7 +1372,7 @@ static Variable GetDistanceBetween(const std::vector<Variable> &args, const Rout
     return Variable::ofFloat(oObjectA->getDistanceTo(*oObjectB));
 }
 
-static Variable SetReturnStrref(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetReturnStrref(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bShow = getInt(args, 0);
     auto srStringRef = getIntOrElse(args, 1, 0);
@@ -1384,7 +1384,7 @@ static Variable SetReturnStrref(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetReturnStrref");
 }
 
-static Variable GetItemInSlot(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemInSlot(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nInventorySlot = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -1397,7 +1397,7 @@ static Variable GetItemInSlot(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable SetGlobalString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto sValue = getString(args, 1);
@@ -1409,7 +1409,7 @@ static Variable SetGlobalString(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable SetCommandable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCommandable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bCommandable = getInt(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -1422,7 +1422,7 @@ static Variable SetCommandable(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable GetCommandable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCommandable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -1432,7 +1432,7 @@ static Variable GetCommandable(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(static_cast<int>(oTarget->isCommandable()));
 }
 
-static Variable GetHitDice(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHitDice(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1443,7 +1443,7 @@ static Variable GetHitDice(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(creature->attributes().getAggregateLevel());
 }
 
-static Variable GetTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -1453,7 +1453,7 @@ static Variable GetTag(const std::vector<Variable> &args, const RoutineContext &
     return Variable::ofString(oObject->tag());
 }
 
-static Variable ResistForce(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ResistForce(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSource = getObject(args, 0, ctx);
     auto oTarget = getObject(args, 1, ctx);
@@ -1464,7 +1464,7 @@ static Variable ResistForce(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("ResistForce");
 }
 
-static Variable GetEffectType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -1474,7 +1474,7 @@ static Variable GetEffectType(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(eEffect->type()));
 }
 
-static Variable GetFactionEqual(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionEqual(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFirstObject = getObject(args, 0, ctx);
     auto oSecondObject = getObjectOrCaller(args, 1, ctx);
@@ -1487,7 +1487,7 @@ static Variable GetFactionEqual(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(static_cast<int>(firstObject->faction() == secondObject->faction()));
 }
 
-static Variable ChangeFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeFaction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObjectToChangeFaction = getObject(args, 0, ctx);
     auto oMemberOfFactionToJoin = getObject(args, 1, ctx);
@@ -1498,7 +1498,7 @@ static Variable ChangeFaction(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("ChangeFaction");
 }
 
-static Variable GetIsListening(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsListening(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -1508,7 +1508,7 @@ static Variable GetIsListening(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetIsListening");
 }
 
-static Variable SetListening(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetListening(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto bValue = getInt(args, 1);
@@ -1519,7 +1519,7 @@ static Variable SetListening(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SetListening");
 }
 
-static Variable SetListenPattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetListenPattern(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto sPattern = getString(args, 1);
@@ -1531,7 +1531,7 @@ static Variable SetListenPattern(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetListenPattern");
 }
 
-static Variable TestStringAgainstPattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TestStringAgainstPattern(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sPattern = getString(args, 0);
     auto sStringToTest = getString(args, 1);
@@ -1542,7 +1542,7 @@ static Variable TestStringAgainstPattern(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("TestStringAgainstPattern");
 }
 
-static Variable GetMatchedSubstring(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMatchedSubstring(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nString = getInt(args, 0);
 
@@ -1552,12 +1552,12 @@ static Variable GetMatchedSubstring(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetMatchedSubstring");
 }
 
-static Variable GetMatchedSubstringsCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMatchedSubstringsCount(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetMatchedSubstringsCount");
 }
 
-static Variable GetFactionWeakestMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionWeakestMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1568,7 +1568,7 @@ static Variable GetFactionWeakestMember(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetFactionWeakestMember");
 }
 
-static Variable GetFactionStrongestMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionStrongestMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1579,7 +1579,7 @@ static Variable GetFactionStrongestMember(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetFactionStrongestMember");
 }
 
-static Variable GetFactionMostDamagedMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionMostDamagedMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1590,7 +1590,7 @@ static Variable GetFactionMostDamagedMember(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetFactionMostDamagedMember");
 }
 
-static Variable GetFactionLeastDamagedMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionLeastDamagedMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1601,7 +1601,7 @@ static Variable GetFactionLeastDamagedMember(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("GetFactionLeastDamagedMember");
 }
 
-static Variable GetFactionGold(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionGold(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1611,7 +1611,7 @@ static Variable GetFactionGold(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetFactionGold");
 }
 
-static Variable GetFactionAverageReputation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageReputation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSourceFactionMember = getObject(args, 0, ctx);
     auto oTarget = getObject(args, 1, ctx);
@@ -1622,7 +1622,7 @@ static Variable GetFactionAverageReputation(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetFactionAverageReputation");
 }
 
-static Variable GetFactionAverageGoodEvilAlignment(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageGoodEvilAlignment(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1632,7 +1632,7 @@ static Variable GetFactionAverageGoodEvilAlignment(const std::vector<Variable> &
     throw RoutineNotImplementedException("GetFactionAverageGoodEvilAlignment");
 }
 
-static Variable SoundObjectGetFixedVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectGetFixedVariance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -1642,7 +1642,7 @@ static Variable SoundObjectGetFixedVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectGetFixedVariance");
 }
 
-static Variable GetFactionAverageLevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageLevel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1652,7 +1652,7 @@ static Variable GetFactionAverageLevel(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetFactionAverageLevel");
 }
 
-static Variable GetFactionAverageXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionAverageXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1662,7 +1662,7 @@ static Variable GetFactionAverageXP(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetFactionAverageXP");
 }
 
-static Variable GetFactionMostFrequentClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionMostFrequentClass(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObject(args, 0, ctx);
 
@@ -1672,7 +1672,7 @@ static Variable GetFactionMostFrequentClass(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetFactionMostFrequentClass");
 }
 
-static Variable GetFactionWorstAC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionWorstAC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1683,7 +1683,7 @@ static Variable GetFactionWorstAC(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetFactionWorstAC");
 }
 
-static Variable GetFactionBestAC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionBestAC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFactionMember = getObjectOrCaller(args, 0, ctx);
     auto bMustBeVisible = getIntOrElse(args, 1, 1);
@@ -1694,7 +1694,7 @@ static Variable GetFactionBestAC(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetFactionBestAC");
 }
 
-static Variable GetGlobalString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -1704,12 +1704,12 @@ static Variable GetGlobalString(const std::vector<Variable> &args, const Routine
     return Variable::ofString(ctx.game.getGlobalString(sIdentifier));
 }
 
-static Variable GetListenPatternNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetListenPatternNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetListenPatternNumber");
 }
 
-static Variable GetWaypointByTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWaypointByTag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sWaypointTag = getString(args, 0);
 
@@ -1727,7 +1727,7 @@ static Variable GetWaypointByTag(const std::vector<Variable> &args, const Routin
     return Variable::ofObject(getObjectIdOrInvalid(waypoint));
 }
 
-static Variable GetTransitionTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTransitionTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTransition = getObject(args, 0, ctx);
 
@@ -1737,7 +1737,7 @@ static Variable GetTransitionTarget(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetTransitionTarget");
 }
 
-static Variable GetObjectByTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectByTag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sTag = getString(args, 0);
     auto nNth = getIntOrElse(args, 1, 0);
@@ -1755,7 +1755,7 @@ static Variable GetObjectByTag(const std::vector<Variable> &args, const RoutineC
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable AdjustAlignment(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustAlignment(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSubject = getObject(args, 0, ctx);
     auto nAlignment = getInt(args, 1);
@@ -1768,7 +1768,7 @@ static Variable AdjustAlignment(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("AdjustAlignment");
 }
 
-static Variable SetAreaTransitionBMP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAreaTransitionBMP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPredefinedAreaTransition = getInt(args, 0);
     auto sCustomAreaTransitionBMP = getStringOrElse(args, 1, "");
@@ -1779,7 +1779,7 @@ static Variable SetAreaTransitionBMP(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetAreaTransitionBMP");
 }
 
-static Variable GetReputation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetReputation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSource = getObject(args, 0, ctx);
     auto oTarget = getObject(args, 1, ctx);
@@ -1790,7 +1790,7 @@ static Variable GetReputation(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetReputation");
 }
 
-static Variable AdjustReputation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustReputation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSourceFactionMember = getObject(args, 1, ctx);
@@ -1802,12 +1802,12 @@ static Variable AdjustReputation(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("AdjustReputation");
 }
 
-static Variable GetModuleFileName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleFileName(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleFileName");
 }
 
-static Variable GetGoingToBeAttackedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGoingToBeAttackedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -1817,7 +1817,7 @@ static Variable GetGoingToBeAttackedBy(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetGoingToBeAttackedBy");
 }
 
-static Variable GetLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -1827,7 +1827,7 @@ static Variable GetLocation(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofLocation(ctx.game.newLocation(oObject->position(), oObject->getFacing()));
 }
 
-static Variable CreateLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vPosition = getVector(args, 0);
     auto fOrientation = getFloat(args, 1);
@@ -1839,7 +1839,7 @@ static Variable CreateLocation(const std::vector<Variable> &args, const RoutineC
     return Variable::ofLocation(ctx.game.newLocation(std::move(vPosition), orientation));
 }
 
-static Variable ApplyEffectAtLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ApplyEffectAtLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDurationType = getInt(args, 0);
     auto eEffect = getEffect(args, 1);
@@ -1852,7 +1852,7 @@ static Variable ApplyEffectAtLocation(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("ApplyEffectAtLocation");
 }
 
-static Variable GetIsPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -1864,7 +1864,7 @@ static Variable GetIsPC(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofInt(static_cast<int>(pc));
 }
 
-static Variable FeetToMeters(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FeetToMeters(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fFeet = getFloat(args, 0);
 
@@ -1874,7 +1874,7 @@ static Variable FeetToMeters(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("FeetToMeters");
 }
 
-static Variable YardsToMeters(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable YardsToMeters(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fYards = getFloat(args, 0);
 
@@ -1884,7 +1884,7 @@ static Variable YardsToMeters(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("YardsToMeters");
 }
 
-static Variable ApplyEffectToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ApplyEffectToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDurationType = getInt(args, 0);
     auto eEffect = getEffect(args, 1);
@@ -1899,7 +1899,7 @@ static Variable ApplyEffectToObject(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable SpeakString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpeakString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sStringToSpeak = getString(args, 0);
     auto nTalkVolume = getIntOrElse(args, 1, 0);
@@ -1910,12 +1910,12 @@ static Variable SpeakString(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("SpeakString");
 }
 
-static Variable GetSpellTargetLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellTargetLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellTargetLocation");
 }
 
-static Variable GetPositionFromLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPositionFromLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lLocation = getLocationArgument(args, 0);
 
@@ -1925,7 +1925,7 @@ static Variable GetPositionFromLocation(const std::vector<Variable> &args, const
     return Variable::ofVector(lLocation->position());
 }
 
-static Variable GetFacingFromLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFacingFromLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lLocation = getLocationArgument(args, 0);
 
@@ -1935,7 +1935,7 @@ static Variable GetFacingFromLocation(const std::vector<Variable> &args, const R
     return Variable::ofFloat(glm::degrees(lLocation->facing()));
 }
 
-static Variable GetNearestCreatureToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestCreatureToLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFirstCriteriaType = getInt(args, 0);
     auto nFirstCriteriaValue = getInt(args, 1);
@@ -1952,7 +1952,7 @@ static Variable GetNearestCreatureToLocation(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("GetNearestCreatureToLocation");
 }
 
-static Variable GetNearestObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nObjectType = getIntOrElse(args, 0, 32767);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -1968,7 +1968,7 @@ static Variable GetNearestObject(const std::vector<Variable> &args, const Routin
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable GetNearestObjectToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestObjectToLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nObjectType = getInt(args, 0);
     auto lLocation = getLocationArgument(args, 1);
@@ -1980,7 +1980,7 @@ static Variable GetNearestObjectToLocation(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetNearestObjectToLocation");
 }
 
-static Variable GetNearestObjectByTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestObjectByTag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sTag = getString(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -1996,7 +1996,7 @@ static Variable GetNearestObjectByTag(const std::vector<Variable> &args, const R
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable IntToFloat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IntToFloat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -2006,7 +2006,7 @@ static Variable IntToFloat(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofFloat(static_cast<float>(nInteger));
 }
 
-static Variable FloatToInt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatToInt(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fFloat = getFloat(args, 0);
 
@@ -2016,7 +2016,7 @@ static Variable FloatToInt(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(fFloat));
 }
 
-static Variable StringToInt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StringToInt(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sNumber = getString(args, 0);
 
@@ -2030,7 +2030,7 @@ static Variable StringToInt(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(intValue);
 }
 
-static Variable StringToFloat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StringToFloat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sNumber = getString(args, 0);
 
@@ -2040,7 +2040,7 @@ static Variable StringToFloat(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("StringToFloat");
 }
 
-static Variable GetIsEnemy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsEnemy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2054,7 +2054,7 @@ static Variable GetIsEnemy(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(enemy));
 }
 
-static Variable GetIsFriend(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsFriend(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2068,7 +2068,7 @@ static Variable GetIsFriend(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(isFriend));
 }
 
-static Variable GetIsNeutral(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsNeutral(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2082,13 +2082,13 @@ static Variable GetIsNeutral(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofInt(static_cast<int>(neutral));
 }
 
-static Variable GetPCSpeaker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPCSpeaker(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto player = ctx.game.party().player();
     return Variable::ofObject(getObjectIdOrInvalid(player));
 }
 
-static Variable GetStringByStrRef(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStringByStrRef(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
 
@@ -2098,7 +2098,7 @@ static Variable GetStringByStrRef(const std::vector<Variable> &args, const Routi
     return Variable::ofString(ctx.services.resource.strings.getText(nStrRef));
 }
 
-static Variable DestroyObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DestroyObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oDestroy = getObject(args, 0, ctx);
     auto fDelay = getFloatOrElse(args, 1, 0.0f);
@@ -2113,12 +2113,12 @@ static Variable DestroyObject(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable GetModule(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModule(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofObject(getObjectIdOrInvalid(ctx.game.module()));
 }
 
-static Variable CreateObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nObjectType = getInt(args, 0);
     auto sTemplate = getString(args, 1);
@@ -2134,7 +2134,7 @@ static Variable CreateObject(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-static Variable EventSpellCastAt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventSpellCastAt(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCaster = getObject(args, 0, ctx);
     auto nSpell = getInt(args, 1);
@@ -2146,37 +2146,37 @@ static Variable EventSpellCastAt(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("EventSpellCastAt");
 }
 
-static Variable GetLastSpellCaster(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpellCaster(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpellCaster");
 }
 
-static Variable GetLastSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpell(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpell");
 }
 
-static Variable GetUserDefinedEventNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetUserDefinedEventNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(ctx.execution.userDefinedEventNumber);
 }
 
-static Variable GetSpellId(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellId(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellId");
 }
 
-static Variable RandomName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RandomName(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("RandomName");
 }
 
-static Variable GetLoadFromSaveGame(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLoadFromSaveGame(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLoadFromSaveGame");
 }
 
-static Variable GetName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetName(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -2186,12 +2186,12 @@ static Variable GetName(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofString(oObject->name());
 }
 
-static Variable GetLastSpeaker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpeaker(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpeaker");
 }
 
-static Variable BeginConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable BeginConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sResRef = getStringOrElse(args, 0, "");
     auto oObjectToDialog = getObjectOrNull(args, 1, ctx);
@@ -2202,48 +2202,48 @@ static Variable BeginConversation(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("BeginConversation");
 }
 
-static Variable GetLastPerceived(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceived(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     auto perceived = caller->perception().lastPerceived;
     return Variable::ofObject(getObjectIdOrInvalid(perceived));
 }
 
-static Variable GetLastPerceptionHeard(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionHeard(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool heard = caller->perception().lastPerception == PerceptionType::Heard;
     return Variable::ofInt(static_cast<int>(heard));
 }
 
-static Variable GetLastPerceptionInaudible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionInaudible(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool inaudible = caller->perception().lastPerception == PerceptionType::NotHeard;
     return Variable::ofInt(static_cast<int>(inaudible));
 }
 
-static Variable GetLastPerceptionSeen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionSeen(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool seen = caller->perception().lastPerception == PerceptionType::Seen;
     return Variable::ofInt(static_cast<int>(seen));
 }
 
-static Variable GetLastClosedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastClosedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetLastPerceptionVanished(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPerceptionVanished(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     bool vanished = caller->perception().lastPerception == PerceptionType::NotSeen;
     return Variable::ofInt(static_cast<int>(vanished));
 }
 
-static Variable GetFirstInPersistentObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstInPersistentObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPersistentObject = getObjectOrCaller(args, 0, ctx);
     auto nResidentObjectType = getIntOrElse(args, 1, 1);
@@ -2255,7 +2255,7 @@ static Variable GetFirstInPersistentObject(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetFirstInPersistentObject");
 }
 
-static Variable GetNextInPersistentObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextInPersistentObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPersistentObject = getObjectOrCaller(args, 0, ctx);
     auto nResidentObjectType = getIntOrElse(args, 1, 1);
@@ -2267,7 +2267,7 @@ static Variable GetNextInPersistentObject(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetNextInPersistentObject");
 }
 
-static Variable GetAreaOfEffectCreator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAreaOfEffectCreator(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAreaOfEffectObject = getObjectOrCaller(args, 0, ctx);
 
@@ -2277,12 +2277,12 @@ static Variable GetAreaOfEffectCreator(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetAreaOfEffectCreator");
 }
 
-static Variable ShowLevelUpGUI(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowLevelUpGUI(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ShowLevelUpGUI");
 }
 
-static Variable SetItemNonEquippable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetItemNonEquippable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto bNonEquippable = getInt(args, 1);
@@ -2293,12 +2293,12 @@ static Variable SetItemNonEquippable(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetItemNonEquippable");
 }
 
-static Variable GetButtonMashCheck(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetButtonMashCheck(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetButtonMashCheck");
 }
 
-static Variable SetButtonMashCheck(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetButtonMashCheck(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCheck = getInt(args, 0);
 
@@ -2308,7 +2308,7 @@ static Variable SetButtonMashCheck(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetButtonMashCheck");
 }
 
-static Variable GiveItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GiveItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto oGiveTo = getObject(args, 1, ctx);
@@ -2319,7 +2319,7 @@ static Variable GiveItem(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("GiveItem");
 }
 
-static Variable ObjectToString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ObjectToString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -2329,7 +2329,7 @@ static Variable ObjectToString(const std::vector<Variable> &args, const RoutineC
     return Variable::ofString(str(boost::format("%x") % oObject->id()));
 }
 
-static Variable GetIsImmune(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsImmune(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nImmunityType = getInt(args, 1);
@@ -2341,7 +2341,7 @@ static Variable GetIsImmune(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetIsImmune");
 }
 
-static Variable GetEncounterActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterActive(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2351,7 +2351,7 @@ static Variable GetEncounterActive(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetEncounterActive");
 }
 
-static Variable SetEncounterActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterActive(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNewValue = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2362,7 +2362,7 @@ static Variable SetEncounterActive(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetEncounterActive");
 }
 
-static Variable GetEncounterSpawnsMax(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterSpawnsMax(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2372,7 +2372,7 @@ static Variable GetEncounterSpawnsMax(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetEncounterSpawnsMax");
 }
 
-static Variable SetEncounterSpawnsMax(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterSpawnsMax(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNewValue = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2383,7 +2383,7 @@ static Variable SetEncounterSpawnsMax(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SetEncounterSpawnsMax");
 }
 
-static Variable GetEncounterSpawnsCurrent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterSpawnsCurrent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2393,7 +2393,7 @@ static Variable GetEncounterSpawnsCurrent(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetEncounterSpawnsCurrent");
 }
 
-static Variable SetEncounterSpawnsCurrent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterSpawnsCurrent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNewValue = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2404,17 +2404,17 @@ static Variable SetEncounterSpawnsCurrent(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetEncounterSpawnsCurrent");
 }
 
-static Variable GetModuleItemAcquired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemAcquired(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemAcquired");
 }
 
-static Variable GetModuleItemAcquiredFrom(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemAcquiredFrom(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemAcquiredFrom");
 }
 
-static Variable SetCustomToken(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCustomToken(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCustomTokenNumber = getInt(args, 0);
     auto sTokenValue = getString(args, 1);
@@ -2425,7 +2425,7 @@ static Variable SetCustomToken(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SetCustomToken");
 }
 
-static Variable GetHasFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasFeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2439,7 +2439,7 @@ static Variable GetHasFeat(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(hasFeat));
 }
 
-static Variable GetHasSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasSkill(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2453,7 +2453,7 @@ static Variable GetHasSkill(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(hasSkill));
 }
 
-static Variable GetObjectSeen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectSeen(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2466,7 +2466,7 @@ static Variable GetObjectSeen(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(seen));
 }
 
-static Variable GetObjectHeard(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectHeard(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto oSource = getObjectOrCaller(args, 1, ctx);
@@ -2477,27 +2477,27 @@ static Variable GetObjectHeard(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetObjectHeard");
 }
 
-static Variable GetLastPlayerDied(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPlayerDied(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastPlayerDied");
 }
 
-static Variable GetModuleItemLost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemLost(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemLost");
 }
 
-static Variable GetModuleItemLostBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleItemLostBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleItemLostBy");
 }
 
-static Variable EventConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("EventConversation");
 }
 
-static Variable SetEncounterDifficulty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEncounterDifficulty(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nEncounterDifficulty = getInt(args, 0);
     auto oEncounter = getObjectOrCaller(args, 1, ctx);
@@ -2508,7 +2508,7 @@ static Variable SetEncounterDifficulty(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SetEncounterDifficulty");
 }
 
-static Variable GetEncounterDifficulty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEncounterDifficulty(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEncounter = getObjectOrCaller(args, 0, ctx);
 
@@ -2518,7 +2518,7 @@ static Variable GetEncounterDifficulty(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetEncounterDifficulty");
 }
 
-static Variable GetDistanceBetweenLocations(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetweenLocations(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lLocationA = getLocationArgument(args, 0);
     auto lLocationB = getLocationArgument(args, 1);
@@ -2529,7 +2529,7 @@ static Variable GetDistanceBetweenLocations(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("GetDistanceBetweenLocations");
 }
 
-static Variable GetReflexAdjustedDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetReflexAdjustedDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamage = getInt(args, 0);
     auto oTarget = getObject(args, 1, ctx);
@@ -2543,7 +2543,7 @@ static Variable GetReflexAdjustedDamage(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetReflexAdjustedDamage");
 }
 
-static Variable PlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayAnimation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAnimation = getInt(args, 0);
     auto fSpeed = getFloatOrElse(args, 1, 1.0f);
@@ -2560,7 +2560,7 @@ static Variable PlayAnimation(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable TalentSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TalentSpell(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
 
@@ -2570,7 +2570,7 @@ static Variable TalentSpell(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofTalent(ctx.game.newTalent(TalentType::Spell, nSpell));
 }
 
-static Variable TalentFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TalentFeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
 
@@ -2580,7 +2580,7 @@ static Variable TalentFeat(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofTalent(ctx.game.newTalent(TalentType::Feat, nFeat));
 }
 
-static Variable TalentSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TalentSkill(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
 
@@ -2590,7 +2590,7 @@ static Variable TalentSkill(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("TalentSkill");
 }
 
-static Variable GetHasSpellEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasSpellEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oObject = getObjectOrCaller(args, 1, ctx);
@@ -2601,7 +2601,7 @@ static Variable GetHasSpellEffect(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetHasSpellEffect");
 }
 
-static Variable GetEffectSpellId(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetEffectSpellId(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eSpellEffect = getEffect(args, 0);
 
@@ -2611,7 +2611,7 @@ static Variable GetEffectSpellId(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetEffectSpellId");
 }
 
-static Variable GetCreatureHasTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureHasTalent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2622,7 +2622,7 @@ static Variable GetCreatureHasTalent(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetCreatureHasTalent");
 }
 
-static Variable GetCreatureTalentRandom(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureTalentRandom(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCategory = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2634,7 +2634,7 @@ static Variable GetCreatureTalentRandom(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetCreatureTalentRandom");
 }
 
-static Variable GetCreatureTalentBest(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureTalentBest(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCategory = getInt(args, 0);
     auto nCRMax = getInt(args, 1);
@@ -2649,7 +2649,7 @@ static Variable GetCreatureTalentBest(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetCreatureTalentBest");
 }
 
-static Variable GetGoldPieceValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGoldPieceValue(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -2659,7 +2659,7 @@ static Variable GetGoldPieceValue(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetGoldPieceValue");
 }
 
-static Variable GetIsPlayableRacialType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPlayableRacialType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -2669,7 +2669,7 @@ static Variable GetIsPlayableRacialType(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetIsPlayableRacialType");
 }
 
-static Variable JumpToLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable JumpToLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lDestination = getLocationArgument(args, 0);
 
@@ -2681,7 +2681,7 @@ static Variable JumpToLocation(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable GetSkillRank(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSkillRank(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oTarget = getObjectOrCaller(args, 1, ctx);
@@ -2694,7 +2694,7 @@ static Variable GetSkillRank(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofInt(target->attributes().getSkillRank(skill));
 }
 
-static Variable GetAttackTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttackTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -2706,7 +2706,7 @@ static Variable GetAttackTarget(const std::vector<Variable> &args, const Routine
     return Variable::ofObject(getObjectIdOrInvalid(target));
 }
 
-static Variable GetLastAttackType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -2716,7 +2716,7 @@ static Variable GetLastAttackType(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetLastAttackType");
 }
 
-static Variable GetLastAttackMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackMode(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -2726,7 +2726,7 @@ static Variable GetLastAttackMode(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetLastAttackMode");
 }
 
-static Variable GetDistanceBetween2D(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetween2D(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObjectA = getObject(args, 0, ctx);
     auto oObjectB = getObject(args, 1, ctx);
@@ -2738,7 +2738,7 @@ static Variable GetDistanceBetween2D(const std::vector<Variable> &args, const Ro
     return Variable::ofFloat(distance);
 }
 
-static Variable GetIsInCombat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsInCombat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
     auto bOnlyCountReal = getIntOrElse(args, 1, 0);
@@ -2750,7 +2750,7 @@ static Variable GetIsInCombat(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(creature->isInCombat()));
 }
 
-static Variable GetLastAssociateCommand(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAssociateCommand(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAssociate = getObjectOrCaller(args, 0, ctx);
 
@@ -2760,7 +2760,7 @@ static Variable GetLastAssociateCommand(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetLastAssociateCommand");
 }
 
-static Variable GiveGoldToCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GiveGoldToCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nGP = getInt(args, 1);
@@ -2773,7 +2773,7 @@ static Variable GiveGoldToCreature(const std::vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-static Variable SetIsDestroyable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetIsDestroyable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bDestroyable = getInt(args, 0);
     auto bRaiseable = getIntOrElse(args, 1, 1);
@@ -2785,7 +2785,7 @@ static Variable SetIsDestroyable(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetIsDestroyable");
 }
 
-static Variable SetLocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLocked(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto bLocked = getInt(args, 1);
@@ -2799,7 +2799,7 @@ static Variable SetLocked(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-static Variable GetLocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocked(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -2810,12 +2810,12 @@ static Variable GetLocked(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(target->isLocked()));
 }
 
-static Variable GetClickingObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetClickingObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetClickingObject");
 }
 
-static Variable SetAssociateListenPatterns(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAssociateListenPatterns(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -2825,7 +2825,7 @@ static Variable SetAssociateListenPatterns(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SetAssociateListenPatterns");
 }
 
-static Variable GetLastWeaponUsed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastWeaponUsed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -2835,12 +2835,12 @@ static Variable GetLastWeaponUsed(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetLastWeaponUsed");
 }
 
-static Variable GetLastUsedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastUsedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastUsedBy");
 }
 
-static Variable GetAbilityModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAbilityModifier(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAbility = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2851,7 +2851,7 @@ static Variable GetAbilityModifier(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetAbilityModifier");
 }
 
-static Variable GetIdentified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIdentified(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -2861,7 +2861,7 @@ static Variable GetIdentified(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetIdentified");
 }
 
-static Variable SetIdentified(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetIdentified(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto bIdentified = getInt(args, 1);
@@ -2872,7 +2872,7 @@ static Variable SetIdentified(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetIdentified");
 }
 
-static Variable GetDistanceBetweenLocations2D(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceBetweenLocations2D(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto lLocationA = getLocationArgument(args, 0);
     auto lLocationB = getLocationArgument(args, 1);
@@ -2883,7 +2883,7 @@ static Variable GetDistanceBetweenLocations2D(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("GetDistanceBetweenLocations2D");
 }
 
-static Variable GetDistanceToObject2D(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDistanceToObject2D(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -2895,12 +2895,12 @@ static Variable GetDistanceToObject2D(const std::vector<Variable> &args, const R
     return Variable::ofFloat(result);
 }
 
-static Variable GetBlockingDoor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBlockingDoor(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetBlockingDoor");
 }
 
-static Variable GetIsDoorActionPossible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDoorActionPossible(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTargetDoor = getObject(args, 0, ctx);
     auto nDoorAction = getInt(args, 1);
@@ -2911,7 +2911,7 @@ static Variable GetIsDoorActionPossible(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetIsDoorActionPossible");
 }
 
-static Variable DoDoorAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DoDoorAction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTargetDoor = getObject(args, 0, ctx);
     auto nDoorAction = getInt(args, 1);
@@ -2922,7 +2922,7 @@ static Variable DoDoorAction(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("DoDoorAction");
 }
 
-static Variable GetFirstItemInInventory(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstItemInInventory(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -2933,7 +2933,7 @@ static Variable GetFirstItemInInventory(const std::vector<Variable> &args, const
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable GetNextItemInInventory(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextItemInInventory(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -2944,7 +2944,7 @@ static Variable GetNextItemInInventory(const std::vector<Variable> &args, const
     return Variable::ofObject(getObjectIdOrInvalid(item));
 }
 
-static Variable GetClassByPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetClassByPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nClassPosition = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2957,7 +2957,7 @@ static Variable GetClassByPosition(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(static_cast<int>(clazz));
 }
 
-static Variable GetLevelByPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLevelByPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nClassPosition = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2970,7 +2970,7 @@ static Variable GetLevelByPosition(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(level);
 }
 
-static Variable GetLevelByClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLevelByClass(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nClassType = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -2984,7 +2984,7 @@ static Variable GetLevelByClass(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(level);
 }
 
-static Variable GetDamageDealtByType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDamageDealtByType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDamageType = getInt(args, 0);
 
@@ -2994,47 +2994,47 @@ static Variable GetDamageDealtByType(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetDamageDealtByType");
 }
 
-static Variable GetTotalDamageDealt(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTotalDamageDealt(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetTotalDamageDealt");
 }
 
-static Variable GetLastDamager(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastDamager(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastDamager");
 }
 
-static Variable GetLastDisarmed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastDisarmed(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastDisarmed");
 }
 
-static Variable GetLastDisturbed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastDisturbed(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastDisturbed");
 }
 
-static Variable GetLastLocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastLocked(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastLocked");
 }
 
-static Variable GetLastUnlocked(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastUnlocked(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastUnlocked");
 }
 
-static Variable GetInventoryDisturbType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetInventoryDisturbType(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetInventoryDisturbType");
 }
 
-static Variable GetInventoryDisturbItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetInventoryDisturbItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetInventoryDisturbItem");
 }
 
-static Variable ShowUpgradeScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowUpgradeScreen(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObjectOrNull(args, 0, ctx);
     auto oCharacter = getObjectOrNull(args, 1, ctx);
@@ -3048,7 +3048,7 @@ static Variable ShowUpgradeScreen(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("ShowUpgradeScreen");
 }
 
-static Variable VersusAlignmentEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VersusAlignmentEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
     auto nLawChaos = getIntOrElse(args, 1, 0);
@@ -3060,7 +3060,7 @@ static Variable VersusAlignmentEffect(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("VersusAlignmentEffect");
 }
 
-static Variable VersusRacialTypeEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VersusRacialTypeEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
     auto nRacialType = getInt(args, 1);
@@ -3071,7 +3071,7 @@ static Variable VersusRacialTypeEffect(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("VersusRacialTypeEffect");
 }
 
-static Variable VersusTrapEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable VersusTrapEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
 
@@ -3081,7 +3081,7 @@ static Variable VersusTrapEffect(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("VersusTrapEffect");
 }
 
-static Variable GetGender(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGender(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -3092,7 +3092,7 @@ static Variable GetGender(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(creature->gender()));
 }
 
-static Variable GetIsTalentValid(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsTalentValid(Span<const Variable> args, const RoutineContext &ctx) {
     bool valid;
     try {
         auto tTalent = getTalent(args, 0);
@@ -3103,14 +3103,14 @@ static Variable GetIsTalentValid(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(valid));
 }
 
-static Variable GetAttemptedAttackTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttemptedAttackTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     auto target = caller->getAttemptedAttackTarget();
     return Variable::ofObject(getObjectIdOrInvalid(target));
 }
 
-static Variable GetTypeFromTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTypeFromTalent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
 
@@ -3120,7 +3120,7 @@ static Variable GetTypeFromTalent(const std::vector<Variable> &args, const Routi
     return Variable::ofInt(static_cast<int>(tTalent->type()));
 }
 
-static Variable GetIdFromTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIdFromTalent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
 
@@ -3130,7 +3130,7 @@ static Variable GetIdFromTalent(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetIdFromTalent");
 }
 
-static Variable PlayPazaak(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayPazaak(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nOpponentPazaakDeck = getInt(args, 0);
     auto sEndScript = getString(args, 1);
@@ -3144,12 +3144,12 @@ static Variable PlayPazaak(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("PlayPazaak");
 }
 
-static Variable GetLastPazaakResult(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPazaakResult(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastPazaakResult");
 }
 
-static Variable DisplayFeedBackText(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisplayFeedBackText(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nTextConstant = getInt(args, 1);
@@ -3160,7 +3160,7 @@ static Variable DisplayFeedBackText(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("DisplayFeedBackText");
 }
 
-static Variable AddJournalQuestEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddJournalQuestEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
     auto nState = getInt(args, 1);
@@ -3172,7 +3172,7 @@ static Variable AddJournalQuestEntry(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("AddJournalQuestEntry");
 }
 
-static Variable RemoveJournalQuestEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveJournalQuestEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
 
@@ -3182,7 +3182,7 @@ static Variable RemoveJournalQuestEntry(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("RemoveJournalQuestEntry");
 }
 
-static Variable GetJournalEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetJournalEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
 
@@ -3192,7 +3192,7 @@ static Variable GetJournalEntry(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetJournalEntry");
 }
 
-static Variable PlayRumblePattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayRumblePattern(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPattern = getInt(args, 0);
 
@@ -3202,7 +3202,7 @@ static Variable PlayRumblePattern(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("PlayRumblePattern");
 }
 
-static Variable StopRumblePattern(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StopRumblePattern(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPattern = getInt(args, 0);
 
@@ -3212,7 +3212,7 @@ static Variable StopRumblePattern(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("StopRumblePattern");
 }
 
-static Variable SendMessageToPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SendMessageToPC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlayer = getObject(args, 0, ctx);
     auto szMessage = getString(args, 1);
@@ -3223,18 +3223,18 @@ static Variable SendMessageToPC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SendMessageToPC");
 }
 
-static Variable GetAttemptedSpellTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttemptedSpellTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetAttemptedSpellTarget");
 }
 
-static Variable GetLastOpenedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastOpenedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-static Variable GetHasSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasSpell(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -3245,7 +3245,7 @@ static Variable GetHasSpell(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetHasSpell");
 }
 
-static Variable OpenStore(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable OpenStore(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oStore = getObject(args, 0, ctx);
     auto oPC = getObject(args, 1, ctx);
@@ -3258,7 +3258,7 @@ static Variable OpenStore(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("OpenStore");
 }
 
-static Variable GetFirstFactionMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstFactionMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMemberOfFaction = getObject(args, 0, ctx);
     auto bPCOnly = getIntOrElse(args, 1, 1);
@@ -3269,7 +3269,7 @@ static Variable GetFirstFactionMember(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetFirstFactionMember");
 }
 
-static Variable GetNextFactionMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextFactionMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMemberOfFaction = getObject(args, 0, ctx);
     auto bPCOnly = getIntOrElse(args, 1, 1);
@@ -3280,7 +3280,7 @@ static Variable GetNextFactionMember(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetNextFactionMember");
 }
 
-static Variable GetJournalQuestExperience(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetJournalQuestExperience(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
 
@@ -3290,7 +3290,7 @@ static Variable GetJournalQuestExperience(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetJournalQuestExperience");
 }
 
-static Variable JumpToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable JumpToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oToJumpTo = getObject(args, 0, ctx);
     auto nWalkStraightLineToPoint = getIntOrElse(args, 1, 1);
@@ -3304,7 +3304,7 @@ static Variable JumpToObject(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-static Variable SetMapPinEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMapPinEnabled(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMapPin = getObject(args, 0, ctx);
     auto nEnabled = getInt(args, 1);
@@ -3315,7 +3315,7 @@ static Variable SetMapPinEnabled(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetMapPinEnabled");
 }
 
-static Variable PopUpGUIPanel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PopUpGUIPanel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
     auto nGUIPanel = getInt(args, 1);
@@ -3326,7 +3326,7 @@ static Variable PopUpGUIPanel(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("PopUpGUIPanel");
 }
 
-static Variable AddMultiClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddMultiClass(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nClassType = getInt(args, 0);
     auto oSource = getObject(args, 1, ctx);
@@ -3337,7 +3337,7 @@ static Variable AddMultiClass(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("AddMultiClass");
 }
 
-static Variable GetIsLinkImmune(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsLinkImmune(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto eEffect = getEffect(args, 1);
@@ -3348,7 +3348,7 @@ static Variable GetIsLinkImmune(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetIsLinkImmune");
 }
 
-static Variable GiveXPToCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GiveXPToCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nXpAmount = getInt(args, 1);
@@ -3361,7 +3361,7 @@ static Variable GiveXPToCreature(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable SetXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nXpAmount = getInt(args, 1);
@@ -3374,7 +3374,7 @@ static Variable SetXP(const std::vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-static Variable GetXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -3385,7 +3385,7 @@ static Variable GetXP(const std::vector<Variable> &args, const RoutineContext &c
     return Variable::ofInt(creature->xp());
 }
 
-static Variable IntToHexString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IntToHexString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nInteger = getInt(args, 0);
 
@@ -3395,7 +3395,7 @@ static Variable IntToHexString(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("IntToHexString");
 }
 
-static Variable GetBaseItemType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBaseItemType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -3406,7 +3406,7 @@ static Variable GetBaseItemType(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(item->baseItemType());
 }
 
-static Variable GetItemHasItemProperty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemHasItemProperty(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto nProperty = getInt(args, 1);
@@ -3417,7 +3417,7 @@ static Variable GetItemHasItemProperty(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetItemHasItemProperty");
 }
 
-static Variable GetItemACValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemACValue(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -3427,7 +3427,7 @@ static Variable GetItemACValue(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetItemACValue");
 }
 
-static Variable ExploreAreaForPlayer(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExploreAreaForPlayer(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto oPlayer = getObject(args, 1, ctx);
@@ -3438,27 +3438,27 @@ static Variable ExploreAreaForPlayer(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("ExploreAreaForPlayer");
 }
 
-static Variable GetIsDay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDay(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsDay");
 }
 
-static Variable GetIsNight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsNight(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsNight");
 }
 
-static Variable GetIsDawn(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDawn(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsDawn");
 }
 
-static Variable GetIsDusk(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDusk(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsDusk");
 }
 
-static Variable GetIsEncounterCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsEncounterCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -3468,17 +3468,17 @@ static Variable GetIsEncounterCreature(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetIsEncounterCreature");
 }
 
-static Variable GetLastPlayerDying(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastPlayerDying(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastPlayerDying");
 }
 
-static Variable GetStartingLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStartingLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetStartingLocation");
 }
 
-static Variable ChangeToStandardFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeToStandardFaction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreatureToChange = getObject(args, 0, ctx);
     auto nStandardFaction = getInt(args, 1);
@@ -3489,7 +3489,7 @@ static Variable ChangeToStandardFaction(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("ChangeToStandardFaction");
 }
 
-static Variable SoundObjectPlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectPlay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -3501,7 +3501,7 @@ static Variable SoundObjectPlay(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable SoundObjectStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectStop(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -3513,7 +3513,7 @@ static Variable SoundObjectStop(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable SoundObjectSetVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto nVolume = getInt(args, 1);
@@ -3524,7 +3524,7 @@ static Variable SoundObjectSetVolume(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SoundObjectSetVolume");
 }
 
-static Variable SoundObjectSetPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto vPosition = getVector(args, 1);
@@ -3535,7 +3535,7 @@ static Variable SoundObjectSetPosition(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SoundObjectSetPosition");
 }
 
-static Variable SpeakOneLinerConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpeakOneLinerConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sDialogResRef = getStringOrElse(args, 0, "");
     auto oTokenTarget = getObjectOrNull(args, 1, ctx);
@@ -3546,7 +3546,7 @@ static Variable SpeakOneLinerConversation(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SpeakOneLinerConversation");
 }
 
-static Variable GetGold(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGold(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3557,12 +3557,12 @@ static Variable GetGold(const std::vector<Variable> &args, const RoutineContext
     return Variable::ofInt(creature->gold());
 }
 
-static Variable GetLastRespawnButtonPresser(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastRespawnButtonPresser(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastRespawnButtonPresser");
 }
 
-static Variable SetLightsaberPowered(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLightsaberPowered(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto bOverride = getInt(args, 1);
@@ -3575,7 +3575,7 @@ static Variable SetLightsaberPowered(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetLightsaberPowered");
 }
 
-static Variable GetIsWeaponEffective(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsWeaponEffective(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oVersus = getObjectOrNull(args, 0, ctx);
     auto bOffHand = getIntOrElse(args, 1, 0);
@@ -3586,12 +3586,12 @@ static Variable GetIsWeaponEffective(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetIsWeaponEffective");
 }
 
-static Variable GetLastSpellHarmful(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastSpellHarmful(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastSpellHarmful");
 }
 
-static Variable EventActivateItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EventActivateItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
     auto lTarget = getLocationArgument(args, 1);
@@ -3603,7 +3603,7 @@ static Variable EventActivateItem(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("EventActivateItem");
 }
 
-static Variable MusicBackgroundPlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundPlay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3613,7 +3613,7 @@ static Variable MusicBackgroundPlay(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("MusicBackgroundPlay");
 }
 
-static Variable MusicBackgroundStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundStop(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3623,7 +3623,7 @@ static Variable MusicBackgroundStop(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("MusicBackgroundStop");
 }
 
-static Variable MusicBackgroundSetDelay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundSetDelay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nDelay = getInt(args, 1);
@@ -3634,7 +3634,7 @@ static Variable MusicBackgroundSetDelay(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("MusicBackgroundSetDelay");
 }
 
-static Variable MusicBackgroundChangeDay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundChangeDay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3646,7 +3646,7 @@ static Variable MusicBackgroundChangeDay(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("MusicBackgroundChangeDay");
 }
 
-static Variable MusicBackgroundChangeNight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundChangeNight(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3658,7 +3658,7 @@ static Variable MusicBackgroundChangeNight(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("MusicBackgroundChangeNight");
 }
 
-static Variable MusicBattlePlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBattlePlay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3668,7 +3668,7 @@ static Variable MusicBattlePlay(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("MusicBattlePlay");
 }
 
-static Variable MusicBattleStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBattleStop(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3678,7 +3678,7 @@ static Variable MusicBattleStop(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("MusicBattleStop");
 }
 
-static Variable MusicBattleChange(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBattleChange(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3689,7 +3689,7 @@ static Variable MusicBattleChange(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("MusicBattleChange");
 }
 
-static Variable AmbientSoundPlay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundPlay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3699,7 +3699,7 @@ static Variable AmbientSoundPlay(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("AmbientSoundPlay");
 }
 
-static Variable AmbientSoundStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundStop(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -3709,7 +3709,7 @@ static Variable AmbientSoundStop(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("AmbientSoundStop");
 }
 
-static Variable AmbientSoundChangeDay(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundChangeDay(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3720,7 +3720,7 @@ static Variable AmbientSoundChangeDay(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("AmbientSoundChangeDay");
 }
 
-static Variable AmbientSoundChangeNight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundChangeNight(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nTrack = getInt(args, 1);
@@ -3731,37 +3731,37 @@ static Variable AmbientSoundChangeNight(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("AmbientSoundChangeNight");
 }
 
-static Variable GetLastKiller(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastKiller(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastKiller");
 }
 
-static Variable GetSpellCastItem(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellCastItem(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellCastItem");
 }
 
-static Variable GetItemActivated(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivated(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivated");
 }
 
-static Variable GetItemActivator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivator(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivator");
 }
 
-static Variable GetItemActivatedTargetLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivatedTargetLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivatedTargetLocation");
 }
 
-static Variable GetItemActivatedTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemActivatedTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemActivatedTarget");
 }
 
-static Variable GetIsOpen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsOpen(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -3771,7 +3771,7 @@ static Variable GetIsOpen(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(oObject->isOpen()));
 }
 
-static Variable TakeGoldFromCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable TakeGoldFromCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAmount = getInt(args, 0);
     auto oCreatureToTakeFrom = getObject(args, 1, ctx);
@@ -3792,7 +3792,7 @@ static Variable TakeGoldFromCreature(const std::vector<Variable> &args, const Ro
     return Variable::ofNull();
 }
 
-static Variable GetIsInConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsInConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -3802,7 +3802,7 @@ static Variable GetIsInConversation(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetIsInConversation");
 }
 
-static Variable GetPlotFlag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlotFlag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3813,7 +3813,7 @@ static Variable GetPlotFlag(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(plotFlag));
 }
 
-static Variable SetPlotFlag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlotFlag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nPlotFlag = getInt(args, 1);
@@ -3826,7 +3826,7 @@ static Variable SetPlotFlag(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable SetDialogPlaceableCamera(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetDialogPlaceableCamera(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCameraId = getInt(args, 0);
 
@@ -3836,18 +3836,18 @@ static Variable SetDialogPlaceableCamera(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("SetDialogPlaceableCamera");
 }
 
-static Variable GetSoloMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSoloMode(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     bool solo = ctx.game.party().isSoloMode();
     return Variable::ofInt(static_cast<int>(solo));
 }
 
-static Variable GetMaxStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMaxStealthXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetMaxStealthXP");
 }
 
-static Variable SetMaxStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMaxStealthXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nMax = getInt(args, 0);
 
@@ -3858,13 +3858,13 @@ static Variable SetMaxStealthXP(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable GetCurrentStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentStealthXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     int xp = ctx.game.module()->area()->currentStealthXP();
     return Variable::ofInt(xp);
 }
 
-static Variable GetNumStackedItems(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNumStackedItems(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -3874,12 +3874,12 @@ static Variable GetNumStackedItems(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetNumStackedItems");
 }
 
-static Variable SurrenderToEnemies(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SurrenderToEnemies(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SurrenderToEnemies");
 }
 
-static Variable SetCurrentStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCurrentStealthXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCurrent = getInt(args, 0);
 
@@ -3890,7 +3890,7 @@ static Variable SetCurrentStealthXP(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable GetCreatureSize(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureSize(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -3900,7 +3900,7 @@ static Variable GetCreatureSize(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetCreatureSize");
 }
 
-static Variable AwardStealthXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AwardStealthXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3910,12 +3910,12 @@ static Variable AwardStealthXP(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("AwardStealthXP");
 }
 
-static Variable GetStealthXPEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStealthXPEnabled(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetStealthXPEnabled");
 }
 
-static Variable SetStealthXPEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetStealthXPEnabled(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bEnabled = getInt(args, 0);
 
@@ -3927,7 +3927,7 @@ static Variable SetStealthXPEnabled(const std::vector<Variable> &args, const Rou
     return Variable::ofNull();
 }
 
-static Variable GetLastTrapDetected(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastTrapDetected(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3937,7 +3937,7 @@ static Variable GetLastTrapDetected(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetLastTrapDetected");
 }
 
-static Variable GetNearestTrapToObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNearestTrapToObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
     auto nTrapDetected = getIntOrElse(args, 1, 1);
@@ -3948,12 +3948,12 @@ static Variable GetNearestTrapToObject(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetNearestTrapToObject");
 }
 
-static Variable GetAttemptedMovementTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAttemptedMovementTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetAttemptedMovementTarget");
 }
 
-static Variable GetBlockingCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBlockingCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -3963,7 +3963,7 @@ static Variable GetBlockingCreature(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetBlockingCreature");
 }
 
-static Variable GetFortitudeSavingThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFortitudeSavingThrow(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3973,7 +3973,7 @@ static Variable GetFortitudeSavingThrow(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetFortitudeSavingThrow");
 }
 
-static Variable GetWillSavingThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWillSavingThrow(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3983,7 +3983,7 @@ static Variable GetWillSavingThrow(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetWillSavingThrow");
 }
 
-static Variable GetReflexSavingThrow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetReflexSavingThrow(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -3993,7 +3993,7 @@ static Variable GetReflexSavingThrow(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetReflexSavingThrow");
 }
 
-static Variable GetChallengeRating(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetChallengeRating(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4003,7 +4003,7 @@ static Variable GetChallengeRating(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetChallengeRating");
 }
 
-static Variable GetFoundEnemyCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFoundEnemyCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObjectOrCaller(args, 0, ctx);
 
@@ -4013,7 +4013,7 @@ static Variable GetFoundEnemyCreature(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetFoundEnemyCreature");
 }
 
-static Variable GetMovementRate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMovementRate(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4023,7 +4023,7 @@ static Variable GetMovementRate(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetMovementRate");
 }
 
-static Variable GetSubRace(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSubRace(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4034,12 +4034,12 @@ static Variable GetSubRace(const std::vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(creature->subrace()));
 }
 
-static Variable GetStealthXPDecrement(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStealthXPDecrement(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetStealthXPDecrement");
 }
 
-static Variable SetStealthXPDecrement(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetStealthXPDecrement(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nDecrement = getInt(args, 0);
 
@@ -4049,7 +4049,7 @@ static Variable SetStealthXPDecrement(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SetStealthXPDecrement");
 }
 
-static Variable DuplicateHeadAppearance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DuplicateHeadAppearance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oidCreatureToChange = getObject(args, 0, ctx);
     auto oidCreatureToMatch = getObject(args, 1, ctx);
@@ -4060,7 +4060,7 @@ static Variable DuplicateHeadAppearance(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("DuplicateHeadAppearance");
 }
 
-static Variable CutsceneAttack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CutsceneAttack(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nAnimation = getInt(args, 1);
@@ -4076,7 +4076,7 @@ static Variable CutsceneAttack(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable SetCameraMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCameraMode(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlayer = getObject(args, 0, ctx);
     auto nCameraMode = getInt(args, 1);
@@ -4087,7 +4087,7 @@ static Variable SetCameraMode(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetCameraMode");
 }
 
-static Variable SetLockOrientationInDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLockOrientationInDialog(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nValue = getInt(args, 1);
@@ -4098,7 +4098,7 @@ static Variable SetLockOrientationInDialog(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SetLockOrientationInDialog");
 }
 
-static Variable SetLockHeadFollowInDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLockHeadFollowInDialog(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nValue = getInt(args, 1);
@@ -4109,7 +4109,7 @@ static Variable SetLockHeadFollowInDialog(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetLockHeadFollowInDialog");
 }
 
-static Variable CutsceneMove(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CutsceneMove(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto vPosition = getVector(args, 1);
@@ -4121,7 +4121,7 @@ static Variable CutsceneMove(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("CutsceneMove");
 }
 
-static Variable EnableVideoEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EnableVideoEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nEffectType = getInt(args, 0);
 
@@ -4131,7 +4131,7 @@ static Variable EnableVideoEffect(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("EnableVideoEffect");
 }
 
-static Variable StartNewModule(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StartNewModule(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sModuleName = getString(args, 0);
     auto sWayPoint = getStringOrElse(args, 1, "");
@@ -4151,12 +4151,12 @@ static Variable StartNewModule(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable DisableVideoEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisableVideoEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("DisableVideoEffect");
 }
 
-static Variable GetWeaponRanged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWeaponRanged(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oItem = getObject(args, 0, ctx);
 
@@ -4166,23 +4166,23 @@ static Variable GetWeaponRanged(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetWeaponRanged");
 }
 
-static Variable DoSinglePlayerAutoSave(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DoSinglePlayerAutoSave(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("DoSinglePlayerAutoSave");
 }
 
-static Variable GetGameDifficulty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGameDifficulty(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetGameDifficulty");
 }
 
-static Variable GetUserActionsPending(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetUserActionsPending(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = checkCreature(getCaller(ctx));
     return Variable::ofInt(static_cast<int>(caller->hasUserActionsPending()));
 }
 
-static Variable RevealMap(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RevealMap(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vPoint = getVectorOrElse(args, 0, glm::vec3(0.0f, 0.0f, 0.0f));
     auto nRadius = getIntOrElse(args, 1, -1);
@@ -4193,7 +4193,7 @@ static Variable RevealMap(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("RevealMap");
 }
 
-static Variable SetTutorialWindowsEnabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTutorialWindowsEnabled(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bEnabled = getInt(args, 0);
 
@@ -4203,7 +4203,7 @@ static Variable SetTutorialWindowsEnabled(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetTutorialWindowsEnabled");
 }
 
-static Variable ShowTutorialWindow(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowTutorialWindow(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nWindow = getInt(args, 0);
 
@@ -4213,7 +4213,7 @@ static Variable ShowTutorialWindow(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("ShowTutorialWindow");
 }
 
-static Variable StartCreditSequence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable StartCreditSequence(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bTransparentBackground = getInt(args, 0);
 
@@ -4223,12 +4223,12 @@ static Variable StartCreditSequence(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("StartCreditSequence");
 }
 
-static Variable IsCreditSequenceInProgress(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsCreditSequenceInProgress(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("IsCreditSequenceInProgress");
 }
 
-static Variable GetCurrentAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCurrentAction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObjectOrCaller(args, 0, ctx);
 
@@ -4239,12 +4239,12 @@ static Variable GetCurrentAction(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(action ? action->type() : ActionType::QueueEmpty));
 }
 
-static Variable GetDifficultyModifier(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetDifficultyModifier(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetDifficultyModifier");
 }
 
-static Variable GetAppearanceType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetAppearanceType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4254,7 +4254,7 @@ static Variable GetAppearanceType(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetAppearanceType");
 }
 
-static Variable FloatingTextStrRefOnCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatingTextStrRefOnCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStrRefToDisplay = getInt(args, 0);
     auto oCreatureToFloatAbove = getObject(args, 1, ctx);
@@ -4266,7 +4266,7 @@ static Variable FloatingTextStrRefOnCreature(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("FloatingTextStrRefOnCreature");
 }
 
-static Variable FloatingTextStringOnCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FloatingTextStringOnCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sStringToDisplay = getString(args, 0);
     auto oCreatureToFloatAbove = getObject(args, 1, ctx);
@@ -4278,7 +4278,7 @@ static Variable FloatingTextStringOnCreature(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("FloatingTextStringOnCreature");
 }
 
-static Variable GetTrapDisarmable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDisarmable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4288,7 +4288,7 @@ static Variable GetTrapDisarmable(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetTrapDisarmable");
 }
 
-static Variable GetTrapDetectable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDetectable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4298,7 +4298,7 @@ static Variable GetTrapDetectable(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetTrapDetectable");
 }
 
-static Variable GetTrapDetectedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDetectedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
     auto oCreature = getObject(args, 1, ctx);
@@ -4309,7 +4309,7 @@ static Variable GetTrapDetectedBy(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("GetTrapDetectedBy");
 }
 
-static Variable GetTrapFlagged(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapFlagged(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4319,7 +4319,7 @@ static Variable GetTrapFlagged(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetTrapFlagged");
 }
 
-static Variable GetTrapBaseType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapBaseType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4329,7 +4329,7 @@ static Variable GetTrapBaseType(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetTrapBaseType");
 }
 
-static Variable GetTrapOneShot(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapOneShot(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4339,7 +4339,7 @@ static Variable GetTrapOneShot(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetTrapOneShot");
 }
 
-static Variable GetTrapCreator(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapCreator(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4349,7 +4349,7 @@ static Variable GetTrapCreator(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetTrapCreator");
 }
 
-static Variable GetTrapKeyTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapKeyTag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4359,7 +4359,7 @@ static Variable GetTrapKeyTag(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetTrapKeyTag");
 }
 
-static Variable GetTrapDisarmDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDisarmDC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4369,7 +4369,7 @@ static Variable GetTrapDisarmDC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetTrapDisarmDC");
 }
 
-static Variable GetTrapDetectDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetTrapDetectDC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrapObject = getObject(args, 0, ctx);
 
@@ -4379,7 +4379,7 @@ static Variable GetTrapDetectDC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetTrapDetectDC");
 }
 
-static Variable GetLockKeyRequired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockKeyRequired(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4389,7 +4389,7 @@ static Variable GetLockKeyRequired(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetLockKeyRequired");
 }
 
-static Variable GetLockKeyTag(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockKeyTag(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4399,7 +4399,7 @@ static Variable GetLockKeyTag(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetLockKeyTag");
 }
 
-static Variable GetLockLockable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockLockable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4409,7 +4409,7 @@ static Variable GetLockLockable(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetLockLockable");
 }
 
-static Variable GetLockUnlockDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockUnlockDC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4419,7 +4419,7 @@ static Variable GetLockUnlockDC(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetLockUnlockDC");
 }
 
-static Variable GetLockLockDC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLockLockDC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4429,12 +4429,12 @@ static Variable GetLockLockDC(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetLockLockDC");
 }
 
-static Variable GetPCLevellingUp(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPCLevellingUp(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetPCLevellingUp");
 }
 
-static Variable GetHasFeatEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasFeatEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oObject = getObjectOrCaller(args, 1, ctx);
@@ -4445,7 +4445,7 @@ static Variable GetHasFeatEffect(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetHasFeatEffect");
 }
 
-static Variable SetPlaceableIllumination(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlaceableIllumination(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObjectOrCaller(args, 0, ctx);
     auto bIlluminate = getIntOrElse(args, 1, 1);
@@ -4456,7 +4456,7 @@ static Variable SetPlaceableIllumination(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("SetPlaceableIllumination");
 }
 
-static Variable GetPlaceableIllumination(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlaceableIllumination(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObjectOrCaller(args, 0, ctx);
 
@@ -4466,7 +4466,7 @@ static Variable GetPlaceableIllumination(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("GetPlaceableIllumination");
 }
 
-static Variable GetIsPlaceableObjectActionPossible(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPlaceableObjectActionPossible(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
     auto nPlaceableAction = getInt(args, 1);
@@ -4477,7 +4477,7 @@ static Variable GetIsPlaceableObjectActionPossible(const std::vector<Variable> &
     throw RoutineNotImplementedException("GetIsPlaceableObjectActionPossible");
 }
 
-static Variable DoPlaceableObjectAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DoPlaceableObjectAction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
     auto nPlaceableAction = getInt(args, 1);
@@ -4488,18 +4488,18 @@ static Variable DoPlaceableObjectAction(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("DoPlaceableObjectAction");
 }
 
-static Variable GetFirstPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstPC(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto player = ctx.game.party().player();
     return Variable::ofObject(getObjectIdOrInvalid(player));
 }
 
-static Variable GetNextPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextPC(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofObject(kObjectInvalid);
 }
 
-static Variable SetTrapDetectedBy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTrapDetectedBy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrap = getObject(args, 0, ctx);
     auto oDetector = getObject(args, 1, ctx);
@@ -4510,7 +4510,7 @@ static Variable SetTrapDetectedBy(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SetTrapDetectedBy");
 }
 
-static Variable GetIsTrapped(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsTrapped(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4520,7 +4520,7 @@ static Variable GetIsTrapped(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("GetIsTrapped");
 }
 
-static Variable SetEffectIcon(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetEffectIcon(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto eEffect = getEffect(args, 0);
     auto nIcon = getInt(args, 1);
@@ -4531,7 +4531,7 @@ static Variable SetEffectIcon(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetEffectIcon");
 }
 
-static Variable FaceObjectAwayFromObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable FaceObjectAwayFromObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFacer = getObject(args, 0, ctx);
     auto oObjectToFaceAwayFrom = getObject(args, 1, ctx);
@@ -4543,7 +4543,7 @@ static Variable FaceObjectAwayFromObject(const std::vector<Variable> &args, cons
     return Variable::ofNull();
 }
 
-static Variable PopUpDeathGUIPanel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PopUpDeathGUIPanel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
     auto bRespawnButtonEnabled = getIntOrElse(args, 1, 1);
@@ -4557,7 +4557,7 @@ static Variable PopUpDeathGUIPanel(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("PopUpDeathGUIPanel");
 }
 
-static Variable SetTrapDisabled(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetTrapDisabled(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTrap = getObject(args, 0, ctx);
 
@@ -4567,7 +4567,7 @@ static Variable SetTrapDisabled(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetTrapDisabled");
 }
 
-static Variable GetLastHostileActor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastHostileActor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oVictim = getObjectOrCaller(args, 0, ctx);
 
@@ -4577,12 +4577,12 @@ static Variable GetLastHostileActor(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetLastHostileActor");
 }
 
-static Variable ExportAllCharacters(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ExportAllCharacters(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ExportAllCharacters");
 }
 
-static Variable MusicBackgroundGetDayTrack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundGetDayTrack(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -4592,7 +4592,7 @@ static Variable MusicBackgroundGetDayTrack(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("MusicBackgroundGetDayTrack");
 }
 
-static Variable MusicBackgroundGetNightTrack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundGetNightTrack(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -4602,7 +4602,7 @@ static Variable MusicBackgroundGetNightTrack(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("MusicBackgroundGetNightTrack");
 }
 
-static Variable WriteTimestampedLogEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable WriteTimestampedLogEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sLogEntry = getString(args, 0);
 
@@ -4612,12 +4612,12 @@ static Variable WriteTimestampedLogEntry(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("WriteTimestampedLogEntry");
 }
 
-static Variable GetModuleName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetModuleName(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetModuleName");
 }
 
-static Variable GetFactionLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFactionLeader(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMemberOfFaction = getObject(args, 0, ctx);
 
@@ -4627,7 +4627,7 @@ static Variable GetFactionLeader(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetFactionLeader");
 }
 
-static Variable EndGame(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EndGame(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nShowEndGameGui = getIntOrElse(args, 0, 1);
 
@@ -4637,12 +4637,12 @@ static Variable EndGame(const std::vector<Variable> &args, const RoutineContext
     throw RoutineNotImplementedException("EndGame");
 }
 
-static Variable GetRunScriptVar(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRunScriptVar(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(ctx.execution.scriptVar);
 }
 
-static Variable GetCreatureMovmentType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCreatureMovmentType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oidCreature = getObject(args, 0, ctx);
 
@@ -4652,7 +4652,7 @@ static Variable GetCreatureMovmentType(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetCreatureMovmentType");
 }
 
-static Variable AmbientSoundSetDayVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundSetDayVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nVolume = getInt(args, 1);
@@ -4663,7 +4663,7 @@ static Variable AmbientSoundSetDayVolume(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("AmbientSoundSetDayVolume");
 }
 
-static Variable AmbientSoundSetNightVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AmbientSoundSetNightVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto nVolume = getInt(args, 1);
@@ -4674,7 +4674,7 @@ static Variable AmbientSoundSetNightVolume(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("AmbientSoundSetNightVolume");
 }
 
-static Variable MusicBackgroundGetBattleTrack(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable MusicBackgroundGetBattleTrack(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
 
@@ -4684,7 +4684,7 @@ static Variable MusicBackgroundGetBattleTrack(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("MusicBackgroundGetBattleTrack");
 }
 
-static Variable GetHasInventory(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHasInventory(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -4694,7 +4694,7 @@ static Variable GetHasInventory(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetHasInventory");
 }
 
-static Variable GetStrRefSoundDuration(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStrRefSoundDuration(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
 
@@ -4704,7 +4704,7 @@ static Variable GetStrRefSoundDuration(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetStrRefSoundDuration");
 }
 
-static Variable AddToParty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddToParty(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
     auto oPartyLeader = getObject(args, 1, ctx);
@@ -4715,7 +4715,7 @@ static Variable AddToParty(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("AddToParty");
 }
 
-static Variable RemoveFromParty(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveFromParty(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPC = getObject(args, 0, ctx);
 
@@ -4725,7 +4725,7 @@ static Variable RemoveFromParty(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("RemoveFromParty");
 }
 
-static Variable AddPartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddPartyMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -4738,7 +4738,7 @@ static Variable AddPartyMember(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(static_cast<int>(added));
 }
 
-static Variable RemovePartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemovePartyMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -4756,7 +4756,7 @@ static Variable RemovePartyMember(const std::vector<Variable> &args, const Routi
     return Variable::ofInt(static_cast<int>(removed));
 }
 
-static Variable IsObjectPartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsObjectPartyMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -4768,7 +4768,7 @@ static Variable IsObjectPartyMember(const std::vector<Variable> &args, const Rou
     return Variable::ofInt(static_cast<int>(member));
 }
 
-static Variable GetPartyMemberByIndex(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyMemberByIndex(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
 
@@ -4779,7 +4779,7 @@ static Variable GetPartyMemberByIndex(const std::vector<Variable> &args, const R
     return Variable::ofObject(getObjectIdOrInvalid(member));
 }
 
-static Variable GetGlobalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalBoolean(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -4790,7 +4790,7 @@ static Variable GetGlobalBoolean(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(value));
 }
 
-static Variable SetGlobalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalBoolean(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nValue = getInt(args, 1);
@@ -4802,7 +4802,7 @@ static Variable SetGlobalBoolean(const std::vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-static Variable GetGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -4813,7 +4813,7 @@ static Variable GetGlobalNumber(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(value);
 }
 
-static Variable SetGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nValue = getInt(args, 1);
@@ -4825,7 +4825,7 @@ static Variable SetGlobalNumber(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable AurPostString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AurPostString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sString = getString(args, 0);
     auto nX = getInt(args, 1);
@@ -4838,7 +4838,7 @@ static Variable AurPostString(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("AurPostString");
 }
 
-static Variable AddJournalWorldEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddJournalWorldEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
     auto szEntry = getString(args, 1);
@@ -4850,7 +4850,7 @@ static Variable AddJournalWorldEntry(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("AddJournalWorldEntry");
 }
 
-static Variable AddJournalWorldEntryStrref(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddJournalWorldEntryStrref(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto strref = getInt(args, 0);
     auto strrefTitle = getInt(args, 1);
@@ -4861,7 +4861,7 @@ static Variable AddJournalWorldEntryStrref(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("AddJournalWorldEntryStrref");
 }
 
-static Variable BarkString(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable BarkString(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto strRef = getInt(args, 1);
@@ -4874,12 +4874,12 @@ static Variable BarkString(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("BarkString");
 }
 
-static Variable DeleteJournalWorldAllEntries(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DeleteJournalWorldAllEntries(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("DeleteJournalWorldAllEntries");
 }
 
-static Variable DeleteJournalWorldEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DeleteJournalWorldEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
 
@@ -4889,7 +4889,7 @@ static Variable DeleteJournalWorldEntry(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("DeleteJournalWorldEntry");
 }
 
-static Variable DeleteJournalWorldEntryStrref(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DeleteJournalWorldEntryStrref(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto strref = getInt(args, 0);
 
@@ -4899,7 +4899,7 @@ static Variable DeleteJournalWorldEntryStrref(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("DeleteJournalWorldEntryStrref");
 }
 
-static Variable PlayVisualAreaEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayVisualAreaEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nEffectID = getInt(args, 0);
     auto lTarget = getLocationArgument(args, 1);
@@ -4910,7 +4910,7 @@ static Variable PlayVisualAreaEffect(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("PlayVisualAreaEffect");
 }
 
-static Variable SetJournalQuestEntryPicture(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetJournalQuestEntryPicture(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto szPlotID = getString(args, 0);
     auto oObject = getObject(args, 1, ctx);
@@ -4924,7 +4924,7 @@ static Variable SetJournalQuestEntryPicture(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SetJournalQuestEntryPicture");
 }
 
-static Variable GetLocalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocalBoolean(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4936,7 +4936,7 @@ static Variable GetLocalBoolean(const std::vector<Variable> &args, const Routine
     return Variable::ofInt(static_cast<int>(value));
 }
 
-static Variable SetLocalBoolean(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLocalBoolean(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4949,7 +4949,7 @@ static Variable SetLocalBoolean(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable GetLocalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLocalNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4960,7 +4960,7 @@ static Variable GetLocalNumber(const std::vector<Variable> &args, const RoutineC
     return Variable::ofInt(oObject->getLocalNumber(nIndex));
 }
 
-static Variable SetLocalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetLocalNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nIndex = getInt(args, 1);
@@ -4973,7 +4973,7 @@ static Variable SetLocalNumber(const std::vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-static Variable SoundObjectGetPitchVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectGetPitchVariance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -4983,7 +4983,7 @@ static Variable SoundObjectGetPitchVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectGetPitchVariance");
 }
 
-static Variable SoundObjectSetPitchVariance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectSetPitchVariance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto fVariance = getFloat(args, 1);
@@ -4994,7 +4994,7 @@ static Variable SoundObjectSetPitchVariance(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SoundObjectSetPitchVariance");
 }
 
-static Variable SoundObjectGetVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectGetVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
 
@@ -5004,7 +5004,7 @@ static Variable SoundObjectGetVolume(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SoundObjectGetVolume");
 }
 
-static Variable GetGlobalLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetGlobalLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
 
@@ -5014,7 +5014,7 @@ static Variable GetGlobalLocation(const std::vector<Variable> &args, const Routi
     return Variable::ofLocation(ctx.game.getGlobalLocation(sIdentifier));
 }
 
-static Variable SetGlobalLocation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalLocation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto lValue = getLocationArgument(args, 1);
@@ -5026,7 +5026,7 @@ static Variable SetGlobalLocation(const std::vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-static Variable AddAvailableNPCByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailableNPCByObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -5037,7 +5037,7 @@ static Variable AddAvailableNPCByObject(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("AddAvailableNPCByObject");
 }
 
-static Variable RemoveAvailableNPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveAvailableNPC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5048,7 +5048,7 @@ static Variable RemoveAvailableNPC(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(static_cast<int>(removed));
 }
 
-static Variable IsAvailableCreature(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsAvailableCreature(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5059,7 +5059,7 @@ static Variable IsAvailableCreature(const std::vector<Variable> &args, const Rou
     return Variable::ofInt(static_cast<int>(available));
 }
 
-static Variable AddAvailableNPCByTemplate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailableNPCByTemplate(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto sTemplate = getString(args, 1);
@@ -5072,7 +5072,7 @@ static Variable AddAvailableNPCByTemplate(const std::vector<Variable> &args, con
     return Variable::ofInt(static_cast<int>(added));
 }
 
-static Variable SpawnAvailableNPC(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpawnAvailableNPC(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto lPosition = getLocationArgument(args, 1);
@@ -5083,7 +5083,7 @@ static Variable SpawnAvailableNPC(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SpawnAvailableNPC");
 }
 
-static Variable IsNPCPartyMember(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsNPCPartyMember(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5094,17 +5094,17 @@ static Variable IsNPCPartyMember(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(member));
 }
 
-static Variable GetIsConversationActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsConversationActive(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsConversationActive");
 }
 
-static Variable GetPartyAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyAIStyle(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetPartyAIStyle");
 }
 
-static Variable GetNPCAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNPCAIStyle(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5115,7 +5115,7 @@ static Variable GetNPCAIStyle(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofInt(static_cast<int>(creature->aiStyle()));
 }
 
-static Variable SetPartyAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPartyAIStyle(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStyle = getInt(args, 0);
 
@@ -5125,7 +5125,7 @@ static Variable SetPartyAIStyle(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetPartyAIStyle");
 }
 
-static Variable SetNPCAIStyle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetNPCAIStyle(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nStyle = getInt(args, 1);
@@ -5139,7 +5139,7 @@ static Variable SetNPCAIStyle(const std::vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-static Variable SetNPCSelectability(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetNPCSelectability(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto nSelectability = getInt(args, 1);
@@ -5150,7 +5150,7 @@ static Variable SetNPCSelectability(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SetNPCSelectability");
 }
 
-static Variable GetNPCSelectability(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNPCSelectability(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5160,19 +5160,19 @@ static Variable GetNPCSelectability(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetNPCSelectability");
 }
 
-static Variable ClearAllEffects(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ClearAllEffects(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     auto caller = getCaller(ctx);
     caller->clearAllEffects();
     return Variable::ofNull();
 }
 
-static Variable GetLastConversation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastConversation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastConversation");
 }
 
-static Variable ShowPartySelectionGUI(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowPartySelectionGUI(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sExitScript = getStringOrElse(args, 0, "");
     auto nForceNPC1 = getIntOrElse(args, 1, -1);
@@ -5193,7 +5193,7 @@ static Variable ShowPartySelectionGUI(const std::vector<Variable> &args, const R
     return Variable::ofNull();
 }
 
-static Variable GetStandardFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetStandardFaction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5204,7 +5204,7 @@ static Variable GetStandardFaction(const std::vector<Variable> &args, const Rout
     return Variable::ofInt(static_cast<int>(creature->faction()));
 }
 
-static Variable GivePlotXP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GivePlotXP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sPlotName = getString(args, 0);
     auto nPercentage = getInt(args, 1);
@@ -5215,7 +5215,7 @@ static Variable GivePlotXP(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("GivePlotXP");
 }
 
-static Variable GetMinOneHP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetMinOneHP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5225,7 +5225,7 @@ static Variable GetMinOneHP(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofInt(static_cast<int>(oObject->isMinOneHP()));
 }
 
-static Variable SetMinOneHP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMinOneHP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nMinOneHP = getInt(args, 1);
@@ -5238,7 +5238,7 @@ static Variable SetMinOneHP(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable SetGlobalFadeIn(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalFadeIn(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fWait = getFloatOrElse(args, 0, 0.0f);
     auto fLength = getFloatOrElse(args, 1, 0.0f);
@@ -5252,7 +5252,7 @@ static Variable SetGlobalFadeIn(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetGlobalFadeIn");
 }
 
-static Variable SetGlobalFadeOut(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGlobalFadeOut(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fWait = getFloatOrElse(args, 0, 0.0f);
     auto fLength = getFloatOrElse(args, 1, 0.0f);
@@ -5266,7 +5266,7 @@ static Variable SetGlobalFadeOut(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetGlobalFadeOut");
 }
 
-static Variable GetLastHostileTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastHostileTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5276,7 +5276,7 @@ static Variable GetLastHostileTarget(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetLastHostileTarget");
 }
 
-static Variable GetLastAttackObjectAction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackObjectAction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5286,7 +5286,7 @@ static Variable GetLastAttackObjectAction(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetLastAttackObjectAction");
 }
 
-static Variable GetLastForcePowerUsed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastForcePowerUsed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5296,7 +5296,7 @@ static Variable GetLastForcePowerUsed(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetLastForcePowerUsed");
 }
 
-static Variable GetLastCombatFeatUsed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastCombatFeatUsed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5306,7 +5306,7 @@ static Variable GetLastCombatFeatUsed(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetLastCombatFeatUsed");
 }
 
-static Variable GetLastAttackResult(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastAttackResult(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5316,7 +5316,7 @@ static Variable GetLastAttackResult(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetLastAttackResult");
 }
 
-static Variable GetWasForcePowerSuccessful(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetWasForcePowerSuccessful(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAttacker = getObjectOrCaller(args, 0, ctx);
 
@@ -5326,7 +5326,7 @@ static Variable GetWasForcePowerSuccessful(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetWasForcePowerSuccessful");
 }
 
-static Variable GetFirstAttacker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFirstAttacker(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5336,7 +5336,7 @@ static Variable GetFirstAttacker(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetFirstAttacker");
 }
 
-static Variable GetNextAttacker(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetNextAttacker(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5346,7 +5346,7 @@ static Variable GetNextAttacker(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetNextAttacker");
 }
 
-static Variable SetFormation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFormation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oAnchor = getObject(args, 0, ctx);
     auto oCreature = getObject(args, 1, ctx);
@@ -5359,7 +5359,7 @@ static Variable SetFormation(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SetFormation");
 }
 
-static Variable SetForcePowerUnsuccessful(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetForcePowerUnsuccessful(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nResult = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -5370,7 +5370,7 @@ static Variable SetForcePowerUnsuccessful(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SetForcePowerUnsuccessful");
 }
 
-static Variable GetIsDebilitated(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsDebilitated(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5381,7 +5381,7 @@ static Variable GetIsDebilitated(const std::vector<Variable> &args, const Routin
     return Variable::ofInt(static_cast<int>(creature->isDebilitated()));
 }
 
-static Variable PlayMovie(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayMovie(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sMovie = getString(args, 0);
     auto nStreamingMusic = getIntOrElse(args, 1, 0);
@@ -5394,7 +5394,7 @@ static Variable PlayMovie(const std::vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-static Variable SaveNPCState(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SaveNPCState(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5404,7 +5404,7 @@ static Variable SaveNPCState(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SaveNPCState");
 }
 
-static Variable GetCategoryFromTalent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCategoryFromTalent(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto tTalent = getTalent(args, 0);
 
@@ -5414,7 +5414,7 @@ static Variable GetCategoryFromTalent(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("GetCategoryFromTalent");
 }
 
-static Variable SurrenderByFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SurrenderByFaction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFactionFrom = getInt(args, 0);
     auto nFactionTo = getInt(args, 1);
@@ -5425,7 +5425,7 @@ static Variable SurrenderByFaction(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SurrenderByFaction");
 }
 
-static Variable ChangeFactionByFaction(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeFactionByFaction(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFactionFrom = getInt(args, 0);
     auto nFactionTo = getInt(args, 1);
@@ -5436,7 +5436,7 @@ static Variable ChangeFactionByFaction(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("ChangeFactionByFaction");
 }
 
-static Variable PlayRoomAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayRoomAnimation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sRoom = getString(args, 0);
     auto nAnimation = getInt(args, 1);
@@ -5447,7 +5447,7 @@ static Variable PlayRoomAnimation(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("PlayRoomAnimation");
 }
 
-static Variable ShowGalaxyMap(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowGalaxyMap(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
 
@@ -5457,7 +5457,7 @@ static Variable ShowGalaxyMap(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("ShowGalaxyMap");
 }
 
-static Variable SetPlanetSelectable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlanetSelectable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
     auto bSelectable = getInt(args, 1);
@@ -5468,7 +5468,7 @@ static Variable SetPlanetSelectable(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SetPlanetSelectable");
 }
 
-static Variable GetPlanetSelectable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlanetSelectable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
 
@@ -5478,7 +5478,7 @@ static Variable GetPlanetSelectable(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetPlanetSelectable");
 }
 
-static Variable SetPlanetAvailable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetPlanetAvailable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
     auto bAvailable = getInt(args, 1);
@@ -5489,7 +5489,7 @@ static Variable SetPlanetAvailable(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetPlanetAvailable");
 }
 
-static Variable GetPlanetAvailable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPlanetAvailable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPlanet = getInt(args, 0);
 
@@ -5499,12 +5499,12 @@ static Variable GetPlanetAvailable(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetPlanetAvailable");
 }
 
-static Variable GetSelectedPlanet(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSelectedPlanet(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSelectedPlanet");
 }
 
-static Variable SoundObjectFadeAndStop(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SoundObjectFadeAndStop(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oSound = getObject(args, 0, ctx);
     auto fSeconds = getFloat(args, 1);
@@ -5515,7 +5515,7 @@ static Variable SoundObjectFadeAndStop(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SoundObjectFadeAndStop");
 }
 
-static Variable SetAreaFogColor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAreaFogColor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oArea = getObject(args, 0, ctx);
     auto fRed = getFloat(args, 1);
@@ -5528,7 +5528,7 @@ static Variable SetAreaFogColor(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SetAreaFogColor");
 }
 
-static Variable ChangeItemCost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeItemCost(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sItem = getString(args, 0);
     auto fCostMultiplier = getFloat(args, 1);
@@ -5539,7 +5539,7 @@ static Variable ChangeItemCost(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("ChangeItemCost");
 }
 
-static Variable GetIsLiveContentAvailable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsLiveContentAvailable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPkg = getInt(args, 0);
 
@@ -5549,12 +5549,12 @@ static Variable GetIsLiveContentAvailable(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("GetIsLiveContentAvailable");
 }
 
-static Variable ResetDialogState(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ResetDialogState(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ResetDialogState");
 }
 
-static Variable SetGoodEvilValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetGoodEvilValue(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nAlignment = getInt(args, 1);
@@ -5565,7 +5565,7 @@ static Variable SetGoodEvilValue(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetGoodEvilValue");
 }
 
-static Variable GetIsPoisoned(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPoisoned(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5575,7 +5575,7 @@ static Variable GetIsPoisoned(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetIsPoisoned");
 }
 
-static Variable GetSpellTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
 
@@ -5585,7 +5585,7 @@ static Variable GetSpellTarget(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("GetSpellTarget");
 }
 
-static Variable SetSoloMode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetSoloMode(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bActivate = getInt(args, 0);
 
@@ -5597,12 +5597,12 @@ static Variable SetSoloMode(const std::vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-static Variable CancelPostDialogCharacterSwitch(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CancelPostDialogCharacterSwitch(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("CancelPostDialogCharacterSwitch");
 }
 
-static Variable SetMaxHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMaxHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nMaxHP = getInt(args, 1);
@@ -5614,7 +5614,7 @@ static Variable SetMaxHitPoints(const std::vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-static Variable NoClicksFor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable NoClicksFor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fDuration = getFloat(args, 0);
 
@@ -5624,22 +5624,22 @@ static Variable NoClicksFor(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("NoClicksFor");
 }
 
-static Variable HoldWorldFadeInForDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable HoldWorldFadeInForDialog(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("HoldWorldFadeInForDialog");
 }
 
-static Variable ShipBuild(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShipBuild(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     return Variable::ofInt(static_cast<int>(kShipBuild));
 }
 
-static Variable SurrenderRetainBuffs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SurrenderRetainBuffs(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SurrenderRetainBuffs");
 }
 
-static Variable SuppressStatusSummaryEntry(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SuppressStatusSummaryEntry(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNumEntries = getIntOrElse(args, 0, 1);
 
@@ -5649,7 +5649,7 @@ static Variable SuppressStatusSummaryEntry(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SuppressStatusSummaryEntry");
 }
 
-static Variable GetCheatCode(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCheatCode(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nCode = getInt(args, 0);
 
@@ -5659,7 +5659,7 @@ static Variable GetCheatCode(const std::vector<Variable> &args, const RoutineCon
     return Variable::ofInt(0);
 }
 
-static Variable SetMusicVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetMusicVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fVolume = getFloatOrElse(args, 0, 1.0f);
 
@@ -5669,7 +5669,7 @@ static Variable SetMusicVolume(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SetMusicVolume");
 }
 
-static Variable CreateItemOnFloor(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreateItemOnFloor(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sTemplate = getString(args, 0);
     auto lLocation = getLocationArgument(args, 1);
@@ -5681,7 +5681,7 @@ static Variable CreateItemOnFloor(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("CreateItemOnFloor");
 }
 
-static Variable SetAvailableNPCId(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetAvailableNPCId(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oidNPC = getObject(args, 1, ctx);
@@ -5692,7 +5692,7 @@ static Variable SetAvailableNPCId(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SetAvailableNPCId");
 }
 
-static Variable GetScriptParameter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetScriptParameter(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nIndex = getInt(args, 0);
 
@@ -5702,22 +5702,22 @@ static Variable GetScriptParameter(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("GetScriptParameter");
 }
 
-static Variable SetFadeUntilScript(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFadeUntilScript(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SetFadeUntilScript");
 }
 
-static Variable GetItemComponent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemComponent(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemComponent");
 }
 
-static Variable GetItemComponentPieceValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetItemComponentPieceValue(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetItemComponentPieceValue");
 }
 
-static Variable ShowChemicalUpgradeScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowChemicalUpgradeScreen(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCharacter = getObject(args, 0, ctx);
 
@@ -5727,22 +5727,22 @@ static Variable ShowChemicalUpgradeScreen(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("ShowChemicalUpgradeScreen");
 }
 
-static Variable GetChemicals(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetChemicals(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetChemicals");
 }
 
-static Variable GetChemicalPieceValue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetChemicalPieceValue(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetChemicalPieceValue");
 }
 
-static Variable GetSpellForcePointCost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellForcePointCost(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetSpellForcePointCost");
 }
 
-static Variable GetFeatAcquired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetFeatAcquired(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -5753,7 +5753,7 @@ static Variable GetFeatAcquired(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("GetFeatAcquired");
 }
 
-static Variable GetSpellAcquired(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellAcquired(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oCreature = getObjectOrCaller(args, 1, ctx);
@@ -5764,12 +5764,12 @@ static Variable GetSpellAcquired(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetSpellAcquired");
 }
 
-static Variable ShowSwoopUpgradeScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowSwoopUpgradeScreen(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("ShowSwoopUpgradeScreen");
 }
 
-static Variable GrantFeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GrantFeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFeat = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -5780,7 +5780,7 @@ static Variable GrantFeat(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("GrantFeat");
 }
 
-static Variable GrantSpell(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GrantSpell(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpell = getInt(args, 0);
     auto oCreature = getObject(args, 1, ctx);
@@ -5791,7 +5791,7 @@ static Variable GrantSpell(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("GrantSpell");
 }
 
-static Variable SpawnMine(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpawnMine(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nMineType = getInt(args, 0);
     auto lPoint = getLocationArgument(args, 1);
@@ -5805,7 +5805,7 @@ static Variable SpawnMine(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("SpawnMine");
 }
 
-static Variable SetFakeCombatState(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetFakeCombatState(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nEnable = getInt(args, 1);
@@ -5816,7 +5816,7 @@ static Variable SetFakeCombatState(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetFakeCombatState");
 }
 
-static Variable GetOwnerDemolitionsSkill(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetOwnerDemolitionsSkill(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -5826,7 +5826,7 @@ static Variable GetOwnerDemolitionsSkill(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("GetOwnerDemolitionsSkill");
 }
 
-static Variable SetOrientOnClick(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetOrientOnClick(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObjectOrCaller(args, 0, ctx);
     auto nState = getIntOrElse(args, 1, 1);
@@ -5837,7 +5837,7 @@ static Variable SetOrientOnClick(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SetOrientOnClick");
 }
 
-static Variable GetInfluence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetInfluence(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -5847,7 +5847,7 @@ static Variable GetInfluence(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("GetInfluence");
 }
 
-static Variable SetInfluence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetInfluence(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto nInfluence = getInt(args, 1);
@@ -5858,7 +5858,7 @@ static Variable SetInfluence(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SetInfluence");
 }
 
-static Variable ModifyInfluence(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyInfluence(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto nModifier = getInt(args, 1);
@@ -5869,7 +5869,7 @@ static Variable ModifyInfluence(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("ModifyInfluence");
 }
 
-static Variable GetRacialSubType(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRacialSubType(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
 
@@ -5879,7 +5879,7 @@ static Variable GetRacialSubType(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetRacialSubType");
 }
 
-static Variable IncrementGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IncrementGlobalNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nAmount = getInt(args, 1);
@@ -5890,7 +5890,7 @@ static Variable IncrementGlobalNumber(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("IncrementGlobalNumber");
 }
 
-static Variable DecrementGlobalNumber(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DecrementGlobalNumber(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sIdentifier = getString(args, 0);
     auto nAmount = getInt(args, 1);
@@ -5901,7 +5901,7 @@ static Variable DecrementGlobalNumber(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("DecrementGlobalNumber");
 }
 
-static Variable SetBonusForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetBonusForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nBonusFP = getInt(args, 1);
@@ -5912,7 +5912,7 @@ static Variable SetBonusForcePoints(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SetBonusForcePoints");
 }
 
-static Variable AddBonusForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddBonusForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nBonusFP = getInt(args, 1);
@@ -5923,7 +5923,7 @@ static Variable AddBonusForcePoints(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("AddBonusForcePoints");
 }
 
-static Variable GetBonusForcePoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetBonusForcePoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5933,12 +5933,12 @@ static Variable GetBonusForcePoints(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("GetBonusForcePoints");
 }
 
-static Variable IsMoviePlaying(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsMoviePlaying(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("IsMoviePlaying");
 }
 
-static Variable QueueMovie(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable QueueMovie(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sMovie = getString(args, 0);
     auto nSkippable = getIntOrElse(args, 1, 1);
@@ -5949,7 +5949,7 @@ static Variable QueueMovie(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("QueueMovie");
 }
 
-static Variable PlayMovieQueue(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayMovieQueue(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nAllowSkips = getIntOrElse(args, 0, 1);
 
@@ -5959,7 +5959,7 @@ static Variable PlayMovieQueue(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("PlayMovieQueue");
 }
 
-static Variable YavinHackDoorClose(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable YavinHackDoorClose(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5969,7 +5969,7 @@ static Variable YavinHackDoorClose(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("YavinHackDoorClose");
 }
 
-static Variable IsStealthed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsStealthed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5979,7 +5979,7 @@ static Variable IsStealthed(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("IsStealthed");
 }
 
-static Variable IsMeditating(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsMeditating(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5989,7 +5989,7 @@ static Variable IsMeditating(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("IsMeditating");
 }
 
-static Variable IsInTotalDefense(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsInTotalDefense(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -5999,7 +5999,7 @@ static Variable IsInTotalDefense(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("IsInTotalDefense");
 }
 
-static Variable SetHealTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetHealTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oidHealer = getObject(args, 0, ctx);
     auto oidTarget = getObject(args, 1, ctx);
@@ -6010,7 +6010,7 @@ static Variable SetHealTarget(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetHealTarget");
 }
 
-static Variable GetHealTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetHealTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oidHealer = getObject(args, 0, ctx);
 
@@ -6020,7 +6020,7 @@ static Variable GetHealTarget(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("GetHealTarget");
 }
 
-static Variable GetRandomDestination(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetRandomDestination(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto rangeLimit = getInt(args, 1);
@@ -6031,7 +6031,7 @@ static Variable GetRandomDestination(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("GetRandomDestination");
 }
 
-static Variable IsFormActive(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsFormActive(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nFormID = getInt(args, 1);
@@ -6042,7 +6042,7 @@ static Variable IsFormActive(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("IsFormActive");
 }
 
-static Variable GetSpellFormMask(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellFormMask(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpellID = getInt(args, 0);
 
@@ -6052,7 +6052,7 @@ static Variable GetSpellFormMask(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetSpellFormMask");
 }
 
-static Variable GetSpellBaseForcePointCost(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSpellBaseForcePointCost(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSpellID = getInt(args, 0);
 
@@ -6062,7 +6062,7 @@ static Variable GetSpellBaseForcePointCost(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("GetSpellBaseForcePointCost");
 }
 
-static Variable SetKeepStealthInDialog(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetKeepStealthInDialog(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStealthState = getInt(args, 0);
 
@@ -6072,7 +6072,7 @@ static Variable SetKeepStealthInDialog(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SetKeepStealthInDialog");
 }
 
-static Variable HasLineOfSight(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable HasLineOfSight(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vSource = getVector(args, 0);
     auto vTarget = getVector(args, 1);
@@ -6085,7 +6085,7 @@ static Variable HasLineOfSight(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("HasLineOfSight");
 }
 
-static Variable ShowDemoScreen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ShowDemoScreen(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sTexture = getString(args, 0);
     auto nTimeout = getInt(args, 1);
@@ -6099,7 +6099,7 @@ static Variable ShowDemoScreen(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("ShowDemoScreen");
 }
 
-static Variable ForceHeartbeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ForceHeartbeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -6109,7 +6109,7 @@ static Variable ForceHeartbeat(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("ForceHeartbeat");
 }
 
-static Variable IsRunning(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable IsRunning(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -6119,7 +6119,7 @@ static Variable IsRunning(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("IsRunning");
 }
 
-static Variable SetForfeitConditions(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetForfeitConditions(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nForfeitFlags = getInt(args, 0);
 
@@ -6129,12 +6129,12 @@ static Variable SetForfeitConditions(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetForfeitConditions");
 }
 
-static Variable GetLastForfeitViolation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetLastForfeitViolation(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetLastForfeitViolation");
 }
 
-static Variable ModifyReflexSavingThrowBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyReflexSavingThrowBase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
     auto aModValue = getInt(args, 1);
@@ -6145,7 +6145,7 @@ static Variable ModifyReflexSavingThrowBase(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("ModifyReflexSavingThrowBase");
 }
 
-static Variable ModifyFortitudeSavingThrowBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyFortitudeSavingThrowBase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
     auto aModValue = getInt(args, 1);
@@ -6156,7 +6156,7 @@ static Variable ModifyFortitudeSavingThrowBase(const std::vector<Variable> &args
     throw RoutineNotImplementedException("ModifyFortitudeSavingThrowBase");
 }
 
-static Variable ModifyWillSavingThrowBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ModifyWillSavingThrowBase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
     auto aModValue = getInt(args, 1);
@@ -6167,12 +6167,12 @@ static Variable ModifyWillSavingThrowBase(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("ModifyWillSavingThrowBase");
 }
 
-static Variable GetScriptStringParameter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetScriptStringParameter(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetScriptStringParameter");
 }
 
-static Variable GetObjectPersonalSpace(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetObjectPersonalSpace(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto aObject = getObject(args, 0, ctx);
 
@@ -6182,7 +6182,7 @@ static Variable GetObjectPersonalSpace(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetObjectPersonalSpace");
 }
 
-static Variable AdjustCreatureAttributes(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustCreatureAttributes(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nAttribute = getInt(args, 1);
@@ -6194,7 +6194,7 @@ static Variable AdjustCreatureAttributes(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("AdjustCreatureAttributes");
 }
 
-static Variable SetCreatureAILevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCreatureAILevel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nPriority = getInt(args, 1);
@@ -6205,7 +6205,7 @@ static Variable SetCreatureAILevel(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SetCreatureAILevel");
 }
 
-static Variable ResetCreatureAILevel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ResetCreatureAILevel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -6215,7 +6215,7 @@ static Variable ResetCreatureAILevel(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("ResetCreatureAILevel");
 }
 
-static Variable AddAvailablePUPByTemplate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailablePUPByTemplate(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto sTemplate = getString(args, 1);
@@ -6226,7 +6226,7 @@ static Variable AddAvailablePUPByTemplate(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("AddAvailablePUPByTemplate");
 }
 
-static Variable AddAvailablePUPByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddAvailablePUPByObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto oPuppet = getObject(args, 1, ctx);
@@ -6237,7 +6237,7 @@ static Variable AddAvailablePUPByObject(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("AddAvailablePUPByObject");
 }
 
-static Variable AssignPUP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AssignPUP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto nNPC = getInt(args, 1);
@@ -6248,7 +6248,7 @@ static Variable AssignPUP(const std::vector<Variable> &args, const RoutineContex
     throw RoutineNotImplementedException("AssignPUP");
 }
 
-static Variable SpawnAvailablePUP(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SpawnAvailablePUP(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto lLocation = getLocationArgument(args, 1);
@@ -6259,7 +6259,7 @@ static Variable SpawnAvailablePUP(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SpawnAvailablePUP");
 }
 
-static Variable AddPartyPuppet(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AddPartyPuppet(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto oidCreature = getObject(args, 1, ctx);
@@ -6270,7 +6270,7 @@ static Variable AddPartyPuppet(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("AddPartyPuppet");
 }
 
-static Variable GetPUPOwner(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPUPOwner(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPUP = getObjectOrCaller(args, 0, ctx);
 
@@ -6280,7 +6280,7 @@ static Variable GetPUPOwner(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetPUPOwner");
 }
 
-static Variable GetIsPuppet(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPuppet(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPUP = getObjectOrCaller(args, 0, ctx);
 
@@ -6290,7 +6290,7 @@ static Variable GetIsPuppet(const std::vector<Variable> &args, const RoutineCont
     throw RoutineNotImplementedException("GetIsPuppet");
 }
 
-static Variable GetIsPartyLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPartyLeader(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCharacter = getObjectOrCaller(args, 0, ctx);
 
@@ -6300,12 +6300,12 @@ static Variable GetIsPartyLeader(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetIsPartyLeader");
 }
 
-static Variable GetPartyLeader(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetPartyLeader(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetPartyLeader");
 }
 
-static Variable RemoveNPCFromPartyToBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveNPCFromPartyToBase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
 
@@ -6315,7 +6315,7 @@ static Variable RemoveNPCFromPartyToBase(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("RemoveNPCFromPartyToBase");
 }
 
-static Variable CreatureFlourishWeapon(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable CreatureFlourishWeapon(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -6325,7 +6325,7 @@ static Variable CreatureFlourishWeapon(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("CreatureFlourishWeapon");
 }
 
-static Variable ChangeObjectAppearance(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable ChangeObjectAppearance(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObjectToChange = getObject(args, 0, ctx);
     auto nAppearance = getInt(args, 1);
@@ -6336,12 +6336,12 @@ static Variable ChangeObjectAppearance(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("ChangeObjectAppearance");
 }
 
-static Variable GetIsXBox(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsXBox(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("GetIsXBox");
 }
 
-static Variable PlayOverlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable PlayOverlayAnimation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oTarget = getObject(args, 0, ctx);
     auto nAnimation = getInt(args, 1);
@@ -6352,12 +6352,12 @@ static Variable PlayOverlayAnimation(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("PlayOverlayAnimation");
 }
 
-static Variable UnlockAllSongs(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable UnlockAllSongs(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("UnlockAllSongs");
 }
 
-static Variable DisableMap(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisableMap(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getIntOrElse(args, 0, 0);
 
@@ -6367,7 +6367,7 @@ static Variable DisableMap(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("DisableMap");
 }
 
-static Variable DetonateMine(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DetonateMine(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oMine = getObject(args, 0, ctx);
 
@@ -6377,7 +6377,7 @@ static Variable DetonateMine(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("DetonateMine");
 }
 
-static Variable DisableHealthRegen(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisableHealthRegen(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getIntOrElse(args, 0, 0);
 
@@ -6387,7 +6387,7 @@ static Variable DisableHealthRegen(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("DisableHealthRegen");
 }
 
-static Variable SetCurrentForm(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetCurrentForm(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nFormID = getInt(args, 1);
@@ -6398,7 +6398,7 @@ static Variable SetCurrentForm(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SetCurrentForm");
 }
 
-static Variable SetDisableTransit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetDisableTransit(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getIntOrElse(args, 0, 0);
 
@@ -6408,7 +6408,7 @@ static Variable SetDisableTransit(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SetDisableTransit");
 }
 
-static Variable SetInputClass(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetInputClass(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nClass = getInt(args, 0);
 
@@ -6418,7 +6418,7 @@ static Variable SetInputClass(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SetInputClass");
 }
 
-static Variable SetForceAlwaysUpdate(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SetForceAlwaysUpdate(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nFlag = getInt(args, 1);
@@ -6429,7 +6429,7 @@ static Variable SetForceAlwaysUpdate(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SetForceAlwaysUpdate");
 }
 
-static Variable EnableRain(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EnableRain(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nFlag = getInt(args, 0);
 
@@ -6439,7 +6439,7 @@ static Variable EnableRain(const std::vector<Variable> &args, const RoutineConte
     throw RoutineNotImplementedException("EnableRain");
 }
 
-static Variable DisplayMessageBox(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisplayMessageBox(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nStrRef = getInt(args, 0);
     auto sIcon = getStringOrElse(args, 1, "");
@@ -6450,7 +6450,7 @@ static Variable DisplayMessageBox(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("DisplayMessageBox");
 }
 
-static Variable DisplayDatapad(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable DisplayDatapad(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oDatapad = getObject(args, 0, ctx);
 
@@ -6460,7 +6460,7 @@ static Variable DisplayDatapad(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("DisplayDatapad");
 }
 
-static Variable RemoveHeartbeat(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveHeartbeat(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oPlaceable = getObject(args, 0, ctx);
 
@@ -6470,7 +6470,7 @@ static Variable RemoveHeartbeat(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("RemoveHeartbeat");
 }
 
-static Variable RemoveEffectByID(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveEffectByID(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto nEffectID = getInt(args, 1);
@@ -6481,7 +6481,7 @@ static Variable RemoveEffectByID(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("RemoveEffectByID");
 }
 
-static Variable RemoveEffectByExactMatch(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RemoveEffectByExactMatch(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
     auto eEffect = getEffect(args, 1);
@@ -6492,7 +6492,7 @@ static Variable RemoveEffectByExactMatch(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("RemoveEffectByExactMatch");
 }
 
-static Variable AdjustCreatureSkills(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable AdjustCreatureSkills(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto nSkill = getInt(args, 1);
@@ -6504,7 +6504,7 @@ static Variable AdjustCreatureSkills(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("AdjustCreatureSkills");
 }
 
-static Variable GetSkillRankBase(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetSkillRankBase(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSkill = getInt(args, 0);
     auto oObject = getObjectOrCaller(args, 1, ctx);
@@ -6515,7 +6515,7 @@ static Variable GetSkillRankBase(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("GetSkillRankBase");
 }
 
-static Variable EnableRendering(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable EnableRendering(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto bEnable = getInt(args, 1);
@@ -6526,7 +6526,7 @@ static Variable EnableRendering(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("EnableRendering");
 }
 
-static Variable GetCombatActionsPending(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetCombatActionsPending(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oCreature = getObject(args, 0, ctx);
 
@@ -6536,7 +6536,7 @@ static Variable GetCombatActionsPending(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("GetCombatActionsPending");
 }
 
-static Variable SaveNPCByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SaveNPCByObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nNPC = getInt(args, 0);
     auto oidCharacter = getObject(args, 1, ctx);
@@ -6547,7 +6547,7 @@ static Variable SaveNPCByObject(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SaveNPCByObject");
 }
 
-static Variable SavePUPByObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SavePUPByObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nPUP = getInt(args, 0);
     auto oidPuppet = getObject(args, 1, ctx);
@@ -6558,7 +6558,7 @@ static Variable SavePUPByObject(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SavePUPByObject");
 }
 
-static Variable GetIsPlayerMadeCharacter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable GetIsPlayerMadeCharacter(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oidCharacter = getObject(args, 0, ctx);
 
@@ -6568,7 +6568,7 @@ static Variable GetIsPlayerMadeCharacter(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("GetIsPlayerMadeCharacter");
 }
 
-static Variable RebuildPartyTable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable RebuildPartyTable(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("RebuildPartyTable");
 }
@@ -39,7 +39,7 @@ namespace reone {
 
 namespace game {
 
-static Variable SWMG_SetLateralAccelerationPerSecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetLateralAccelerationPerSecond(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fLAPS = getFloat(args, 0);
 
@@ -49,12 +49,12 @@ static Variable SWMG_SetLateralAccelerationPerSecond(const std::vector<Variable>
     throw RoutineNotImplementedException("SWMG_SetLateralAccelerationPerSecond");
 }
 
-static Variable SWMG_GetLateralAccelerationPerSecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLateralAccelerationPerSecond(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLateralAccelerationPerSecond");
 }
 
-static Variable SWMG_SetSpeedBlurEffect(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetSpeedBlurEffect(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto bEnabled = getInt(args, 0);
     auto fRatio = getFloatOrElse(args, 1, 0.75f);
@@ -65,17 +65,17 @@ static Variable SWMG_SetSpeedBlurEffect(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetSpeedBlurEffect");
 }
 
-static Variable SWMG_GetLastEvent(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastEvent(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastEvent");
 }
 
-static Variable SWMG_GetLastEventModelName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastEventModelName(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastEventModelName");
 }
 
-static Variable SWMG_GetObjectByName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetObjectByName(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto sName = getString(args, 0);
 
@@ -85,7 +85,7 @@ static Variable SWMG_GetObjectByName(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_GetObjectByName");
 }
 
-static Variable SWMG_PlayAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_PlayAnimation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto sAnimName = getString(args, 1);
@@ -99,22 +99,22 @@ static Variable SWMG_PlayAnimation(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SWMG_PlayAnimation");
 }
 
-static Variable SWMG_GetLastBulletHitDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastBulletHitDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastBulletHitDamage");
 }
 
-static Variable SWMG_GetLastBulletHitTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastBulletHitTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastBulletHitTarget");
 }
 
-static Variable SWMG_GetLastBulletHitShooter(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastBulletHitShooter(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastBulletHitShooter");
 }
 
-static Variable SWMG_AdjustFollowerHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_AdjustFollowerHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nHP = getInt(args, 1);
@@ -126,37 +126,37 @@ static Variable SWMG_AdjustFollowerHitPoints(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("SWMG_AdjustFollowerHitPoints");
 }
 
-static Variable SWMG_OnBulletHit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_OnBulletHit(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_OnBulletHit");
 }
 
-static Variable SWMG_OnObstacleHit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_OnObstacleHit(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_OnObstacleHit");
 }
 
-static Variable SWMG_GetLastFollowerHit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastFollowerHit(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastFollowerHit");
 }
 
-static Variable SWMG_GetLastObstacleHit(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastObstacleHit(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastObstacleHit");
 }
 
-static Variable SWMG_GetLastBulletFiredDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastBulletFiredDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastBulletFiredDamage");
 }
 
-static Variable SWMG_GetLastBulletFiredTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastBulletFiredTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastBulletFiredTarget");
 }
 
-static Variable SWMG_GetObjectName(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetObjectName(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oid = getObjectOrCaller(args, 0, ctx);
 
@@ -166,12 +166,12 @@ static Variable SWMG_GetObjectName(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SWMG_GetObjectName");
 }
 
-static Variable SWMG_OnDeath(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_OnDeath(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_OnDeath");
 }
 
-static Variable SWMG_IsFollower(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_IsFollower(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oid = getObjectOrCaller(args, 0, ctx);
 
@@ -181,7 +181,7 @@ static Variable SWMG_IsFollower(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SWMG_IsFollower");
 }
 
-static Variable SWMG_IsPlayer(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_IsPlayer(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oid = getObjectOrCaller(args, 0, ctx);
 
@@ -191,7 +191,7 @@ static Variable SWMG_IsPlayer(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SWMG_IsPlayer");
 }
 
-static Variable SWMG_IsEnemy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_IsEnemy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oid = getObjectOrCaller(args, 0, ctx);
 
@@ -201,7 +201,7 @@ static Variable SWMG_IsEnemy(const std::vector<Variable> &args, const RoutineCon
     throw RoutineNotImplementedException("SWMG_IsEnemy");
 }
 
-static Variable SWMG_IsTrigger(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_IsTrigger(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oid = getObjectOrCaller(args, 0, ctx);
 
@@ -211,7 +211,7 @@ static Variable SWMG_IsTrigger(const std::vector<Variable> &args, const RoutineC
     throw RoutineNotImplementedException("SWMG_IsTrigger");
 }
 
-static Variable SWMG_IsObstacle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_IsObstacle(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oid = getObjectOrCaller(args, 0, ctx);
 
@@ -221,7 +221,7 @@ static Variable SWMG_IsObstacle(const std::vector<Variable> &args, const Routine
     throw RoutineNotImplementedException("SWMG_IsObstacle");
 }
 
-static Variable SWMG_SetFollowerHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetFollowerHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nHP = getInt(args, 1);
@@ -232,17 +232,17 @@ static Variable SWMG_SetFollowerHitPoints(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SWMG_SetFollowerHitPoints");
 }
 
-static Variable SWMG_OnDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_OnDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_OnDamage");
 }
 
-static Variable SWMG_GetLastHPChange(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastHPChange(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastHPChange");
 }
 
-static Variable SWMG_RemoveAnimation(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_RemoveAnimation(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
     auto sAnimName = getString(args, 1);
@@ -253,17 +253,17 @@ static Variable SWMG_RemoveAnimation(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_RemoveAnimation");
 }
 
-static Variable SWMG_GetCameraNearClip(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetCameraNearClip(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetCameraNearClip");
 }
 
-static Variable SWMG_GetCameraFarClip(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetCameraFarClip(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetCameraFarClip");
 }
 
-static Variable SWMG_SetCameraClip(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetCameraClip(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fNear = getFloat(args, 0);
     auto fFar = getFloat(args, 1);
@@ -274,17 +274,17 @@ static Variable SWMG_SetCameraClip(const std::vector<Variable> &args, const Rout
     throw RoutineNotImplementedException("SWMG_SetCameraClip");
 }
 
-static Variable SWMG_GetPlayer(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayer(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayer");
 }
 
-static Variable SWMG_GetEnemyCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetEnemyCount(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetEnemyCount");
 }
 
-static Variable SWMG_GetEnemy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetEnemy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nEntry = getInt(args, 0);
 
@@ -294,12 +294,12 @@ static Variable SWMG_GetEnemy(const std::vector<Variable> &args, const RoutineCo
     throw RoutineNotImplementedException("SWMG_GetEnemy");
 }
 
-static Variable SWMG_GetObstacleCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetObstacleCount(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetObstacleCount");
 }
 
-static Variable SWMG_GetObstacle(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetObstacle(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nEntry = getInt(args, 0);
 
@@ -309,7 +309,7 @@ static Variable SWMG_GetObstacle(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SWMG_GetObstacle");
 }
 
-static Variable SWMG_GetHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -319,7 +319,7 @@ static Variable SWMG_GetHitPoints(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SWMG_GetHitPoints");
 }
 
-static Variable SWMG_GetMaxHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetMaxHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -329,7 +329,7 @@ static Variable SWMG_GetMaxHitPoints(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_GetMaxHitPoints");
 }
 
-static Variable SWMG_SetMaxHitPoints(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetMaxHitPoints(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nMaxHP = getInt(args, 1);
@@ -340,7 +340,7 @@ static Variable SWMG_SetMaxHitPoints(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_SetMaxHitPoints");
 }
 
-static Variable SWMG_GetSphereRadius(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetSphereRadius(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -350,7 +350,7 @@ static Variable SWMG_GetSphereRadius(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_GetSphereRadius");
 }
 
-static Variable SWMG_SetSphereRadius(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetSphereRadius(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto fRadius = getFloat(args, 1);
@@ -361,7 +361,7 @@ static Variable SWMG_SetSphereRadius(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_SetSphereRadius");
 }
 
-static Variable SWMG_GetNumLoops(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetNumLoops(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -371,7 +371,7 @@ static Variable SWMG_GetNumLoops(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SWMG_GetNumLoops");
 }
 
-static Variable SWMG_SetNumLoops(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetNumLoops(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nNumLoops = getInt(args, 1);
@@ -382,7 +382,7 @@ static Variable SWMG_SetNumLoops(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SWMG_SetNumLoops");
 }
 
-static Variable SWMG_GetPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -392,7 +392,7 @@ static Variable SWMG_GetPosition(const std::vector<Variable> &args, const Routin
     throw RoutineNotImplementedException("SWMG_GetPosition");
 }
 
-static Variable SWMG_GetGunBankCount(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankCount(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -402,7 +402,7 @@ static Variable SWMG_GetGunBankCount(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_GetGunBankCount");
 }
 
-static Variable SWMG_GetGunBankBulletModel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankBulletModel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -413,7 +413,7 @@ static Variable SWMG_GetGunBankBulletModel(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SWMG_GetGunBankBulletModel");
 }
 
-static Variable SWMG_GetGunBankGunModel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankGunModel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -424,7 +424,7 @@ static Variable SWMG_GetGunBankGunModel(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_GetGunBankGunModel");
 }
 
-static Variable SWMG_GetGunBankDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -435,7 +435,7 @@ static Variable SWMG_GetGunBankDamage(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SWMG_GetGunBankDamage");
 }
 
-static Variable SWMG_GetGunBankTimeBetweenShots(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankTimeBetweenShots(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -446,7 +446,7 @@ static Variable SWMG_GetGunBankTimeBetweenShots(const std::vector<Variable> &arg
     throw RoutineNotImplementedException("SWMG_GetGunBankTimeBetweenShots");
 }
 
-static Variable SWMG_GetGunBankLifespan(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankLifespan(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -457,7 +457,7 @@ static Variable SWMG_GetGunBankLifespan(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_GetGunBankLifespan");
 }
 
-static Variable SWMG_GetGunBankSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -468,7 +468,7 @@ static Variable SWMG_GetGunBankSpeed(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_GetGunBankSpeed");
 }
 
-static Variable SWMG_GetGunBankTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -479,7 +479,7 @@ static Variable SWMG_GetGunBankTarget(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SWMG_GetGunBankTarget");
 }
 
-static Variable SWMG_SetGunBankBulletModel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankBulletModel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -491,7 +491,7 @@ static Variable SWMG_SetGunBankBulletModel(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SWMG_SetGunBankBulletModel");
 }
 
-static Variable SWMG_SetGunBankGunModel(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankGunModel(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -503,7 +503,7 @@ static Variable SWMG_SetGunBankGunModel(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetGunBankGunModel");
 }
 
-static Variable SWMG_SetGunBankDamage(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankDamage(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -515,7 +515,7 @@ static Variable SWMG_SetGunBankDamage(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SWMG_SetGunBankDamage");
 }
 
-static Variable SWMG_SetGunBankTimeBetweenShots(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankTimeBetweenShots(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -527,7 +527,7 @@ static Variable SWMG_SetGunBankTimeBetweenShots(const std::vector<Variable> &arg
     throw RoutineNotImplementedException("SWMG_SetGunBankTimeBetweenShots");
 }
 
-static Variable SWMG_SetGunBankLifespan(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankLifespan(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -539,7 +539,7 @@ static Variable SWMG_SetGunBankLifespan(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetGunBankLifespan");
 }
 
-static Variable SWMG_SetGunBankSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -551,7 +551,7 @@ static Variable SWMG_SetGunBankSpeed(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_SetGunBankSpeed");
 }
 
-static Variable SWMG_SetGunBankTarget(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankTarget(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -563,12 +563,12 @@ static Variable SWMG_SetGunBankTarget(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SWMG_SetGunBankTarget");
 }
 
-static Variable SWMG_GetLastBulletHitPart(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetLastBulletHitPart(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetLastBulletHitPart");
 }
 
-static Variable SWMG_IsGunBankTargetting(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_IsGunBankTargetting(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -579,37 +579,37 @@ static Variable SWMG_IsGunBankTargetting(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("SWMG_IsGunBankTargetting");
 }
 
-static Variable SWMG_GetPlayerOffset(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerOffset(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerOffset");
 }
 
-static Variable SWMG_GetPlayerInvincibility(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerInvincibility(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerInvincibility");
 }
 
-static Variable SWMG_GetPlayerSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerSpeed");
 }
 
-static Variable SWMG_GetPlayerMinSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerMinSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerMinSpeed");
 }
 
-static Variable SWMG_GetPlayerAccelerationPerSecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerAccelerationPerSecond(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerAccelerationPerSecond");
 }
 
-static Variable SWMG_GetPlayerTunnelPos(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerTunnelPos(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerTunnelPos");
 }
 
-static Variable SWMG_SetPlayerOffset(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerOffset(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vOffset = getVector(args, 0);
 
@@ -619,7 +619,7 @@ static Variable SWMG_SetPlayerOffset(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_SetPlayerOffset");
 }
 
-static Variable SWMG_SetPlayerInvincibility(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerInvincibility(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fInvincibility = getFloat(args, 0);
 
@@ -629,7 +629,7 @@ static Variable SWMG_SetPlayerInvincibility(const std::vector<Variable> &args, c
     throw RoutineNotImplementedException("SWMG_SetPlayerInvincibility");
 }
 
-static Variable SWMG_SetPlayerSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fSpeed = getFloat(args, 0);
 
@@ -639,7 +639,7 @@ static Variable SWMG_SetPlayerSpeed(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SWMG_SetPlayerSpeed");
 }
 
-static Variable SWMG_SetPlayerMinSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerMinSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fMinSpeed = getFloat(args, 0);
 
@@ -649,7 +649,7 @@ static Variable SWMG_SetPlayerMinSpeed(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetPlayerMinSpeed");
 }
 
-static Variable SWMG_SetPlayerAccelerationPerSecond(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerAccelerationPerSecond(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fAPS = getFloat(args, 0);
 
@@ -659,7 +659,7 @@ static Variable SWMG_SetPlayerAccelerationPerSecond(const std::vector<Variable>
     throw RoutineNotImplementedException("SWMG_SetPlayerAccelerationPerSecond");
 }
 
-static Variable SWMG_SetPlayerTunnelPos(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerTunnelPos(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vTunnel = getVector(args, 0);
 
@@ -669,12 +669,12 @@ static Variable SWMG_SetPlayerTunnelPos(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetPlayerTunnelPos");
 }
 
-static Variable SWMG_GetPlayerTunnelNeg(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerTunnelNeg(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerTunnelNeg");
 }
 
-static Variable SWMG_SetPlayerTunnelNeg(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerTunnelNeg(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vTunnel = getVector(args, 0);
 
@@ -684,12 +684,12 @@ static Variable SWMG_SetPlayerTunnelNeg(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetPlayerTunnelNeg");
 }
 
-static Variable SWMG_GetPlayerOrigin(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerOrigin(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerOrigin");
 }
 
-static Variable SWMG_SetPlayerOrigin(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerOrigin(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vOrigin = getVector(args, 0);
 
@@ -699,7 +699,7 @@ static Variable SWMG_SetPlayerOrigin(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_SetPlayerOrigin");
 }
 
-static Variable SWMG_GetGunBankHorizontalSpread(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankHorizontalSpread(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -710,7 +710,7 @@ static Variable SWMG_GetGunBankHorizontalSpread(const std::vector<Variable> &arg
     throw RoutineNotImplementedException("SWMG_GetGunBankHorizontalSpread");
 }
 
-static Variable SWMG_GetGunBankVerticalSpread(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankVerticalSpread(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -721,7 +721,7 @@ static Variable SWMG_GetGunBankVerticalSpread(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("SWMG_GetGunBankVerticalSpread");
 }
 
-static Variable SWMG_GetGunBankSensingRadius(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankSensingRadius(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -732,7 +732,7 @@ static Variable SWMG_GetGunBankSensingRadius(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("SWMG_GetGunBankSensingRadius");
 }
 
-static Variable SWMG_GetGunBankInaccuracy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetGunBankInaccuracy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -743,7 +743,7 @@ static Variable SWMG_GetGunBankInaccuracy(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SWMG_GetGunBankInaccuracy");
 }
 
-static Variable SWMG_SetGunBankHorizontalSpread(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankHorizontalSpread(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -755,7 +755,7 @@ static Variable SWMG_SetGunBankHorizontalSpread(const std::vector<Variable> &arg
     throw RoutineNotImplementedException("SWMG_SetGunBankHorizontalSpread");
 }
 
-static Variable SWMG_SetGunBankVerticalSpread(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankVerticalSpread(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -767,7 +767,7 @@ static Variable SWMG_SetGunBankVerticalSpread(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("SWMG_SetGunBankVerticalSpread");
 }
 
-static Variable SWMG_SetGunBankSensingRadius(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankSensingRadius(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -779,7 +779,7 @@ static Variable SWMG_SetGunBankSensingRadius(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("SWMG_SetGunBankSensingRadius");
 }
 
-static Variable SWMG_SetGunBankInaccuracy(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetGunBankInaccuracy(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oEnemy = getObject(args, 0, ctx);
     auto nGunBank = getInt(args, 1);
@@ -791,7 +791,7 @@ static Variable SWMG_SetGunBankInaccuracy(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SWMG_SetGunBankInaccuracy");
 }
 
-static Variable SWMG_GetIsInvulnerable(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetIsInvulnerable(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -801,7 +801,7 @@ static Variable SWMG_GetIsInvulnerable(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_GetIsInvulnerable");
 }
 
-static Variable SWMG_StartInvulnerability(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_StartInvulnerability(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -811,12 +811,12 @@ static Variable SWMG_StartInvulnerability(const std::vector<Variable> &args, con
     throw RoutineNotImplementedException("SWMG_StartInvulnerability");
 }
 
-static Variable SWMG_GetPlayerMaxSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerMaxSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerMaxSpeed");
 }
 
-static Variable SWMG_SetPlayerMaxSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerMaxSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fMaxSpeed = getFloat(args, 0);
 
@@ -826,7 +826,7 @@ static Variable SWMG_SetPlayerMaxSpeed(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetPlayerMaxSpeed");
 }
 
-static Variable SWMG_GetSoundFrequency(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetSoundFrequency(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nSound = getInt(args, 1);
@@ -837,7 +837,7 @@ static Variable SWMG_GetSoundFrequency(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_GetSoundFrequency");
 }
 
-static Variable SWMG_SetSoundFrequency(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetSoundFrequency(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nSound = getInt(args, 1);
@@ -849,7 +849,7 @@ static Variable SWMG_SetSoundFrequency(const std::vector<Variable> &args, const
     throw RoutineNotImplementedException("SWMG_SetSoundFrequency");
 }
 
-static Variable SWMG_GetSoundFrequencyIsRandom(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetSoundFrequencyIsRandom(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nSound = getInt(args, 1);
@@ -860,7 +860,7 @@ static Variable SWMG_GetSoundFrequencyIsRandom(const std::vector<Variable> &args
     throw RoutineNotImplementedException("SWMG_GetSoundFrequencyIsRandom");
 }
 
-static Variable SWMG_SetSoundFrequencyIsRandom(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetSoundFrequencyIsRandom(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nSound = getInt(args, 1);
@@ -872,7 +872,7 @@ static Variable SWMG_SetSoundFrequencyIsRandom(const std::vector<Variable> &args
     throw RoutineNotImplementedException("SWMG_SetSoundFrequencyIsRandom");
 }
 
-static Variable SWMG_GetSoundVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetSoundVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nSound = getInt(args, 1);
@@ -883,7 +883,7 @@ static Variable SWMG_GetSoundVolume(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SWMG_GetSoundVolume");
 }
 
-static Variable SWMG_SetSoundVolume(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetSoundVolume(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
     auto nSound = getInt(args, 1);
@@ -895,12 +895,12 @@ static Variable SWMG_SetSoundVolume(const std::vector<Variable> &args, const Rou
     throw RoutineNotImplementedException("SWMG_SetSoundVolume");
 }
 
-static Variable SWMG_GetPlayerTunnelInfinite(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetPlayerTunnelInfinite(Span<const Variable> args, const RoutineContext &ctx) {
     // Execute
     throw RoutineNotImplementedException("SWMG_GetPlayerTunnelInfinite");
 }
 
-static Variable SWMG_SetPlayerTunnelInfinite(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetPlayerTunnelInfinite(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vInfinite = getVector(args, 0);
 
@@ -910,7 +910,7 @@ static Variable SWMG_SetPlayerTunnelInfinite(const std::vector<Variable> &args,
     throw RoutineNotImplementedException("SWMG_SetPlayerTunnelInfinite");
 }
 
-static Variable SWMG_GetSwoopUpgrade(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetSwoopUpgrade(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto nSlot = getInt(args, 0);
 
@@ -920,7 +920,7 @@ static Variable SWMG_GetSwoopUpgrade(const std::vector<Variable> &args, const Ro
     throw RoutineNotImplementedException("SWMG_GetSwoopUpgrade");
 }
 
-static Variable SWMG_GetTrackPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_GetTrackPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oFollower = getObject(args, 0, ctx);
 
@@ -930,7 +930,7 @@ static Variable SWMG_GetTrackPosition(const std::vector<Variable> &args, const R
     throw RoutineNotImplementedException("SWMG_GetTrackPosition");
 }
 
-static Variable SWMG_SetFollowerPosition(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetFollowerPosition(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vPos = getVector(args, 0);
 
@@ -940,7 +940,7 @@ static Variable SWMG_SetFollowerPosition(const std::vector<Variable> &args, cons
     throw RoutineNotImplementedException("SWMG_SetFollowerPosition");
 }
 
-static Variable SWMG_DestroyMiniGameObject(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_DestroyMiniGameObject(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto oObject = getObject(args, 0, ctx);
 
@@ -950,7 +950,7 @@ static Variable SWMG_DestroyMiniGameObject(const std::vector<Variable> &args, co
     throw RoutineNotImplementedException("SWMG_DestroyMiniGameObject");
 }
 
-static Variable SWMG_SetJumpSpeed(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_SetJumpSpeed(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto fSpeed = getFloat(args, 0);
 
@@ -960,7 +960,7 @@ static Variable SWMG_SetJumpSpeed(const std::vector<Variable> &args, const Routi
     throw RoutineNotImplementedException("SWMG_SetJumpSpeed");
 }
 
-static Variable SWMG_PlayerApplyForce(const std::vector<Variable> &args, const RoutineContext &ctx) {
+static Variable SWMG_PlayerApplyForce(Span<const Variable> args, const RoutineContext &ctx) {
     // Load
     auto vForce = getVector(args, 0);
 
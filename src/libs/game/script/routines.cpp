@@ -74,7 +74,7 @@ void Routines::insert(
     std::string name,
     VariableType retType,
     std::vector<VariableType> argTypes,
-    Variable (*fn)(const std::vector<Variable> &args, const RoutineContext &ctx)) {
+    Variable (*fn)(Span<const Variable> args, const RoutineContext &ctx)) {
 
     Variable defRetValue;
     defRetValue.type = retType;
@@ -94,7 +94,7 @@ void Routines::insert(
         retType,
         std::move(defRetValue),
         std::move(argTypes),
-        [this, fn](auto &args, auto &execution) {
+        [this, fn](auto args, auto &execution) {
             RoutineContext ctx(*_game, *_services, execution);
             return fn(args, std::move(ctx));
         });
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/timerwheel.h"
+
+namespace reone {
+
+namespace game {
+
+void TimerWheel::schedule(float delay, Callback callback, uint32_t owner) {
+    auto delayTicks = static_cast<uint64_t>(std::ceil(std::max(0.0f, delay) / kTickLength));
+    delayTicks = std::clamp(delayTicks, static_cast<uint64_t>(1), kMaxDelayTicks);
+
+    Entry entry;
+    entry.deadline = _currentTick + delayTicks;
+    if (_updating) {
+        entry.deadline = std::max(entry.deadline, _targetTick + 1);
+    }
+    entry.sequence = _nextSequence++;
+    entry.owner = owner;
+    entry.callback = std::move(callback);
+    insert(std::move(entry));
+    ++_size;
+}
+
+void TimerWheel::update(float dt) {
+    _timeSinceTick += dt;
+    auto numTicks = static_cast<uint64_t>(_timeSinceTick / kTickLength);
+    _timeSinceTick -= numTicks * kTickLength;
+
+    _targetTick = _currentTick + numTicks;
+    _updating = true;
+    while (_currentTick < _targetTick) {
+        if (_size == 0) {
+            _currentTick = _targetTick;
+            break;
+        }
+        advance();
+    }
+    _updating = false;
+}
+
+void TimerWheel::cancelIf(const std::function<bool(uint32_t)> &predicate) {
+    for (auto &level : _slots) {
+        for (auto &slot : level) {
+            auto it = std::remove_if(slot.begin(), slot.end(), [&predicate](auto &entry) {
+                return predicate(entry.owner);
+            });
+            _size -= static_cast<int>(std::distance(it, slot.end()));
+            slot.erase(it, slot.end());
+        }
+    }
+}
+
+void TimerWheel::clear() {
+    for (auto &level : _slots) {
+        for (auto &slot : level) {
+            slot.clear();
+        }
+    }
+    _size = 0;
+}
+
+void TimerWheel::insert(Entry entry) {
+    uint64_t delta = entry.deadline - _currentTick;
+    int level = 0;
+    while (level < kNumLevels - 1 && delta >= (1ull << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+    auto slot = (entry.deadline >> (kSlotBits * level)) & (kNumSlots - 1);
+    _slots[level][slot].push_back(std::move(entry));
+}
+
+void TimerWheel::cascade(int level) {
+    auto slot = (_currentTick >> (kSlotBits * level)) & (kNumSlots - 1);
+    auto entries = std::move(_slots[level][slot]);
+    _slots[level][slot].clear();
+    for (auto &entry : entries) {
+        insert(std::move(entry));
+    }
+}
+
+void TimerWheel::advance() {
+    ++_currentTick;
+
+    // Move timers of coarser wheels, that are due within the next revolution
+    // of a finer wheel, starting from the coarsest wheel
+    for (int level = kNumLevels - 1; level > 0; --level) {
+        uint64_t mask = (1ull << (kSlotBits * level)) - 1;
+        if ((_currentTick & mask) == 0) {
+            cascade(level);
+        }
+    }
+
+    auto &slot = _slots[0][_currentTick & (kNumSlots - 1)];
+    if (slot.empty()) {
+        return;
+    }
+
+    // Callbacks may schedule new timers, so take ownership of due timers first
+    std::vector<Entry> due;
+    std::swap(due, slot);
+    std::sort(due.begin(), due.end(), [](auto &left, auto &right) {
+        return left.sequence < right.sequence;
+    });
+    _size -= static_cast<int>(due.size());
+
+    for (auto &entry : due) {
+        entry.callback();
+    }
+}
+
+} // namespace game
+
+} // namespace reone
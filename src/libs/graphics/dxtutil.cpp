@@ -17,141 +17,149 @@
 
 #include "reone/graphics/dxtutil.h"
 
+#include "reone/system/threadpool.h"
+
 namespace reone {
 
 namespace graphics {
 
-static uint32_t packRGBA(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+static constexpr int kBlockRowsPerChunk = 16;
+static constexpr int kMaxDecompressTasks = 8;
+
+static constexpr uint32_t packRGBA(uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
     return ((r << 24) | (g << 16) | (b << 8) | a);
 }
 
-static void decompressDXT15Block(uint32_t x,
-                                 uint32_t y,
-                                 uint32_t width,
-                                 const uint8_t *blockStorage,
-                                 bool hasAlpha,
-                                 uint32_t *outImage) {
-    uint8_t alphas[2];
-    uint64_t alphaCodes;
+static uint8_t expand5(uint32_t value) {
+    uint32_t temp = value * 255 + 16;
+    return static_cast<uint8_t>((temp / 32 + temp) / 32);
+}
+
+static uint8_t expand6(uint32_t value) {
+    uint32_t temp = value * 255 + 32;
+    return static_cast<uint8_t>((temp / 64 + temp) / 64);
+}
+
+static void decodeColorPalette(const uint8_t *colorBlock, bool fourColors, uint32_t palette[4]) {
     uint16_t colors[2];
-    uint32_t colorCodes;
-    if (hasAlpha) {
-        alphas[0] = *(blockStorage + 0);
-        alphas[1] = *(blockStorage + 1);
-        alphaCodes = *reinterpret_cast<const uint64_t *>(blockStorage + 2);
-        colors[0] = *reinterpret_cast<const uint16_t *>(blockStorage + 8);
-        colors[1] = *reinterpret_cast<const uint16_t *>(blockStorage + 10);
-        colorCodes = *reinterpret_cast<const uint32_t *>(blockStorage + 12);
+    colors[0] = *reinterpret_cast<const uint16_t *>(colorBlock + 0);
+    colors[1] = *reinterpret_cast<const uint16_t *>(colorBlock + 2);
+
+    uint32_t r[2], g[2], b[2];
+    for (int i = 0; i < 2; ++i) {
+        r[i] = expand5(colors[i] >> 11);
+        g[i] = expand6((colors[i] & 0x07e0) >> 5);
+        b[i] = expand5(colors[i] & 0x001f);
+    }
+
+    palette[0] = packRGBA(r[0], g[0], b[0], 0);
+    palette[1] = packRGBA(r[1], g[1], b[1], 0);
+    if (fourColors || colors[0] > colors[1]) {
+        palette[2] = packRGBA((2 * r[0] + r[1]) / 3, (2 * g[0] + g[1]) / 3, (2 * b[0] + b[1]) / 3, 0);
+        palette[3] = packRGBA((r[0] + 2 * r[1]) / 3, (g[0] + 2 * g[1]) / 3, (b[0] + 2 * b[1]) / 3, 0);
     } else {
-        colors[0] = *reinterpret_cast<const uint16_t *>(blockStorage + 0);
-        colors[1] = *reinterpret_cast<const uint16_t *>(blockStorage + 2);
-        colorCodes = *reinterpret_cast<const uint32_t *>(blockStorage + 4);
+        palette[2] = packRGBA((r[0] + r[1]) / 2, (g[0] + g[1]) / 2, (b[0] + b[1]) / 2, 0);
+        palette[3] = 0;
     }
+}
 
-    uint8_t r[2], g[2], b[2];
-    for (int i = 0; i < 2; ++i) {
-        uint32_t temp = (colors[i] >> 11) * 255 + 16;
-        r[i] = static_cast<uint8_t>((temp / 32 + temp) / 32);
-        temp = ((colors[i] & 0x07e0) >> 5) * 255 + 32;
-        g[i] = static_cast<uint8_t>((temp / 64 + temp) / 64);
-        temp = (colors[i] & 0x001f) * 255 + 16;
-        b[i] = static_cast<uint8_t>((temp / 32 + temp) / 32);
+static void decodeAlphaPalette(const uint8_t *alphaBlock, uint32_t palette[8]) {
+    uint32_t a0 = alphaBlock[0];
+    uint32_t a1 = alphaBlock[1];
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1) {
+        for (uint32_t code = 2; code < 8; ++code) {
+            palette[code] = ((8 - code) * a0 + (code - 1) * a1) / 7;
+        }
+    } else {
+        for (uint32_t code = 2; code < 6; ++code) {
+            palette[code] = ((6 - code) * a0 + (code - 1) * a1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
     }
+}
 
-    for (int j = 0; j < 4; j++) {
-        for (int i = 0; i < 4; i++) {
-            uint8_t alpha;
-            if (hasAlpha) {
-                int alphaCodeIdx = 3 * (4 * j + i);
-                int alphaCode = (alphaCodes >> alphaCodeIdx) & 0x07;
-                if (alphaCode == 0) {
-                    alpha = alphas[0];
-                } else if (alphaCode == 1) {
-                    alpha = alphas[1];
-                } else {
-                    if (alphas[0] > alphas[1]) {
-                        alpha = ((8 - alphaCode) * alphas[0] + (alphaCode - 1) * alphas[1]) / 7;
-                    } else {
-                        if (alphaCode == 6)
-                            alpha = 0;
-                        else if (alphaCode == 7)
-                            alpha = 255;
-                        else
-                            alpha = ((6 - alphaCode) * alphas[0] + (alphaCode - 1) * alphas[1]) / 5;
-                    }
-                }
-            } else {
-                alpha = 255;
-            }
+/**
+ * Decodes a horizontal row of 4x4 blocks. Palettes are resolved once per
+ * block, so that each pixel is a pair of table lookups, and every block row
+ * is written as a single store unless clipped by image bounds.
+ */
+template <bool HasAlpha>
+static void decompressBlockRow(uint32_t width,
+                               uint32_t height,
+                               uint32_t y,
+                               const uint8_t *blockStorage,
+                               uint32_t *outImage) {
+    constexpr uint32_t kBlockSize = HasAlpha ? 16 : 8;
+    uint32_t blockCountX = (width + 3) / 4;
+    uint32_t numRows = std::min(4u, height - y);
 
-            int colorCodeIdx = 2 * (4 * j + i);
-            uint8_t colorCode = (colorCodes >> colorCodeIdx) & 0x03;
-            uint32_t color = 0;
-            if (hasAlpha || colors[0] > colors[1]) {
-                switch (colorCode) {
-                case 0:
-                    color = packRGBA(r[0], g[0], b[0], alpha);
-                    break;
-                case 1:
-                    color = packRGBA(r[1], g[1], b[1], alpha);
-                    break;
-                case 2:
-                    color = packRGBA((2 * r[0] + r[1]) / 3, (2 * g[0] + g[1]) / 3, (2 * b[0] + b[1]) / 3, alpha);
-                    break;
-                case 3:
-                    color = packRGBA((r[0] + 2 * r[1]) / 3, (g[0] + 2 * g[1]) / 3, (b[0] + 2 * b[1]) / 3, alpha);
-                    break;
-                }
-            } else {
-                switch (colorCode) {
-                case 0:
-                    color = packRGBA(r[0], g[0], b[0], alpha);
-                    break;
-                case 1:
-                    color = packRGBA(r[1], g[1], b[1], alpha);
-                    break;
-                case 2:
-                    color = packRGBA((r[0] + r[1]) / 2, (g[0] + g[1]) / 2, (b[0] + b[1]) / 2, alpha);
-                    break;
-                case 3:
-                    color = packRGBA(0, 0, 0, alpha);
-                    break;
-                }
-            }
+    uint32_t colors[4];
+    uint32_t alphas[8];
+    uint32_t pixels[16];
 
-            if (x + i < width) {
-                outImage[(y + j) * width + (x + i)] = color;
+    for (uint32_t i = 0; i < blockCountX; ++i) {
+        const uint8_t *block = blockStorage + i * kBlockSize;
+        const uint8_t *colorBlock = HasAlpha ? block + 8 : block;
+        uint32_t colorCodes = *reinterpret_cast<const uint32_t *>(colorBlock + 4);
+        decodeColorPalette(colorBlock, HasAlpha, colors);
+        if (HasAlpha) {
+            uint64_t alphaCodes = *reinterpret_cast<const uint64_t *>(block + 2);
+            decodeAlphaPalette(block, alphas);
+            for (int k = 0; k < 16; ++k) {
+                pixels[k] = colors[(colorCodes >> (2 * k)) & 0x03] | alphas[(alphaCodes >> (3 * k)) & 0x07];
+            }
+        } else {
+            for (int k = 0; k < 16; ++k) {
+                pixels[k] = colors[(colorCodes >> (2 * k)) & 0x03] | 0xff;
             }
         }
+
+        uint32_t x = i * 4;
+        uint32_t numCols = std::min(4u, width - x);
+        uint32_t *out = outImage + static_cast<size_t>(y) * width + x;
+        for (uint32_t j = 0; j < numRows; ++j) {
+            std::memcpy(out + static_cast<size_t>(j) * width, &pixels[4 * j], numCols * sizeof(uint32_t));
+        }
     }
 }
 
-void decompressDXT1(uint32_t width,
-                    uint32_t height,
-                    const uint8_t *blockStorage,
-                    uint32_t *outImage) {
+template <bool HasAlpha>
+static void decompressBlocks(uint32_t width,
+                             uint32_t height,
+                             const uint8_t *blockStorage,
+                             uint32_t *outImage,
+                             IThreadPool *threadPool) {
+    constexpr uint32_t kBlockSize = HasAlpha ? 16 : 8;
     uint32_t blockCountX = (width + 3) / 4;
     uint32_t blockCountY = (height + 3) / 4;
-    for (uint32_t j = 0; j < blockCountY; j++) {
-        for (uint32_t i = 0; i < blockCountX; i++) {
-            decompressDXT15Block(i * 4, j * 4, width, blockStorage + i * 8, false, outImage);
+    size_t blockRowSize = static_cast<size_t>(blockCountX) * kBlockSize;
+
+    // Rows of blocks write disjoint rows of pixels, so chunks of them are
+    // decoded independently, by whichever thread is free
+    parallelFor(threadPool, static_cast<int>(blockCountY), kBlockRowsPerChunk, kMaxDecompressTasks, [=](int begin, int end) {
+        for (int blockY = begin; blockY < end; ++blockY) {
+            decompressBlockRow<HasAlpha>(width, height, 4 * blockY, blockStorage + blockY * blockRowSize, outImage);
         }
-        blockStorage += blockCountX * 8;
-    }
+    });
+}
+
+void decompressDXT1(uint32_t width,
+                    uint32_t height,
+                    const uint8_t *blockStorage,
+                    uint32_t *outImage,
+                    IThreadPool *threadPool) {
+    decompressBlocks<false>(width, height, blockStorage, outImage, threadPool);
 }
 
 void decompressDXT5(uint32_t width,
                     uint32_t height,
                     const uint8_t *blockStorage,
-                    uint32_t *outImage) {
-    uint32_t blockCountX = (width + 3) / 4;
-    uint32_t blockCountY = (height + 3) / 4;
-    for (uint32_t j = 0; j < blockCountY; j++) {
-        for (uint32_t i = 0; i < blockCountX; i++) {
-            decompressDXT15Block(i * 4, j * 4, width, blockStorage + i * 16, true, outImage);
-        }
-        blockStorage += blockCountX * 16;
-    }
+                    uint32_t *outImage,
+                    IThreadPool *threadPool) {
+    decompressBlocks<true>(width, height, blockStorage, outImage, threadPool);
 }
 
 } // namespace graphics
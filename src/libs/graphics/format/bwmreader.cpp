@@ -167,7 +167,7 @@ void BwmReader::loadAABB() {
         aabbs[i]->right = aabbs[childIdx2];
     }
 
-    _walkmesh->_rootAabb = aabbs[0];
+    _walkmesh->setRootAABB(aabbs[0]);
 }
 
 } // namespace graphics
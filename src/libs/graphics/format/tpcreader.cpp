@@ -27,6 +27,19 @@ namespace reone {
 namespace graphics {
 
 void TpcReader::load() {
+    loadHeader();
+    loadLayers();
+    loadFeatures();
+    loadTexture();
+}
+
+void TpcReader::loadHeaderAndFeatures() {
+    loadHeader();
+    skipLayers();
+    loadFeatures();
+}
+
+void TpcReader::loadHeader() {
     uint32_t dataSize = _tpc.readUint32();
 
     _tpc.skipBytes(4);
@@ -55,10 +68,6 @@ void TpcReader::load() {
         getMipMapSize(0, w, h);
         _dataSize = getMipMapDataSize(w, h);
     }
-
-    loadLayers();
-    loadFeatures();
-    loadTexture();
 }
 
 void TpcReader::loadLayers() {
@@ -80,6 +89,16 @@ void TpcReader::loadLayers() {
     }
 }
 
+void TpcReader::skipLayers() {
+    size_t layerSize = _dataSize;
+    for (int i = 1; i < _numMipMaps; ++i) {
+        int w, h;
+        getMipMapSize(i, w, h);
+        layerSize += getMipMapDataSize(w, h);
+    }
+    _tpc.seek(128 + _numLayers * layerSize);
+}
+
 void TpcReader::loadFeatures() {
     auto pos = _tpc.position();
     auto length = _tpc.length();
@@ -18,6 +18,7 @@
 #include "reone/graphics/model.h"
 
 #include "reone/graphics/animation.h"
+#include "reone/graphics/animationbinding.h"
 #include "reone/graphics/mesh.h"
 #include "reone/graphics/modelnode.h"
 #include "reone/graphics/types.h"
@@ -53,6 +54,7 @@ Model::Model(
 void Model::fillLookups(const std::shared_ptr<ModelNode> &node) {
     _nodeByNumber[node->number()] = node;
     _nodeByName[node->name()] = node;
+    _nodes.push_back(node.get());
 
     for (auto &child : node->children()) {
         fillLookups(child);
@@ -133,6 +135,51 @@ std::shared_ptr<Animation> Model::getAnimation(const std::string &name) const {
     return anim;
 }
 
+static bool doesNodeHaveAncestor(const ModelNode &node, const std::string &name) {
+    if (name.empty()) {
+        return true;
+    }
+    for (auto ancestor = &node; ancestor; ancestor = ancestor->parent()) {
+        if (ancestor->name() == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const AnimationBinding &Model::bindAnimation(const Animation &anim) {
+    std::lock_guard<std::mutex> lock(_animBindingsMutex);
+    auto maybeBinding = _animBindings.find(&anim);
+    if (maybeBinding != _animBindings.end()) {
+        return *maybeBinding->second;
+    }
+    auto binding = std::make_shared<AnimationBinding>();
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        const auto &node = *_nodes[i];
+        if (!node.isAnimated()) {
+            continue;
+        }
+        auto animNode = anim.getNodeByName(node.name());
+        if (!animNode || !doesNodeHaveAncestor(node, anim.root())) {
+            continue;
+        }
+        AnimationBinding::Node boundNode;
+        boundNode.index = static_cast<int>(i);
+        boundNode.restPosition = node.restPosition();
+        boundNode.restOrientation = node.restOrientation();
+        boundNode.position = animNode->vectorTrack(ControllerTypes::position);
+        boundNode.orientation = animNode->quaternionTrack(ControllerTypes::orientation);
+        boundNode.scale = animNode->floatTrack(ControllerTypes::scale);
+        boundNode.alpha = animNode->floatTrack(ControllerTypes::alpha);
+        boundNode.selfIllumColor = animNode->vectorTrack(ControllerTypes::selfIllumColor);
+        boundNode.color = animNode->vectorTrack(ControllerTypes::color);
+        binding->nodes.push_back(std::move(boundNode));
+    }
+    auto &result = *binding;
+    _animBindings[&anim] = std::move(binding);
+    return result;
+}
+
 } // namespace graphics
 
 } // namespace reone
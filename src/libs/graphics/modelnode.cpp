@@ -95,6 +95,21 @@ bool ModelNode::quaternionValueAt(ControllerType type, float time, glm::quat &va
     return track.valueAtTime(time, value);
 }
 
+const KeyframeTrack<float> *ModelNode::floatTrack(ControllerType type) const {
+    auto it = _floatTracks.find(type);
+    return it != _floatTracks.end() ? &it->second : nullptr;
+}
+
+const KeyframeTrack<glm::vec3> *ModelNode::vectorTrack(ControllerType type) const {
+    auto it = _vectorTracks.find(type);
+    return it != _vectorTracks.end() ? &it->second : nullptr;
+}
+
+const KeyframeTrack<glm::quat> *ModelNode::quaternionTrack(ControllerType type) const {
+    auto it = _quaternionTracks.find(type);
+    return it != _quaternionTracks.end() ? &it->second : nullptr;
+}
+
 } // namespace graphics
 
 } // namespace reone
@@ -24,7 +24,7 @@ namespace reone {
 
 namespace graphics {
 
-static void decompressLayer(int width, int height, Texture::Layer &layer, PixelFormat srcFormat, PixelFormat &dstFormat) {
+static void decompressLayer(int width, int height, Texture::Layer &layer, PixelFormat srcFormat, PixelFormat &dstFormat, IThreadPool *threadPool) {
     if (!isCompressed(srcFormat)) {
         throw std::invalid_argument("format must be either DXT1 or DXT5");
     }
@@ -36,10 +36,10 @@ static void decompressLayer(int width, int height, Texture::Layer &layer, PixelF
     bool alpha;
 
     if (srcFormat == PixelFormat::DXT5) {
-        decompressDXT5(width, height, srcPixels, decompPixelsPtr);
+        decompressDXT5(width, height, srcPixels, decompPixelsPtr, threadPool);
         alpha = true;
     } else {
-        decompressDXT1(width, height, srcPixels, decompPixelsPtr);
+        decompressDXT1(width, height, srcPixels, decompPixelsPtr, threadPool);
         alpha = false;
     }
 
@@ -76,7 +76,7 @@ static int getBytesPerPixel(PixelFormat format) {
     }
 }
 
-void convertGridTextureToArray(Texture &texture, int numX, int numY) {
+void convertGridTextureToArray(Texture &texture, int numX, int numY, IThreadPool *threadPool) {
     checkEqual("layers size", static_cast<int>(texture.layers().size()), 1);
     if (isCompressed(texture.pixelFormat())) {
         PixelFormat newFormat;
@@ -85,7 +85,8 @@ void convertGridTextureToArray(Texture &texture, int numX, int numY) {
             texture.height(),
             texture.layers().front(),
             texture.pixelFormat(),
-            newFormat);
+            newFormat,
+            threadPool);
         texture.setPixelFormat(newFormat);
     }
     auto gridPixels = *texture.layers().front().pixels;
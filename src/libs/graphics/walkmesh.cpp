@@ -17,20 +17,139 @@
 
 #include "reone/graphics/walkmesh.h"
 
+#include "reone/system/exception/validation.h"
+
 namespace reone {
 
 namespace graphics {
 
+static constexpr int kMaxLeafTriangles = 4;
+static constexpr int kMaxTreeDepth = 62;
+
+static inline uint64_t surfaceBit(uint32_t material) {
+    return material < 64 ? (1ull << material) : 0ull;
+}
+
+// Same as AABB::raycast, minus the indirection, for nodes of flattened trees
+static inline bool raycastBox(const glm::vec3 &min,
+                              const glm::vec3 &max,
+                              const glm::vec3 &origin,
+                              const glm::vec3 &invDir,
+                              float maxDistance,
+                              float &outDistance) {
+    glm::vec3 t1((min - origin) * invDir);
+    glm::vec3 t2((max - origin) * invDir);
+    glm::vec3 tmin3(glm::min(t1, t2));
+    glm::vec3 tmax3(glm::max(t1, t2));
+
+    float tmin = glm::max(0.0f, glm::max(glm::max(tmin3.x, tmin3.y), tmin3.z));
+    float tmax = glm::min(glm::min(tmax3.x, tmax3.y), tmax3.z);
+
+    if (tmax < tmin || tmin >= maxDistance) {
+        return false;
+    }
+
+    outDistance = tmin;
+    return true;
+}
+
+uint64_t Walkmesh::surfaceMask(const std::set<uint32_t> &surfaces) {
+    uint64_t mask = 0;
+    for (auto &material : surfaces) {
+        mask |= surfaceBit(material);
+    }
+    return mask;
+}
+
+void Walkmesh::setRootAABB(const std::shared_ptr<AABB> &aabb) {
+    _nodes.clear();
+    _triangles.clear();
+    if (!aabb) {
+        _bounds = graphics::AABB();
+        return;
+    }
+    _bounds = aabb->value;
+    appendAABB(*aabb, 0);
+}
+
+uint32_t Walkmesh::appendAABB(const AABB &aabb, int depth) {
+    if (depth > kMaxTreeDepth) {
+        throw ValidationException("Walkmesh AABB tree is too deep");
+    }
+    auto nodeIdx = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    if (aabb.faceIdx != -1) {
+        if (aabb.faceIdx >= static_cast<int>(_faces.size())) {
+            throw ValidationException("Walkmesh AABB face index out of range: " + std::to_string(aabb.faceIdx));
+        }
+        auto &face = _faces[aabb.faceIdx];
+        Triangle triangle;
+        std::copy_n(face.vertices.begin(), 3, triangle.vertices);
+        triangle.surfaceBit = surfaceBit(face.material);
+        triangle.faceIdx = aabb.faceIdx;
+
+        auto &node = _nodes[nodeIdx];
+        node.min = glm::min(glm::min(triangle.vertices[0], triangle.vertices[1]), triangle.vertices[2]);
+        node.max = glm::max(glm::max(triangle.vertices[0], triangle.vertices[1]), triangle.vertices[2]);
+        node.offset = static_cast<uint32_t>(_triangles.size());
+        node.triangleCount = 1;
+        _triangles.push_back(std::move(triangle));
+        return nodeIdx;
+    }
+
+    auto &left = aabb.left ? aabb.left : aabb.right;
+    auto &right = aabb.left ? aabb.right : aabb.left;
+    if (!left) {
+        throw ValidationException("Walkmesh AABB node has neither face nor children");
+    }
+    _nodes[nodeIdx].min = aabb.value.min();
+    _nodes[nodeIdx].max = aabb.value.max();
+    appendAABB(*left, depth + 1);
+    if (right) {
+        _nodes[nodeIdx].offset = appendAABB(*right, depth + 1);
+    }
+
+    // Collapse small subtrees into leaf nodes. Triangles of a subtree are
+    // contiguous, as the tree is flattened depth-first.
+    auto childCount = _nodes.size() - nodeIdx - 1;
+    if (childCount > 2) {
+        return nodeIdx;
+    }
+    uint32_t triangleCount = 0;
+    for (auto i = nodeIdx + 1; i < _nodes.size(); ++i) {
+        if (_nodes[i].triangleCount == 0) {
+            return nodeIdx;
+        }
+        triangleCount += _nodes[i].triangleCount;
+    }
+    if (triangleCount > kMaxLeafTriangles) {
+        return nodeIdx;
+    }
+    auto &node = _nodes[nodeIdx];
+    node.min = _nodes[nodeIdx + 1].min;
+    node.max = _nodes[nodeIdx + 1].max;
+    for (auto i = nodeIdx + 2; i < _nodes.size(); ++i) {
+        node.min = glm::min(node.min, _nodes[i].min);
+        node.max = glm::max(node.max, _nodes[i].max);
+    }
+    node.offset = _nodes[nodeIdx + 1].offset;
+    node.triangleCount = triangleCount;
+    _nodes.resize(nodeIdx + 1);
+
+    return nodeIdx;
+}
+
 const Walkmesh::Face *Walkmesh::raycast(
-    std::set<uint32_t> surfaces,
+    uint64_t surfaceMask,
     const glm::vec3 &origin,
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
 
     // For area walkmeshes, find intersection via AABB tree
-    if (_rootAabb) {
-        return raycastAABB(surfaces, origin, dir, maxDistance, outDistance);
+    if (!_nodes.empty()) {
+        return raycastAABB(surfaceMask, origin, dir, maxDistance, outDistance);
     }
 
     // For placeable and door walkmeshes, test all faces for intersection
@@ -38,7 +157,7 @@ const Walkmesh::Face *Walkmesh::raycast(
     float minDistance = std::numeric_limits<float>::max();
     std::optional<std::reference_wrapper<const Face>> intersected;
     for (auto &face : _faces) {
-        if (!raycastFace(surfaces, face, origin, dir, maxDistance, distance)) {
+        if (!raycastFace(surfaceMask, face, origin, dir, maxDistance, distance)) {
             continue;
         }
         if (distance < minDistance) {
@@ -55,59 +174,96 @@ const Walkmesh::Face *Walkmesh::raycast(
 }
 
 const Walkmesh::Face *Walkmesh::raycastAABB(
-    std::set<uint32_t> surfaces,
+    uint64_t surfaceMask,
     const glm::vec3 &origin,
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
 
-    float distance = 0.0f;
-
-    std::stack<AABB *> aabbs;
-    aabbs.push(_rootAabb.get());
+    struct StackEntry {
+        uint32_t nodeIdx;
+        float distance;
+    };
 
     auto invDir = 1.0f / dir;
 
-    while (!aabbs.empty()) {
-        auto aabb = aabbs.top();
-        aabbs.pop();
+    float distance = 0.0f;
+    auto &root = _nodes.front();
+    if (!raycastBox(root.min, root.max, origin, invDir, maxDistance, distance)) {
+        return nullptr;
+    }
+
+    // Tree depth is limited, and every iteration pops one node and pushes at
+    // most two, so stack cannot overflow
+    StackEntry stack[kMaxTreeDepth + 2];
+    int stackSize = 0;
+    stack[stackSize++] = StackEntry {0, distance};
 
-        // Test ray/face intersection for tree leafs
-        if (aabb->faceIdx != -1) {
-            const Face &face = _faces[aabb->faceIdx];
-            if (raycastFace(surfaces, face, origin, dir, maxDistance, distance)) {
-                outDistance = distance;
-                return &face;
-            }
+    const Triangle *nearest = nullptr;
+    float nearestDistance = maxDistance;
+
+    while (stackSize > 0) {
+        auto entry = stack[--stackSize];
+        if (entry.distance >= nearestDistance) {
             continue;
         }
+        auto &node = _nodes[entry.nodeIdx];
 
-        // Test ray/AABB intersection
-        if (!aabb->value.raycast(origin, invDir, maxDistance, distance)) {
+        // Test ray/triangle intersection for tree leafs
+        if (node.triangleCount > 0) {
+            for (uint32_t i = 0; i < node.triangleCount; ++i) {
+                auto &triangle = _triangles[node.offset + i];
+                if ((triangle.surfaceBit & surfaceMask) == 0) {
+                    continue;
+                }
+                glm::vec2 baryPosition(0.0f);
+                if (glm::intersectRayTriangle(origin, dir, triangle.vertices[0], triangle.vertices[1], triangle.vertices[2], baryPosition, distance) &&
+                    distance > 0.0f && distance < nearestDistance) {
+                    nearest = &triangle;
+                    nearestDistance = distance;
+                }
+            }
             continue;
         }
 
-        // Find intersection with child AABB nodes
-        if (aabb->left) {
-            aabbs.push(aabb->left.get());
-        }
-        if (aabb->right) {
-            aabbs.push(aabb->right.get());
+        // Test ray/AABB intersection for child nodes, visiting nearest first
+        uint32_t leftIdx = entry.nodeIdx + 1;
+        uint32_t rightIdx = node.offset;
+        float leftDistance = 0.0f;
+        float rightDistance = 0.0f;
+        bool left = raycastBox(_nodes[leftIdx].min, _nodes[leftIdx].max, origin, invDir, nearestDistance, leftDistance);
+        bool right = rightIdx != 0 && raycastBox(_nodes[rightIdx].min, _nodes[rightIdx].max, origin, invDir, nearestDistance, rightDistance);
+        if (left && right) {
+            if (leftDistance < rightDistance) {
+                stack[stackSize++] = StackEntry {rightIdx, rightDistance};
+                stack[stackSize++] = StackEntry {leftIdx, leftDistance};
+            } else {
+                stack[stackSize++] = StackEntry {leftIdx, leftDistance};
+                stack[stackSize++] = StackEntry {rightIdx, rightDistance};
+            }
+        } else if (left) {
+            stack[stackSize++] = StackEntry {leftIdx, leftDistance};
+        } else if (right) {
+            stack[stackSize++] = StackEntry {rightIdx, rightDistance};
         }
     }
 
-    return nullptr;
+    if (!nearest) {
+        return nullptr;
+    }
+    outDistance = nearestDistance;
+    return &_faces[nearest->faceIdx];
 }
 
 bool Walkmesh::raycastFace(
-    std::set<uint32_t> surfaces,
+    uint64_t surfaceMask,
     const Face &face,
     const glm::vec3 &origin,
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
 
-    if (surfaces.count(face.material) == 0) {
+    if ((surfaceBit(face.material) & surfaceMask) == 0) {
         return false;
     }
 
@@ -127,10 +283,10 @@ bool Walkmesh::raycastFace(
 }
 
 bool Walkmesh::contains(const glm::vec2 &point) const {
-    if (!_rootAabb) {
+    if (_nodes.empty()) {
         return false;
     }
-    return _rootAabb->value.contains(point);
+    return _bounds.contains(point);
 }
 
 } // namespace graphics
@@ -18,17 +18,19 @@
 #include "reone/movie/format/bikreader.h"
 
 #include "reone/audio/clip.h"
+#include "reone/movie/framequeue.h"
 #include "reone/movie/movie.h"
 #include "reone/movie/videostream.h"
 #include "reone/system/exception/filenotfound.h"
 #include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
+#include "reone/system/threadutil.h"
 
 #ifdef R_ENABLE_MOVIE
 
 extern "C" {
 #include "libavcodec/avcodec.h"
 #include "libavformat/avformat.h"
-#include "libavutil/imgutils.h"
 #include "libswresample/swresample.h"
 #include "libswscale/swscale.h"
 }
@@ -43,35 +45,209 @@ namespace movie {
 
 #ifdef R_ENABLE_MOVIE
 
-class BinkVideoDecoder : public movie::VideoStream {
+static constexpr int kVideoFrameQueueCapacity = 8;
+
+static void openCodec(AVFormatContext *formatCtx, int streamIdx, AVCodecContext **codecCtx) {
+    AVCodecParameters *codecParams = formatCtx->streams[streamIdx]->codecpar;
+    const AVCodec *codec = avcodec_find_decoder(codecParams->codec_id);
+    if (!codec) {
+        throw ValidationException("BIK codec not found");
+    }
+    *codecCtx = avcodec_alloc_context3(codec);
+    if (avcodec_parameters_to_context(*codecCtx, codecParams) != 0) {
+        throw ValidationException("Failed to copy BIK codec parameters");
+    }
+    if (avcodec_open2(*codecCtx, codec, nullptr) != 0) {
+        throw ValidationException("Failed to open BIK codec");
+    }
+}
+
+static int64_t streamTimestampFromTime(const AVStream *stream, float time) {
+    auto micros = static_cast<int64_t>(1e6f * time);
+    return av_rescale_q(micros, AVRational {1, AV_TIME_BASE}, stream->time_base);
+}
+
+static float timeFromStreamTimestamp(const AVStream *stream, int64_t timestamp) {
+    int64_t micros = av_rescale_q(timestamp, stream->time_base, AVRational {1, AV_TIME_BASE});
+    return micros / 1e6f;
+}
+
+/**
+ * Decodes audio track of a BIK file incrementally. Uses its own demuxer, so
+ * that it can be driven by the audio source independently of video decoding.
+ */
+class BinkAudioDecoder : public IAudioDecoder, boost::noncopyable {
 public:
-    BinkVideoDecoder(std::filesystem::path path) :
+    BinkAudioDecoder(std::filesystem::path path) :
         _path(std::move(path)) {
     }
 
-    ~BinkVideoDecoder() { deinit(); }
+    ~BinkAudioDecoder() { deinit(); }
 
     void deinit() {
-        if (_avFrameScaled) {
-            av_frame_free(&_avFrameScaled);
+        if (_packet) {
+            av_packet_free(&_packet);
         }
         if (_avFrame) {
             av_frame_free(&_avFrame);
         }
-        if (_frameBuffer) {
-            av_free(_frameBuffer);
-            _frameBuffer = nullptr;
-        }
         if (_swrContext) {
             swr_free(&_swrContext);
         }
+        if (_codecCtx) {
+            avcodec_free_context(&_codecCtx);
+        }
+        if (_formatCtx) {
+            avformat_close_input(&_formatCtx);
+        }
+    }
+
+    void load() {
+        if (avformat_open_input(&_formatCtx, _path.string().c_str(), nullptr, nullptr) != 0) {
+            throw ValidationException("Failed to open BIK file: " + _path.string());
+        }
+        if (avformat_find_stream_info(_formatCtx, nullptr) != 0) {
+            throw ValidationException("Failed to find BIK stream info");
+        }
+        _streamIdx = av_find_best_stream(_formatCtx, AVMEDIA_TYPE_AUDIO, -1, -1, nullptr, 0);
+        if (_streamIdx < 0) {
+            throw ValidationException("Audio stream not found in BIK");
+        }
+        openCodec(_formatCtx, _streamIdx, &_codecCtx);
+        initResamplingContext();
+
+        _avFrame = av_frame_alloc();
+        _packet = av_packet_alloc();
+    }
+
+    bool decode(AudioClip::Frame &frame, int sampleCount) override {
+        frame.format = AudioFormat::Mono16;
+        frame.sampleRate = _codecCtx->sample_rate;
+        frame.samples.clear();
+
+        while (frame.samples.size() < static_cast<size_t>(2 * sampleCount)) {
+            int ret = avcodec_receive_frame(_codecCtx, _avFrame);
+            if (ret == 0) {
+                appendSamples(frame.samples);
+                continue;
+            }
+            if (ret != AVERROR(EAGAIN) || !sendNextPacket()) {
+                break;
+            }
+        }
+
+        return !frame.samples.empty();
+    }
+
+    /**
+     * Seeks to the nearest preceding packet of the audio stream.
+     */
+    void seek(float time) override {
+        int64_t timestamp = streamTimestampFromTime(_formatCtx->streams[_streamIdx], time);
+        av_seek_frame(_formatCtx, _streamIdx, timestamp, AVSEEK_FLAG_BACKWARD);
+        avcodec_flush_buffers(_codecCtx);
+        swr_init(_swrContext);
+        _eof = false;
+    }
+
+private:
+    std::filesystem::path _path;
+
+    int _streamIdx {-1};
+    bool _eof {false};
+
+    AVFormatContext *_formatCtx {nullptr};
+    AVCodecContext *_codecCtx {nullptr};
+    SwrContext *_swrContext {nullptr};
+    AVFrame *_avFrame {nullptr};
+    AVPacket *_packet {nullptr};
+
+    void initResamplingContext() {
+#if (LIBSWRESAMPLE_VERSION_MAJOR > 4) || \
+    (LIBSWRESAMPLE_VERSION_MAJOR == 4 && LIBSWRESAMPLE_VERSION_MINOR >= 7)
+        AVChannelLayout outChLayout(AV_CHANNEL_LAYOUT_MONO);
+        auto &inChLayout = _codecCtx->ch_layout;
+        swr_alloc_set_opts2(
+            &_swrContext,
+            &outChLayout, AV_SAMPLE_FMT_S16, _codecCtx->sample_rate,
+            &inChLayout, _codecCtx->sample_fmt, _codecCtx->sample_rate,
+            0, nullptr);
+#else
+        _swrContext = swr_alloc_set_opts(
+            nullptr,
+            AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_S16, _codecCtx->sample_rate,
+            _codecCtx->channel_layout, _codecCtx->sample_fmt, _codecCtx->sample_rate,
+            0, nullptr);
+#endif
+        swr_init(_swrContext);
+    }
+
+    /**
+     * Sends the next audio packet to the decoder, or flushes the decoder
+     * once the end of the file is reached.
+     *
+     * @return false if decoder has already been flushed
+     */
+    bool sendNextPacket() {
+        if (_eof) {
+            return false;
+        }
+        while (av_read_frame(_formatCtx, _packet) >= 0) {
+            if (_packet->stream_index != _streamIdx) {
+                av_packet_unref(_packet);
+                continue;
+            }
+            avcodec_send_packet(_codecCtx, _packet);
+            av_packet_unref(_packet);
+            return true;
+        }
+        avcodec_send_packet(_codecCtx, nullptr);
+        _eof = true;
+        return true;
+    }
+
+    void appendSamples(ByteBuffer &samples) {
+        int numSamples = swr_get_out_samples(_swrContext, _avFrame->nb_samples);
+        size_t offset = samples.size();
+        samples.resize(offset + 2ll * numSamples);
+        uint8_t *samplesPtr = reinterpret_cast<uint8_t *>(&samples[offset]);
+        int numConverted = swr_convert(
+            _swrContext,
+            &samplesPtr, numSamples,
+            const_cast<const uint8_t **>(&_avFrame->extended_data[0]), _avFrame->nb_samples);
+        samples.resize(offset + 2ll * std::max(numConverted, 0));
+    }
+};
+
+/**
+ * Decodes and colour-converts video frames on a separate thread, ahead of the
+ * presentation clock, into a bounded queue of pooled pixel buffers.
+ */
+class BinkVideoDecoder : public movie::VideoStream {
+public:
+    BinkVideoDecoder(std::filesystem::path path) :
+        _path(std::move(path)) {
+    }
+
+    ~BinkVideoDecoder() { deinit(); }
+
+    void deinit() {
+        if (_frames) {
+            _frames->close();
+        }
+        if (_decodeThread.joinable()) {
+            _decodeThread.join();
+        }
+        if (_packet) {
+            av_packet_free(&_packet);
+        }
+        if (_avFrame) {
+            av_frame_free(&_avFrame);
+        }
         if (_swsContext) {
             sws_freeContext(_swsContext);
             _swsContext = nullptr;
         }
-        if (_audioCodecCtx) {
-            avcodec_free_context(&_audioCodecCtx);
-        }
         if (_videoCodecCtx) {
             avcodec_free_context(&_videoCodecCtx);
         }
@@ -88,8 +264,7 @@ public:
 
         // Video
 
-        openCodec(_videoStreamIdx, &_videoCodecCtx);
-        initFrames();
+        openCodec(_formatCtx, _videoStreamIdx, &_videoCodecCtx);
         initScalingContext();
 
         _width = _videoCodecCtx->width;
@@ -98,16 +273,20 @@ public:
         // Audio
 
         if (hasAudio()) {
-            openCodec(_audioStreamIdx, &_audioCodecCtx);
-            initResamplingContext();
             loadAudioClip();
-            seekBeginning();
         }
+
+        _avFrame = av_frame_alloc();
+        _packet = av_packet_alloc();
+        _frames = std::make_unique<VideoFrameQueue>(kVideoFrameQueueCapacity, 3ll * _width * _height);
+        _decodeThread = std::thread(&BinkVideoDecoder::decodeThreadFunc, this);
     }
 
     void seek(float time) override {
-        int64_t timestamp = streamTimestampFromTime(_videoStreamIdx, time);
-        loadVideoFrame(timestamp);
+        _frame.pixels = _frames->pickDue(time);
+        if (_frames->isDrained()) {
+            _ended = true;
+        }
     }
 
     std::shared_ptr<audio::AudioClip> audioStream() const { return _audioStream; }
@@ -117,16 +296,16 @@ private:
 
     int _videoStreamIdx {-1};
     int _audioStreamIdx {-1};
-    int64_t _lastPacketTimestamp {-1};
 
     AVFormatContext *_formatCtx {nullptr};
     AVCodecContext *_videoCodecCtx {nullptr};
-    AVCodecContext *_audioCodecCtx {nullptr};
     SwsContext *_swsContext {nullptr};
-    SwrContext *_swrContext {nullptr};
     AVFrame *_avFrame {nullptr};
-    AVFrame *_avFrameScaled {nullptr};
-    uint8_t *_frameBuffer {nullptr};
+    AVPacket *_packet {nullptr};
+
+    std::unique_ptr<VideoFrameQueue> _frames;
+    std::thread _decodeThread;
+    float _lastFrameTime {0.0f};
 
     std::shared_ptr<audio::AudioClip> _audioStream;
 
@@ -152,35 +331,6 @@ private:
         }
     }
 
-    void openCodec(int streamIdx, AVCodecContext **codecCtx) {
-        AVCodecParameters *codecParams = _formatCtx->streams[streamIdx]->codecpar;
-        const AVCodec *codec = avcodec_find_decoder(codecParams->codec_id);
-        if (!codec) {
-            throw ValidationException("BIK codec not found");
-        }
-        *codecCtx = avcodec_alloc_context3(codec);
-        if (avcodec_parameters_to_context(*codecCtx, codecParams) != 0) {
-            throw ValidationException("Failed to copy BIK codec parameters");
-        }
-        if (avcodec_open2(*codecCtx, codec, nullptr) != 0) {
-            throw ValidationException("Failed to open BIK codec");
-        }
-    }
-
-    void initFrames() {
-        _avFrame = av_frame_alloc();
-        _avFrameScaled = av_frame_alloc();
-
-        int bufSize = av_image_get_buffer_size(AV_PIX_FMT_RGB24, _videoCodecCtx->width, _videoCodecCtx->height, 32);
-        _frameBuffer = static_cast<uint8_t *>(av_malloc(bufSize));
-        av_image_fill_arrays(
-            _avFrameScaled->data, _avFrameScaled->linesize,
-            _frameBuffer,
-            AV_PIX_FMT_RGB24,
-            _videoCodecCtx->width, _videoCodecCtx->height,
-            32);
-    }
-
     void initScalingContext() {
         _swsContext = sws_getContext(
             _videoCodecCtx->width, _videoCodecCtx->height,
@@ -191,124 +341,78 @@ private:
             nullptr, nullptr, nullptr);
     }
 
-    void initResamplingContext() {
-#if (LIBSWRESAMPLE_VERSION_MAJOR > 4) || \
-    (LIBSWRESAMPLE_VERSION_MAJOR == 4 && LIBSWRESAMPLE_VERSION_MINOR >= 7)
-        AVChannelLayout outChLayout(AV_CHANNEL_LAYOUT_MONO);
-        auto &inChLayout = _audioCodecCtx->ch_layout;
-        swr_alloc_set_opts2(
-            &_swrContext,
-            &outChLayout, AV_SAMPLE_FMT_S16, _audioCodecCtx->sample_rate,
-            &inChLayout, _audioCodecCtx->sample_fmt, _audioCodecCtx->sample_rate,
-            0, nullptr);
-#else
-        _swrContext = swr_alloc_set_opts(
-            nullptr,
-            AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_S16, _audioCodecCtx->sample_rate,
-            _audioCodecCtx->channel_layout, _audioCodecCtx->sample_fmt, _audioCodecCtx->sample_rate,
-            0, nullptr);
-#endif
-        swr_init(_swrContext);
+    void loadAudioClip() {
+        const AVStream *stream = _formatCtx->streams[_audioStreamIdx];
+        float duration;
+        if (stream->duration != AV_NOPTS_VALUE) {
+            duration = timeFromStreamTimestamp(stream, stream->duration);
+        } else {
+            duration = _formatCtx->duration / static_cast<float>(AV_TIME_BASE);
+        }
+        auto path = _path;
+        _audioStream = std::make_shared<AudioClip>(
+            [path]() -> std::unique_ptr<IAudioDecoder> {
+                auto decoder = std::make_unique<BinkAudioDecoder>(path);
+                decoder->load();
+                return decoder;
+            },
+            duration);
     }
 
-    void loadVideoFrame(int64_t timestamp) {
-        AVPacket packet;
-
-        // Do nothing if last packet timestamp is greater or equals requested
-        if (_lastPacketTimestamp != -1 && _lastPacketTimestamp >= timestamp) {
-            _frame.pixels.reset();
-            return;
+    void decodeThreadFunc() {
+        setThreadName("movie");
+        try {
+            decodeVideoFrames();
+        } catch (const std::exception &ex) {
+            error("Error decoding BIK video: " + std::string(ex.what()));
         }
+        _frames->finish();
+    }
 
-        int ret;
-        while ((ret = av_read_frame(_formatCtx, &packet)) >= 0) {
-            if (packet.stream_index != _videoStreamIdx) {
+    void decodeVideoFrames() {
+        bool eof = false;
+        while (true) {
+            int ret = avcodec_receive_frame(_videoCodecCtx, _avFrame);
+            if (ret == 0) {
+                if (!queueVideoFrame()) {
+                    return;
+                }
                 continue;
             }
-            _lastPacketTimestamp = packet.pts;
-
-            avcodec_send_packet(_videoCodecCtx, &packet);
-            ret = avcodec_receive_frame(_videoCodecCtx, _avFrame);
-            if (ret == AVERROR(EAGAIN)) {
-                continue;
-            } else if (ret < 0) {
-                break;
+            if (ret != AVERROR(EAGAIN) || eof) {
+                return;
             }
-
-            if (_lastPacketTimestamp < timestamp) {
+            if (av_read_frame(_formatCtx, _packet) < 0) {
+                avcodec_send_packet(_videoCodecCtx, nullptr);
+                eof = true;
                 continue;
             }
-            sws_scale(
-                _swsContext,
-                _avFrame->data, _avFrame->linesize, 0, _videoCodecCtx->height,
-                _avFrameScaled->data, _avFrameScaled->linesize);
-            auto pixels = std::make_shared<ByteBuffer>(3ll * _videoCodecCtx->width * _videoCodecCtx->height, '\0');
-            for (int y = 0; y < _videoCodecCtx->height; ++y) {
-                int dstIdx = 3 * _videoCodecCtx->width * y;
-                uint8_t *src = _avFrameScaled->data[0] + static_cast<long long>(y) * _avFrameScaled->linesize[0];
-                memcpy(pixels->data() + dstIdx, src, 3ll * _videoCodecCtx->width);
+            if (_packet->stream_index == _videoStreamIdx) {
+                avcodec_send_packet(_videoCodecCtx, _packet);
             }
-            _frame.pixels = std::move(pixels);
-
-            break;
-        }
-        if (ret < 0) {
-            _ended = true;
+            av_packet_unref(_packet);
         }
-        av_packet_unref(&packet);
     }
 
-    void loadAudioClip() {
-        _audioStream = std::make_shared<AudioClip>();
-
-        AVPacket packet;
-        int ret;
-        while ((ret = av_read_frame(_formatCtx, &packet)) >= 0) {
-            if (packet.stream_index != _audioStreamIdx) {
-                continue;
-            }
-            avcodec_send_packet(_audioCodecCtx, &packet);
-            while ((ret = avcodec_receive_frame(_audioCodecCtx, _avFrame)) >= 0) {
-                // Resample frame
-                int numSamples = swr_get_out_samples(_swrContext, _avFrame->nb_samples);
-                int bufSize = av_samples_get_buffer_size(nullptr, 1, numSamples, AV_SAMPLE_FMT_S16, 1);
-                ByteBuffer samples(bufSize, '\0');
-                uint8_t *samplesPtr = reinterpret_cast<uint8_t *>(&samples[0]);
-                swr_convert(
-                    _swrContext,
-                    &samplesPtr, numSamples,
-                    const_cast<const uint8_t **>(&_avFrame->extended_data[0]), _avFrame->nb_samples);
-
-                // Save frame
-                AudioClip::Frame frame;
-                frame.format = AudioFormat::Mono16;
-                frame.sampleRate = _audioCodecCtx->sample_rate;
-                frame.samples = std::move(samples);
-                _audioStream->add(std::move(frame));
-            }
-            if (ret < 0) {
-                if (ret == AVERROR_EOF || ret == AVERROR(EAGAIN)) {
-                    continue;
-                } else {
-                    break;
-                }
-            }
+    bool queueVideoFrame() {
+        auto pixels = _frames->acquire();
+        if (!pixels) {
+            return false;
         }
-        av_packet_unref(&packet);
-    }
-
-    void seekBeginning() {
-        av_seek_frame(_formatCtx, -1, 0, AVSEEK_FLAG_ANY);
-    }
-
-    int64_t streamTimestampFromTime(int streamIdx, float time) {
-        auto micros = static_cast<int64_t>(1e6f * time);
-        return av_rescale_q(micros, AVRational {1, AV_TIME_BASE}, _formatCtx->streams[streamIdx]->time_base);
-    }
+        uint8_t *dstData[] {reinterpret_cast<uint8_t *>(pixels->data())};
+        int dstLinesize[] {3 * _width};
+        sws_scale(
+            _swsContext,
+            _avFrame->data, _avFrame->linesize, 0, _height,
+            dstData, dstLinesize);
+
+        int64_t timestamp = _avFrame->best_effort_timestamp;
+        if (timestamp != AV_NOPTS_VALUE) {
+            _lastFrameTime = timeFromStreamTimestamp(_formatCtx->streams[_videoStreamIdx], timestamp);
+        }
+        _frames->push(_lastFrameTime, std::move(pixels));
 
-    float timeFromStreamTimestamp(int streamIdx, int64_t timestamp) {
-        int64_t micros = av_rescale_q(timestamp, _formatCtx->streams[streamIdx]->time_base, AVRational {1, AV_TIME_BASE});
-        return micros / 1e6f;
+        return true;
     }
 
     inline bool hasAudio() const {
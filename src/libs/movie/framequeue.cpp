@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/movie/framequeue.h"
+
+namespace reone {
+
+namespace movie {
+
+// Besides queued frames, one buffer is being presented and one is being decoded into
+static constexpr int kExtraBufferCount = 2;
+
+std::shared_ptr<ByteBuffer> VideoFrameQueue::acquire() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condVar.wait(lock, [this]() {
+        return _closed || !_free.empty() || _allocated < _capacity + kExtraBufferCount;
+    });
+    if (_closed) {
+        return nullptr;
+    }
+    if (!_free.empty()) {
+        auto pixels = std::move(_free.back());
+        _free.pop_back();
+        return pixels;
+    }
+    ++_allocated;
+    return std::make_shared<ByteBuffer>(_frameSize, '\0');
+}
+
+void VideoFrameQueue::push(float time, std::shared_ptr<ByteBuffer> pixels) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _frames.push_back(Frame {time, std::move(pixels)});
+}
+
+void VideoFrameQueue::finish() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished = true;
+}
+
+std::shared_ptr<ByteBuffer> VideoFrameQueue::pickDue(float time) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::shared_ptr<ByteBuffer> picked;
+    while (!_frames.empty() && _frames.front().time <= time) {
+        if (picked) {
+            _free.push_back(std::move(picked));
+        }
+        picked = std::move(_frames.front().pixels);
+        _frames.pop_front();
+    }
+    if (picked) {
+        if (_current) {
+            _free.push_back(std::move(_current));
+        }
+        _current = picked;
+        _condVar.notify_one();
+    }
+    return picked;
+}
+
+bool VideoFrameQueue::isDrained() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _finished && _frames.empty();
+}
+
+void VideoFrameQueue::close() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _closed = true;
+    _condVar.notify_all();
+}
+
+} // namespace movie
+
+} // namespace reone
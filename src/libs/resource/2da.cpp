@@ -25,26 +25,69 @@ namespace resource {
 
 static constexpr char kCellValueDeleted[] = "****";
 
+TwoDA::TwoDA(std::vector<std::string> columns, std::vector<Row> rows) :
+    _columnNames(std::move(columns)),
+    _rowCount(static_cast<int>(rows.size())) {
+
+    size_t numColumns = _columnNames.size();
+    for (size_t row = 0; row < rows.size(); ++row) {
+        size_t numValues = rows[row].values.size();
+        if (numValues != numColumns) {
+            throw ValidationException(str(boost::format("Expected %d columns in 2DA row %d, was %d") % numColumns % row % numValues));
+        }
+    }
+    _columns.reserve(numColumns);
+    _columnIndices.reserve(numColumns);
+    for (size_t col = 0; col < numColumns; ++col) {
+        auto column = std::make_unique<Column>();
+        column->values.reserve(rows.size());
+        for (auto &row : rows) {
+            column->values.push_back(std::move(row.values[col]));
+        }
+        _columns.push_back(std::move(column));
+        _columnIndices.emplace(_columnNames[col], static_cast<int>(col));
+    }
+}
+
+template <class T, class Parse>
+void TwoDA::parseColumn(const std::vector<std::string> &values, TypedColumn<T> &typed, Parse parse) {
+    typed.values.resize(values.size());
+    typed.states.resize(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        const std::string &value = values[i];
+        if (value.empty()) {
+            typed.states[i] = CellState::Empty;
+        } else if (value == kCellValueDeleted) {
+            typed.states[i] = CellState::Deleted;
+        } else {
+            try {
+                typed.values[i] = parse(value);
+                typed.states[i] = CellState::Valid;
+            } catch (const std::logic_error &) {
+                typed.states[i] = CellState::Invalid;
+            }
+        }
+    }
+}
+
 int TwoDA::indexByCellValue(const std::string &column, const std::string &value) const {
     int columnIdx = getColumnIndex(column);
     if (columnIdx == -1) {
         warn("2DA: column not found: " + column);
         return -1;
     }
-    for (size_t i = 0; i < _rows.size(); ++i) {
-        if (_rows[i].values[columnIdx] == value)
-            return static_cast<int>(i);
+    const auto &index = getIndex(*_columns[columnIdx]);
+    auto maybeRows = index.find(value);
+    if (maybeRows == index.end()) {
+        return -1;
     }
 
-    return -1;
+    return maybeRows->second.front();
 }
 
 int TwoDA::getColumnIndex(const std::string &column) const {
-    for (size_t i = 0; i < _columns.size(); ++i) {
-        if (_columns[i] == column)
-            return static_cast<int>(i);
-    }
-    return -1;
+    auto maybeIndex = _columnIndices.find(column);
+    return maybeIndex != _columnIndices.end() ? maybeIndex->second : -1;
 }
 
 static std::vector<std::string> getColumnNames(const std::vector<std::pair<std::string, std::string>> &values) {
@@ -58,18 +101,27 @@ static std::vector<std::string> getColumnNames(const std::vector<std::pair<std::
 int TwoDA::indexByCellValues(const std::vector<std::pair<std::string, std::string>> &values) const {
     std::vector<std::string> columns(getColumnNames(values));
     std::vector<int> columnIndices(getColumnIndices(columns));
+    if (values.empty()) {
+        return _rowCount > 0 ? 0 : -1;
+    }
 
-    for (size_t i = 0; i < _rows.size(); ++i) {
+    // Candidate rows are those matching the first value, in ascending order
+    const auto &index = getIndex(*_columns[columnIndices[0]]);
+    auto maybeRows = index.find(values[0].second);
+    if (maybeRows == index.end()) {
+        return -1;
+    }
+    for (int row : maybeRows->second) {
         bool match = true;
-        for (size_t j = 0; j < values.size(); ++j) {
+        for (size_t j = 1; j < values.size(); ++j) {
             int columnIdx = columnIndices[j];
-            if (_rows[i].values[columnIdx] != values[j].second) {
+            if (_columns[columnIdx]->values[row] != values[j].second) {
                 match = false;
                 break;
             }
         }
         if (match)
-            return static_cast<int>(i);
+            return row;
     }
 
     return -1;
@@ -87,22 +139,59 @@ std::vector<int> TwoDA::getColumnIndices(const std::vector<std::string> &columns
     return indices;
 }
 
+const TwoDA::Column *TwoDA::getCellColumn(int row, const std::string &column) const {
+    if (row < 0 || row >= _rowCount) {
+        warn("2DA: row index out of range: " + std::to_string(row));
+        return nullptr;
+    }
+    int columnIdx = getColumnIndex(column);
+    if (columnIdx == -1) {
+        return nullptr;
+    }
+    return _columns[columnIdx].get();
+}
+
+const TwoDA::TypedColumn<int> &TwoDA::getInts(const Column &column) const {
+    std::call_once(column.intsFlag, [&column]() {
+        parseColumn(column.values, column.ints, [](auto &value) { return stoi(value); });
+    });
+    return column.ints;
+}
+
+const TwoDA::TypedColumn<uint32_t> &TwoDA::getHexInts(const Column &column) const {
+    std::call_once(column.hexIntsFlag, [&column]() {
+        parseColumn(column.values, column.hexInts, [](auto &value) { return static_cast<uint32_t>(stoi(value, nullptr, 16)); });
+    });
+    return column.hexInts;
+}
+
+const TwoDA::TypedColumn<float> &TwoDA::getFloats(const Column &column) const {
+    std::call_once(column.floatsFlag, [&column]() {
+        parseColumn(column.values, column.floats, [](auto &value) { return stof(value); });
+    });
+    return column.floats;
+}
+
+const std::unordered_map<std::string, std::vector<int>> &TwoDA::getIndex(const Column &column) const {
+    std::call_once(column.indexFlag, [&column]() {
+        for (size_t i = 0; i < column.values.size(); ++i) {
+            column.index[column.values[i]].push_back(static_cast<int>(i));
+        }
+    });
+    return column.index;
+}
+
 std::string TwoDA::getString(int row, const std::string &column, std::string defValue) const {
     return getStringOpt(row, column).value_or(defValue);
 }
 
 std::optional<std::string> TwoDA::getStringOpt(int row, const std::string &column) const {
-    if (row < 0 || row >= _rows.size()) {
-        warn("2DA: row index out of range: " + std::to_string(row));
+    auto cellColumn = getCellColumn(row, column);
+    if (!cellColumn) {
         return std::nullopt;
     }
 
-    int columnIdx = getColumnIndex(column);
-    if (columnIdx == -1) {
-        return std::nullopt;
-    }
-
-    const std::string &value = _rows[row].values[columnIdx];
+    const std::string &value = cellColumn->values[row];
 
     if (value == kCellValueDeleted) {
         warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % column));
@@ -112,16 +201,33 @@ std::optional<std::string> TwoDA::getStringOpt(int row, const std::string &colum
     return value;
 }
 
+template <class T, class Parse>
+std::optional<T> TwoDA::getTypedValue(const TypedColumn<T> &typed, const std::string &value, int row, const std::string &column, Parse parse) {
+    switch (typed.states[row]) {
+    case CellState::Valid:
+        return typed.values[row];
+    case CellState::Deleted:
+        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % column));
+        return std::nullopt;
+    case CellState::Invalid:
+        return parse(value);
+    default:
+        return std::nullopt;
+    }
+}
+
 int TwoDA::getInt(int row, const std::string &column, int defValue) const {
     return getIntOpt(row, column).value_or(defValue);
 }
 
 std::optional<int> TwoDA::getIntOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+    auto cellColumn = getCellColumn(row, column);
+    if (!cellColumn) {
         return std::nullopt;
     }
-    return stoi(value);
+    return getTypedValue(getInts(*cellColumn), cellColumn->values[row], row, column, [](auto &value) {
+        return stoi(value);
+    });
 }
 
 uint32_t TwoDA::getHexInt(int row, const std::string &column, uint32_t defValue) const {
@@ -129,11 +235,13 @@ uint32_t TwoDA::getHexInt(int row, const std::string &column, uint32_t defValue)
 }
 
 std::optional<uint32_t> TwoDA::getHexIntOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+    auto cellColumn = getCellColumn(row, column);
+    if (!cellColumn) {
         return std::nullopt;
     }
-    return stoi(value, nullptr, 16);
+    return getTypedValue(getHexInts(*cellColumn), cellColumn->values[row], row, column, [](auto &value) {
+        return static_cast<uint32_t>(stoi(value, nullptr, 16));
+    });
 }
 
 float TwoDA::getFloat(int row, const std::string &column, float defValue) const {
@@ -141,11 +249,13 @@ float TwoDA::getFloat(int row, const std::string &column, float defValue) const
 }
 
 std::optional<float> TwoDA::getFloatOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+    auto cellColumn = getCellColumn(row, column);
+    if (!cellColumn) {
         return std::nullopt;
     }
-    return stof(value);
+    return getTypedValue(getFloats(*cellColumn), cellColumn->values[row], row, column, [](auto &value) {
+        return stof(value);
+    });
 }
 
 bool TwoDA::getBool(int row, const std::string &column, bool defValue) const {
@@ -153,11 +263,11 @@ bool TwoDA::getBool(int row, const std::string &column, bool defValue) const {
 }
 
 std::optional<bool> TwoDA::getBoolOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+    auto value = getIntOpt(row, column);
+    if (!value) {
         return std::nullopt;
     }
-    return stoi(value) != 0;
+    return *value != 0;
 }
 
 } // namespace resource
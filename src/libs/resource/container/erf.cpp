@@ -18,15 +18,18 @@
 #include "reone/resource/container/erf.h"
 
 #include "reone/resource/format/erfreader.h"
+#include "reone/system/stream/memoryinput.h"
 
 namespace reone {
 
 namespace resource {
 
 void ErfResourceContainer::init() {
-    _erf = std::make_unique<FileInputStream>(_path);
+    _erf = std::make_shared<MemoryMappedFile>(_path);
+    _erf->init();
 
-    auto reader = ErfReader(*_erf);
+    auto stream = MemoryInputStream(_erf->data(), _erf->size());
+    auto reader = ErfReader(stream);
     reader.load();
 
     auto &keys = reader.keys();
@@ -43,21 +46,24 @@ void ErfResourceContainer::init() {
 }
 
 std::optional<ByteBuffer> ErfResourceContainer::findResourceData(const ResourceId &id) {
+    auto view = findResourceView(id);
+    if (!view) {
+        return std::nullopt;
+    }
+    return ByteBuffer(view->data, view->data + view->size);
+}
+
+std::optional<ResourceView> ErfResourceContainer::findResourceView(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
         return std::nullopt;
     }
     auto &resource = it->second;
-    if (resource.fileSize == 0) {
-        return ByteBuffer();
+    if (resource.offset >= _erf->size()) {
+        return ResourceView {nullptr, 0, _erf};
     }
-    ByteBuffer buf;
-    buf.resize(resource.fileSize);
-
-    _erf->seek(resource.offset, SeekOrigin::Begin);
-    _erf->read(&buf[0], buf.size());
-
-    return buf;
+    auto size = std::min<size_t>(resource.fileSize, _erf->size() - resource.offset);
+    return ResourceView {_erf->data() + resource.offset, size, _erf};
 }
 
 } // namespace resource
@@ -18,7 +18,7 @@
 #include "reone/resource/container/exe.h"
 
 #include "reone/resource/format/pereader.h"
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/memoryinput.h"
 
 namespace reone {
 
@@ -29,9 +29,11 @@ static std::unordered_map<PEResType, ResType> kPEResTypeToResType {
     {PEResType::CursorGroup, ResType::CursorGroup}};
 
 void ExeResourceContainer::init() {
-    _exe = std::make_unique<FileInputStream>(_path);
+    _exe = std::make_shared<MemoryMappedFile>(_path);
+    _exe->init();
 
-    auto reader = PeReader(*_exe);
+    auto stream = MemoryInputStream(_exe->data(), _exe->size());
+    auto reader = PeReader(stream);
     reader.load();
 
     for (auto &peRes : reader.resources()) {
@@ -54,16 +56,13 @@ std::optional<ByteBuffer> ExeResourceContainer::findResourceData(const ResourceI
         return std::nullopt;
     }
     auto &res = it->second;
-    if (res.size == 0) {
+    if (res.offset >= _exe->size()) {
         return ByteBuffer();
     }
-    ByteBuffer buf;
-    buf.resize(res.size);
+    auto size = std::min<size_t>(res.size, _exe->size() - res.offset);
+    auto data = _exe->data() + res.offset;
 
-    _exe->seek(res.offset, SeekOrigin::Begin);
-    _exe->read(&buf[0], buf.size());
-
-    return buf;
+    return ByteBuffer(data, data + size);
 }
 
 } // namespace resource
@@ -21,6 +21,7 @@
 #include "reone/resource/format/keyreader.h"
 #include "reone/system/fileutil.h"
 #include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/memoryinput.h"
 
 namespace reone {
 
@@ -42,8 +43,10 @@ void KeyBifResourceContainer::init() {
     for (auto i = 0; i < keyReader.files().size(); ++i) {
         auto &file = keyReader.files()[i];
         auto bifPath = getFileIgnoreCase(gamePath, file.filename);
-        auto bif = std::make_unique<FileInputStream>(bifPath);
-        auto bifReader = BifReader(*bif);
+        auto bif = std::make_shared<MemoryMappedFile>(bifPath);
+        bif->init();
+        auto bifStream = MemoryInputStream(bif->data(), bif->size());
+        auto bifReader = BifReader(bifStream);
         bifReader.load();
 
         auto &keys = bifIdxToKey.at(i);
@@ -66,22 +69,25 @@ void KeyBifResourceContainer::init() {
 }
 
 std::optional<ByteBuffer> KeyBifResourceContainer::findResourceData(const ResourceId &id) {
+    auto view = findResourceView(id);
+    if (!view) {
+        return std::nullopt;
+    }
+    return ByteBuffer(view->data, view->data + view->size);
+}
+
+std::optional<ResourceView> KeyBifResourceContainer::findResourceView(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
         return std::nullopt;
     }
     auto &resource = it->second;
-    if (resource.fileSize == 0) {
-        return ByteBuffer();
-    }
-    ByteBuffer buf;
-    buf.resize(resource.fileSize);
-
     auto &bif = _bifs.at(resource.bifIdx);
-    bif->seek(resource.bifOffset, SeekOrigin::Begin);
-    bif->read(&buf[0], buf.size());
-
-    return buf;
+    if (resource.bifOffset >= bif->size()) {
+        return ResourceView {nullptr, 0, bif};
+    }
+    auto size = std::min<size_t>(resource.fileSize, bif->size() - resource.bifOffset);
+    return ResourceView {bif->data() + resource.bifOffset, size, bif};
 }
 
 } // namespace resource
@@ -18,16 +18,18 @@
 #include "reone/resource/container/rim.h"
 
 #include "reone/resource/format/rimreader.h"
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/memoryinput.h"
 
 namespace reone {
 
 namespace resource {
 
 void RimResourceContainer::init() {
-    _rim = std::make_unique<FileInputStream>(_path);
+    _rim = std::make_shared<MemoryMappedFile>(_path);
+    _rim->init();
 
-    auto reader = RimReader(*_rim);
+    auto stream = MemoryInputStream(_rim->data(), _rim->size());
+    auto reader = RimReader(stream);
     reader.load();
 
     for (auto &rimResource : reader.resources()) {
@@ -41,21 +43,24 @@ void RimResourceContainer::init() {
 }
 
 std::optional<ByteBuffer> RimResourceContainer::findResourceData(const ResourceId &id) {
+    auto view = findResourceView(id);
+    if (!view) {
+        return std::nullopt;
+    }
+    return ByteBuffer(view->data, view->data + view->size);
+}
+
+std::optional<ResourceView> RimResourceContainer::findResourceView(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
         return std::nullopt;
     }
     auto &resource = it->second;
-    if (resource.fileSize == 0) {
-        return ByteBuffer();
+    if (resource.offset >= _rim->size()) {
+        return ResourceView {nullptr, 0, _rim};
     }
-    ByteBuffer buf;
-    buf.resize(resource.fileSize);
-
-    _rim->seek(resource.offset, SeekOrigin::Begin);
-    _rim->read(&buf[0], buf.size());
-
-    return buf;
+    auto size = std::min<size_t>(resource.fileSize, _rim->size() - resource.offset);
+    return ResourceView {_rim->data() + resource.offset, size, _rim};
 }
 
 } // namespace resource
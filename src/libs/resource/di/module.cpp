@@ -20,6 +20,7 @@
 #include "reone/audio/di/module.h"
 #include "reone/graphics/di/module.h"
 #include "reone/script/di/module.h"
+#include "reone/system/di/module.h"
 
 namespace reone {
 
@@ -29,9 +30,9 @@ void ResourceModule::init() {
     _resources = std::make_unique<Resources>();
     _strings = std::make_unique<Strings>();
     _twoDas = std::make_unique<TwoDAs>(*_resources);
-    _gffs = std::make_unique<Gffs>(*_resources);
+    _gffs = std::make_unique<Gffs>(*_resources, _system.services().threadPool);
     _shaders = std::make_unique<Shaders>(_graphicsOpt, _graphics.shaderRegistry(), *_resources);
-    _textures = std::make_unique<Textures>(_graphicsOpt, *_resources);
+    _textures = std::make_unique<Textures>(_graphicsOpt, *_resources, _system.services().threadPool);
     _models = std::make_unique<Models>(*_textures, *_resources, _graphics.statistic());
     _walkmeshes = std::make_unique<Walkmeshes>(*_resources);
     _lips = std::make_unique<Lips>(*_resources);
@@ -69,7 +69,7 @@ void TwoDAWriter::writeData() {
 
     for (int i = 0; i < _twoDa.getRowCount(); ++i) {
         for (size_t j = 0; j < columnCount; ++j) {
-            const std::string &value = _twoDa.rows()[i].values[j];
+            const std::string &value = _twoDa.getCell(i, static_cast<int>(j));
             auto maybeData = std::find_if(data.begin(), data.end(), [&](auto &pair) { return pair.first == value; });
             if (maybeData != data.end()) {
                 _writer->writeUint16(maybeData->second);
@@ -19,11 +19,15 @@
 
 #include "reone/resource/talktable.h"
 #include "reone/system/checkutil.h"
+#include "reone/system/exception/validation.h"
 
 namespace reone {
 
 namespace resource {
 
+static constexpr int kHeaderSize = 20;
+static constexpr int kEntrySize = 40;
+
 struct StringFlags {
     static constexpr int textPresent = 1;
     static constexpr int soundPresent = 2;
@@ -37,7 +41,11 @@ void TlkReader::load() {
     _stringCount = _tlk.readUint32();
     _stringsOffset = _tlk.readUint32();
 
-    loadStrings();
+    if (_owner) {
+        loadStringsLazy();
+    } else {
+        loadStrings();
+    }
 }
 
 void TlkReader::loadStrings() {
@@ -66,6 +74,36 @@ void TlkReader::loadStrings() {
     _table = std::make_unique<TalkTable>(std::move(strings));
 }
 
+void TlkReader::loadStringsLazy() {
+    if (kHeaderSize + static_cast<uint64_t>(kEntrySize) * _stringCount > _size || _stringsOffset > _size) {
+        throw ValidationException("TLK entry table is out of bounds");
+    }
+    auto decoder = [data = _data, size = _size, owner = _owner, stringsOffset = _stringsOffset](int index) {
+        const char *entry = data + kHeaderSize + static_cast<size_t>(kEntrySize) * index;
+        uint32_t flags = boost::endian::load_little_u32(reinterpret_cast<const unsigned char *>(entry));
+
+        const char *soundResRefData = entry + 4;
+        auto soundResRefEnd = static_cast<const char *>(std::memchr(soundResRefData, '\0', 16));
+        std::string soundResRef(soundResRefData, soundResRefEnd ? soundResRefEnd : soundResRefData + 16);
+        boost::to_lower(soundResRef);
+
+        std::string text;
+        if (flags & StringFlags::textPresent) {
+            uint32_t stringOffset = boost::endian::load_little_u32(reinterpret_cast<const unsigned char *>(entry + 28));
+            uint32_t stringSize = boost::endian::load_little_u32(reinterpret_cast<const unsigned char *>(entry + 32));
+            if (stringsOffset + static_cast<uint64_t>(stringOffset) + stringSize > size) {
+                throw ValidationException("TLK string is out of bounds: " + std::to_string(index));
+            }
+            const char *textData = data + stringsOffset + stringOffset;
+            auto textEnd = static_cast<const char *>(std::memchr(textData, '\0', stringSize));
+            text = std::string(textData, textEnd ? textEnd : textData + stringSize);
+        }
+
+        return TalkTable::String {std::move(text), std::move(soundResRef)};
+    };
+    _table = std::make_shared<TalkTable>(static_cast<int>(_stringCount), std::move(decoder));
+}
+
 } // namespace resource
 
 } // namespace reone
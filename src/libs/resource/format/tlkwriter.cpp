@@ -42,7 +42,7 @@ void TlkWriter::save(IOutputStream &out) {
 
     uint32_t offString = 0;
     for (int i = 0; i < _talkTable.getStringCount(); ++i) {
-        auto &str = _talkTable.getString(i);
+        auto str = _talkTable.getString(i);
         auto strSize = static_cast<uint32_t>(str.text.length());
 
         StringDataElement strDataElem;
@@ -0,0 +1,594 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/gffview.h"
+
+#include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
+
+namespace reone {
+
+namespace resource {
+
+static constexpr int kHeaderSize = 56;
+static constexpr int kStructSize = 12;
+static constexpr int kFieldSize = 12;
+static constexpr int kLabelSize = 16;
+
+template <class T>
+static T loadLittle(const char *data) {
+    T val;
+    std::memcpy(&val, data, sizeof(T));
+    boost::endian::little_to_native_inplace(val);
+    return val;
+}
+
+static std::string loadString(const char *data, size_t size) {
+    // Strings are truncated at the first null character, as in GffReader
+    auto term = static_cast<const char *>(std::memchr(data, '\0', size));
+    return std::string(data, term ? term - data : size);
+}
+
+static float loadFloat(const char *data) {
+    uint32_t bits = loadLittle<uint32_t>(data);
+    float val;
+    std::memcpy(&val, &bits, sizeof(float));
+    return val;
+}
+
+class GffView::Document : boost::noncopyable {
+public:
+    struct Struct {
+        uint32_t type {0};
+        uint32_t fieldsBegin {0}; /**< index into _structFields */
+        uint32_t fieldsEnd {0};
+    };
+
+    struct StructField {
+        uint32_t labelIdx {0};
+        uint32_t fieldIdx {0};
+    };
+
+    Document(const char *data, size_t size, std::shared_ptr<const void> owner) :
+        _data(data),
+        _size(size),
+        _owner(std::move(owner)) {
+
+        if (size < kHeaderSize) {
+            throw ValidationException("GFF: header is truncated");
+        }
+        _structOffset = loadLittle<uint32_t>(data + 8);
+        _structCount = loadLittle<uint32_t>(data + 12);
+        _fieldOffset = loadLittle<uint32_t>(data + 16);
+        _fieldCount = loadLittle<uint32_t>(data + 20);
+        _labelOffset = loadLittle<uint32_t>(data + 24);
+        _labelCount = loadLittle<uint32_t>(data + 28);
+        _fieldDataOffset = loadLittle<uint32_t>(data + 32);
+        _fieldDataCount = loadLittle<uint32_t>(data + 36);
+        _fieldIndicesOffset = loadLittle<uint32_t>(data + 40);
+        _fieldIndicesCount = loadLittle<uint32_t>(data + 44);
+        _listIndicesOffset = loadLittle<uint32_t>(data + 48);
+        _listIndicesCount = loadLittle<uint32_t>(data + 52);
+
+        checkTable(_structOffset, kStructSize * static_cast<uint64_t>(_structCount), "struct array");
+        checkTable(_fieldOffset, kFieldSize * static_cast<uint64_t>(_fieldCount), "field array");
+        checkTable(_labelOffset, kLabelSize * static_cast<uint64_t>(_labelCount), "label array");
+        checkTable(_fieldDataOffset, _fieldDataCount, "field data");
+        checkTable(_fieldIndicesOffset, _fieldIndicesCount, "field indices");
+        checkTable(_listIndicesOffset, _listIndicesCount, "list indices");
+        if (_structCount == 0) {
+            throw ValidationException("GFF: root struct is missing");
+        }
+
+        indexLabels();
+        indexStructs();
+    }
+
+    ~Document() {
+        if (!_schemaSlots) {
+            return;
+        }
+        for (int i = 0; i < GffSchema::kMaxSchemas; ++i) {
+            delete _schemaSlots[i].load();
+        }
+    }
+
+    std::optional<uint32_t> findLabel(std::string_view label) const {
+        auto maybeLabel = _labelIndices.find(label);
+        if (maybeLabel == _labelIndices.end()) {
+            return std::nullopt;
+        }
+        return maybeLabel->second;
+    }
+
+    std::optional<Field> findField(uint32_t structIdx, uint32_t labelIdx) const {
+        const Struct &strct = _structs[structIdx];
+        auto begin = _structFields.begin() + strct.fieldsBegin;
+        auto end = _structFields.begin() + strct.fieldsEnd;
+        auto maybeField = std::lower_bound(begin, end, labelIdx, [](auto &field, uint32_t idx) {
+            return field.labelIdx < idx;
+        });
+        if (maybeField == end || maybeField->labelIdx != labelIdx) {
+            return std::nullopt;
+        }
+        return readField(maybeField->fieldIdx);
+    }
+
+    uint32_t fieldCount(uint32_t structIdx) const {
+        const Struct &strct = _structs[structIdx];
+        return strct.fieldsEnd - strct.fieldsBegin;
+    }
+
+    Field fieldAt(uint32_t structIdx, uint32_t i, uint32_t &labelIdx) const {
+        const StructField &field = _structFields[_structs[structIdx].fieldsBegin + i];
+        labelIdx = field.labelIdx;
+        return readField(field.fieldIdx);
+    }
+
+    /**
+     * Lock-free once the schema is resolved. Concurrent first calls may
+     * resolve the schema more than once, but only one result is kept.
+     */
+    const std::vector<int> &resolveSchema(const GffSchema &schema) const {
+        std::call_once(_schemaSlotsFlag, [this]() {
+            _schemaSlots = std::make_unique<SchemaSlot[]>(GffSchema::kMaxSchemas);
+        });
+        SchemaSlot &slot = _schemaSlots[schema.id()];
+        const std::vector<int> *resolved = slot.load(std::memory_order_acquire);
+        if (resolved) {
+            return *resolved;
+        }
+        auto members = std::make_unique<std::vector<int>>(_labelCount, -1);
+        const auto &labels = schema.labels();
+        for (size_t i = 0; i < labels.size(); ++i) {
+            auto labelIdx = findLabel(labels[i]);
+            if (labelIdx) {
+                (*members)[*labelIdx] = static_cast<int>(i);
+            }
+        }
+        if (slot.compare_exchange_strong(resolved, members.get(), std::memory_order_acq_rel)) {
+            return *members.release();
+        }
+        return *resolved;
+    }
+
+    uint32_t structType(uint32_t structIdx) const {
+        return _structs[structIdx].type;
+    }
+
+    uint32_t structCount() const {
+        return _structCount;
+    }
+
+    /**
+     * @return pointer to size bytes of field data at offset
+     * @throws ValidationException if the range is out of bounds
+     */
+    const char *fieldData(uint32_t offset, uint64_t size) const {
+        if (offset + size > _fieldDataCount) {
+            throw ValidationException("GFF: field data out of bounds");
+        }
+        return _data + _fieldDataOffset + offset;
+    }
+
+    /**
+     * @return pointer to the list at offset, and the number of elements in it
+     * @throws ValidationException if the list is out of bounds
+     */
+    std::pair<const char *, uint32_t> list(uint32_t offset) const {
+        if (offset + 4ull > _listIndicesCount) {
+            throw ValidationException("GFF: list indices out of bounds");
+        }
+        const char *data = _data + _listIndicesOffset + offset;
+        uint32_t count = loadLittle<uint32_t>(data);
+        if (offset + 4ull * (count + 1ull) > _listIndicesCount) {
+            throw ValidationException("GFF: list indices out of bounds");
+        }
+        return std::make_pair(data + 4, count);
+    }
+
+private:
+    const char *_data;
+    size_t _size;
+    std::shared_ptr<const void> _owner;
+
+    uint32_t _structOffset {0};
+    uint32_t _structCount {0};
+    uint32_t _fieldOffset {0};
+    uint32_t _fieldCount {0};
+    uint32_t _labelOffset {0};
+    uint32_t _labelCount {0};
+    uint32_t _fieldDataOffset {0};
+    uint32_t _fieldDataCount {0};
+    uint32_t _fieldIndicesOffset {0};
+    uint32_t _fieldIndicesCount {0};
+    uint32_t _listIndicesOffset {0};
+    uint32_t _listIndicesCount {0};
+
+    std::unordered_map<std::string_view, uint32_t> _labelIndices;
+    std::vector<uint32_t> _canonicalLabels; /**< label index to index of the first equal label */
+    std::vector<Struct> _structs;
+    std::vector<StructField> _structFields;
+
+    using SchemaSlot = std::atomic<const std::vector<int> *>;
+
+    mutable std::once_flag _schemaSlotsFlag;
+    mutable std::unique_ptr<SchemaSlot[]> _schemaSlots; /**< resolved schemas by schema id */
+
+    Field readField(uint32_t fieldIdx) const {
+        const char *fieldData = _data + _fieldOffset + kFieldSize * static_cast<size_t>(fieldIdx);
+        Field field;
+        field.type = static_cast<Gff::FieldType>(loadLittle<uint32_t>(fieldData));
+        field.dataOrDataOffset = loadLittle<uint32_t>(fieldData + 8);
+        return field;
+    }
+
+    void checkTable(uint32_t offset, uint64_t size, const char *name) const {
+        if (offset + size > _size) {
+            throw ValidationException(str(boost::format("GFF: %s is out of bounds") % name));
+        }
+    }
+
+    void indexLabels() {
+        _labelIndices.reserve(_labelCount);
+        _canonicalLabels.resize(_labelCount);
+        for (uint32_t i = 0; i < _labelCount; ++i) {
+            const char *label = _data + _labelOffset + kLabelSize * static_cast<size_t>(i);
+            auto term = static_cast<const char *>(std::memchr(label, '\0', kLabelSize));
+            auto view = std::string_view(label, term ? term - label : kLabelSize);
+            _canonicalLabels[i] = _labelIndices.emplace(view, i).first->second;
+        }
+    }
+
+    void indexStructs() {
+        _structs.resize(_structCount);
+        _structFields.reserve(_fieldCount);
+        for (uint32_t i = 0; i < _structCount; ++i) {
+            const char *structData = _data + _structOffset + kStructSize * static_cast<size_t>(i);
+            uint32_t dataOffset = loadLittle<uint32_t>(structData + 4);
+            uint32_t fieldCount = loadLittle<uint32_t>(structData + 8);
+
+            Struct &strct = _structs[i];
+            strct.type = loadLittle<uint32_t>(structData);
+            strct.fieldsBegin = static_cast<uint32_t>(_structFields.size());
+            if (fieldCount == 1) {
+                addStructField(dataOffset);
+            } else if (fieldCount > 1) {
+                if (dataOffset + 4ull * fieldCount > _fieldIndicesCount) {
+                    throw ValidationException("GFF: field indices out of bounds");
+                }
+                const char *indices = _data + _fieldIndicesOffset + dataOffset;
+                for (uint32_t j = 0; j < fieldCount; ++j) {
+                    addStructField(loadLittle<uint32_t>(indices + 4 * j));
+                }
+            }
+            strct.fieldsEnd = static_cast<uint32_t>(_structFields.size());
+
+            // Stable, so that the first of the fields with equal labels wins, as in Gff
+            std::stable_sort(
+                _structFields.begin() + strct.fieldsBegin,
+                _structFields.end(),
+                [](auto &lhs, auto &rhs) { return lhs.labelIdx < rhs.labelIdx; });
+        }
+    }
+
+    void addStructField(uint32_t fieldIdx) {
+        if (fieldIdx >= _fieldCount) {
+            throw ValidationException("GFF: field index out of bounds");
+        }
+        const char *fieldData = _data + _fieldOffset + kFieldSize * static_cast<size_t>(fieldIdx);
+        uint32_t labelIdx = loadLittle<uint32_t>(fieldData + 4);
+        if (labelIdx >= _labelCount) {
+            throw ValidationException("GFF: label index out of bounds");
+        }
+        StructField field;
+        field.labelIdx = _canonicalLabels[labelIdx];
+        field.fieldIdx = fieldIdx;
+        _structFields.push_back(std::move(field));
+    }
+};
+
+GffView GffView::load(const char *data, size_t size, std::shared_ptr<const void> owner) {
+    auto document = std::make_shared<Document>(data, size, std::move(owner));
+    return GffView(std::move(document), 0);
+}
+
+uint32_t GffView::type() const {
+    return _document->structType(_structIdx);
+}
+
+std::optional<GffView::FieldValue> GffView::get(const std::string &name) const {
+    auto labelIdx = _document->findLabel(name);
+    if (!labelIdx) {
+        return std::nullopt;
+    }
+    auto field = _document->findField(_structIdx, *labelIdx);
+    if (!field) {
+        return std::nullopt;
+    }
+    return FieldValue(*this, std::move(*field));
+}
+
+const std::vector<int> &GffView::resolveSchema(const GffSchema &schema) const {
+    return _document->resolveSchema(schema);
+}
+
+uint32_t GffView::fieldCount() const {
+    return _document->fieldCount(_structIdx);
+}
+
+GffView::Field GffView::fieldAt(uint32_t i, uint32_t &labelIdx) const {
+    return _document->fieldAt(_structIdx, i, labelIdx);
+}
+
+bool GffView::getBool(const std::string &name, bool defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getBool();
+}
+
+int GffView::getInt(const std::string &name, int defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getInt();
+}
+
+int64_t GffView::readInt64(const std::string &name, int64_t defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->readInt64();
+}
+
+uint32_t GffView::getUint(const std::string &name, uint32_t defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getUint();
+}
+
+uint64_t GffView::readUint64(const std::string &name, uint64_t defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->readUint64();
+}
+
+glm::vec3 GffView::getColor(const std::string &name, glm::vec3 defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getColor();
+}
+
+float GffView::getFloat(const std::string &name, float defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getFloat();
+}
+
+double GffView::getDouble(const std::string &name, double defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getDouble();
+}
+
+std::string GffView::getString(const std::string &name, std::string defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getString();
+}
+
+glm::vec3 GffView::getVector(const std::string &name, glm::vec3 defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getVector();
+}
+
+glm::quat GffView::getOrientation(const std::string &name, glm::quat defValue) const {
+    auto field = get(name);
+    if (!field)
+        return defValue;
+
+    return field->getOrientation();
+}
+
+GffView GffView::findStruct(const std::string &name) const {
+    auto field = get(name);
+    if (!field)
+        return GffView();
+
+    return field->getStruct();
+}
+
+std::vector<GffView> GffView::getList(const std::string &name) const {
+    auto field = get(name);
+    if (!field)
+        return std::vector<GffView>();
+
+    return field->getList();
+}
+
+ByteBuffer GffView::getData(const std::string &name) const {
+    auto field = get(name);
+    if (!field)
+        return ByteBuffer();
+
+    return field->getData();
+}
+
+uint64_t GffView::FieldValue::getRawValue() const {
+    // Mirrors the value union of Gff::Field, as populated by GffReader
+    switch (_field.type) {
+    case Gff::FieldType::Byte:
+    case Gff::FieldType::Char:
+    case Gff::FieldType::Word:
+    case Gff::FieldType::Short:
+    case Gff::FieldType::Dword:
+    case Gff::FieldType::Int:
+    case Gff::FieldType::Float:
+        return _field.dataOrDataOffset;
+    case Gff::FieldType::Dword64:
+    case Gff::FieldType::Int64:
+    case Gff::FieldType::Double:
+        return loadLittle<uint64_t>(_owner._document->fieldData(_field.dataOrDataOffset, 8));
+    case Gff::FieldType::CExoLocString:
+    case Gff::FieldType::StrRef:
+        return loadLittle<uint32_t>(_owner._document->fieldData(_field.dataOrDataOffset, 8) + 4);
+    default:
+        return 0;
+    }
+}
+
+bool GffView::FieldValue::getBool() const {
+    return static_cast<uint32_t>(getRawValue()) != 0;
+}
+
+int GffView::FieldValue::getInt() const {
+    return static_cast<int32_t>(getRawValue());
+}
+
+int64_t GffView::FieldValue::readInt64() const {
+    return static_cast<int64_t>(getRawValue());
+}
+
+uint32_t GffView::FieldValue::getUint() const {
+    return static_cast<uint32_t>(getRawValue());
+}
+
+uint64_t GffView::FieldValue::readUint64() const {
+    return getRawValue();
+}
+
+glm::vec3 GffView::FieldValue::getColor() const {
+    return Gff::colorFromUint32(static_cast<uint32_t>(getRawValue()));
+}
+
+float GffView::FieldValue::getFloat() const {
+    auto bits = static_cast<uint32_t>(getRawValue());
+    float val;
+    std::memcpy(&val, &bits, sizeof(float));
+    return val;
+}
+
+double GffView::FieldValue::getDouble() const {
+    auto bits = getRawValue();
+    double val;
+    std::memcpy(&val, &bits, sizeof(double));
+    return val;
+}
+
+std::string GffView::FieldValue::getString() const {
+    const Document &document = *_owner._document;
+    uint32_t offset = _field.dataOrDataOffset;
+    switch (_field.type) {
+    case Gff::FieldType::CExoString: {
+        uint32_t size = loadLittle<uint32_t>(document.fieldData(offset, 4));
+        return loadString(document.fieldData(offset + 4, size), size);
+    }
+    case Gff::FieldType::ResRef: {
+        auto size = static_cast<uint8_t>(*document.fieldData(offset, 1));
+        return loadString(document.fieldData(offset + 1, size), size);
+    }
+    case Gff::FieldType::CExoLocString: {
+        const char *data = document.fieldData(offset, 12);
+        uint32_t count = loadLittle<uint32_t>(data + 8);
+        // Same as GffReader: substrings are only read when there is exactly one
+        if (count != 1) {
+            if (count > 1) {
+                warn("GFF: more than one substring in CExoLocString, ignoring");
+            }
+            return "";
+        }
+        uint32_t size = loadLittle<uint32_t>(document.fieldData(offset + 16, 4));
+        return loadString(document.fieldData(offset + 20, size), size);
+    }
+    default:
+        return "";
+    }
+}
+
+glm::vec3 GffView::FieldValue::getVector() const {
+    if (_field.type != Gff::FieldType::Vector)
+        return glm::vec3(0.0f);
+
+    const char *data = _owner._document->fieldData(_field.dataOrDataOffset, 3 * sizeof(float));
+    return glm::vec3(loadFloat(data), loadFloat(data + 4), loadFloat(data + 8));
+}
+
+glm::quat GffView::FieldValue::getOrientation() const {
+    if (_field.type != Gff::FieldType::Orientation)
+        return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+    const char *data = _owner._document->fieldData(_field.dataOrDataOffset, 4 * sizeof(float));
+    return glm::quat(loadFloat(data), loadFloat(data + 4), loadFloat(data + 8), loadFloat(data + 12));
+}
+
+GffView GffView::FieldValue::getStruct() const {
+    if (_field.type != Gff::FieldType::Struct)
+        return GffView();
+    if (_field.dataOrDataOffset >= _owner._document->structCount())
+        throw ValidationException("GFF: struct index out of bounds");
+
+    return GffView(_owner._document, _field.dataOrDataOffset);
+}
+
+std::vector<GffView> GffView::FieldValue::getList() const {
+    if (_field.type != Gff::FieldType::List)
+        return std::vector<GffView>();
+
+    auto list = _owner._document->list(_field.dataOrDataOffset);
+    std::vector<GffView> items;
+    items.reserve(list.second);
+    for (uint32_t i = 0; i < list.second; ++i) {
+        uint32_t structIdx = loadLittle<uint32_t>(list.first + 4 * i);
+        if (structIdx >= _owner._document->structCount()) {
+            throw ValidationException("GFF: struct index out of bounds");
+        }
+        items.emplace_back(_owner._document, structIdx);
+    }
+    return items;
+}
+
+ByteBuffer GffView::FieldValue::getData() const {
+    if (_field.type != Gff::FieldType::Void)
+        return ByteBuffer();
+
+    uint32_t size = loadLittle<uint32_t>(_owner._document->fieldData(_field.dataOrDataOffset, 4));
+    const char *data = _owner._document->fieldData(_field.dataOrDataOffset + 4, size);
+    return ByteBuffer(data, data + size);
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/are.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -384,6 +385,1119 @@ ARE parseARE(const Gff &gff) {
     return strct;
 }
 
+static ARE_MiniGame_Player_Gun_Banks_Bullet parseARE_MiniGame_Player_Gun_Banks_Bullet(const GffView &gff) {
+    ARE_MiniGame_Player_Gun_Banks_Bullet strct;
+    static const GffSchema schema {
+        "Bullet_Model",
+        "Collision_Sound",
+        "Damage",
+        "Lifespan",
+        "Rate_Of_Fire",
+        "Speed",
+        "Target_Type",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Bullet_Model = field.getString();
+            break;
+        case 1:
+            strct.Collision_Sound = field.getString();
+            break;
+        case 2:
+            strct.Damage = field.getUint();
+            break;
+        case 3:
+            strct.Lifespan = field.getFloat();
+            break;
+        case 4:
+            strct.Rate_Of_Fire = field.getFloat();
+            break;
+        case 5:
+            strct.Speed = field.getFloat();
+            break;
+        case 6:
+            strct.Target_Type = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Gun_Banks_Bullet parseARE_MiniGame_Enemies_Gun_Banks_Bullet(const GffView &gff) {
+    ARE_MiniGame_Enemies_Gun_Banks_Bullet strct;
+    static const GffSchema schema {
+        "Bullet_Model",
+        "Collision_Sound",
+        "Damage",
+        "Lifespan",
+        "Rate_Of_Fire",
+        "Speed",
+        "Target_Type",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Bullet_Model = field.getString();
+            break;
+        case 1:
+            strct.Collision_Sound = field.getString();
+            break;
+        case 2:
+            strct.Damage = field.getUint();
+            break;
+        case 3:
+            strct.Lifespan = field.getFloat();
+            break;
+        case 4:
+            strct.Rate_Of_Fire = field.getFloat();
+            break;
+        case 5:
+            strct.Speed = field.getFloat();
+            break;
+        case 6:
+            strct.Target_Type = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Sounds parseARE_MiniGame_Player_Sounds(const GffView &gff) {
+    ARE_MiniGame_Player_Sounds strct;
+    static const GffSchema schema {
+        "Death",
+        "Engine",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Death = field.getString();
+            break;
+        case 1:
+            strct.Engine = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Scripts parseARE_MiniGame_Player_Scripts(const GffView &gff) {
+    ARE_MiniGame_Player_Scripts strct;
+    static const GffSchema schema {
+        "OnAccelerate",
+        "OnAnimEvent",
+        "OnBrake",
+        "OnCreate",
+        "OnDamage",
+        "OnDeath",
+        "OnFire",
+        "OnHeartbeat",
+        "OnHitBullet",
+        "OnHitFollower",
+        "OnHitObstacle",
+        "OnHitWorld",
+        "OnTrackLoop",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.OnAccelerate = field.getString();
+            break;
+        case 1:
+            strct.OnAnimEvent = field.getString();
+            break;
+        case 2:
+            strct.OnBrake = field.getString();
+            break;
+        case 3:
+            strct.OnCreate = field.getString();
+            break;
+        case 4:
+            strct.OnDamage = field.getString();
+            break;
+        case 5:
+            strct.OnDeath = field.getString();
+            break;
+        case 6:
+            strct.OnFire = field.getString();
+            break;
+        case 7:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 8:
+            strct.OnHitBullet = field.getString();
+            break;
+        case 9:
+            strct.OnHitFollower = field.getString();
+            break;
+        case 10:
+            strct.OnHitObstacle = field.getString();
+            break;
+        case 11:
+            strct.OnHitWorld = field.getString();
+            break;
+        case 12:
+            strct.OnTrackLoop = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Models parseARE_MiniGame_Player_Models(const GffView &gff) {
+    ARE_MiniGame_Player_Models strct;
+    static const GffSchema schema {
+        "Model",
+        "RotatingModel",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Model = field.getString();
+            break;
+        case 1:
+            strct.RotatingModel = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Gun_Banks parseARE_MiniGame_Player_Gun_Banks(const GffView &gff) {
+    ARE_MiniGame_Player_Gun_Banks strct;
+    static const GffSchema schema {
+        "BankID",
+        "Bullet",
+        "Fire_Sound",
+        "Gun_Model",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.BankID = field.getUint();
+            break;
+        case 1:
+            if (auto item = field.getStruct()) {
+                strct.Bullet = parseARE_MiniGame_Player_Gun_Banks_Bullet(item);
+            }
+            break;
+        case 2:
+            strct.Fire_Sound = field.getString();
+            break;
+        case 3:
+            strct.Gun_Model = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Obstacles_Scripts parseARE_MiniGame_Obstacles_Scripts(const GffView &gff) {
+    ARE_MiniGame_Obstacles_Scripts strct;
+    static const GffSchema schema {
+        "OnAnimEvent",
+        "OnCreate",
+        "OnHeartbeat",
+        "OnHitBullet",
+        "OnHitFollower",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.OnAnimEvent = field.getString();
+            break;
+        case 1:
+            strct.OnCreate = field.getString();
+            break;
+        case 2:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 3:
+            strct.OnHitBullet = field.getString();
+            break;
+        case 4:
+            strct.OnHitFollower = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Sounds parseARE_MiniGame_Enemies_Sounds(const GffView &gff) {
+    ARE_MiniGame_Enemies_Sounds strct;
+    static const GffSchema schema {
+        "Death",
+        "Engine",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Death = field.getString();
+            break;
+        case 1:
+            strct.Engine = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Scripts parseARE_MiniGame_Enemies_Scripts(const GffView &gff) {
+    ARE_MiniGame_Enemies_Scripts strct;
+    static const GffSchema schema {
+        "OnAccelerate",
+        "OnAnimEvent",
+        "OnBrake",
+        "OnCreate",
+        "OnDamage",
+        "OnDeath",
+        "OnFire",
+        "OnHeartbeat",
+        "OnHitBullet",
+        "OnHitFollower",
+        "OnHitObstacle",
+        "OnHitWorld",
+        "OnTrackLoop",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.OnAccelerate = field.getString();
+            break;
+        case 1:
+            strct.OnAnimEvent = field.getString();
+            break;
+        case 2:
+            strct.OnBrake = field.getString();
+            break;
+        case 3:
+            strct.OnCreate = field.getString();
+            break;
+        case 4:
+            strct.OnDamage = field.getString();
+            break;
+        case 5:
+            strct.OnDeath = field.getString();
+            break;
+        case 6:
+            strct.OnFire = field.getString();
+            break;
+        case 7:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 8:
+            strct.OnHitBullet = field.getString();
+            break;
+        case 9:
+            strct.OnHitFollower = field.getString();
+            break;
+        case 10:
+            strct.OnHitObstacle = field.getString();
+            break;
+        case 11:
+            strct.OnHitWorld = field.getString();
+            break;
+        case 12:
+            strct.OnTrackLoop = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Models parseARE_MiniGame_Enemies_Models(const GffView &gff) {
+    ARE_MiniGame_Enemies_Models strct;
+    static const GffSchema schema {
+        "Model",
+        "RotatingModel",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Model = field.getString();
+            break;
+        case 1:
+            strct.RotatingModel = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Gun_Banks parseARE_MiniGame_Enemies_Gun_Banks(const GffView &gff) {
+    ARE_MiniGame_Enemies_Gun_Banks strct;
+    static const GffSchema schema {
+        "BankID",
+        "Bullet",
+        "Fire_Sound",
+        "Gun_Model",
+        "Horiz_Spread",
+        "Inaccuracy",
+        "Sensing_Radius",
+        "Vert_Spread",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.BankID = field.getUint();
+            break;
+        case 1:
+            if (auto item = field.getStruct()) {
+                strct.Bullet = parseARE_MiniGame_Enemies_Gun_Banks_Bullet(item);
+            }
+            break;
+        case 2:
+            strct.Fire_Sound = field.getString();
+            break;
+        case 3:
+            strct.Gun_Model = field.getString();
+            break;
+        case 4:
+            strct.Horiz_Spread = field.getFloat();
+            break;
+        case 5:
+            strct.Inaccuracy = field.getFloat();
+            break;
+        case 6:
+            strct.Sensing_Radius = field.getFloat();
+            break;
+        case 7:
+            strct.Vert_Spread = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player parseARE_MiniGame_Player(const GffView &gff) {
+    ARE_MiniGame_Player strct;
+    static const GffSchema schema {
+        "Accel_Secs",
+        "Bump_Damage",
+        "Camera",
+        "CameraRotate",
+        "Gun_Banks",
+        "Hit_Points",
+        "Invince_Period",
+        "Max_HPs",
+        "Maximum_Speed",
+        "Minimum_Speed",
+        "Models",
+        "Num_Loops",
+        "Scripts",
+        "Sounds",
+        "Sphere_Radius",
+        "Start_Offset_X",
+        "Start_Offset_Y",
+        "Start_Offset_Z",
+        "Target_Offset_X",
+        "Target_Offset_Y",
+        "Target_Offset_Z",
+        "Track",
+        "TunnelInfinite",
+        "TunnelXNeg",
+        "TunnelXPos",
+        "TunnelYNeg",
+        "TunnelYPos",
+        "TunnelZNeg",
+        "TunnelZPos",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Accel_Secs = field.getFloat();
+            break;
+        case 1:
+            strct.Bump_Damage = field.getInt();
+            break;
+        case 2:
+            strct.Camera = field.getString();
+            break;
+        case 3:
+            strct.CameraRotate = field.getUint();
+            break;
+        case 4:
+            for (auto &item : field.getList()) {
+                strct.Gun_Banks.push_back(parseARE_MiniGame_Player_Gun_Banks(item));
+            }
+            break;
+        case 5:
+            strct.Hit_Points = field.getUint();
+            break;
+        case 6:
+            strct.Invince_Period = field.getFloat();
+            break;
+        case 7:
+            strct.Max_HPs = field.getUint();
+            break;
+        case 8:
+            strct.Maximum_Speed = field.getFloat();
+            break;
+        case 9:
+            strct.Minimum_Speed = field.getFloat();
+            break;
+        case 10:
+            for (auto &item : field.getList()) {
+                strct.Models.push_back(parseARE_MiniGame_Player_Models(item));
+            }
+            break;
+        case 11:
+            strct.Num_Loops = field.getInt();
+            break;
+        case 12:
+            if (auto item = field.getStruct()) {
+                strct.Scripts = parseARE_MiniGame_Player_Scripts(item);
+            }
+            break;
+        case 13:
+            if (auto item = field.getStruct()) {
+                strct.Sounds = parseARE_MiniGame_Player_Sounds(item);
+            }
+            break;
+        case 14:
+            strct.Sphere_Radius = field.getFloat();
+            break;
+        case 15:
+            strct.Start_Offset_X = field.getFloat();
+            break;
+        case 16:
+            strct.Start_Offset_Y = field.getFloat();
+            break;
+        case 17:
+            strct.Start_Offset_Z = field.getFloat();
+            break;
+        case 18:
+            strct.Target_Offset_X = field.getFloat();
+            break;
+        case 19:
+            strct.Target_Offset_Y = field.getFloat();
+            break;
+        case 20:
+            strct.Target_Offset_Z = field.getFloat();
+            break;
+        case 21:
+            strct.Track = field.getString();
+            break;
+        case 22:
+            strct.TunnelInfinite = field.getVector();
+            break;
+        case 23:
+            strct.TunnelXNeg = field.getFloat();
+            break;
+        case 24:
+            strct.TunnelXPos = field.getFloat();
+            break;
+        case 25:
+            strct.TunnelYNeg = field.getFloat();
+            break;
+        case 26:
+            strct.TunnelYPos = field.getFloat();
+            break;
+        case 27:
+            strct.TunnelZNeg = field.getFloat();
+            break;
+        case 28:
+            strct.TunnelZPos = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Obstacles parseARE_MiniGame_Obstacles(const GffView &gff) {
+    ARE_MiniGame_Obstacles strct;
+    static const GffSchema schema {
+        "Name",
+        "Scripts",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Name = field.getString();
+            break;
+        case 1:
+            if (auto item = field.getStruct()) {
+                strct.Scripts = parseARE_MiniGame_Obstacles_Scripts(item);
+            }
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Mouse parseARE_MiniGame_Mouse(const GffView &gff) {
+    ARE_MiniGame_Mouse strct;
+    static const GffSchema schema {
+        "AxisX",
+        "AxisY",
+        "FlipAxisX",
+        "FlipAxisY",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AxisX = field.getUint();
+            break;
+        case 1:
+            strct.AxisY = field.getUint();
+            break;
+        case 2:
+            strct.FlipAxisX = field.getUint();
+            break;
+        case 3:
+            strct.FlipAxisY = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies parseARE_MiniGame_Enemies(const GffView &gff) {
+    ARE_MiniGame_Enemies strct;
+    static const GffSchema schema {
+        "Bump_Damage",
+        "Gun_Banks",
+        "Hit_Points",
+        "Invince_Period",
+        "Max_HPs",
+        "Models",
+        "Num_Loops",
+        "Scripts",
+        "Sounds",
+        "Sphere_Radius",
+        "Track",
+        "Trigger",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Bump_Damage = field.getInt();
+            break;
+        case 1:
+            for (auto &item : field.getList()) {
+                strct.Gun_Banks.push_back(parseARE_MiniGame_Enemies_Gun_Banks(item));
+            }
+            break;
+        case 2:
+            strct.Hit_Points = field.getUint();
+            break;
+        case 3:
+            strct.Invince_Period = field.getFloat();
+            break;
+        case 4:
+            strct.Max_HPs = field.getUint();
+            break;
+        case 5:
+            for (auto &item : field.getList()) {
+                strct.Models.push_back(parseARE_MiniGame_Enemies_Models(item));
+            }
+            break;
+        case 6:
+            strct.Num_Loops = field.getInt();
+            break;
+        case 7:
+            if (auto item = field.getStruct()) {
+                strct.Scripts = parseARE_MiniGame_Enemies_Scripts(item);
+            }
+            break;
+        case 8:
+            if (auto item = field.getStruct()) {
+                strct.Sounds = parseARE_MiniGame_Enemies_Sounds(item);
+            }
+            break;
+        case 9:
+            strct.Sphere_Radius = field.getFloat();
+            break;
+        case 10:
+            strct.Track = field.getString();
+            break;
+        case 11:
+            strct.Trigger = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_Rooms parseARE_Rooms(const GffView &gff) {
+    ARE_Rooms strct;
+    static const GffSchema schema {
+        "AmbientScale",
+        "DisableWeather",
+        "EnvAudio",
+        "ForceRating",
+        "RoomName",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AmbientScale = field.getFloat();
+            break;
+        case 1:
+            strct.DisableWeather = field.getUint();
+            break;
+        case 2:
+            strct.EnvAudio = field.getInt();
+            break;
+        case 3:
+            strct.ForceRating = field.getInt();
+            break;
+        case 4:
+            strct.RoomName = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame parseARE_MiniGame(const GffView &gff) {
+    ARE_MiniGame strct;
+    static const GffSchema schema {
+        "Bump_Plane",
+        "CameraViewAngle",
+        "DOF",
+        "DoBumping",
+        "Enemies",
+        "Far_Clip",
+        "LateralAccel",
+        "Mouse",
+        "MovementPerSec",
+        "Music",
+        "Near_Clip",
+        "Obstacles",
+        "Player",
+        "Type",
+        "UseInertia",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Bump_Plane = field.getUint();
+            break;
+        case 1:
+            strct.CameraViewAngle = field.getFloat();
+            break;
+        case 2:
+            strct.DOF = field.getUint();
+            break;
+        case 3:
+            strct.DoBumping = field.getUint();
+            break;
+        case 4:
+            for (auto &item : field.getList()) {
+                strct.Enemies.push_back(parseARE_MiniGame_Enemies(item));
+            }
+            break;
+        case 5:
+            strct.Far_Clip = field.getFloat();
+            break;
+        case 6:
+            strct.LateralAccel = field.getFloat();
+            break;
+        case 7:
+            if (auto item = field.getStruct()) {
+                strct.Mouse = parseARE_MiniGame_Mouse(item);
+            }
+            break;
+        case 8:
+            strct.MovementPerSec = field.getFloat();
+            break;
+        case 9:
+            strct.Music = field.getString();
+            break;
+        case 10:
+            strct.Near_Clip = field.getFloat();
+            break;
+        case 11:
+            for (auto &item : field.getList()) {
+                strct.Obstacles.push_back(parseARE_MiniGame_Obstacles(item));
+            }
+            break;
+        case 12:
+            if (auto item = field.getStruct()) {
+                strct.Player = parseARE_MiniGame_Player(item);
+            }
+            break;
+        case 13:
+            strct.Type = field.getUint();
+            break;
+        case 14:
+            strct.UseInertia = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_Map parseARE_Map(const GffView &gff) {
+    ARE_Map strct;
+    static const GffSchema schema {
+        "MapPt1X",
+        "MapPt1Y",
+        "MapPt2X",
+        "MapPt2Y",
+        "MapResX",
+        "MapZoom",
+        "NorthAxis",
+        "WorldPt1X",
+        "WorldPt1Y",
+        "WorldPt2X",
+        "WorldPt2Y",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.MapPt1X = field.getFloat();
+            break;
+        case 1:
+            strct.MapPt1Y = field.getFloat();
+            break;
+        case 2:
+            strct.MapPt2X = field.getFloat();
+            break;
+        case 3:
+            strct.MapPt2Y = field.getFloat();
+            break;
+        case 4:
+            strct.MapResX = field.getInt();
+            break;
+        case 5:
+            strct.MapZoom = field.getInt();
+            break;
+        case 6:
+            strct.NorthAxis = field.getInt();
+            break;
+        case 7:
+            strct.WorldPt1X = field.getFloat();
+            break;
+        case 8:
+            strct.WorldPt1Y = field.getFloat();
+            break;
+        case 9:
+            strct.WorldPt2X = field.getFloat();
+            break;
+        case 10:
+            strct.WorldPt2Y = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+ARE parseARE(const GffView &gff) {
+    ARE strct;
+    static const GffSchema schema {
+        "AlphaTest",
+        "CameraStyle",
+        "ChanceLightning",
+        "ChanceRain",
+        "ChanceSnow",
+        "Comments",
+        "Creator_ID",
+        "DayNightCycle",
+        "DefaultEnvMap",
+        "DirtyARGBOne",
+        "DirtyARGBThree",
+        "DirtyARGBTwo",
+        "DirtyFormulaOne",
+        "DirtyFormulaThre",
+        "DirtyFormulaTwo",
+        "DirtyFuncOne",
+        "DirtyFuncThree",
+        "DirtyFuncTwo",
+        "DirtySizeOne",
+        "DirtySizeThree",
+        "DirtySizeTwo",
+        "DisableTransit",
+        "DynAmbientColor",
+        "Flags",
+        "Grass_Ambient",
+        "Grass_Density",
+        "Grass_Diffuse",
+        "Grass_Emissive",
+        "Grass_Prob_LL",
+        "Grass_Prob_LR",
+        "Grass_Prob_UL",
+        "Grass_Prob_UR",
+        "Grass_QuadSize",
+        "Grass_TexName",
+        "ID",
+        "IsNight",
+        "LightingScheme",
+        "LoadScreenID",
+        "Map",
+        "MiniGame",
+        "ModListenCheck",
+        "ModSpotCheck",
+        "MoonAmbientColor",
+        "MoonDiffuseColor",
+        "MoonFogColor",
+        "MoonFogFar",
+        "MoonFogNear",
+        "MoonFogOn",
+        "MoonShadows",
+        "Name",
+        "NoHangBack",
+        "NoRest",
+        "OnEnter",
+        "OnExit",
+        "OnHeartbeat",
+        "OnUserDefined",
+        "PlayerOnly",
+        "PlayerVsPlayer",
+        "Rooms",
+        "ShadowOpacity",
+        "StealthXPEnabled",
+        "StealthXPLoss",
+        "StealthXPMax",
+        "SunAmbientColor",
+        "SunDiffuseColor",
+        "SunFogColor",
+        "SunFogFar",
+        "SunFogNear",
+        "SunFogOn",
+        "SunShadows",
+        "Tag",
+        "Unescapable",
+        "Version",
+        "WindPower",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AlphaTest = field.getFloat();
+            break;
+        case 1:
+            strct.CameraStyle = field.getInt();
+            break;
+        case 2:
+            strct.ChanceLightning = field.getInt();
+            break;
+        case 3:
+            strct.ChanceRain = field.getInt();
+            break;
+        case 4:
+            strct.ChanceSnow = field.getInt();
+            break;
+        case 5:
+            strct.Comments = field.getString();
+            break;
+        case 6:
+            strct.Creator_ID = field.getInt();
+            break;
+        case 7:
+            strct.DayNightCycle = field.getUint();
+            break;
+        case 8:
+            strct.DefaultEnvMap = field.getString();
+            break;
+        case 9:
+            strct.DirtyARGBOne = field.getInt();
+            break;
+        case 10:
+            strct.DirtyARGBThree = field.getInt();
+            break;
+        case 11:
+            strct.DirtyARGBTwo = field.getInt();
+            break;
+        case 12:
+            strct.DirtyFormulaOne = field.getInt();
+            break;
+        case 13:
+            strct.DirtyFormulaThre = field.getInt();
+            break;
+        case 14:
+            strct.DirtyFormulaTwo = field.getInt();
+            break;
+        case 15:
+            strct.DirtyFuncOne = field.getInt();
+            break;
+        case 16:
+            strct.DirtyFuncThree = field.getInt();
+            break;
+        case 17:
+            strct.DirtyFuncTwo = field.getInt();
+            break;
+        case 18:
+            strct.DirtySizeOne = field.getInt();
+            break;
+        case 19:
+            strct.DirtySizeThree = field.getInt();
+            break;
+        case 20:
+            strct.DirtySizeTwo = field.getInt();
+            break;
+        case 21:
+            strct.DisableTransit = field.getUint();
+            break;
+        case 22:
+            strct.DynAmbientColor = field.getUint();
+            break;
+        case 23:
+            strct.Flags = field.getUint();
+            break;
+        case 24:
+            strct.Grass_Ambient = field.getUint();
+            break;
+        case 25:
+            strct.Grass_Density = field.getFloat();
+            break;
+        case 26:
+            strct.Grass_Diffuse = field.getUint();
+            break;
+        case 27:
+            strct.Grass_Emissive = field.getUint();
+            break;
+        case 28:
+            strct.Grass_Prob_LL = field.getFloat();
+            break;
+        case 29:
+            strct.Grass_Prob_LR = field.getFloat();
+            break;
+        case 30:
+            strct.Grass_Prob_UL = field.getFloat();
+            break;
+        case 31:
+            strct.Grass_Prob_UR = field.getFloat();
+            break;
+        case 32:
+            strct.Grass_QuadSize = field.getFloat();
+            break;
+        case 33:
+            strct.Grass_TexName = field.getString();
+            break;
+        case 34:
+            strct.ID = field.getInt();
+            break;
+        case 35:
+            strct.IsNight = field.getUint();
+            break;
+        case 36:
+            strct.LightingScheme = field.getUint();
+            break;
+        case 37:
+            strct.LoadScreenID = field.getUint();
+            break;
+        case 38:
+            if (auto item = field.getStruct()) {
+                strct.Map = parseARE_Map(item);
+            }
+            break;
+        case 39:
+            if (auto item = field.getStruct()) {
+                strct.MiniGame = parseARE_MiniGame(item);
+            }
+            break;
+        case 40:
+            strct.ModListenCheck = field.getInt();
+            break;
+        case 41:
+            strct.ModSpotCheck = field.getInt();
+            break;
+        case 42:
+            strct.MoonAmbientColor = field.getUint();
+            break;
+        case 43:
+            strct.MoonDiffuseColor = field.getUint();
+            break;
+        case 44:
+            strct.MoonFogColor = field.getUint();
+            break;
+        case 45:
+            strct.MoonFogFar = field.getFloat();
+            break;
+        case 46:
+            strct.MoonFogNear = field.getFloat();
+            break;
+        case 47:
+            strct.MoonFogOn = field.getUint();
+            break;
+        case 48:
+            strct.MoonShadows = field.getUint();
+            break;
+        case 49:
+            strct.Name = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 50:
+            strct.NoHangBack = field.getUint();
+            break;
+        case 51:
+            strct.NoRest = field.getUint();
+            break;
+        case 52:
+            strct.OnEnter = field.getString();
+            break;
+        case 53:
+            strct.OnExit = field.getString();
+            break;
+        case 54:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 55:
+            strct.OnUserDefined = field.getString();
+            break;
+        case 56:
+            strct.PlayerOnly = field.getUint();
+            break;
+        case 57:
+            strct.PlayerVsPlayer = field.getUint();
+            break;
+        case 58:
+            for (auto &item : field.getList()) {
+                strct.Rooms.push_back(parseARE_Rooms(item));
+            }
+            break;
+        case 59:
+            strct.ShadowOpacity = field.getUint();
+            break;
+        case 60:
+            strct.StealthXPEnabled = field.getUint();
+            break;
+        case 61:
+            strct.StealthXPLoss = field.getUint();
+            break;
+        case 62:
+            strct.StealthXPMax = field.getUint();
+            break;
+        case 63:
+            strct.SunAmbientColor = field.getUint();
+            break;
+        case 64:
+            strct.SunDiffuseColor = field.getUint();
+            break;
+        case 65:
+            strct.SunFogColor = field.getUint();
+            break;
+        case 66:
+            strct.SunFogFar = field.getFloat();
+            break;
+        case 67:
+            strct.SunFogNear = field.getFloat();
+            break;
+        case 68:
+            strct.SunFogOn = field.getUint();
+            break;
+        case 69:
+            strct.SunShadows = field.getUint();
+            break;
+        case 70:
+            strct.Tag = field.getString();
+            break;
+        case 71:
+            strct.Unescapable = field.getUint();
+            break;
+        case 72:
+            strct.Version = field.getUint();
+            break;
+        case 73:
+            strct.WindPower = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/dlg.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -164,6 +165,475 @@ DLG parseDLG(const Gff &gff) {
     return strct;
 }
 
+static DLG_EntryReplyList_EntriesRepliesList parseDLG_EntryReplyList_EntriesRepliesList(const GffView &gff) {
+    DLG_EntryReplyList_EntriesRepliesList strct;
+    static const GffSchema schema {
+        "Active",
+        "Active2",
+        "Index",
+        "IsChild",
+        "LinkComment",
+        "Logic",
+        "Not",
+        "Not2",
+        "Param1",
+        "Param1b",
+        "Param2",
+        "Param2b",
+        "Param3",
+        "Param3b",
+        "Param4",
+        "Param4b",
+        "Param5",
+        "Param5b",
+        "ParamStrA",
+        "ParamStrB",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Active = field.getString();
+            break;
+        case 1:
+            strct.Active2 = field.getString();
+            break;
+        case 2:
+            strct.Index = field.getUint();
+            break;
+        case 3:
+            strct.IsChild = field.getUint();
+            break;
+        case 4:
+            strct.LinkComment = field.getString();
+            break;
+        case 5:
+            strct.Logic = field.getInt();
+            break;
+        case 6:
+            strct.Not = field.getUint();
+            break;
+        case 7:
+            strct.Not2 = field.getUint();
+            break;
+        case 8:
+            strct.Param1 = field.getInt();
+            break;
+        case 9:
+            strct.Param1b = field.getInt();
+            break;
+        case 10:
+            strct.Param2 = field.getInt();
+            break;
+        case 11:
+            strct.Param2b = field.getInt();
+            break;
+        case 12:
+            strct.Param3 = field.getInt();
+            break;
+        case 13:
+            strct.Param3b = field.getInt();
+            break;
+        case 14:
+            strct.Param4 = field.getInt();
+            break;
+        case 15:
+            strct.Param4b = field.getInt();
+            break;
+        case 16:
+            strct.Param5 = field.getInt();
+            break;
+        case 17:
+            strct.Param5b = field.getInt();
+            break;
+        case 18:
+            strct.ParamStrA = field.getString();
+            break;
+        case 19:
+            strct.ParamStrB = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG_EntryReplyList_AnimList parseDLG_EntryReplyList_AnimList(const GffView &gff) {
+    DLG_EntryReplyList_AnimList strct;
+    static const GffSchema schema {
+        "Animation",
+        "Participant",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Animation = field.getUint();
+            break;
+        case 1:
+            strct.Participant = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG_StuntList parseDLG_StuntList(const GffView &gff) {
+    DLG_StuntList strct;
+    static const GffSchema schema {
+        "Participant",
+        "StuntModel",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Participant = field.getString();
+            break;
+        case 1:
+            strct.StuntModel = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG_EntryReplyList parseDLG_EntryReplyList(const GffView &gff) {
+    DLG_EntryReplyList strct;
+    static const GffSchema schema {
+        "ActionParam1",
+        "ActionParam1b",
+        "ActionParam2",
+        "ActionParam2b",
+        "ActionParam3",
+        "ActionParam3b",
+        "ActionParam4",
+        "ActionParam4b",
+        "ActionParam5",
+        "ActionParam5b",
+        "ActionParamStrA",
+        "ActionParamStrB",
+        "AlienRaceNode",
+        "AnimList",
+        "CamFieldOfView",
+        "CamHeightOffset",
+        "CamVidEffect",
+        "CameraAngle",
+        "CameraAnimation",
+        "CameraID",
+        "Changed",
+        "Comment",
+        "Delay",
+        "Emotion",
+        "EntriesList",
+        "FacialAnim",
+        "FadeColor",
+        "FadeDelay",
+        "FadeLength",
+        "FadeType",
+        "Listener",
+        "NodeID",
+        "NodeUnskippable",
+        "PlotIndex",
+        "PlotXPPercentage",
+        "PostProcNode",
+        "Quest",
+        "QuestEntry",
+        "RecordNoVOOverri",
+        "RecordVO",
+        "RepliesList",
+        "Script",
+        "Script2",
+        "Sound",
+        "SoundExists",
+        "Speaker",
+        "TarHeightOffset",
+        "Text",
+        "VOTextChanged",
+        "VO_ResRef",
+        "WaitFlags",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.ActionParam1 = field.getInt();
+            break;
+        case 1:
+            strct.ActionParam1b = field.getInt();
+            break;
+        case 2:
+            strct.ActionParam2 = field.getInt();
+            break;
+        case 3:
+            strct.ActionParam2b = field.getInt();
+            break;
+        case 4:
+            strct.ActionParam3 = field.getInt();
+            break;
+        case 5:
+            strct.ActionParam3b = field.getInt();
+            break;
+        case 6:
+            strct.ActionParam4 = field.getInt();
+            break;
+        case 7:
+            strct.ActionParam4b = field.getInt();
+            break;
+        case 8:
+            strct.ActionParam5 = field.getInt();
+            break;
+        case 9:
+            strct.ActionParam5b = field.getInt();
+            break;
+        case 10:
+            strct.ActionParamStrA = field.getString();
+            break;
+        case 11:
+            strct.ActionParamStrB = field.getString();
+            break;
+        case 12:
+            strct.AlienRaceNode = field.getInt();
+            break;
+        case 13:
+            for (auto &item : field.getList()) {
+                strct.AnimList.push_back(parseDLG_EntryReplyList_AnimList(item));
+            }
+            break;
+        case 14:
+            strct.CamFieldOfView = field.getFloat();
+            break;
+        case 15:
+            strct.CamHeightOffset = field.getFloat();
+            break;
+        case 16:
+            strct.CamVidEffect = field.getInt();
+            break;
+        case 17:
+            strct.CameraAngle = field.getUint();
+            break;
+        case 18:
+            strct.CameraAnimation = field.getUint();
+            break;
+        case 19:
+            strct.CameraID = field.getInt();
+            break;
+        case 20:
+            strct.Changed = field.getUint();
+            break;
+        case 21:
+            strct.Comment = field.getString();
+            break;
+        case 22:
+            strct.Delay = field.getUint();
+            break;
+        case 23:
+            strct.Emotion = field.getInt();
+            break;
+        case 24:
+            for (auto &item : field.getList()) {
+                strct.EntriesList.push_back(parseDLG_EntryReplyList_EntriesRepliesList(item));
+            }
+            break;
+        case 25:
+            strct.FacialAnim = field.getInt();
+            break;
+        case 26:
+            strct.FadeColor = field.getVector();
+            break;
+        case 27:
+            strct.FadeDelay = field.getFloat();
+            break;
+        case 28:
+            strct.FadeLength = field.getFloat();
+            break;
+        case 29:
+            strct.FadeType = field.getUint();
+            break;
+        case 30:
+            strct.Listener = field.getString();
+            break;
+        case 31:
+            strct.NodeID = field.getInt();
+            break;
+        case 32:
+            strct.NodeUnskippable = field.getInt();
+            break;
+        case 33:
+            strct.PlotIndex = field.getInt();
+            break;
+        case 34:
+            strct.PlotXPPercentage = field.getFloat();
+            break;
+        case 35:
+            strct.PostProcNode = field.getInt();
+            break;
+        case 36:
+            strct.Quest = field.getString();
+            break;
+        case 37:
+            strct.QuestEntry = field.getUint();
+            break;
+        case 38:
+            strct.RecordNoVOOverri = field.getInt();
+            break;
+        case 39:
+            strct.RecordVO = field.getInt();
+            break;
+        case 40:
+            for (auto &item : field.getList()) {
+                strct.RepliesList.push_back(parseDLG_EntryReplyList_EntriesRepliesList(item));
+            }
+            break;
+        case 41:
+            strct.Script = field.getString();
+            break;
+        case 42:
+            strct.Script2 = field.getString();
+            break;
+        case 43:
+            strct.Sound = field.getString();
+            break;
+        case 44:
+            strct.SoundExists = field.getUint();
+            break;
+        case 45:
+            strct.Speaker = field.getString();
+            break;
+        case 46:
+            strct.TarHeightOffset = field.getFloat();
+            break;
+        case 47:
+            strct.Text = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 48:
+            strct.VOTextChanged = field.getUint();
+            break;
+        case 49:
+            strct.VO_ResRef = field.getString();
+            break;
+        case 50:
+            strct.WaitFlags = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+DLG parseDLG(const GffView &gff) {
+    DLG strct;
+    static const GffSchema schema {
+        "AlienRaceOwner",
+        "AmbientTrack",
+        "AnimatedCut",
+        "CameraModel",
+        "ComputerType",
+        "ConversationType",
+        "DelayEntry",
+        "DelayReply",
+        "DeletedVOFiles",
+        "EditorInfo",
+        "EndConverAbort",
+        "EndConversation",
+        "EntryList",
+        "NextNodeID",
+        "NumWords",
+        "OldHitCheck",
+        "PostProcOwner",
+        "RecordNoVO",
+        "ReplyList",
+        "Skippable",
+        "StartingList",
+        "StuntList",
+        "UnequipHItem",
+        "UnequipItems",
+        "VO_ID",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AlienRaceOwner = field.getInt();
+            break;
+        case 1:
+            strct.AmbientTrack = field.getString();
+            break;
+        case 2:
+            strct.AnimatedCut = field.getUint();
+            break;
+        case 3:
+            strct.CameraModel = field.getString();
+            break;
+        case 4:
+            strct.ComputerType = field.getUint();
+            break;
+        case 5:
+            strct.ConversationType = field.getInt();
+            break;
+        case 6:
+            strct.DelayEntry = field.getUint();
+            break;
+        case 7:
+            strct.DelayReply = field.getUint();
+            break;
+        case 8:
+            strct.DeletedVOFiles = field.getString();
+            break;
+        case 9:
+            strct.EditorInfo = field.getString();
+            break;
+        case 10:
+            strct.EndConverAbort = field.getString();
+            break;
+        case 11:
+            strct.EndConversation = field.getString();
+            break;
+        case 12:
+            for (auto &item : field.getList()) {
+                strct.EntryList.push_back(parseDLG_EntryReplyList(item));
+            }
+            break;
+        case 13:
+            strct.NextNodeID = field.getInt();
+            break;
+        case 14:
+            strct.NumWords = field.getUint();
+            break;
+        case 15:
+            strct.OldHitCheck = field.getUint();
+            break;
+        case 16:
+            strct.PostProcOwner = field.getInt();
+            break;
+        case 17:
+            strct.RecordNoVO = field.getInt();
+            break;
+        case 18:
+            for (auto &item : field.getList()) {
+                strct.ReplyList.push_back(parseDLG_EntryReplyList(item));
+            }
+            break;
+        case 19:
+            strct.Skippable = field.getUint();
+            break;
+        case 20:
+            for (auto &item : field.getList()) {
+                strct.StartingList.push_back(parseDLG_EntryReplyList_EntriesRepliesList(item));
+            }
+            break;
+        case 21:
+            for (auto &item : field.getList()) {
+                strct.StuntList.push_back(parseDLG_StuntList(item));
+            }
+            break;
+        case 22:
+            strct.UnequipHItem = field.getUint();
+            break;
+        case 23:
+            strct.UnequipItems = field.getUint();
+            break;
+        case 24:
+            strct.VO_ID = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/git.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -228,6 +229,610 @@ GIT parseGIT(const Gff &gff) {
     return strct;
 }
 
+static GIT_TriggerList_Geometry parseGIT_TriggerList_Geometry(const GffView &gff) {
+    GIT_TriggerList_Geometry strct;
+    static const GffSchema schema {
+        "PointX",
+        "PointY",
+        "PointZ",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.PointX = field.getFloat();
+            break;
+        case 1:
+            strct.PointY = field.getFloat();
+            break;
+        case 2:
+            strct.PointZ = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Encounter_List_SpawnPointList parseGIT_Encounter_List_SpawnPointList(const GffView &gff) {
+    GIT_Encounter_List_SpawnPointList strct;
+    static const GffSchema schema {
+        "Orientation",
+        "X",
+        "Y",
+        "Z",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Orientation = field.getFloat();
+            break;
+        case 1:
+            strct.X = field.getFloat();
+            break;
+        case 2:
+            strct.Y = field.getFloat();
+            break;
+        case 3:
+            strct.Z = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Encounter_List_Geometry parseGIT_Encounter_List_Geometry(const GffView &gff) {
+    GIT_Encounter_List_Geometry strct;
+    static const GffSchema schema {
+        "X",
+        "Y",
+        "Z",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.X = field.getFloat();
+            break;
+        case 1:
+            strct.Y = field.getFloat();
+            break;
+        case 2:
+            strct.Z = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_WaypointList parseGIT_WaypointList(const GffView &gff) {
+    GIT_WaypointList strct;
+    static const GffSchema schema {
+        "Appearance",
+        "Description",
+        "HasMapNote",
+        "LinkedTo",
+        "LocalizedName",
+        "MapNote",
+        "MapNoteEnabled",
+        "Tag",
+        "TemplateResRef",
+        "XOrientation",
+        "XPosition",
+        "YOrientation",
+        "YPosition",
+        "ZPosition",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Appearance = field.getUint();
+            break;
+        case 1:
+            strct.Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 2:
+            strct.HasMapNote = field.getUint();
+            break;
+        case 3:
+            strct.LinkedTo = field.getString();
+            break;
+        case 4:
+            strct.LocalizedName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 5:
+            strct.MapNote = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 6:
+            strct.MapNoteEnabled = field.getUint();
+            break;
+        case 7:
+            strct.Tag = field.getString();
+            break;
+        case 8:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 9:
+            strct.XOrientation = field.getFloat();
+            break;
+        case 10:
+            strct.XPosition = field.getFloat();
+            break;
+        case 11:
+            strct.YOrientation = field.getFloat();
+            break;
+        case 12:
+            strct.YPosition = field.getFloat();
+            break;
+        case 13:
+            strct.ZPosition = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_TriggerList parseGIT_TriggerList(const GffView &gff) {
+    GIT_TriggerList strct;
+    static const GffSchema schema {
+        "Geometry",
+        "LinkedTo",
+        "LinkedToFlags",
+        "LinkedToModule",
+        "Tag",
+        "TemplateResRef",
+        "TransitionDestin",
+        "XOrientation",
+        "XPosition",
+        "YOrientation",
+        "YPosition",
+        "ZOrientation",
+        "ZPosition",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            for (auto &item : field.getList()) {
+                strct.Geometry.push_back(parseGIT_TriggerList_Geometry(item));
+            }
+            break;
+        case 1:
+            strct.LinkedTo = field.getString();
+            break;
+        case 2:
+            strct.LinkedToFlags = field.getUint();
+            break;
+        case 3:
+            strct.LinkedToModule = field.getString();
+            break;
+        case 4:
+            strct.Tag = field.getString();
+            break;
+        case 5:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 6:
+            strct.TransitionDestin = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 7:
+            strct.XOrientation = field.getFloat();
+            break;
+        case 8:
+            strct.XPosition = field.getFloat();
+            break;
+        case 9:
+            strct.YOrientation = field.getFloat();
+            break;
+        case 10:
+            strct.YPosition = field.getFloat();
+            break;
+        case 11:
+            strct.ZOrientation = field.getFloat();
+            break;
+        case 12:
+            strct.ZPosition = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_StoreList parseGIT_StoreList(const GffView &gff) {
+    GIT_StoreList strct;
+    static const GffSchema schema {
+        "ResRef",
+        "XOrientation",
+        "XPosition",
+        "YOrientation",
+        "YPosition",
+        "ZPosition",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.ResRef = field.getString();
+            break;
+        case 1:
+            strct.XOrientation = field.getFloat();
+            break;
+        case 2:
+            strct.XPosition = field.getFloat();
+            break;
+        case 3:
+            strct.YOrientation = field.getFloat();
+            break;
+        case 4:
+            strct.YPosition = field.getFloat();
+            break;
+        case 5:
+            strct.ZPosition = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_SoundList parseGIT_SoundList(const GffView &gff) {
+    GIT_SoundList strct;
+    static const GffSchema schema {
+        "GeneratedType",
+        "TemplateResRef",
+        "XPosition",
+        "YPosition",
+        "ZPosition",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.GeneratedType = field.getUint();
+            break;
+        case 1:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 2:
+            strct.XPosition = field.getFloat();
+            break;
+        case 3:
+            strct.YPosition = field.getFloat();
+            break;
+        case 4:
+            strct.ZPosition = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Placeable_List parseGIT_Placeable_List(const GffView &gff) {
+    GIT_Placeable_List strct;
+    static const GffSchema schema {
+        "Bearing",
+        "TemplateResRef",
+        "TweakColor",
+        "UseTweakColor",
+        "X",
+        "Y",
+        "Z",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Bearing = field.getFloat();
+            break;
+        case 1:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 2:
+            strct.TweakColor = field.getUint();
+            break;
+        case 3:
+            strct.UseTweakColor = field.getUint();
+            break;
+        case 4:
+            strct.X = field.getFloat();
+            break;
+        case 5:
+            strct.Y = field.getFloat();
+            break;
+        case 6:
+            strct.Z = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Encounter_List parseGIT_Encounter_List(const GffView &gff) {
+    GIT_Encounter_List strct;
+    static const GffSchema schema {
+        "Geometry",
+        "SpawnPointList",
+        "TemplateResRef",
+        "XPosition",
+        "YPosition",
+        "ZPosition",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            for (auto &item : field.getList()) {
+                strct.Geometry.push_back(parseGIT_Encounter_List_Geometry(item));
+            }
+            break;
+        case 1:
+            for (auto &item : field.getList()) {
+                strct.SpawnPointList.push_back(parseGIT_Encounter_List_SpawnPointList(item));
+            }
+            break;
+        case 2:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 3:
+            strct.XPosition = field.getFloat();
+            break;
+        case 4:
+            strct.YPosition = field.getFloat();
+            break;
+        case 5:
+            strct.ZPosition = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Door_List parseGIT_Door_List(const GffView &gff) {
+    GIT_Door_List strct;
+    static const GffSchema schema {
+        "Bearing",
+        "LinkedTo",
+        "LinkedToFlags",
+        "LinkedToModule",
+        "Tag",
+        "TemplateResRef",
+        "TransitionDestin",
+        "TweakColor",
+        "UseTweakColor",
+        "X",
+        "Y",
+        "Z",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Bearing = field.getFloat();
+            break;
+        case 1:
+            strct.LinkedTo = field.getString();
+            break;
+        case 2:
+            strct.LinkedToFlags = field.getUint();
+            break;
+        case 3:
+            strct.LinkedToModule = field.getString();
+            break;
+        case 4:
+            strct.Tag = field.getString();
+            break;
+        case 5:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 6:
+            strct.TransitionDestin = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 7:
+            strct.TweakColor = field.getUint();
+            break;
+        case 8:
+            strct.UseTweakColor = field.getUint();
+            break;
+        case 9:
+            strct.X = field.getFloat();
+            break;
+        case 10:
+            strct.Y = field.getFloat();
+            break;
+        case 11:
+            strct.Z = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Creature_List parseGIT_Creature_List(const GffView &gff) {
+    GIT_Creature_List strct;
+    static const GffSchema schema {
+        "TemplateResRef",
+        "XOrientation",
+        "XPosition",
+        "YOrientation",
+        "YPosition",
+        "ZPosition",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 1:
+            strct.XOrientation = field.getFloat();
+            break;
+        case 2:
+            strct.XPosition = field.getFloat();
+            break;
+        case 3:
+            strct.YOrientation = field.getFloat();
+            break;
+        case 4:
+            strct.YPosition = field.getFloat();
+            break;
+        case 5:
+            strct.ZPosition = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_CameraList parseGIT_CameraList(const GffView &gff) {
+    GIT_CameraList strct;
+    static const GffSchema schema {
+        "CameraID",
+        "FieldOfView",
+        "Height",
+        "MicRange",
+        "Orientation",
+        "Pitch",
+        "Position",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.CameraID = field.getInt();
+            break;
+        case 1:
+            strct.FieldOfView = field.getFloat();
+            break;
+        case 2:
+            strct.Height = field.getFloat();
+            break;
+        case 3:
+            strct.MicRange = field.getFloat();
+            break;
+        case 4:
+            strct.Orientation = field.getOrientation();
+            break;
+        case 5:
+            strct.Pitch = field.getFloat();
+            break;
+        case 6:
+            strct.Position = field.getVector();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_AreaProperties parseGIT_AreaProperties(const GffView &gff) {
+    GIT_AreaProperties strct;
+    static const GffSchema schema {
+        "AmbientSndDay",
+        "AmbientSndDayVol",
+        "AmbientSndNight",
+        "AmbientSndNitVol",
+        "EnvAudio",
+        "MusicBattle",
+        "MusicDay",
+        "MusicDelay",
+        "MusicNight",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AmbientSndDay = field.getInt();
+            break;
+        case 1:
+            strct.AmbientSndDayVol = field.getInt();
+            break;
+        case 2:
+            strct.AmbientSndNight = field.getInt();
+            break;
+        case 3:
+            strct.AmbientSndNitVol = field.getInt();
+            break;
+        case 4:
+            strct.EnvAudio = field.getInt();
+            break;
+        case 5:
+            strct.MusicBattle = field.getInt();
+            break;
+        case 6:
+            strct.MusicDay = field.getInt();
+            break;
+        case 7:
+            strct.MusicDelay = field.getInt();
+            break;
+        case 8:
+            strct.MusicNight = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
+GIT parseGIT(const GffView &gff) {
+    GIT strct;
+    static const GffSchema schema {
+        "AreaProperties",
+        "CameraList",
+        "Creature List",
+        "Door List",
+        "Encounter List",
+        "Placeable List",
+        "SoundList",
+        "StoreList",
+        "TriggerList",
+        "UseTemplates",
+        "WaypointList",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            if (auto item = field.getStruct()) {
+                strct.AreaProperties = parseGIT_AreaProperties(item);
+            }
+            break;
+        case 1:
+            for (auto &item : field.getList()) {
+                strct.CameraList.push_back(parseGIT_CameraList(item));
+            }
+            break;
+        case 2:
+            for (auto &item : field.getList()) {
+                strct.Creature_List.push_back(parseGIT_Creature_List(item));
+            }
+            break;
+        case 3:
+            for (auto &item : field.getList()) {
+                strct.Door_List.push_back(parseGIT_Door_List(item));
+            }
+            break;
+        case 4:
+            for (auto &item : field.getList()) {
+                strct.Encounter_List.push_back(parseGIT_Encounter_List(item));
+            }
+            break;
+        case 5:
+            for (auto &item : field.getList()) {
+                strct.Placeable_List.push_back(parseGIT_Placeable_List(item));
+            }
+            break;
+        case 6:
+            for (auto &item : field.getList()) {
+                strct.SoundList.push_back(parseGIT_SoundList(item));
+            }
+            break;
+        case 7:
+            for (auto &item : field.getList()) {
+                strct.StoreList.push_back(parseGIT_StoreList(item));
+            }
+            break;
+        case 8:
+            for (auto &item : field.getList()) {
+                strct.TriggerList.push_back(parseGIT_TriggerList(item));
+            }
+            break;
+        case 9:
+            strct.UseTemplates = field.getUint();
+            break;
+        case 10:
+            for (auto &item : field.getList()) {
+                strct.WaypointList.push_back(parseGIT_WaypointList(item));
+            }
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/gui.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -213,6 +214,471 @@ GUI parseGUI(const Gff &gff) {
     return strct;
 }
 
+static GUI_EXTENT parseGUI_EXTENT(const GffView &gff) {
+    GUI_EXTENT strct;
+    static const GffSchema schema {
+        "HEIGHT",
+        "LEFT",
+        "TOP",
+        "WIDTH",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.HEIGHT = field.getInt();
+            break;
+        case 1:
+            strct.LEFT = field.getInt();
+            break;
+        case 2:
+            strct.TOP = field.getInt();
+            break;
+        case 3:
+            strct.WIDTH = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_BORDER parseGUI_BORDER(const GffView &gff) {
+    GUI_BORDER strct;
+    static const GffSchema schema {
+        "COLOR",
+        "CORNER",
+        "DIMENSION",
+        "EDGE",
+        "FILL",
+        "FILLSTYLE",
+        "INNEROFFSET",
+        "INNEROFFSETY",
+        "PULSING",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.COLOR = field.getVector();
+            break;
+        case 1:
+            strct.CORNER = field.getString();
+            break;
+        case 2:
+            strct.DIMENSION = field.getInt();
+            break;
+        case 3:
+            strct.EDGE = field.getString();
+            break;
+        case 4:
+            strct.FILL = field.getString();
+            break;
+        case 5:
+            strct.FILLSTYLE = field.getInt();
+            break;
+        case 6:
+            strct.INNEROFFSET = field.getInt();
+            break;
+        case 7:
+            strct.INNEROFFSETY = field.getInt();
+            break;
+        case 8:
+            strct.PULSING = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_TEXT parseGUI_TEXT(const GffView &gff) {
+    GUI_TEXT strct;
+    static const GffSchema schema {
+        "ALIGNMENT",
+        "COLOR",
+        "FONT",
+        "PULSING",
+        "STRREF",
+        "TEXT",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.ALIGNMENT = field.getInt();
+            break;
+        case 1:
+            strct.COLOR = field.getVector();
+            break;
+        case 2:
+            strct.FONT = field.getString();
+            break;
+        case 3:
+            strct.PULSING = field.getUint();
+            break;
+        case 4:
+            strct.STRREF = field.getUint();
+            break;
+        case 5:
+            strct.TEXT = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_CONTROLS_SCROLLBAR_DIRTHUMB parseGUI_CONTROLS_SCROLLBAR_DIRTHUMB(const GffView &gff) {
+    GUI_CONTROLS_SCROLLBAR_DIRTHUMB strct;
+    static const GffSchema schema {
+        "ALIGNMENT",
+        "DRAWSTYLE",
+        "FLIPSTYLE",
+        "IMAGE",
+        "ROTATE",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.ALIGNMENT = field.getInt();
+            break;
+        case 1:
+            strct.DRAWSTYLE = field.getInt();
+            break;
+        case 2:
+            strct.FLIPSTYLE = field.getInt();
+            break;
+        case 3:
+            strct.IMAGE = field.getString();
+            break;
+        case 4:
+            strct.ROTATE = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_CONTROLS_SCROLLBAR parseGUI_CONTROLS_SCROLLBAR(const GffView &gff) {
+    GUI_CONTROLS_SCROLLBAR strct;
+    static const GffSchema schema {
+        "BORDER",
+        "CONTROLTYPE",
+        "CURVALUE",
+        "DIR",
+        "DRAWMODE",
+        "EXTENT",
+        "MAXVALUE",
+        "Obj_Parent",
+        "Obj_ParentID",
+        "TAG",
+        "THUMB",
+        "VISIBLEVALUE",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            if (auto item = field.getStruct()) {
+                strct.BORDER = parseGUI_BORDER(item);
+            }
+            break;
+        case 1:
+            strct.CONTROLTYPE = field.getInt();
+            break;
+        case 2:
+            strct.CURVALUE = field.getInt();
+            break;
+        case 3:
+            if (auto item = field.getStruct()) {
+                strct.DIR = parseGUI_CONTROLS_SCROLLBAR_DIRTHUMB(item);
+            }
+            break;
+        case 4:
+            strct.DRAWMODE = field.getUint();
+            break;
+        case 5:
+            if (auto item = field.getStruct()) {
+                strct.EXTENT = parseGUI_EXTENT(item);
+            }
+            break;
+        case 6:
+            strct.MAXVALUE = field.getInt();
+            break;
+        case 7:
+            strct.Obj_Parent = field.getString();
+            break;
+        case 8:
+            strct.Obj_ParentID = field.getInt();
+            break;
+        case 9:
+            strct.TAG = field.getString();
+            break;
+        case 10:
+            if (auto item = field.getStruct()) {
+                strct.THUMB = parseGUI_CONTROLS_SCROLLBAR_DIRTHUMB(item);
+            }
+            break;
+        case 11:
+            strct.VISIBLEVALUE = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_CONTROLS_PROTOITEM parseGUI_CONTROLS_PROTOITEM(const GffView &gff) {
+    GUI_CONTROLS_PROTOITEM strct;
+    static const GffSchema schema {
+        "BORDER",
+        "CONTROLTYPE",
+        "EXTENT",
+        "HILIGHT",
+        "HILIGHTSELECTED",
+        "ISSELECTED",
+        "Obj_Parent",
+        "Obj_ParentID",
+        "SELECTED",
+        "TAG",
+        "TEXT",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            if (auto item = field.getStruct()) {
+                strct.BORDER = parseGUI_BORDER(item);
+            }
+            break;
+        case 1:
+            strct.CONTROLTYPE = field.getInt();
+            break;
+        case 2:
+            if (auto item = field.getStruct()) {
+                strct.EXTENT = parseGUI_EXTENT(item);
+            }
+            break;
+        case 3:
+            if (auto item = field.getStruct()) {
+                strct.HILIGHT = parseGUI_BORDER(item);
+            }
+            break;
+        case 4:
+            if (auto item = field.getStruct()) {
+                strct.HILIGHTSELECTED = parseGUI_BORDER(item);
+            }
+            break;
+        case 5:
+            strct.ISSELECTED = field.getUint();
+            break;
+        case 6:
+            strct.Obj_Parent = field.getString();
+            break;
+        case 7:
+            strct.Obj_ParentID = field.getInt();
+            break;
+        case 8:
+            if (auto item = field.getStruct()) {
+                strct.SELECTED = parseGUI_BORDER(item);
+            }
+            break;
+        case 9:
+            strct.TAG = field.getString();
+            break;
+        case 10:
+            if (auto item = field.getStruct()) {
+                strct.TEXT = parseGUI_TEXT(item);
+            }
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_CONTROLS_MOVETO parseGUI_CONTROLS_MOVETO(const GffView &gff) {
+    GUI_CONTROLS_MOVETO strct;
+    static const GffSchema schema {
+        "DOWN",
+        "LEFT",
+        "RIGHT",
+        "UP",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.DOWN = field.getInt();
+            break;
+        case 1:
+            strct.LEFT = field.getInt();
+            break;
+        case 2:
+            strct.RIGHT = field.getInt();
+            break;
+        case 3:
+            strct.UP = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
+static GUI_CONTROLS parseGUI_CONTROLS(const GffView &gff) {
+    GUI_CONTROLS strct;
+    static const GffSchema schema {
+        "BORDER",
+        "COLOR",
+        "CONTROLTYPE",
+        "CURVALUE",
+        "EXTENT",
+        "HILIGHT",
+        "ID",
+        "LEFTSCROLLBAR",
+        "LOOPING",
+        "MAXVALUE",
+        "MOVETO",
+        "Obj_Locked",
+        "Obj_Parent",
+        "Obj_ParentID",
+        "PADDING",
+        "PROGRESS",
+        "PROTOITEM",
+        "SCROLLBAR",
+        "STARTFROMLEFT",
+        "TAG",
+        "TEXT",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            if (auto item = field.getStruct()) {
+                strct.BORDER = parseGUI_BORDER(item);
+            }
+            break;
+        case 1:
+            strct.COLOR = field.getVector();
+            break;
+        case 2:
+            strct.CONTROLTYPE = field.getInt();
+            break;
+        case 3:
+            strct.CURVALUE = field.getInt();
+            break;
+        case 4:
+            if (auto item = field.getStruct()) {
+                strct.EXTENT = parseGUI_EXTENT(item);
+            }
+            break;
+        case 5:
+            if (auto item = field.getStruct()) {
+                strct.HILIGHT = parseGUI_BORDER(item);
+            }
+            break;
+        case 6:
+            strct.ID = field.getInt();
+            break;
+        case 7:
+            strct.LEFTSCROLLBAR = field.getUint();
+            break;
+        case 8:
+            strct.LOOPING = field.getUint();
+            break;
+        case 9:
+            strct.MAXVALUE = field.getInt();
+            break;
+        case 10:
+            if (auto item = field.getStruct()) {
+                strct.MOVETO = parseGUI_CONTROLS_MOVETO(item);
+            }
+            break;
+        case 11:
+            strct.Obj_Locked = field.getUint();
+            break;
+        case 12:
+            strct.Obj_Parent = field.getString();
+            break;
+        case 13:
+            strct.Obj_ParentID = field.getInt();
+            break;
+        case 14:
+            strct.PADDING = field.getInt();
+            break;
+        case 15:
+            if (auto item = field.getStruct()) {
+                strct.PROGRESS = parseGUI_BORDER(item);
+            }
+            break;
+        case 16:
+            if (auto item = field.getStruct()) {
+                strct.PROTOITEM = parseGUI_CONTROLS_PROTOITEM(item);
+            }
+            break;
+        case 17:
+            if (auto item = field.getStruct()) {
+                strct.SCROLLBAR = parseGUI_CONTROLS_SCROLLBAR(item);
+            }
+            break;
+        case 18:
+            strct.STARTFROMLEFT = field.getUint();
+            break;
+        case 19:
+            strct.TAG = field.getString();
+            break;
+        case 20:
+            if (auto item = field.getStruct()) {
+                strct.TEXT = parseGUI_TEXT(item);
+            }
+            break;
+        }
+    });
+    return strct;
+}
+
+GUI parseGUI(const GffView &gff) {
+    GUI strct;
+    static const GffSchema schema {
+        "ALPHA",
+        "BORDER",
+        "COLOR",
+        "CONTROLS",
+        "CONTROLTYPE",
+        "EXTENT",
+        "Obj_Locked",
+        "Obj_ParentID",
+        "TAG",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.ALPHA = field.getFloat();
+            break;
+        case 1:
+            if (auto item = field.getStruct()) {
+                strct.BORDER = parseGUI_BORDER(item);
+            }
+            break;
+        case 2:
+            strct.COLOR = field.getVector();
+            break;
+        case 3:
+            for (auto &item : field.getList()) {
+                strct.CONTROLS.push_back(parseGUI_CONTROLS(item));
+            }
+            break;
+        case 4:
+            strct.CONTROLTYPE = field.getInt();
+            break;
+        case 5:
+            if (auto item = field.getStruct()) {
+                strct.EXTENT = parseGUI_EXTENT(item);
+            }
+            break;
+        case 6:
+            strct.Obj_Locked = field.getUint();
+            break;
+        case 7:
+            strct.Obj_ParentID = field.getInt();
+            break;
+        case 8:
+            strct.TAG = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/ifo.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -78,6 +79,194 @@ IFO parseIFO(const Gff &gff) {
     return strct;
 }
 
+static IFO_Mod_Area_list parseIFO_Mod_Area_list(const GffView &gff) {
+    IFO_Mod_Area_list strct;
+    static const GffSchema schema {
+        "Area_Name",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Area_Name = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+IFO parseIFO(const GffView &gff) {
+    IFO strct;
+    static const GffSchema schema {
+        "Expansion_Pack",
+        "Mod_Area_list",
+        "Mod_Creator_ID",
+        "Mod_DawnHour",
+        "Mod_Description",
+        "Mod_DuskHour",
+        "Mod_Entry_Area",
+        "Mod_Entry_Dir_X",
+        "Mod_Entry_Dir_Y",
+        "Mod_Entry_X",
+        "Mod_Entry_Y",
+        "Mod_Entry_Z",
+        "Mod_Hak",
+        "Mod_ID",
+        "Mod_IsSaveGame",
+        "Mod_MinPerHour",
+        "Mod_Name",
+        "Mod_OnAcquirItem",
+        "Mod_OnActvtItem",
+        "Mod_OnClientEntr",
+        "Mod_OnClientLeav",
+        "Mod_OnHeartbeat",
+        "Mod_OnModLoad",
+        "Mod_OnModStart",
+        "Mod_OnPlrDeath",
+        "Mod_OnPlrDying",
+        "Mod_OnPlrLvlUp",
+        "Mod_OnPlrRest",
+        "Mod_OnSpawnBtnDn",
+        "Mod_OnUnAqreItem",
+        "Mod_OnUsrDefined",
+        "Mod_StartDay",
+        "Mod_StartHour",
+        "Mod_StartMonth",
+        "Mod_StartMovie",
+        "Mod_StartYear",
+        "Mod_Tag",
+        "Mod_VO_ID",
+        "Mod_Version",
+        "Mod_XPScale",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Expansion_Pack = field.getUint();
+            break;
+        case 1:
+            for (auto &item : field.getList()) {
+                strct.Mod_Area_list.push_back(parseIFO_Mod_Area_list(item));
+            }
+            break;
+        case 2:
+            strct.Mod_Creator_ID = field.getInt();
+            break;
+        case 3:
+            strct.Mod_DawnHour = field.getUint();
+            break;
+        case 4:
+            strct.Mod_Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 5:
+            strct.Mod_DuskHour = field.getUint();
+            break;
+        case 6:
+            strct.Mod_Entry_Area = field.getString();
+            break;
+        case 7:
+            strct.Mod_Entry_Dir_X = field.getFloat();
+            break;
+        case 8:
+            strct.Mod_Entry_Dir_Y = field.getFloat();
+            break;
+        case 9:
+            strct.Mod_Entry_X = field.getFloat();
+            break;
+        case 10:
+            strct.Mod_Entry_Y = field.getFloat();
+            break;
+        case 11:
+            strct.Mod_Entry_Z = field.getFloat();
+            break;
+        case 12:
+            strct.Mod_Hak = field.getString();
+            break;
+        case 13:
+            strct.Mod_ID = field.getData();
+            break;
+        case 14:
+            strct.Mod_IsSaveGame = field.getUint();
+            break;
+        case 15:
+            strct.Mod_MinPerHour = field.getUint();
+            break;
+        case 16:
+            strct.Mod_Name = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 17:
+            strct.Mod_OnAcquirItem = field.getString();
+            break;
+        case 18:
+            strct.Mod_OnActvtItem = field.getString();
+            break;
+        case 19:
+            strct.Mod_OnClientEntr = field.getString();
+            break;
+        case 20:
+            strct.Mod_OnClientLeav = field.getString();
+            break;
+        case 21:
+            strct.Mod_OnHeartbeat = field.getString();
+            break;
+        case 22:
+            strct.Mod_OnModLoad = field.getString();
+            break;
+        case 23:
+            strct.Mod_OnModStart = field.getString();
+            break;
+        case 24:
+            strct.Mod_OnPlrDeath = field.getString();
+            break;
+        case 25:
+            strct.Mod_OnPlrDying = field.getString();
+            break;
+        case 26:
+            strct.Mod_OnPlrLvlUp = field.getString();
+            break;
+        case 27:
+            strct.Mod_OnPlrRest = field.getString();
+            break;
+        case 28:
+            strct.Mod_OnSpawnBtnDn = field.getString();
+            break;
+        case 29:
+            strct.Mod_OnUnAqreItem = field.getString();
+            break;
+        case 30:
+            strct.Mod_OnUsrDefined = field.getString();
+            break;
+        case 31:
+            strct.Mod_StartDay = field.getUint();
+            break;
+        case 32:
+            strct.Mod_StartHour = field.getUint();
+            break;
+        case 33:
+            strct.Mod_StartMonth = field.getUint();
+            break;
+        case 34:
+            strct.Mod_StartMovie = field.getString();
+            break;
+        case 35:
+            strct.Mod_StartYear = field.getUint();
+            break;
+        case 36:
+            strct.Mod_Tag = field.getString();
+            break;
+        case 37:
+            strct.Mod_VO_ID = field.getString();
+            break;
+        case 38:
+            strct.Mod_Version = field.getUint();
+            break;
+        case 39:
+            strct.Mod_XPScale = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/pth.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -51,6 +52,71 @@ PTH parsePTH(const Gff &gff) {
     return strct;
 }
 
+static PTH_Path_Points parsePTH_Path_Points(const GffView &gff) {
+    PTH_Path_Points strct;
+    static const GffSchema schema {
+        "Conections",
+        "First_Conection",
+        "X",
+        "Y",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Conections = field.getUint();
+            break;
+        case 1:
+            strct.First_Conection = field.getUint();
+            break;
+        case 2:
+            strct.X = field.getFloat();
+            break;
+        case 3:
+            strct.Y = field.getFloat();
+            break;
+        }
+    });
+    return strct;
+}
+
+static PTH_Path_Conections parsePTH_Path_Conections(const GffView &gff) {
+    PTH_Path_Conections strct;
+    static const GffSchema schema {
+        "Destination",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Destination = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+PTH parsePTH(const GffView &gff) {
+    PTH strct;
+    static const GffSchema schema {
+        "Path_Conections",
+        "Path_Points",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            for (auto &item : field.getList()) {
+                strct.Path_Conections.push_back(parsePTH_Path_Conections(item));
+            }
+            break;
+        case 1:
+            for (auto &item : field.getList()) {
+                strct.Path_Points.push_back(parsePTH_Path_Points(item));
+            }
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
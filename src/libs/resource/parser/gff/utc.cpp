@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/utc.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -170,6 +171,472 @@ UTC parseUTC(const Gff &gff) {
     return strct;
 }
 
+static UTC_ClassList_KnownList0 parseUTC_ClassList_KnownList0(const GffView &gff) {
+    UTC_ClassList_KnownList0 strct;
+    static const GffSchema schema {
+        "Spell",
+        "SpellFlags",
+        "SpellMetaMagic",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Spell = field.getUint();
+            break;
+        case 1:
+            strct.SpellFlags = field.getUint();
+            break;
+        case 2:
+            strct.SpellMetaMagic = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_SpecAbilityList parseUTC_SpecAbilityList(const GffView &gff) {
+    UTC_SpecAbilityList strct;
+    static const GffSchema schema {
+        "Spell",
+        "SpellCasterLevel",
+        "SpellFlags",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Spell = field.getUint();
+            break;
+        case 1:
+            strct.SpellCasterLevel = field.getUint();
+            break;
+        case 2:
+            strct.SpellFlags = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_SkillList parseUTC_SkillList(const GffView &gff) {
+    UTC_SkillList strct;
+    static const GffSchema schema {
+        "Rank",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Rank = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_ItemList parseUTC_ItemList(const GffView &gff) {
+    UTC_ItemList strct;
+    static const GffSchema schema {
+        "Dropable",
+        "InventoryRes",
+        "Repos_PosX",
+        "Repos_Posy",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Dropable = field.getUint();
+            break;
+        case 1:
+            strct.InventoryRes = field.getString();
+            break;
+        case 2:
+            strct.Repos_PosX = field.getUint();
+            break;
+        case 3:
+            strct.Repos_Posy = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_FeatList parseUTC_FeatList(const GffView &gff) {
+    UTC_FeatList strct;
+    static const GffSchema schema {
+        "Feat",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Feat = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_Equip_ItemList parseUTC_Equip_ItemList(const GffView &gff) {
+    UTC_Equip_ItemList strct;
+    static const GffSchema schema {
+        "Dropable",
+        "EquippedRes",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Dropable = field.getUint();
+            break;
+        case 1:
+            strct.EquippedRes = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_ClassList parseUTC_ClassList(const GffView &gff) {
+    UTC_ClassList strct;
+    static const GffSchema schema {
+        "Class",
+        "ClassLevel",
+        "KnownList0",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Class = field.getInt();
+            break;
+        case 1:
+            strct.ClassLevel = field.getInt();
+            break;
+        case 2:
+            for (auto &item : field.getList()) {
+                strct.KnownList0.push_back(parseUTC_ClassList_KnownList0(item));
+            }
+            break;
+        }
+    });
+    return strct;
+}
+
+UTC parseUTC(const GffView &gff) {
+    UTC strct;
+    static const GffSchema schema {
+        "Appearance_Type",
+        "BlindSpot",
+        "BodyBag",
+        "BodyVariation",
+        "Cha",
+        "ChallengeRating",
+        "ClassList",
+        "Comment",
+        "Con",
+        "Conversation",
+        "CurrentForce",
+        "CurrentHitPoints",
+        "Deity",
+        "Description",
+        "Dex",
+        "Disarmable",
+        "Equip_ItemList",
+        "FactionID",
+        "FeatList",
+        "FirstName",
+        "ForcePoints",
+        "Gender",
+        "GoodEvil",
+        "HitPoints",
+        "Hologram",
+        "IgnoreCrePath",
+        "Int",
+        "Interruptable",
+        "IsPC",
+        "ItemList",
+        "LastName",
+        "LawfulChaotic",
+        "MaxHitPoints",
+        "Min1HP",
+        "MultiplierSet",
+        "NaturalAC",
+        "NoPermDeath",
+        "NotReorienting",
+        "PaletteID",
+        "PartyInteract",
+        "PerceptionRange",
+        "Phenotype",
+        "Plot",
+        "PortraitId",
+        "Race",
+        "ScriptAttacked",
+        "ScriptDamaged",
+        "ScriptDeath",
+        "ScriptDialogue",
+        "ScriptDisturbed",
+        "ScriptEndDialogu",
+        "ScriptEndRound",
+        "ScriptHeartbeat",
+        "ScriptOnBlocked",
+        "ScriptOnNotice",
+        "ScriptRested",
+        "ScriptSpawn",
+        "ScriptSpellAt",
+        "ScriptUserDefine",
+        "SkillList",
+        "SoundSetFile",
+        "SpecAbilityList",
+        "Str",
+        "Subrace",
+        "SubraceIndex",
+        "Tag",
+        "TemplateResRef",
+        "TextureVar",
+        "WalkRate",
+        "WillNotRender",
+        "Wis",
+        "fortbonus",
+        "refbonus",
+        "willbonus",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Appearance_Type = field.getUint();
+            break;
+        case 1:
+            strct.BlindSpot = field.getFloat();
+            break;
+        case 2:
+            strct.BodyBag = field.getUint();
+            break;
+        case 3:
+            strct.BodyVariation = field.getUint();
+            break;
+        case 4:
+            strct.Cha = field.getUint();
+            break;
+        case 5:
+            strct.ChallengeRating = field.getFloat();
+            break;
+        case 6:
+            for (auto &item : field.getList()) {
+                strct.ClassList.push_back(parseUTC_ClassList(item));
+            }
+            break;
+        case 7:
+            strct.Comment = field.getString();
+            break;
+        case 8:
+            strct.Con = field.getUint();
+            break;
+        case 9:
+            strct.Conversation = field.getString();
+            break;
+        case 10:
+            strct.CurrentForce = field.getInt();
+            break;
+        case 11:
+            strct.CurrentHitPoints = field.getInt();
+            break;
+        case 12:
+            strct.Deity = field.getString();
+            break;
+        case 13:
+            strct.Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 14:
+            strct.Dex = field.getUint();
+            break;
+        case 15:
+            strct.Disarmable = field.getUint();
+            break;
+        case 16:
+            for (auto &item : field.getList()) {
+                strct.Equip_ItemList.push_back(parseUTC_Equip_ItemList(item));
+            }
+            break;
+        case 17:
+            strct.FactionID = field.getUint();
+            break;
+        case 18:
+            for (auto &item : field.getList()) {
+                strct.FeatList.push_back(parseUTC_FeatList(item));
+            }
+            break;
+        case 19:
+            strct.FirstName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 20:
+            strct.ForcePoints = field.getInt();
+            break;
+        case 21:
+            strct.Gender = field.getUint();
+            break;
+        case 22:
+            strct.GoodEvil = field.getUint();
+            break;
+        case 23:
+            strct.HitPoints = field.getInt();
+            break;
+        case 24:
+            strct.Hologram = field.getUint();
+            break;
+        case 25:
+            strct.IgnoreCrePath = field.getUint();
+            break;
+        case 26:
+            strct.Int = field.getUint();
+            break;
+        case 27:
+            strct.Interruptable = field.getUint();
+            break;
+        case 28:
+            strct.IsPC = field.getUint();
+            break;
+        case 29:
+            for (auto &item : field.getList()) {
+                strct.ItemList.push_back(parseUTC_ItemList(item));
+            }
+            break;
+        case 30:
+            strct.LastName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 31:
+            strct.LawfulChaotic = field.getUint();
+            break;
+        case 32:
+            strct.MaxHitPoints = field.getInt();
+            break;
+        case 33:
+            strct.Min1HP = field.getUint();
+            break;
+        case 34:
+            strct.MultiplierSet = field.getUint();
+            break;
+        case 35:
+            strct.NaturalAC = field.getUint();
+            break;
+        case 36:
+            strct.NoPermDeath = field.getUint();
+            break;
+        case 37:
+            strct.NotReorienting = field.getUint();
+            break;
+        case 38:
+            strct.PaletteID = field.getUint();
+            break;
+        case 39:
+            strct.PartyInteract = field.getUint();
+            break;
+        case 40:
+            strct.PerceptionRange = field.getUint();
+            break;
+        case 41:
+            strct.Phenotype = field.getInt();
+            break;
+        case 42:
+            strct.Plot = field.getUint();
+            break;
+        case 43:
+            strct.PortraitId = field.getUint();
+            break;
+        case 44:
+            strct.Race = field.getUint();
+            break;
+        case 45:
+            strct.ScriptAttacked = field.getString();
+            break;
+        case 46:
+            strct.ScriptDamaged = field.getString();
+            break;
+        case 47:
+            strct.ScriptDeath = field.getString();
+            break;
+        case 48:
+            strct.ScriptDialogue = field.getString();
+            break;
+        case 49:
+            strct.ScriptDisturbed = field.getString();
+            break;
+        case 50:
+            strct.ScriptEndDialogu = field.getString();
+            break;
+        case 51:
+            strct.ScriptEndRound = field.getString();
+            break;
+        case 52:
+            strct.ScriptHeartbeat = field.getString();
+            break;
+        case 53:
+            strct.ScriptOnBlocked = field.getString();
+            break;
+        case 54:
+            strct.ScriptOnNotice = field.getString();
+            break;
+        case 55:
+            strct.ScriptRested = field.getString();
+            break;
+        case 56:
+            strct.ScriptSpawn = field.getString();
+            break;
+        case 57:
+            strct.ScriptSpellAt = field.getString();
+            break;
+        case 58:
+            strct.ScriptUserDefine = field.getString();
+            break;
+        case 59:
+            for (auto &item : field.getList()) {
+                strct.SkillList.push_back(parseUTC_SkillList(item));
+            }
+            break;
+        case 60:
+            strct.SoundSetFile = field.getUint();
+            break;
+        case 61:
+            for (auto &item : field.getList()) {
+                strct.SpecAbilityList.push_back(parseUTC_SpecAbilityList(item));
+            }
+            break;
+        case 62:
+            strct.Str = field.getUint();
+            break;
+        case 63:
+            strct.Subrace = field.getString();
+            break;
+        case 64:
+            strct.SubraceIndex = field.getUint();
+            break;
+        case 65:
+            strct.Tag = field.getString();
+            break;
+        case 66:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 67:
+            strct.TextureVar = field.getUint();
+            break;
+        case 68:
+            strct.WalkRate = field.getInt();
+            break;
+        case 69:
+            strct.WillNotRender = field.getUint();
+            break;
+        case 70:
+            strct.Wis = field.getUint();
+            break;
+        case 71:
+            strct.fortbonus = field.getInt();
+            break;
+        case 72:
+            strct.refbonus = field.getInt();
+            break;
+        case 73:
+            strct.willbonus = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
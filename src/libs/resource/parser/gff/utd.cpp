@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/utd.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -88,6 +89,249 @@ UTD parseUTD(const Gff &gff) {
     return strct;
 }
 
+UTD parseUTD(const GffView &gff) {
+    UTD strct;
+    static const GffSchema schema {
+        "AnimationState",
+        "Appearance",
+        "AutoRemoveKey",
+        "CloseLockDC",
+        "Comment",
+        "Conversation",
+        "CurrentHP",
+        "Description",
+        "DisarmDC",
+        "Faction",
+        "Fort",
+        "GenericType",
+        "HP",
+        "Hardness",
+        "Interruptable",
+        "KeyName",
+        "KeyRequired",
+        "LinkedTo",
+        "LinkedToFlags",
+        "LoadScreenID",
+        "LocName",
+        "Lockable",
+        "Locked",
+        "Min1HP",
+        "NotBlastable",
+        "OnClick",
+        "OnClosed",
+        "OnDamaged",
+        "OnDeath",
+        "OnDisarm",
+        "OnFailToOpen",
+        "OnHeartbeat",
+        "OnLock",
+        "OnMeleeAttacked",
+        "OnOpen",
+        "OnSpellCastAt",
+        "OnTrapTriggered",
+        "OnUnlock",
+        "OnUserDefined",
+        "OpenLockDC",
+        "OpenLockDiff",
+        "OpenLockDiffMod",
+        "OpenState",
+        "PaletteID",
+        "Plot",
+        "Portrait",
+        "PortraitId",
+        "Ref",
+        "Static",
+        "Tag",
+        "TemplateResRef",
+        "TrapDetectDC",
+        "TrapDetectable",
+        "TrapDisarmable",
+        "TrapFlag",
+        "TrapOneShot",
+        "TrapType",
+        "Will",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AnimationState = field.getUint();
+            break;
+        case 1:
+            strct.Appearance = field.getUint();
+            break;
+        case 2:
+            strct.AutoRemoveKey = field.getUint();
+            break;
+        case 3:
+            strct.CloseLockDC = field.getUint();
+            break;
+        case 4:
+            strct.Comment = field.getString();
+            break;
+        case 5:
+            strct.Conversation = field.getString();
+            break;
+        case 6:
+            strct.CurrentHP = field.getInt();
+            break;
+        case 7:
+            strct.Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 8:
+            strct.DisarmDC = field.getUint();
+            break;
+        case 9:
+            strct.Faction = field.getUint();
+            break;
+        case 10:
+            strct.Fort = field.getUint();
+            break;
+        case 11:
+            strct.GenericType = field.getUint();
+            break;
+        case 12:
+            strct.HP = field.getInt();
+            break;
+        case 13:
+            strct.Hardness = field.getUint();
+            break;
+        case 14:
+            strct.Interruptable = field.getUint();
+            break;
+        case 15:
+            strct.KeyName = field.getString();
+            break;
+        case 16:
+            strct.KeyRequired = field.getUint();
+            break;
+        case 17:
+            strct.LinkedTo = field.getString();
+            break;
+        case 18:
+            strct.LinkedToFlags = field.getUint();
+            break;
+        case 19:
+            strct.LoadScreenID = field.getUint();
+            break;
+        case 20:
+            strct.LocName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 21:
+            strct.Lockable = field.getUint();
+            break;
+        case 22:
+            strct.Locked = field.getUint();
+            break;
+        case 23:
+            strct.Min1HP = field.getUint();
+            break;
+        case 24:
+            strct.NotBlastable = field.getUint();
+            break;
+        case 25:
+            strct.OnClick = field.getString();
+            break;
+        case 26:
+            strct.OnClosed = field.getString();
+            break;
+        case 27:
+            strct.OnDamaged = field.getString();
+            break;
+        case 28:
+            strct.OnDeath = field.getString();
+            break;
+        case 29:
+            strct.OnDisarm = field.getString();
+            break;
+        case 30:
+            strct.OnFailToOpen = field.getString();
+            break;
+        case 31:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 32:
+            strct.OnLock = field.getString();
+            break;
+        case 33:
+            strct.OnMeleeAttacked = field.getString();
+            break;
+        case 34:
+            strct.OnOpen = field.getString();
+            break;
+        case 35:
+            strct.OnSpellCastAt = field.getString();
+            break;
+        case 36:
+            strct.OnTrapTriggered = field.getString();
+            break;
+        case 37:
+            strct.OnUnlock = field.getString();
+            break;
+        case 38:
+            strct.OnUserDefined = field.getString();
+            break;
+        case 39:
+            strct.OpenLockDC = field.getUint();
+            break;
+        case 40:
+            strct.OpenLockDiff = field.getUint();
+            break;
+        case 41:
+            strct.OpenLockDiffMod = field.getInt();
+            break;
+        case 42:
+            strct.OpenState = field.getUint();
+            break;
+        case 43:
+            strct.PaletteID = field.getUint();
+            break;
+        case 44:
+            strct.Plot = field.getUint();
+            break;
+        case 45:
+            strct.Portrait = field.getString();
+            break;
+        case 46:
+            strct.PortraitId = field.getUint();
+            break;
+        case 47:
+            strct.Ref = field.getUint();
+            break;
+        case 48:
+            strct.Static = field.getUint();
+            break;
+        case 49:
+            strct.Tag = field.getString();
+            break;
+        case 50:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 51:
+            strct.TrapDetectDC = field.getUint();
+            break;
+        case 52:
+            strct.TrapDetectable = field.getUint();
+            break;
+        case 53:
+            strct.TrapDisarmable = field.getUint();
+            break;
+        case 54:
+            strct.TrapFlag = field.getUint();
+            break;
+        case 55:
+            strct.TrapOneShot = field.getUint();
+            break;
+        case 56:
+            strct.TrapType = field.getUint();
+            break;
+        case 57:
+            strct.Will = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/ute.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -64,6 +65,138 @@ UTE parseUTE(const Gff &gff) {
     return strct;
 }
 
+static UTE_CreatureList parseUTE_CreatureList(const GffView &gff) {
+    UTE_CreatureList strct;
+    static const GffSchema schema {
+        "Appearance",
+        "CR",
+        "GuaranteedCount",
+        "ResRef",
+        "SingleSpawn",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Appearance = field.getInt();
+            break;
+        case 1:
+            strct.CR = field.getFloat();
+            break;
+        case 2:
+            strct.GuaranteedCount = field.getInt();
+            break;
+        case 3:
+            strct.ResRef = field.getString();
+            break;
+        case 4:
+            strct.SingleSpawn = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+UTE parseUTE(const GffView &gff) {
+    UTE strct;
+    static const GffSchema schema {
+        "Active",
+        "Comment",
+        "CreatureList",
+        "Difficulty",
+        "DifficultyIndex",
+        "Faction",
+        "LocalizedName",
+        "MaxCreatures",
+        "OnEntered",
+        "OnExhausted",
+        "OnExit",
+        "OnHeartbeat",
+        "OnUserDefined",
+        "PaletteID",
+        "PlayerOnly",
+        "RecCreatures",
+        "Reset",
+        "ResetTime",
+        "Respawns",
+        "SpawnOption",
+        "Tag",
+        "TemplateResRef",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Active = field.getUint();
+            break;
+        case 1:
+            strct.Comment = field.getString();
+            break;
+        case 2:
+            for (auto &item : field.getList()) {
+                strct.CreatureList.push_back(parseUTE_CreatureList(item));
+            }
+            break;
+        case 3:
+            strct.Difficulty = field.getInt();
+            break;
+        case 4:
+            strct.DifficultyIndex = field.getInt();
+            break;
+        case 5:
+            strct.Faction = field.getUint();
+            break;
+        case 6:
+            strct.LocalizedName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 7:
+            strct.MaxCreatures = field.getInt();
+            break;
+        case 8:
+            strct.OnEntered = field.getString();
+            break;
+        case 9:
+            strct.OnExhausted = field.getString();
+            break;
+        case 10:
+            strct.OnExit = field.getString();
+            break;
+        case 11:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 12:
+            strct.OnUserDefined = field.getString();
+            break;
+        case 13:
+            strct.PaletteID = field.getUint();
+            break;
+        case 14:
+            strct.PlayerOnly = field.getUint();
+            break;
+        case 15:
+            strct.RecCreatures = field.getInt();
+            break;
+        case 16:
+            strct.Reset = field.getUint();
+            break;
+        case 17:
+            strct.ResetTime = field.getInt();
+            break;
+        case 18:
+            strct.Respawns = field.getInt();
+            break;
+        case 19:
+            strct.SpawnOption = field.getInt();
+            break;
+        case 20:
+            strct.Tag = field.getString();
+            break;
+        case 21:
+            strct.TemplateResRef = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
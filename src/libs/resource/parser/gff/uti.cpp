@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/uti.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -65,6 +66,142 @@ UTI parseUTI(const Gff &gff) {
     return strct;
 }
 
+static UTI_PropertiesList parseUTI_PropertiesList(const GffView &gff) {
+    UTI_PropertiesList strct;
+    static const GffSchema schema {
+        "ChanceAppear",
+        "CostTable",
+        "CostValue",
+        "Param1",
+        "Param1Value",
+        "PropertyName",
+        "Subtype",
+        "UpgradeType",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.ChanceAppear = field.getUint();
+            break;
+        case 1:
+            strct.CostTable = field.getUint();
+            break;
+        case 2:
+            strct.CostValue = field.getUint();
+            break;
+        case 3:
+            strct.Param1 = field.getUint();
+            break;
+        case 4:
+            strct.Param1Value = field.getUint();
+            break;
+        case 5:
+            strct.PropertyName = field.getUint();
+            break;
+        case 6:
+            strct.Subtype = field.getUint();
+            break;
+        case 7:
+            strct.UpgradeType = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+UTI parseUTI(const GffView &gff) {
+    UTI strct;
+    static const GffSchema schema {
+        "AddCost",
+        "BaseItem",
+        "BodyVariation",
+        "Charges",
+        "Comment",
+        "Cost",
+        "DescIdentified",
+        "Description",
+        "Identified",
+        "LocalizedName",
+        "ModelVariation",
+        "PaletteID",
+        "Plot",
+        "PropertiesList",
+        "StackSize",
+        "Stolen",
+        "Tag",
+        "TemplateResRef",
+        "TextureVar",
+        "UpgradeLevel",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AddCost = field.getUint();
+            break;
+        case 1:
+            strct.BaseItem = field.getInt();
+            break;
+        case 2:
+            strct.BodyVariation = field.getUint();
+            break;
+        case 3:
+            strct.Charges = field.getUint();
+            break;
+        case 4:
+            strct.Comment = field.getString();
+            break;
+        case 5:
+            strct.Cost = field.getUint();
+            break;
+        case 6:
+            strct.DescIdentified = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 7:
+            strct.Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 8:
+            strct.Identified = field.getUint();
+            break;
+        case 9:
+            strct.LocalizedName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 10:
+            strct.ModelVariation = field.getUint();
+            break;
+        case 11:
+            strct.PaletteID = field.getUint();
+            break;
+        case 12:
+            strct.Plot = field.getUint();
+            break;
+        case 13:
+            for (auto &item : field.getList()) {
+                strct.PropertiesList.push_back(parseUTI_PropertiesList(item));
+            }
+            break;
+        case 14:
+            strct.StackSize = field.getUint();
+            break;
+        case 15:
+            strct.Stolen = field.getUint();
+            break;
+        case 16:
+            strct.Tag = field.getString();
+            break;
+        case 17:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 18:
+            strct.TextureVar = field.getUint();
+            break;
+        case 19:
+            strct.UpgradeLevel = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
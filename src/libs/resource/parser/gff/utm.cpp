@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/utm.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -51,6 +52,86 @@ UTM parseUTM(const Gff &gff) {
     return strct;
 }
 
+static UTM_ItemList parseUTM_ItemList(const GffView &gff) {
+    UTM_ItemList strct;
+    static const GffSchema schema {
+        "Infinite",
+        "InventoryRes",
+        "Repos_PosX",
+        "Repos_Posy",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Infinite = field.getUint();
+            break;
+        case 1:
+            strct.InventoryRes = field.getString();
+            break;
+        case 2:
+            strct.Repos_PosX = field.getUint();
+            break;
+        case 3:
+            strct.Repos_Posy = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+UTM parseUTM(const GffView &gff) {
+    UTM strct;
+    static const GffSchema schema {
+        "BuySellFlag",
+        "Comment",
+        "ID",
+        "ItemList",
+        "LocName",
+        "MarkDown",
+        "MarkUp",
+        "OnOpenStore",
+        "ResRef",
+        "Tag",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.BuySellFlag = field.getUint();
+            break;
+        case 1:
+            strct.Comment = field.getString();
+            break;
+        case 2:
+            strct.ID = field.getUint();
+            break;
+        case 3:
+            for (auto &item : field.getList()) {
+                strct.ItemList.push_back(parseUTM_ItemList(item));
+            }
+            break;
+        case 4:
+            strct.LocName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 5:
+            strct.MarkDown = field.getInt();
+            break;
+        case 6:
+            strct.MarkUp = field.getInt();
+            break;
+        case 7:
+            strct.OnOpenStore = field.getString();
+            break;
+        case 8:
+            strct.ResRef = field.getString();
+            break;
+        case 9:
+            strct.Tag = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
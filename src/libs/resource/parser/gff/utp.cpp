@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/utp.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -102,6 +103,290 @@ UTP parseUTP(const Gff &gff) {
     return strct;
 }
 
+static UTP_ItemList parseUTP_ItemList(const GffView &gff) {
+    UTP_ItemList strct;
+    static const GffSchema schema {
+        "InventoryRes",
+        "Repos_PosX",
+        "Repos_Posy",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.InventoryRes = field.getString();
+            break;
+        case 1:
+            strct.Repos_PosX = field.getUint();
+            break;
+        case 2:
+            strct.Repos_Posy = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
+UTP parseUTP(const GffView &gff) {
+    UTP strct;
+    static const GffSchema schema {
+        "AnimationState",
+        "Appearance",
+        "AutoRemoveKey",
+        "BodyBag",
+        "CloseLockDC",
+        "Comment",
+        "Conversation",
+        "CurrentHP",
+        "Description",
+        "DisarmDC",
+        "Faction",
+        "Fort",
+        "HP",
+        "Hardness",
+        "HasInventory",
+        "Interruptable",
+        "IsComputer",
+        "ItemList",
+        "KeyName",
+        "KeyRequired",
+        "LocName",
+        "Lockable",
+        "Locked",
+        "Min1HP",
+        "NotBlastable",
+        "OnClosed",
+        "OnDamaged",
+        "OnDeath",
+        "OnDisarm",
+        "OnEndDialogue",
+        "OnFailToOpen",
+        "OnHeartbeat",
+        "OnInvDisturbed",
+        "OnLock",
+        "OnMeleeAttacked",
+        "OnOpen",
+        "OnSpellCastAt",
+        "OnTrapTriggered",
+        "OnUnlock",
+        "OnUsed",
+        "OnUserDefined",
+        "OpenLockDC",
+        "OpenLockDiff",
+        "OpenLockDiffMod",
+        "PaletteID",
+        "PartyInteract",
+        "Plot",
+        "Portrait",
+        "PortraitId",
+        "Ref",
+        "Static",
+        "Tag",
+        "TemplateResRef",
+        "TrapDetectDC",
+        "TrapDetectable",
+        "TrapDisarmable",
+        "TrapFlag",
+        "TrapOneShot",
+        "TrapType",
+        "Type",
+        "Useable",
+        "Will",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AnimationState = field.getUint();
+            break;
+        case 1:
+            strct.Appearance = field.getUint();
+            break;
+        case 2:
+            strct.AutoRemoveKey = field.getUint();
+            break;
+        case 3:
+            strct.BodyBag = field.getUint();
+            break;
+        case 4:
+            strct.CloseLockDC = field.getUint();
+            break;
+        case 5:
+            strct.Comment = field.getString();
+            break;
+        case 6:
+            strct.Conversation = field.getString();
+            break;
+        case 7:
+            strct.CurrentHP = field.getInt();
+            break;
+        case 8:
+            strct.Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 9:
+            strct.DisarmDC = field.getUint();
+            break;
+        case 10:
+            strct.Faction = field.getUint();
+            break;
+        case 11:
+            strct.Fort = field.getUint();
+            break;
+        case 12:
+            strct.HP = field.getInt();
+            break;
+        case 13:
+            strct.Hardness = field.getUint();
+            break;
+        case 14:
+            strct.HasInventory = field.getUint();
+            break;
+        case 15:
+            strct.Interruptable = field.getUint();
+            break;
+        case 16:
+            strct.IsComputer = field.getUint();
+            break;
+        case 17:
+            for (auto &item : field.getList()) {
+                strct.ItemList.push_back(parseUTP_ItemList(item));
+            }
+            break;
+        case 18:
+            strct.KeyName = field.getString();
+            break;
+        case 19:
+            strct.KeyRequired = field.getUint();
+            break;
+        case 20:
+            strct.LocName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 21:
+            strct.Lockable = field.getUint();
+            break;
+        case 22:
+            strct.Locked = field.getUint();
+            break;
+        case 23:
+            strct.Min1HP = field.getUint();
+            break;
+        case 24:
+            strct.NotBlastable = field.getUint();
+            break;
+        case 25:
+            strct.OnClosed = field.getString();
+            break;
+        case 26:
+            strct.OnDamaged = field.getString();
+            break;
+        case 27:
+            strct.OnDeath = field.getString();
+            break;
+        case 28:
+            strct.OnDisarm = field.getString();
+            break;
+        case 29:
+            strct.OnEndDialogue = field.getString();
+            break;
+        case 30:
+            strct.OnFailToOpen = field.getString();
+            break;
+        case 31:
+            strct.OnHeartbeat = field.getString();
+            break;
+        case 32:
+            strct.OnInvDisturbed = field.getString();
+            break;
+        case 33:
+            strct.OnLock = field.getString();
+            break;
+        case 34:
+            strct.OnMeleeAttacked = field.getString();
+            break;
+        case 35:
+            strct.OnOpen = field.getString();
+            break;
+        case 36:
+            strct.OnSpellCastAt = field.getString();
+            break;
+        case 37:
+            strct.OnTrapTriggered = field.getString();
+            break;
+        case 38:
+            strct.OnUnlock = field.getString();
+            break;
+        case 39:
+            strct.OnUsed = field.getString();
+            break;
+        case 40:
+            strct.OnUserDefined = field.getString();
+            break;
+        case 41:
+            strct.OpenLockDC = field.getUint();
+            break;
+        case 42:
+            strct.OpenLockDiff = field.getUint();
+            break;
+        case 43:
+            strct.OpenLockDiffMod = field.getInt();
+            break;
+        case 44:
+            strct.PaletteID = field.getUint();
+            break;
+        case 45:
+            strct.PartyInteract = field.getUint();
+            break;
+        case 46:
+            strct.Plot = field.getUint();
+            break;
+        case 47:
+            strct.Portrait = field.getString();
+            break;
+        case 48:
+            strct.PortraitId = field.getUint();
+            break;
+        case 49:
+            strct.Ref = field.getUint();
+            break;
+        case 50:
+            strct.Static = field.getUint();
+            break;
+        case 51:
+            strct.Tag = field.getString();
+            break;
+        case 52:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 53:
+            strct.TrapDetectDC = field.getUint();
+            break;
+        case 54:
+            strct.TrapDetectable = field.getUint();
+            break;
+        case 55:
+            strct.TrapDisarmable = field.getUint();
+            break;
+        case 56:
+            strct.TrapFlag = field.getUint();
+            break;
+        case 57:
+            strct.TrapOneShot = field.getUint();
+            break;
+        case 58:
+            strct.TrapType = field.getUint();
+            break;
+        case 59:
+            strct.Type = field.getUint();
+            break;
+        case 60:
+            strct.Useable = field.getUint();
+            break;
+        case 61:
+            strct.Will = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
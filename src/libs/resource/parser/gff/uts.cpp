@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/uts.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -63,6 +64,134 @@ UTS parseUTS(const Gff &gff) {
     return strct;
 }
 
+static UTS_Sounds parseUTS_Sounds(const GffView &gff) {
+    UTS_Sounds strct;
+    static const GffSchema schema {
+        "Sound",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Sound = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
+UTS parseUTS(const GffView &gff) {
+    UTS strct;
+    static const GffSchema schema {
+        "Active",
+        "Comment",
+        "Continuous",
+        "Elevation",
+        "Hours",
+        "Interval",
+        "IntervalVrtn",
+        "LocName",
+        "Looping",
+        "MaxDistance",
+        "MinDistance",
+        "PaletteID",
+        "PitchVariation",
+        "Positional",
+        "Priority",
+        "Random",
+        "RandomPosition",
+        "RandomRangeX",
+        "RandomRangeY",
+        "Sounds",
+        "Tag",
+        "TemplateResRef",
+        "Times",
+        "Volume",
+        "VolumeVrtn",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Active = field.getUint();
+            break;
+        case 1:
+            strct.Comment = field.getString();
+            break;
+        case 2:
+            strct.Continuous = field.getUint();
+            break;
+        case 3:
+            strct.Elevation = field.getFloat();
+            break;
+        case 4:
+            strct.Hours = field.getUint();
+            break;
+        case 5:
+            strct.Interval = field.getUint();
+            break;
+        case 6:
+            strct.IntervalVrtn = field.getUint();
+            break;
+        case 7:
+            strct.LocName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 8:
+            strct.Looping = field.getUint();
+            break;
+        case 9:
+            strct.MaxDistance = field.getFloat();
+            break;
+        case 10:
+            strct.MinDistance = field.getFloat();
+            break;
+        case 11:
+            strct.PaletteID = field.getUint();
+            break;
+        case 12:
+            strct.PitchVariation = field.getFloat();
+            break;
+        case 13:
+            strct.Positional = field.getUint();
+            break;
+        case 14:
+            strct.Priority = field.getUint();
+            break;
+        case 15:
+            strct.Random = field.getUint();
+            break;
+        case 16:
+            strct.RandomPosition = field.getUint();
+            break;
+        case 17:
+            strct.RandomRangeX = field.getFloat();
+            break;
+        case 18:
+            strct.RandomRangeY = field.getFloat();
+            break;
+        case 19:
+            for (auto &item : field.getList()) {
+                strct.Sounds.push_back(parseUTS_Sounds(item));
+            }
+            break;
+        case 20:
+            strct.Tag = field.getString();
+            break;
+        case 21:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 22:
+            strct.Times = field.getUint();
+            break;
+        case 23:
+            strct.Volume = field.getUint();
+            break;
+        case 24:
+            strct.VolumeVrtn = field.getUint();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
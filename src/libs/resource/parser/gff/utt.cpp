@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/utt.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -61,6 +62,141 @@ UTT parseUTT(const Gff &gff) {
     return strct;
 }
 
+UTT parseUTT(const GffView &gff) {
+    UTT strct;
+    static const GffSchema schema {
+        "AutoRemoveKey",
+        "Comment",
+        "Cursor",
+        "DisarmDC",
+        "Faction",
+        "HighlightHeight",
+        "KeyName",
+        "LinkedTo",
+        "LinkedToFlags",
+        "LoadScreenID",
+        "LocalizedName",
+        "OnClick",
+        "OnDisarm",
+        "OnTrapTriggered",
+        "PaletteID",
+        "PartyRequired",
+        "Portrait",
+        "PortraitId",
+        "ScriptHeartbeat",
+        "ScriptOnEnter",
+        "ScriptOnExit",
+        "ScriptUserDefine",
+        "Tag",
+        "TemplateResRef",
+        "TrapDetectDC",
+        "TrapDetectable",
+        "TrapDisarmable",
+        "TrapFlag",
+        "TrapOneShot",
+        "TrapType",
+        "Type",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.AutoRemoveKey = field.getUint();
+            break;
+        case 1:
+            strct.Comment = field.getString();
+            break;
+        case 2:
+            strct.Cursor = field.getUint();
+            break;
+        case 3:
+            strct.DisarmDC = field.getUint();
+            break;
+        case 4:
+            strct.Faction = field.getUint();
+            break;
+        case 5:
+            strct.HighlightHeight = field.getFloat();
+            break;
+        case 6:
+            strct.KeyName = field.getString();
+            break;
+        case 7:
+            strct.LinkedTo = field.getString();
+            break;
+        case 8:
+            strct.LinkedToFlags = field.getUint();
+            break;
+        case 9:
+            strct.LoadScreenID = field.getUint();
+            break;
+        case 10:
+            strct.LocalizedName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 11:
+            strct.OnClick = field.getString();
+            break;
+        case 12:
+            strct.OnDisarm = field.getString();
+            break;
+        case 13:
+            strct.OnTrapTriggered = field.getString();
+            break;
+        case 14:
+            strct.PaletteID = field.getUint();
+            break;
+        case 15:
+            strct.PartyRequired = field.getUint();
+            break;
+        case 16:
+            strct.Portrait = field.getString();
+            break;
+        case 17:
+            strct.PortraitId = field.getUint();
+            break;
+        case 18:
+            strct.ScriptHeartbeat = field.getString();
+            break;
+        case 19:
+            strct.ScriptOnEnter = field.getString();
+            break;
+        case 20:
+            strct.ScriptOnExit = field.getString();
+            break;
+        case 21:
+            strct.ScriptUserDefine = field.getString();
+            break;
+        case 22:
+            strct.Tag = field.getString();
+            break;
+        case 23:
+            strct.TemplateResRef = field.getString();
+            break;
+        case 24:
+            strct.TrapDetectDC = field.getUint();
+            break;
+        case 25:
+            strct.TrapDetectable = field.getUint();
+            break;
+        case 26:
+            strct.TrapDisarmable = field.getUint();
+            break;
+        case 27:
+            strct.TrapFlag = field.getUint();
+            break;
+        case 28:
+            strct.TrapOneShot = field.getUint();
+            break;
+        case 29:
+            strct.TrapType = field.getUint();
+            break;
+        case 30:
+            strct.Type = field.getInt();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #include "reone/resource/parser/gff/utw.h"
 
 #include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
 
 namespace reone {
 
@@ -41,6 +42,61 @@ UTW parseUTW(const Gff &gff) {
     return strct;
 }
 
+UTW parseUTW(const GffView &gff) {
+    UTW strct;
+    static const GffSchema schema {
+        "Appearance",
+        "Comment",
+        "Description",
+        "HasMapNote",
+        "LinkedTo",
+        "LocalizedName",
+        "MapNote",
+        "MapNoteEnabled",
+        "PaletteID",
+        "Tag",
+        "TemplateResRef",
+    };
+    gff.visitFields(schema, [&strct](int member, const GffView::FieldValue &field) {
+        switch (member) {
+        case 0:
+            strct.Appearance = field.getUint();
+            break;
+        case 1:
+            strct.Comment = field.getString();
+            break;
+        case 2:
+            strct.Description = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 3:
+            strct.HasMapNote = field.getUint();
+            break;
+        case 4:
+            strct.LinkedTo = field.getString();
+            break;
+        case 5:
+            strct.LocalizedName = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 6:
+            strct.MapNote = std::make_pair(field.getInt(), field.getString());
+            break;
+        case 7:
+            strct.MapNoteEnabled = field.getUint();
+            break;
+        case 8:
+            strct.PaletteID = field.getUint();
+            break;
+        case 9:
+            strct.Tag = field.getString();
+            break;
+        case 10:
+            strct.TemplateResRef = field.getString();
+            break;
+        }
+    });
+    return strct;
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -29,21 +29,25 @@ namespace reone {
 
 namespace resource {
 
+// WAV resources larger than this are decoded while playing rather than upfront
+static constexpr size_t kMinStreamingWavSize = 128 * 1024;
+
 std::shared_ptr<AudioClip> AudioClips::doGet(std::string resRef) {
     std::shared_ptr<AudioClip> clip;
     auto m3pRes = _resources.find(ResourceId(resRef, ResType::Mp3));
     if (m3pRes) {
         auto stream = MemoryInputStream(m3pRes->data);
-        auto reader = Mp3Reader();
+        auto reader = Mp3Reader(true);
         reader.load(stream);
         clip = reader.stream();
     }
     if (!clip) {
         auto wavRes = _resources.find(ResourceId(resRef, ResType::Wav));
         if (wavRes) {
+            bool streaming = wavRes->data.size() > kMinStreamingWavSize;
             auto stream = MemoryInputStream(wavRes->data);
-            auto mp3ReaderFactory = Mp3ReaderFactory();
-            auto reader = WavReader(stream, mp3ReaderFactory);
+            auto mp3ReaderFactory = Mp3ReaderFactory(streaming);
+            auto reader = WavReader(stream, mp3ReaderFactory, streaming);
             reader.load();
             clip = reader.stream();
         }
@@ -20,6 +20,7 @@
 #include "reone/resource/format/gffreader.h"
 #include "reone/resource/resources.h"
 #include "reone/system/stream/memoryinput.h"
+#include "reone/system/threadpool.h"
 
 namespace reone {
 
@@ -28,17 +29,71 @@ namespace resource {
 std::shared_ptr<Gff> Gffs::get(const std::string &resRef, ResType type) {
     ResourceId resId(resRef, type);
     return _cache.getOrAdd(resId, [this, &resId]() {
-        auto res = _resources.find(resId);
+        auto res = _resources.findView(resId);
         if (!res) {
             return std::shared_ptr<Gff>();
         }
-        MemoryInputStream stream(res->data);
+        MemoryInputStream stream(res->data, res->size);
         GffReader reader(stream);
         reader.load();
         return reader.root();
     });
 }
 
+GffView Gffs::getView(const std::string &resRef, ResType type) {
+    ResourceId resId(resRef, type);
+    auto view = _viewCache.getOrAdd(resId, [this, &resId]() {
+        auto res = _resources.findView(resId);
+        if (!res) {
+            return std::shared_ptr<GffView>();
+        }
+        return std::make_shared<GffView>(GffView::load(res->data, res->size, res->owner));
+    });
+    return view ? *view : GffView();
+}
+
+void Gffs::prefetch(const std::vector<ResourceId> &ids) {
+    std::vector<ResourceId> uniqueIds;
+    std::set<ResourceId> visited;
+    for (auto &id : ids) {
+        if (id.resRef.value().empty() || _viewCache.contains(id) || !visited.insert(id).second) {
+            continue;
+        }
+        uniqueIds.push_back(id);
+    }
+    std::vector<std::future<std::shared_ptr<GffView>>> futures;
+    futures.reserve(uniqueIds.size());
+    for (auto &id : uniqueIds) {
+        auto promise = std::make_shared<std::promise<std::shared_ptr<GffView>>>();
+        futures.push_back(promise->get_future());
+        auto func = [this, id, promise](const std::atomic_bool &canceled) {
+            try {
+                auto res = _resources.findView(id);
+                if (!res) {
+                    promise->set_value(nullptr);
+                    return;
+                }
+                promise->set_value(std::make_shared<GffView>(GffView::load(res->data, res->size, res->owner)));
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        };
+        if (_threadPool) {
+            _threadPool->enqueue(std::move(func));
+        } else {
+            func(false);
+        }
+    }
+    // Wait for all tasks before rethrowing, as they reference this provider
+    for (auto &future : futures) {
+        future.wait();
+    }
+    for (size_t i = 0; i < uniqueIds.size(); ++i) {
+        auto view = futures[i].get();
+        _viewCache.getOrAdd(uniqueIds[i], [&view]() { return view; });
+    }
+}
+
 } // namespace resource
 
 } // namespace reone
@@ -51,13 +51,13 @@ std::shared_ptr<Model> Models::get(const std::string &resRef) {
 std::shared_ptr<Model> Models::doGet(const std::string &resRef) {
     debug("Load model " + resRef, LogChannel::Graphics);
 
-    auto mdlRes = _resources.find(ResourceId(resRef, ResType::Mdl));
-    auto mdxRes = _resources.find(ResourceId(resRef, ResType::Mdx));
+    auto mdlRes = _resources.findView(ResourceId(resRef, ResType::Mdl));
+    auto mdxRes = _resources.findView(ResourceId(resRef, ResType::Mdx));
     std::shared_ptr<Model> model;
 
     if (mdlRes && mdxRes) {
-        auto mdl = MemoryInputStream(mdlRes->data);
-        auto mdx = MemoryInputStream(mdxRes->data);
+        auto mdl = MemoryInputStream(mdlRes->data, mdlRes->size);
+        auto mdx = MemoryInputStream(mdxRes->data, mdxRes->size);
         auto reader = MdlMdxReader(mdl, mdx, _statistic);
         try {
             reader.load();
@@ -18,6 +18,9 @@
 #include "reone/resource/provider/scripts.h"
 
 #include "reone/script/format/ncsreader.h"
+#include "reone/script/verifier.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
 #include "reone/system/stream/memoryinput.h"
 
 using namespace reone::script;
@@ -34,7 +37,16 @@ std::shared_ptr<ScriptProgram> Scripts::doGet(std::string resRef) {
     auto stream = MemoryInputStream(res->data);
     auto reader = NcsReader(stream, resRef);
     reader.load();
-    return reader.program();
+    auto program = reader.program();
+    if (_routines) {
+        // Programs that fail verification are executed with all runtime checks
+        try {
+            ScriptVerifier(*_routines).verify(*program);
+        } catch (const ValidationException &ex) {
+            warn(str(boost::format("Verify '%s': %s") % resRef % ex.what()), LogChannel::Script);
+        }
+    }
+    return program;
 }
 
 } // namespace resource
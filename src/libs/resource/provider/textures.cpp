@@ -26,8 +26,10 @@
 #include "reone/graphics/textureutil.h"
 #include "reone/graphics/types.h"
 #include "reone/resource/resources.h"
+#include "reone/system/binaryreader.h"
 #include "reone/system/logutil.h"
 #include "reone/system/stream/memoryinput.h"
+#include "reone/system/threadpool.h"
 #include "reone/system/threadutil.h"
 
 using namespace reone::graphics;
@@ -36,11 +38,76 @@ namespace reone {
 
 namespace resource {
 
+static bool isGridTexture(const Texture::Features &features) {
+    return features.procedureType != Texture::ProcedureType::Invalid &&
+           (features.numX > 1 || features.numY > 1);
+}
+
+static bool isCubeMapTga(const ResourceView &tgaRes) {
+    auto tga = MemoryInputStream(tgaRes.data, tgaRes.size);
+    auto reader = BinaryReader(tga);
+    if (tga.length() < 16) {
+        return false;
+    }
+    reader.seek(12);
+    auto width = reader.readUint16();
+    auto height = reader.readUint16();
+    return width > 0 && height / width == kNumCubeFaces;
+}
+
+static std::shared_ptr<Texture> decodeTexture(const std::string &resRef,
+                                              TextureUsage usage,
+                                              const std::optional<ResourceView> &txiRes,
+                                              const std::optional<ResourceView> &tgaRes,
+                                              const std::optional<ResourceView> &tpcRes,
+                                              IThreadPool *threadPool) {
+    std::shared_ptr<Texture> texture;
+    std::optional<Texture::Features> features;
+
+    if (txiRes) {
+        auto txi = MemoryInputStream(txiRes->data, txiRes->size);
+        auto txiReader = TxiReader();
+        txiReader.load(txi);
+        features = txiReader.features();
+    }
+
+    if (tgaRes) {
+        auto tga = MemoryInputStream(tgaRes->data, tgaRes->size);
+        auto tgaReader = TgaReader(tga, resRef, usage);
+        tgaReader.load();
+        texture = tgaReader.texture();
+        if (texture && features) {
+            texture->setFeatures(*features);
+        }
+    }
+
+    if (!texture && tpcRes) {
+        auto tpc = MemoryInputStream(tpcRes->data, tpcRes->size);
+        auto tpcReader = TpcReader(tpc, resRef, usage);
+        tpcReader.load();
+        texture = tpcReader.texture();
+        if (texture) {
+            if (features) {
+                texture->setFeatures(*features);
+            } else {
+                features = texture->features();
+            }
+        }
+    }
+
+    if (texture && features && isGridTexture(*features)) {
+        convertGridTextureToArray(*texture, features->numX, features->numY, threadPool);
+    }
+
+    return texture;
+}
+
 void Textures::init() {
 }
 
 void Textures::clear() {
     _cache.clear();
+    _pending.clear();
 }
 
 std::shared_ptr<Texture> Textures::get(const std::string &resRef, TextureUsage usage) {
@@ -49,6 +116,7 @@ std::shared_ptr<Texture> Textures::get(const std::string &resRef, TextureUsage u
     }
     auto maybeTexture = _cache.find(resRef);
     if (maybeTexture != _cache.end()) {
+        finishPending(maybeTexture->second);
         return maybeTexture->second;
     }
     std::string lcResRef(boost::to_lower_copy(resRef));
@@ -57,60 +125,157 @@ std::shared_ptr<Texture> Textures::get(const std::string &resRef, TextureUsage u
     return inserted.first->second;
 }
 
+std::shared_ptr<Texture> Textures::getAsync(const std::string &resRef, TextureUsage usage) {
+    if (!_threadPool) {
+        return get(resRef, usage);
+    }
+    if (resRef.empty()) {
+        return nullptr;
+    }
+    auto maybeTexture = _cache.find(resRef);
+    if (maybeTexture != _cache.end()) {
+        return maybeTexture->second;
+    }
+    std::string lcResRef(boost::to_lower_copy(resRef));
+    auto inserted = _cache.insert(std::make_pair(lcResRef, doGetAsync(lcResRef, usage)));
+
+    return inserted.first->second;
+}
+
 std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage usage) {
-    std::shared_ptr<Texture> texture;
-    std::optional<Texture::Features> features;
+    auto txiRes = _resources.findView(ResourceId(resRef, ResType::Txi));
+    auto tgaRes = _resources.findView(ResourceId(resRef, ResType::Tga));
+    auto tpcRes = _resources.findView(ResourceId(resRef, ResType::Tpc));
 
-    auto txiRes = _resources.find(ResourceId(resRef, ResType::Txi));
+    auto texture = decodeTexture(resRef, usage, txiRes, tgaRes, tpcRes, _threadPool);
+    if (texture) {
+        float anisotropy = std::max(1.0f, exp2f(_options.anisotropicFiltering));
+        texture->setAnisotropy(anisotropy);
+        texture->init();
+    } else {
+        warn("Texture not found: " + resRef, LogChannel::Graphics);
+    }
+
+    return texture;
+}
+
+std::shared_ptr<Texture> Textures::doGetAsync(const std::string &resRef, TextureUsage usage) {
+    auto txiRes = _resources.findView(ResourceId(resRef, ResType::Txi));
+    auto tgaRes = _resources.findView(ResourceId(resRef, ResType::Tga));
+    auto tpcRes = _resources.findView(ResourceId(resRef, ResType::Tpc));
+    if (!tgaRes && !tpcRes) {
+        warn("Texture not found: " + resRef, LogChannel::Graphics);
+        return nullptr;
+    }
+
+    // Resolve features and texture type up front, so that callers can rely on
+    // them before pixels are decoded
+
+    std::optional<Texture::Features> features;
+    bool cubeMap = false;
     if (txiRes) {
-        auto txi = MemoryInputStream(txiRes->data);
+        auto txi = MemoryInputStream(txiRes->data, txiRes->size);
         auto txiReader = TxiReader();
         txiReader.load(txi);
         features = txiReader.features();
     }
-
-    auto tgaRes = _resources.find(ResourceId(resRef, ResType::Tga));
     if (tgaRes) {
-        auto tga = MemoryInputStream(tgaRes->data);
-        auto tgaReader = TgaReader(tga, resRef, usage);
-        tgaReader.load();
-        texture = tgaReader.texture();
-        if (texture && features) {
-            texture->setFeatures(*features);
+        cubeMap = isCubeMapTga(*tgaRes);
+    } else {
+        auto tpc = MemoryInputStream(tpcRes->data, tpcRes->size);
+        auto tpcReader = TpcReader(tpc, resRef, usage);
+        tpcReader.loadHeaderAndFeatures();
+        cubeMap = tpcReader.isCubeMap();
+        if (!features) {
+            features = tpcReader.features();
         }
     }
 
-    if (!texture) {
-        auto tpcRes = _resources.find(ResourceId(resRef, ResType::Tpc));
-        if (tpcRes) {
-            auto tpc = MemoryInputStream(tpcRes->data);
-            auto tpcReader = TpcReader(tpc, resRef, usage);
-            tpcReader.load();
-            texture = tpcReader.texture();
-            if (texture) {
-                if (features) {
-                    texture->setFeatures(*features);
-                } else {
-                    features = texture->features();
-                }
-            }
-        }
+    auto type = TextureType::TwoDim;
+    int numLayers = 1;
+    if (features && isGridTexture(*features)) {
+        type = TextureType::TwoDimArray;
+        numLayers = features->numX * features->numY;
+    } else if (cubeMap) {
+        type = TextureType::CubeMap;
+        numLayers = kNumCubeFaces;
+    }
+    auto placeholder = std::make_shared<Texture>(resRef, type, getTextureProperties(usage));
+    if (features) {
+        placeholder->setFeatures(*features);
     }
+    placeholder->clear(1, 1, PixelFormat::RGBA8, numLayers);
+    placeholder->init();
 
-    if (texture) {
-        if (features &&
-            features->procedureType != Texture::ProcedureType::Invalid &&
-            (features->numX > 1 || features->numY > 1)) {
-            convertGridTextureToArray(*texture, features->numX, features->numY);
+    auto promise = std::make_shared<std::promise<std::shared_ptr<Texture>>>();
+    auto decoded = promise->get_future();
+    _threadPool->enqueue([threadPool = _threadPool, resRef, usage, txiRes, tgaRes, tpcRes, promise](const std::atomic_bool &canceled) {
+        try {
+            // Nested DXT decoding on the same pool does not deadlock, as the
+            // calling worker decodes block rows too
+            promise->set_value(decodeTexture(resRef, usage, txiRes, tgaRes, tpcRes, threadPool));
+        } catch (...) {
+            promise->set_exception(std::current_exception());
         }
-        float anisotropy = std::max(1.0f, exp2f(_options.anisotropicFiltering));
-        texture->setAnisotropy(anisotropy);
-        texture->init();
-    } else {
-        warn("Texture not found: " + resRef, LogChannel::Graphics);
+    });
+    _pending.push_back(PendingTexture {placeholder, std::move(decoded)});
+
+    return placeholder;
+}
+
+void Textures::uploadPending() {
+    if (_pending.empty()) {
+        return;
     }
+    auto start = std::chrono::steady_clock::now();
+    auto budget = std::chrono::milliseconds(_options.textureUploadBudget);
+    for (auto it = _pending.begin(); it != _pending.end();) {
+        if (it->decoded.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+        upload(*it);
+        it = _pending.erase(it);
+        if (std::chrono::steady_clock::now() - start >= budget) {
+            break;
+        }
+    }
+}
 
-    return texture;
+void Textures::finishPending(const std::shared_ptr<Texture> &texture) {
+    if (_pending.empty() || !texture) {
+        return;
+    }
+    auto it = std::find_if(_pending.begin(), _pending.end(), [&texture](auto &pending) {
+        return pending.placeholder == texture;
+    });
+    if (it == _pending.end()) {
+        return;
+    }
+    upload(*it);
+    _pending.erase(it);
+}
+
+void Textures::upload(PendingTexture &pending) {
+    auto &placeholder = *pending.placeholder;
+    std::shared_ptr<Texture> decoded;
+    try {
+        decoded = pending.decoded.get();
+    } catch (const std::exception &ex) {
+        error(str(boost::format("Error decoding texture '%s': %s") % placeholder.name() % ex.what()), LogChannel::Graphics);
+        return;
+    }
+    if (!decoded) {
+        warn("Texture not decoded: " + placeholder.name(), LogChannel::Graphics);
+        return;
+    }
+    float anisotropy = std::max(1.0f, exp2f(_options.anisotropicFiltering));
+    placeholder.deinit();
+    placeholder.setType(decoded->type());
+    placeholder.setFeatures(decoded->features());
+    placeholder.setPixels(decoded->width(), decoded->height(), decoded->pixelFormat(), decoded->layers());
+    placeholder.setAnisotropy(anisotropy);
+    placeholder.init();
 }
 
 } // namespace resource
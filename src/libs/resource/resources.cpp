@@ -23,39 +23,77 @@
 #include "reone/resource/container/keybif.h"
 #include "reone/resource/container/rim.h"
 #include "reone/resource/exception/notfound.h"
+#include "reone/system/threadpool.h"
 
 namespace reone {
 
 namespace resource {
 
+void Resources::clearLocal() {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    std::vector<ResourceId> orphaned;
+    for (auto &pair : _containers) {
+        if (!pair.local) {
+            continue;
+        }
+        for (auto &id : pair.provider->resourceIds()) {
+            auto it = _index.find(id);
+            if (it != _index.end() && it->second == &pair) {
+                orphaned.push_back(id);
+                _index.erase(it);
+            }
+        }
+    }
+    _containers.remove_if([](auto &pair) {
+        return pair.local;
+    });
+    for (auto &id : orphaned) {
+        for (auto &pair : _containers) {
+            if (pair.provider->resourceIds().count(id) > 0) {
+                _index[id] = &pair;
+                break;
+            }
+        }
+    }
+}
+
+void Resources::add(std::unique_ptr<IResourceContainer> provider, bool local) {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    _containers.push_front(ResourceContainerLocalPair {std::move(provider), local});
+    auto &pair = _containers.front();
+    for (auto &id : pair.provider->resourceIds()) {
+        _index[id] = &pair;
+    }
+}
+
 void Resources::addKEY(const std::filesystem::path &path) {
     auto provider = std::make_unique<KeyBifResourceContainer>(path);
     provider->init();
-    _containers.push_front(ResourceContainerLocalPair {std::move(provider), false});
+    add(std::move(provider), false);
 }
 
 void Resources::addERF(const std::filesystem::path &path, bool local) {
     auto provider = std::make_unique<ErfResourceContainer>(path);
     provider->init();
-    _containers.push_front(ResourceContainerLocalPair {std::move(provider), local});
+    add(std::move(provider), local);
 }
 
 void Resources::addRIM(const std::filesystem::path &path, bool local) {
     auto provider = std::make_unique<RimResourceContainer>(path);
     provider->init();
-    _containers.push_front(ResourceContainerLocalPair {std::move(provider), local});
+    add(std::move(provider), local);
 }
 
 void Resources::addEXE(const std::filesystem::path &path) {
     auto provider = std::make_unique<ExeResourceContainer>(path);
     provider->init();
-    _containers.push_front(ResourceContainerLocalPair {std::move(provider), false});
+    add(std::move(provider), false);
 }
 
 void Resources::addFolder(const std::filesystem::path &path) {
     auto provider = std::make_unique<FolderResourceContainer>(path);
     provider->init();
-    _containers.push_front(ResourceContainerLocalPair {std::move(provider), false});
+    add(std::move(provider), false);
 }
 
 Resource Resources::get(const ResourceId &id) {
@@ -67,13 +105,48 @@ Resource Resources::get(const ResourceId &id) {
 }
 
 std::optional<Resource> Resources::find(const ResourceId &id) {
-    for (auto &[provider, local] : _containers) {
-        auto data = provider->findResourceData(id);
-        if (data) {
-            return Resource {*data, local};
-        }
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    auto container = findContainer(id);
+    if (!container) {
+        return std::nullopt;
+    }
+    auto data = container->provider->findResourceData(id);
+    if (!data) {
+        return std::nullopt;
+    }
+    return Resource {std::move(*data), container->local};
+}
+
+ResourceView Resources::getView(const ResourceId &id) {
+    auto view = findView(id);
+    if (!view) {
+        throw ResourceNotFoundException(id.string());
+    }
+    return *view;
+}
+
+std::optional<ResourceView> Resources::findView(const ResourceId &id) {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    auto container = findContainer(id);
+    if (!container) {
+        return std::nullopt;
+    }
+    auto view = container->provider->findResourceView(id);
+    if (!view) {
+        return std::nullopt;
+    }
+    view->local = container->local;
+    return view;
+}
+
+const ResourceContainerLocalPair *Resources::findContainer(const ResourceId &id) {
+    auto it = _index.find(id);
+    if (it == _index.end()) {
+        ++_numMisses;
+        return nullptr;
     }
-    return std::nullopt;
+    ++_numHits;
+    return it->second;
 }
 
 } // namespace resource
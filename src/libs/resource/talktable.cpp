@@ -22,14 +22,18 @@ namespace reone {
 namespace resource {
 
 int TalkTable::getStringCount() const {
-    return static_cast<int>(_strings.size());
+    return _stringCount;
 }
 
-const TalkTable::String &TalkTable::getString(int index) const {
-    if (index < 0 || index >= static_cast<int>(_strings.size())) {
+TalkTable::String TalkTable::getString(int index) const {
+    if (index < 0 || index >= _stringCount) {
         throw std::out_of_range("index is out of range");
     }
-    return _strings[index];
+    if (!_decoder) {
+        return _strings[index];
+    }
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    return _cache.getOrAdd(index, [this, &index]() { return _decoder(index); });
 }
 
 } // namespace resource
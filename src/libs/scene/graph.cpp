@@ -34,12 +34,12 @@
 #include "reone/scene/node/light.h"
 #include "reone/scene/node/mesh.h"
 #include "reone/scene/node/model.h"
-#include "reone/scene/node/particle.h"
 #include "reone/scene/node/sound.h"
 #include "reone/scene/node/trigger.h"
 #include "reone/scene/node/walkmesh.h"
 #include "reone/scene/render/pipeline.h"
 #include "reone/system/logutil.h"
+#include "reone/system/threadpool.h"
 
 using namespace reone::graphics;
 
@@ -61,6 +61,12 @@ static constexpr float kMaxCollisionDistanceWalk2 = kMaxCollisionDistanceWalk *
 static constexpr float kMaxCollisionDistanceLineOfSight = 16.0f;
 static constexpr float kMaxCollisionDistanceLineOfSight2 = kMaxCollisionDistanceLineOfSight * kMaxCollisionDistanceLineOfSight;
 
+static constexpr int kMinQueriesPerTask = 64;
+static constexpr int kMaxCollisionTasks = 8;
+
+static constexpr int kModelRootsPerChunk = 4;
+static constexpr int kMaxUpdateTasks = 8;
+
 static constexpr float kPointLightShadowsFOV = glm::radians(90.0f);
 static constexpr float kPointLightShadowsNearPlane = 0.25f;
 static constexpr float kPointLightShadowsFarPlane = 2500.0f;
@@ -146,11 +152,9 @@ void SceneGraph::removeRoot(SoundSceneNode &node) {
     _soundRoots.erase(it, _soundRoots.end());
 }
 
-void SceneGraph::update(float dt) {
+void SceneGraph::update(float dt, IThreadPool *threadPool) {
     if (_updateRoots) {
-        for (auto &root : _modelRoots) {
-            root->update(dt);
-        }
+        updateModelRoots(dt, threadPool);
         for (auto &root : _grassRoots) {
             root->update(dt);
         }
@@ -171,6 +175,31 @@ void SceneGraph::update(float dt) {
     prepareTransparentLeafs();
 }
 
+void SceneGraph::updateModelRoots(float dt, IThreadPool *threadPool) {
+    // Parallel phase: animate model roots and propagate their transforms.
+    // Model roots do not share nodes, so they are updated independently, in
+    // chunks taken by whichever thread is free. Animation events are queued.
+
+    std::vector<ModelSceneNode *> roots;
+    roots.reserve(_modelRoots.size());
+    for (auto &root : _modelRoots) {
+        if (root->isEnabled()) {
+            roots.push_back(root.get());
+        }
+    }
+    parallelFor(threadPool, static_cast<int>(roots.size()), kModelRootsPerChunk, kMaxUpdateTasks, [&roots, dt](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            roots[i]->updateDeferringEvents(dt);
+        }
+    });
+
+    // Serial phase: signal queued animation events in order of model roots
+
+    for (auto &root : roots) {
+        root->signalPendingEvents();
+    }
+}
+
 void SceneGraph::cullRoots() {
     for (auto &root : _modelRoots) {
         bool culled =
@@ -388,23 +417,14 @@ void SceneGraph::prepareOpaqueLeafs() {
 void SceneGraph::prepareTransparentLeafs() {
     _transparentLeafs.clear();
 
-    auto camera = _activeCamera->camera();
-
     // Add meshes and emitters to transparent leafs
     std::vector<SceneNode *> leafs;
     for (auto &mesh : _transparentMeshes) {
         leafs.push_back(mesh);
     }
     for (auto &emitter : _emitters) {
-        for (auto &child : emitter->children()) {
-            if (child->type() != SceneNodeType::Particle) {
-                continue;
-            }
-            auto particle = static_cast<ParticleSceneNode *>(child);
-            if (!camera->isInFrustum(particle->origin())) {
-                continue;
-            }
-            leafs.push_back(particle);
+        if (emitter->numParticles() > 0) {
+            leafs.push_back(emitter);
         }
     }
 
@@ -415,12 +435,12 @@ void SceneGraph::prepareTransparentLeafs() {
         SceneNode *parent = leaf->parent();
         if (leaf->type() == SceneNodeType::Mesh) {
             parent = &static_cast<MeshSceneNode *>(leaf)->model();
+        } else if (leaf->type() == SceneNodeType::Emitter) {
+            parent = leaf; // emitter renders its own particles
         }
         if (!bucket.empty()) {
             int maxCount = 1;
-            if (parent->type() == SceneNodeType::Emitter) {
-                maxCount = kMaxParticles;
-            } else if (parent->type() == SceneNodeType::Grass) {
+            if (parent->type() == SceneNodeType::Grass) {
                 maxCount = kMaxGrassClusters;
             }
             if (bucketParent != parent || bucket.size() >= maxCount) {
@@ -755,113 +775,221 @@ std::vector<LightSceneNode *> SceneGraph::computeClosestLights(int count, const
 }
 
 bool SceneGraph::testElevation(const glm::vec2 &position, Collision &outCollision) const {
-    static glm::vec3 down(0.0f, 0.0f, -1.0f);
+    CollisionQuery query;
+    query.type = CollisionTestType::Elevation;
+    query.origin = glm::vec3(position, 0.0f);
 
-    bool walkable = false;
-    float minDistance = std::numeric_limits<float>::max();
+    auto test = prepareRayTest(query);
+    for (auto &root : _walkmeshRoots) {
+        testWalkmesh(*root, test, outCollision);
+    }
+
+    return isRayTestCollided(test);
+}
 
-    glm::vec3 origin {position, kElevationTestZ};
+bool SceneGraph::testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest, Collision &outCollision) const {
+    CollisionQuery query;
+    query.type = CollisionTestType::LineOfSight;
+    query.origin = origin;
+    query.dest = dest;
+
+    auto test = prepareRayTest(query);
+    for (auto &root : _walkmeshRoots) {
+        testWalkmesh(*root, test, outCollision);
+    }
+
+    return isRayTestCollided(test);
+}
+
+bool SceneGraph::testWalk(const glm::vec3 &origin, const glm::vec3 &dest, const IUser *excludeUser, Collision &outCollision) const {
+    CollisionQuery query;
+    query.type = CollisionTestType::Walk;
+    query.origin = origin;
+    query.dest = dest;
+    query.excludeUser = excludeUser;
+
+    auto test = prepareRayTest(query);
+    for (auto &root : _walkmeshRoots) {
+        testWalkmesh(*root, test, outCollision);
+    }
+
+    return isRayTestCollided(test);
+}
+
+void SceneGraph::testCollisions(
+    const std::vector<CollisionQuery> &queries,
+    std::vector<CollisionResult> &outResults,
+    IThreadPool *threadPool) const {
+
+    outResults.clear();
+    outResults.resize(queries.size());
+    if (queries.empty()) {
+        return;
+    }
+
+    // Broad phase: cull walkmeshes against the bounds of all query origins
+
+    glm::vec2 originsMin {std::numeric_limits<float>::max()};
+    glm::vec2 originsMax {std::numeric_limits<float>::lowest()};
+    float maxCullDistance = 0.0f;
+    for (auto &query : queries) {
+        originsMin = glm::min(originsMin, glm::vec2(query.origin));
+        originsMax = glm::max(originsMax, glm::vec2(query.origin));
+        float cullDistance = query.type == CollisionTestType::LineOfSight
+                                 ? kMaxCollisionDistanceLineOfSight
+                                 : kMaxCollisionDistanceWalk;
+        maxCullDistance = std::max(maxCullDistance, cullDistance);
+    }
+    float maxCullDistance2 = maxCullDistance * maxCullDistance;
+
+    std::vector<WalkmeshSceneNode *> roots;
+    roots.reserve(_walkmeshRoots.size());
     for (auto &root : _walkmeshRoots) {
         if (!root->isEnabled()) {
             continue;
         }
         if (!root->walkmesh().isAreaWalkmesh()) {
-            float distance2 = root->getSquareDistanceTo2D(position);
-            if (distance2 > kMaxCollisionDistanceWalk2) {
+            auto origin2D = root->origin2D();
+            auto closest = glm::clamp(origin2D, originsMin, originsMax);
+            if (glm::distance2(origin2D, closest) > maxCullDistance2) {
                 continue;
             }
         }
-        auto objSpaceOrigin = glm::vec3(root->absoluteTransformInverse() * glm::vec4(origin, 1.0f));
-        float distance = 0.0f;
-        auto face = root->walkmesh().raycast(_walkcheckSurfaces, objSpaceOrigin, down, 2.0f * kElevationTestZ, distance);
-        if (!face || distance >= minDistance) {
-            continue;
-        }
-        walkable = _walkableSurfaces.count(face->material) > 0;
-        if (walkable) {
-            outCollision.user = root->user();
-            outCollision.intersection = origin + distance * down;
-            outCollision.normal = root->absoluteTransform() * glm::vec4 {face->normal, 0.0f};
-            outCollision.material = face->material;
-        }
-        minDistance = distance;
+        roots.push_back(root.get());
     }
 
-    return walkable;
+    // Narrow phase: test every walkmesh against queries in a range, walkmesh
+    // by walkmesh, so that its triangles stay in cache
+
+    std::vector<RayTest> tests;
+    tests.reserve(queries.size());
+    for (auto &query : queries) {
+        tests.push_back(prepareRayTest(query));
+    }
+
+    int numQueries = static_cast<int>(queries.size());
+    bool parallel = threadPool && numQueries >= 2 * kMinQueriesPerTask;
+    int chunkSize = parallel ? kMinQueriesPerTask : numQueries;
+    parallelFor(threadPool, numQueries, chunkSize, kMaxCollisionTasks, [this, &roots, &tests, &outResults](int begin, int end) {
+        for (auto root : roots) {
+            for (int i = begin; i < end; ++i) {
+                testWalkmesh(*root, tests[i], outResults[i].collision);
+            }
+        }
+        for (int i = begin; i < end; ++i) {
+            outResults[i].collided = isRayTestCollided(tests[i]);
+        }
+    });
 }
 
-bool SceneGraph::testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest, Collision &outCollision) const {
-    auto originToDest = dest - origin;
-    auto dir = glm::normalize(originToDest);
-    float maxDistance = glm::length(originToDest);
-    float minDistance = std::numeric_limits<float>::max();
+SceneGraph::RayTest SceneGraph::prepareRayTest(const CollisionQuery &query) const {
+    RayTest test;
+    test.query = &query;
+    if (query.type == CollisionTestType::Elevation) {
+        test.origin = glm::vec3(glm::vec2(query.origin), kElevationTestZ);
+        test.dir = glm::vec3(0.0f, 0.0f, -1.0f);
+        test.maxDistance = 2.0f * kElevationTestZ;
+    } else {
+        auto originToDest = query.dest - query.origin;
+        test.origin = query.origin;
+        test.dir = glm::normalize(originToDest);
+        test.maxDistance = glm::length(originToDest);
+    }
+    return test;
+}
 
-    for (auto &root : _walkmeshRoots) {
-        if (!root->isEnabled()) {
-            continue;
+void SceneGraph::testWalkmesh(WalkmeshSceneNode &root, RayTest &test, Collision &outCollision) const {
+    if (!root.isEnabled()) {
+        return;
+    }
+    const auto &query = *test.query;
+    const auto &walkmesh = root.walkmesh();
+    float distance = 0.0f;
+
+    switch (query.type) {
+    case CollisionTestType::Elevation: {
+        if (!walkmesh.isAreaWalkmesh()) {
+            float distance2 = root.getSquareDistanceTo2D(glm::vec2(test.origin));
+            if (distance2 > kMaxCollisionDistanceWalk2) {
+                return;
+            }
         }
+        auto objSpaceOrigin = glm::vec3(root.absoluteTransformInverse() * glm::vec4(test.origin, 1.0f));
+        auto face = walkmesh.raycast(_walkcheckSurfaceMask, objSpaceOrigin, test.dir, test.maxDistance, distance);
+        if (!face || distance >= test.minDistance) {
+            return;
+        }
+        test.walkable = _walkableSurfaces.count(face->material) > 0;
+        if (test.walkable) {
+            outCollision.user = root.user();
+            outCollision.intersection = test.origin + distance * test.dir;
+            outCollision.normal = root.absoluteTransform() * glm::vec4 {face->normal, 0.0f};
+            outCollision.material = face->material;
+        }
+        test.minDistance = distance;
+        break;
+    }
+    case CollisionTestType::LineOfSight: {
         glm::vec3 originLocal;
         glm::vec3 dirLocal;
-        if (root->walkmesh().isAreaWalkmesh()) {
-            if (!root->walkmesh().contains(origin) &&
-                !root->walkmesh().contains(dest)) {
-                continue;
+        if (walkmesh.isAreaWalkmesh()) {
+            if (!walkmesh.contains(query.origin) &&
+                !walkmesh.contains(query.dest)) {
+                return;
             }
-            originLocal = origin;
-            dirLocal = dir;
+            originLocal = test.origin;
+            dirLocal = test.dir;
         } else {
-            if (root->getSquareDistanceTo(origin) > kMaxCollisionDistanceLineOfSight2) {
-                continue;
+            if (root.getSquareDistanceTo(test.origin) > kMaxCollisionDistanceLineOfSight2) {
+                return;
             }
-            originLocal = root->absoluteTransformInverse() * glm::vec4 {origin, 1.0f};
-            dirLocal = root->absoluteTransformInverse() * glm::vec4 {dir, 0.0f};
+            originLocal = root.absoluteTransformInverse() * glm::vec4 {test.origin, 1.0f};
+            dirLocal = root.absoluteTransformInverse() * glm::vec4 {test.dir, 0.0f};
         }
-        float distance = 0.0f;
-        auto face = root->walkmesh().raycast(_lineOfSightSurfaces, originLocal, dirLocal, maxDistance, distance);
-        if (!face || distance > minDistance) {
-            continue;
+        auto face = walkmesh.raycast(_lineOfSightSurfaceMask, originLocal, dirLocal, test.maxDistance, distance);
+        if (!face || distance > test.minDistance) {
+            return;
         }
-        outCollision.user = root->user();
-        outCollision.intersection = origin + distance * dir;
-        outCollision.normal = root->absoluteTransform() * glm::vec4(face->normal, 0.0f);
+        outCollision.user = root.user();
+        outCollision.intersection = test.origin + distance * test.dir;
+        outCollision.normal = root.absoluteTransform() * glm::vec4(face->normal, 0.0f);
         outCollision.material = face->material;
-        minDistance = distance;
+        test.minDistance = distance;
+        break;
     }
-
-    return minDistance != std::numeric_limits<float>::max();
-}
-
-bool SceneGraph::testWalk(const glm::vec3 &origin, const glm::vec3 &dest, const IUser *excludeUser, Collision &outCollision) const {
-    glm::vec3 originToDest(dest - origin);
-    glm::vec3 dir(glm::normalize(originToDest));
-    float maxDistance = glm::length(originToDest);
-    float minDistance = std::numeric_limits<float>::max();
-
-    for (auto &root : _walkmeshRoots) {
-        if (!root->isEnabled() || root->user() == excludeUser) {
-            continue;
+    case CollisionTestType::Walk: {
+        if (root.user() == query.excludeUser) {
+            return;
         }
-        if (!root->walkmesh().isAreaWalkmesh()) {
-            float distance2 = root->getSquareDistanceTo(origin);
+        if (!walkmesh.isAreaWalkmesh()) {
+            float distance2 = root.getSquareDistanceTo(test.origin);
             if (distance2 > kMaxCollisionDistanceWalk2) {
-                continue;
+                return;
             }
         }
-        glm::vec3 objSpaceOrigin(root->absoluteTransformInverse() * glm::vec4(origin, 1.0f));
-        glm::vec3 objSpaceDir(root->absoluteTransformInverse() * glm::vec4(dir, 0.0f));
-        float distance = 0.0f;
-        auto face = root->walkmesh().raycast(_walkcheckSurfaces, objSpaceOrigin, objSpaceDir, kMaxCollisionDistanceWalk, distance);
-        if (!face || distance > maxDistance || distance > minDistance) {
-            continue;
+        glm::vec3 objSpaceOrigin(root.absoluteTransformInverse() * glm::vec4(test.origin, 1.0f));
+        glm::vec3 objSpaceDir(root.absoluteTransformInverse() * glm::vec4(test.dir, 0.0f));
+        auto face = walkmesh.raycast(_walkcheckSurfaceMask, objSpaceOrigin, objSpaceDir, kMaxCollisionDistanceWalk, distance);
+        if (!face || distance > test.maxDistance || distance > test.minDistance) {
+            return;
         }
-        outCollision.user = root->user();
-        outCollision.intersection = origin + distance * dir;
-        outCollision.normal = root->absoluteTransform() * glm::vec4(face->normal, 0.0f);
+        outCollision.user = root.user();
+        outCollision.intersection = test.origin + distance * test.dir;
+        outCollision.normal = root.absoluteTransform() * glm::vec4(face->normal, 0.0f);
         outCollision.material = face->material;
-        minDistance = distance;
+        test.minDistance = distance;
+        break;
+    }
+    default:
+        throw std::invalid_argument("Unsupported collision test type: " + std::to_string(static_cast<int>(query.type)));
     }
+}
 
-    return minDistance != std::numeric_limits<float>::max();
+bool SceneGraph::isRayTestCollided(const RayTest &test) const {
+    if (test.query->type == CollisionTestType::Elevation) {
+        return test.walkable;
+    }
+    return test.minDistance != std::numeric_limits<float>::max();
 }
 
 ModelSceneNode *SceneGraph::pickModelAt(int x, int y, IUser *except) const {
@@ -974,11 +1102,6 @@ std::shared_ptr<EmitterSceneNode> SceneGraph::newEmitter(ModelNode &modelNode) {
     return std::move(node);
 }
 
-std::shared_ptr<ParticleSceneNode> SceneGraph::newParticle(EmitterSceneNode &emitter) {
-    auto node = newSceneNode<ParticleSceneNode, EmitterSceneNode &>(emitter);
-    return std::move(node);
-}
-
 std::shared_ptr<GrassSceneNode> SceneGraph::newGrass(GrassProperties properties, ModelNode &aabbNode) {
     auto node = newSceneNode<GrassSceneNode, GrassProperties, ModelNode &>(properties, aabbNode);
     node->init();
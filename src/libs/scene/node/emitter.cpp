@@ -28,7 +28,6 @@
 #include "reone/resource/provider/textures.h"
 #include "reone/scene/graph.h"
 #include "reone/scene/node/camera.h"
-#include "reone/scene/node/particle.h"
 #include "reone/scene/render/pass.h"
 #include "reone/system/randomutil.h"
 
@@ -85,45 +84,157 @@ void EmitterSceneNode::init() {
     }
 
     // Pre-allocate particles
-    int numParticles;
     if (_modelNode.emitter()->updateMode == ModelNode::Emitter::UpdateMode::Single) {
-        numParticles = 1;
+        _maxParticles = 1;
     } else {
-        numParticles = kMaxParticles;
+        _maxParticles = kMaxParticles;
     }
-    for (int i = 0; i < numParticles; ++i) {
-        _particlePool.push_back(_sceneGraph.newParticle(*this).get());
+    _particles.reserve(_maxParticles);
+    _instances.reserve(_maxParticles);
+}
+
+void EmitterSceneNode::Particles::reserve(size_t capacity) {
+    positions.reserve(capacity);
+    velocities.reserve(capacity);
+    dirs.reserve(capacity);
+    sizes.reserve(capacity);
+    colors.reserve(capacity);
+    lifetimes.reserve(capacity);
+    animLengths.reserve(capacity);
+    frames.reserve(capacity);
+}
+
+void EmitterSceneNode::Particles::clear() {
+    positions.clear();
+    velocities.clear();
+    dirs.clear();
+    sizes.clear();
+    colors.clear();
+    lifetimes.clear();
+    animLengths.clear();
+    frames.clear();
+}
+
+void EmitterSceneNode::Particles::push(const glm::vec3 &position, const glm::vec3 &velocity, float animLength, int frame) {
+    positions.push_back(position);
+    velocities.push_back(velocity);
+    dirs.push_back(glm::vec3(0.0f));
+    sizes.push_back(glm::vec2(1.0f));
+    colors.push_back(glm::vec4(1.0f));
+    lifetimes.push_back(0.0f);
+    animLengths.push_back(animLength);
+    frames.push_back(frame);
+}
+
+void EmitterSceneNode::Particles::swapRemove(size_t index) {
+    size_t last = size() - 1;
+    if (index != last) {
+        positions[index] = positions[last];
+        velocities[index] = velocities[last];
+        dirs[index] = dirs[last];
+        sizes[index] = sizes[last];
+        colors[index] = colors[last];
+        lifetimes[index] = lifetimes[last];
+        animLengths[index] = animLengths[last];
+        frames[index] = frames[last];
     }
+    positions.pop_back();
+    velocities.pop_back();
+    dirs.pop_back();
+    sizes.pop_back();
+    colors.pop_back();
+    lifetimes.pop_back();
+    animLengths.pop_back();
+    frames.pop_back();
 }
 
 void EmitterSceneNode::update(float dt) {
-    removeExpiredParticles(dt);
+    removeExpiredParticles();
     spawnParticles(dt);
+    updateParticles(dt);
+}
 
-    for (auto &child : _children) {
-        auto particle = static_cast<ParticleSceneNode *>(child);
-        particle->update(dt);
+void EmitterSceneNode::removeExpiredParticles() {
+    if (_lifeExpectancy == -1.0f) {
+        return;
+    }
+    for (size_t i = 0; i < _particles.size();) {
+        if (_particles.lifetimes[i] >= _lifeExpectancy) {
+            _particles.swapRemove(i);
+        } else {
+            ++i;
+        }
     }
 }
 
-void EmitterSceneNode::removeExpiredParticles(float dt) {
-    if (_lifeExpectancy == -1.0f) {
+void EmitterSceneNode::updateParticles(float dt) {
+    // Lightning particles are updated on spawn
+    auto &emitter = *_modelNode.emitter();
+    if (emitter.updateMode == ModelNode::Emitter::UpdateMode::Lightning) {
         return;
     }
-    std::vector<ParticleSceneNode *> expiredParticles;
-    for (auto &child : _children) {
-        if (child->type() != SceneNodeType::Particle) {
-            continue;
+    size_t count = _particles.size();
+    auto positions = _particles.positions.data();
+    auto velocities = _particles.velocities.data();
+    auto lifetimes = _particles.lifetimes.data();
+    auto animLengths = _particles.animLengths.data();
+
+    // Advance lifetimes
+    bool mortal = _lifeExpectancy != -1.0f;
+    if (mortal) {
+        for (size_t i = 0; i < count; ++i) {
+            lifetimes[i] = glm::min(lifetimes[i] + dt, _lifeExpectancy);
         }
-        auto particle = static_cast<ParticleSceneNode *>(child);
-        if (particle->isExpired()) {
-            expiredParticles.push_back(particle);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            lifetimes[i] = lifetimes[i] == animLengths[i] ? 0.0f : glm::min(lifetimes[i] + dt, animLengths[i]);
+        }
+    }
+
+    // Integrate positions of particles, that have not expired during this
+    // update. Branch-free, so that the compiler can vectorize it.
+    for (size_t i = 0; i < count; ++i) {
+        float step = (mortal && lifetimes[i] >= _lifeExpectancy) ? 0.0f : dt;
+        positions[i] += velocities[i] * step;
+    }
+
+    // Gravity-type P2P emitter: pull particles towards the reference node
+    if (emitter.p2p && !emitter.p2pBezier) {
+        auto ref = std::find_if(_children.begin(), _children.end(), [](auto &child) { return child->type() == SceneNodeType::Dummy; });
+        if (ref != _children.end()) {
+            glm::vec3 emitterSpaceRefPos(_absTransformInv * glm::vec4((*ref)->origin(), 1.0f));
+            for (size_t i = 0; i < count; ++i) {
+                if (mortal && lifetimes[i] >= _lifeExpectancy) {
+                    continue;
+                }
+                glm::vec3 pullDir(glm::normalize(emitterSpaceRefPos - positions[i]));
+                velocities[i] += _grav * pullDir * dt;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (mortal && lifetimes[i] >= _lifeExpectancy) {
+            continue;
         }
+        updateParticleAnimation(i);
     }
-    for (auto &particle : expiredParticles) {
-        removeChild(*particle);
-        _particlePool.push_back(particle);
+}
+
+void EmitterSceneNode::updateParticleAnimation(size_t index) {
+    float lifetime = _particles.lifetimes[index];
+    float animLength = _particles.animLengths[index];
+    float factor;
+    if (_lifeExpectancy != -1.0f) {
+        factor = lifetime / _lifeExpectancy;
+    } else if (animLength > 0.0f) {
+        factor = lifetime / animLength;
+    } else {
+        factor = 0.0f;
     }
+    _particles.frames[index] = static_cast<int>(glm::ceil(_frameStart + factor * (_frameEnd - _frameStart)));
+    _particles.sizes[index] = glm::vec2(_particleSize.get(factor));
+    _particles.colors[index] = glm::vec4(_color.get(factor), _alpha.get(factor));
 }
 
 void EmitterSceneNode::spawnParticles(float dt) {
@@ -139,7 +250,7 @@ void EmitterSceneNode::spawnParticles(float dt) {
         }
         break;
     case ModelNode::Emitter::UpdateMode::Single:
-        if (!_spawned || (_children.empty() && emitter->loop)) {
+        if (!_spawned || (_particles.empty() && emitter->loop)) {
             doSpawnParticle();
             _spawned = true;
         }
@@ -157,33 +268,26 @@ void EmitterSceneNode::spawnParticles(float dt) {
 }
 
 void EmitterSceneNode::doSpawnParticle() {
-    // Take particle from the pool, if available
-    if (_particlePool.empty()) {
+    if (_particles.size() >= _maxParticles) {
         return;
     }
-    auto particle = static_cast<ParticleSceneNode *>(_particlePool.front());
-    particle->setLifetime(0.0f);
 
     float halfW = 0.005f * _size.x;
     float halfH = 0.005f * _size.y;
     glm::vec3 position(randomFloat(-halfW, halfW), randomFloat(-halfH, halfH), 0.0f);
-    particle->setLocalTransform(glm::translate(position));
 
     float halfSpread = 0.5f * _spread;
     float angle1 = randomFloat(-halfSpread, halfSpread);
     float angle2 = randomFloat(-halfSpread, halfSpread);
     glm::vec3 dir(glm::sin(angle1), glm::sin(angle2), glm::cos(angle1) * glm::cos(angle2));
     glm::vec3 velocity((_velocity + randomFloat(0.0f, _randomVelocity)) * dir);
-    particle->setVelocity(std::move(velocity));
 
-    particle->setFrame(_frameStart);
+    float animLength = 0.0f;
     if (_fps > 0.0f) {
-        particle->setAnimLength((_frameEnd - _frameStart + 1) / _fps);
+        animLength = (_frameEnd - _frameStart + 1) / _fps;
     }
 
-    // Remove particle from pool and append it to emitter
-    _particlePool.pop_front();
-    addChild(*particle);
+    _particles.push(position, velocity, animLength, _frameStart);
 }
 
 void EmitterSceneNode::spawnLightningParticles() {
@@ -216,33 +320,19 @@ void EmitterSceneNode::spawnLightningParticles() {
     }
     segments[_lightningSubDiv].second = emitterSpaceRefPos;
 
-    // Return all particles to pool
-    for (auto it = _children.begin(); it != _children.end();) {
-        auto child = *it;
-        if ((*it)->type() == SceneNodeType::Particle) {
-            _particlePool.push_back(static_cast<ParticleSceneNode *>(child));
-            it = _children.erase(it);
-        } else {
-            ++it;
-        }
-    }
-
+    // Replace all particles with new segments
+    _particles.clear();
     for (auto &segment : segments) {
-        // Take particle from the pool, if available
-        if (_particlePool.empty()) {
+        if (_particles.size() >= _maxParticles) {
             return;
         }
-        auto particle = _particlePool.front();
-        _particlePool.pop_front();
-        particle->setLifetime(0.0f);
-
         glm::vec3 endToStart(segment.second - segment.first);
         glm::vec3 center(0.5f * (segment.first + segment.second));
-        particle->setLocalTransform(glm::translate(center));
-        particle->setDir(_absTransform * glm::vec4(glm::normalize(endToStart), 0.0f));
-        particle->setSize(glm::vec2(_lightningScale, glm::length(endToStart)));
+        _particles.push(center, glm::vec3(0.0f), 0.0f, 0);
 
-        addChild(*particle);
+        size_t index = _particles.size() - 1;
+        _particles.dirs[index] = _absTransform * glm::vec4(glm::normalize(endToStart), 0.0f);
+        _particles.sizes[index] = glm::vec2(_lightningScale, glm::length(endToStart));
     }
 }
 
@@ -251,7 +341,7 @@ void EmitterSceneNode::detonate() {
 }
 
 void EmitterSceneNode::renderLeafs(IRenderPass &pass, const std::vector<SceneNode *> &leafs) {
-    if (leafs.empty()) {
+    if (_particles.empty()) {
         return;
     }
     auto emitter = _modelNode.emitter();
@@ -263,54 +353,71 @@ void EmitterSceneNode::renderLeafs(IRenderPass &pass, const std::vector<SceneNod
     auto emitterUp = glm::vec3(_absTransform[1]);
     auto emitterForward = glm::vec3(_absTransform[2]);
 
-    auto view = _sceneGraph.camera()->get().camera()->view();
+    auto camera = _sceneGraph.camera()->get().camera();
+    auto view = camera->view();
     auto cameraRight = glm::vec3(view[0][0], view[1][0], view[2][0]);
     auto cameraUp = glm::vec3(view[0][1], view[1][1], view[2][1]);
-    auto cameraForward = glm::vec3(view[0][2], view[1][2], view[2][2]);
-
-    auto particles = std::vector<ParticleInstance>(leafs.size());
-    for (size_t i = 0; i < leafs.size(); ++i) {
-        const auto particle = static_cast<ParticleSceneNode *>(leafs[i]);
-        particles[i].frame = particle->frame();
-        particles[i].position = particle->origin();
-        particles[i].size = glm::vec2(particle->size());
-        particles[i].color = glm::vec4(particle->color(), particle->alpha());
-        switch (emitter->renderMode) {
-        case ModelNode::Emitter::RenderMode::BillboardToLocalZ:
-        case ModelNode::Emitter::RenderMode::MotionBlur:
-            if (emitter->renderMode == ModelNode::Emitter::RenderMode::MotionBlur) {
-                particles[i].size = glm::vec2(particle->size().x, (1.0f + kMotionBlurStrength * kProjectileSpeed) * particle->size().y);
-            }
-            particles[i].right = glm::vec4(emitterUp, 0.0f);
-            particles[i].up = glm::vec4(emitterRight, 0.0f);
-            break;
-        case ModelNode::Emitter::RenderMode::BillboardToWorldZ:
-            particles[i].right = glm::vec4(0.0f, 1.0f, 0.0, 0.0f);
-            particles[i].up = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
-            break;
-        case ModelNode::Emitter::RenderMode::AlignedToParticleDir:
-            particles[i].right = glm::vec4(emitterRight, 0.0f);
-            particles[i].up = glm::vec4(emitterForward, 0.0f);
-            break;
-        case ModelNode::Emitter::RenderMode::Linked: {
-            auto particleUp = particle->dir();
-            auto particleForward = glm::cross(particleUp, cameraRight);
-            auto particleRight = glm::cross(particleForward, particleUp);
-            particles[i].right = glm::vec4(particleRight, 0.0f);
-            particles[i].up = glm::vec4(particleUp, 0.0f);
-            break;
+
+    // Billboard axes are shared by all particles, except in Linked render mode
+    glm::vec3 right;
+    glm::vec3 up;
+    float sizeYScale = 1.0f;
+    switch (emitter->renderMode) {
+    case ModelNode::Emitter::RenderMode::BillboardToLocalZ:
+    case ModelNode::Emitter::RenderMode::MotionBlur:
+        if (emitter->renderMode == ModelNode::Emitter::RenderMode::MotionBlur) {
+            sizeYScale = 1.0f + kMotionBlurStrength * kProjectileSpeed;
+        }
+        right = emitterUp;
+        up = emitterRight;
+        break;
+    case ModelNode::Emitter::RenderMode::BillboardToWorldZ:
+        right = glm::vec3(0.0f, 1.0f, 0.0);
+        up = glm::vec3(1.0f, 0.0f, 0.0f);
+        break;
+    case ModelNode::Emitter::RenderMode::AlignedToParticleDir:
+        right = emitterRight;
+        up = emitterForward;
+        break;
+    case ModelNode::Emitter::RenderMode::Linked:
+        break;
+    case ModelNode::Emitter::RenderMode::Normal:
+    default:
+        right = cameraRight;
+        up = cameraUp;
+        break;
+    }
+    bool linked = emitter->renderMode == ModelNode::Emitter::RenderMode::Linked;
+
+    _instances.clear();
+    for (size_t i = 0; i < _particles.size(); ++i) {
+        auto position = glm::vec3(_absTransform * glm::vec4(_particles.positions[i], 1.0f));
+        if (!camera->isInFrustum(position)) {
+            continue;
         }
-        case ModelNode::Emitter::RenderMode::Normal:
-        default:
-            particles[i].right = glm::vec4(cameraRight, 0.0f);
-            particles[i].up = glm::vec4(cameraUp, 0.0f);
-            break;
+        ParticleInstance instance;
+        instance.frame = _particles.frames[i];
+        instance.position = position;
+        instance.size = glm::vec2(_particles.sizes[i].x, sizeYScale * _particles.sizes[i].y);
+        instance.color = _particles.colors[i];
+        if (linked) {
+            auto particleUp = _particles.dirs[i];
+            auto particleForward = glm::cross(particleUp, cameraRight);
+            instance.right = glm::cross(particleForward, particleUp);
+            instance.up = particleUp;
+        } else {
+            instance.right = right;
+            instance.up = up;
         }
+        _instances.push_back(instance);
+    }
+    if (_instances.empty()) {
+        return;
     }
     bool twosided = _modelNode.emitter()->twosided || _modelNode.emitter()->renderMode == ModelNode::Emitter::RenderMode::MotionBlur;
     auto faceCulling = twosided ? FaceCullMode::None : FaceCullMode::Back;
     bool premultipliedAlpha = emitter->blendMode == ModelNode::Emitter::BlendMode::Lighten;
-    pass.drawParticles(*texture, faceCulling, premultipliedAlpha, emitter->gridSize, particles);
+    pass.drawParticles(*texture, faceCulling, premultipliedAlpha, emitter->gridSize, _instances);
 }
 
 } // namespace scene
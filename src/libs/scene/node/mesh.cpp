@@ -59,15 +59,15 @@ void MeshSceneNode::initTextures() {
         return;
     }
     if (!mesh->diffuseMap.empty()) {
-        auto diffuseMap = _resourceSvc.textures.get(mesh->diffuseMap, TextureUsage::MainTex);
+        auto diffuseMap = _resourceSvc.textures.getAsync(mesh->diffuseMap, TextureUsage::MainTex);
         _nodeTextures.diffuse = diffuseMap.get();
     }
     if (!mesh->lightmap.empty()) {
-        auto lightmap = _resourceSvc.textures.get(mesh->lightmap, TextureUsage::Lightmap);
+        auto lightmap = _resourceSvc.textures.getAsync(mesh->lightmap, TextureUsage::Lightmap);
         _nodeTextures.lightmap = lightmap.get();
     }
     if (!mesh->bumpmap.empty()) {
-        auto bumpmap = _resourceSvc.textures.get(mesh->bumpmap, TextureUsage::BumpMap);
+        auto bumpmap = _resourceSvc.textures.getAsync(mesh->bumpmap, TextureUsage::BumpMap);
         _nodeTextures.bumpmap = bumpmap.get();
     }
     refreshAdditionalTextures();
@@ -80,12 +80,12 @@ void MeshSceneNode::refreshAdditionalTextures() {
     }
     const Texture::Features &features = _nodeTextures.diffuse->features();
     if (!features.envmapTexture.empty()) {
-        _nodeTextures.envmap = _resourceSvc.textures.get(features.envmapTexture, TextureUsage::EnvironmentMap).get();
+        _nodeTextures.envmap = _resourceSvc.textures.getAsync(features.envmapTexture, TextureUsage::EnvironmentMap).get();
     } else if (!features.bumpyShinyTexture.empty()) {
-        _nodeTextures.envmap = _resourceSvc.textures.get(features.bumpyShinyTexture, TextureUsage::EnvironmentMap).get();
+        _nodeTextures.envmap = _resourceSvc.textures.getAsync(features.bumpyShinyTexture, TextureUsage::EnvironmentMap).get();
     }
     if (!features.bumpmapTexture.empty()) {
-        _nodeTextures.bumpmap = _resourceSvc.textures.get(features.bumpmapTexture, TextureUsage::BumpMap).get();
+        _nodeTextures.bumpmap = _resourceSvc.textures.getAsync(features.bumpmapTexture, TextureUsage::BumpMap).get();
     }
 }
 
@@ -245,6 +245,33 @@ static bool isReceivingShadows(const ModelSceneNode &model, const MeshSceneNode
     return model.usage() == ModelUsage::Room;
 }
 
+void MeshSceneNode::prepareBones() {
+    const auto &skin = *_modelNode.mesh()->skin;
+    _bones.assign(kMaxBones, glm::mat4(1.0f));
+    for (size_t i = 0; i < kMaxBones; ++i) {
+        if (i >= skin.boneNodeNumber.size()) {
+            break;
+        }
+        auto nodeNumber = skin.boneNodeNumber[i];
+        if (nodeNumber == 0xffff) {
+            continue;
+        }
+        auto bone = _model.getNodeByNumber(nodeNumber);
+        if (!bone) {
+            continue;
+        }
+        _bones[i] = _modelNode.absoluteTransformInverse(); // convert bone transform in model space to bone transform in this model node space
+        _bones[i] *= _model.absoluteTransformInverse();    // convert bone transform in world space to bone transform in model space
+        _bones[i] *= bone->absoluteTransform();
+        _bones[i] *= skin.boneMatrices[skin.boneSerial[i]]; // extract changes to the bone transform in this model node space
+    }
+    _bonesPrepared = true;
+}
+
+void MeshSceneNode::onAbsoluteTransformChanged() {
+    _bonesPrepared = false;
+}
+
 void MeshSceneNode::render(IRenderPass &pass) {
     auto mesh = _modelNode.mesh();
     if (!mesh || !_nodeTextures.diffuse) {
@@ -290,26 +317,10 @@ void MeshSceneNode::render(IRenderPass &pass) {
     }
     material.faceCulling = _nodeTextures.diffuse->features().decal ? FaceCullMode::None : FaceCullMode::Back;
     if (_modelNode.isSkinMesh()) {
-        const auto &skin = *mesh->skin;
-        auto bones = std::vector<glm::mat4>(kMaxBones, glm::mat4(1.0f));
-        for (size_t i = 0; i < kMaxBones; ++i) {
-            if (i >= skin.boneNodeNumber.size()) {
-                break;
-            }
-            auto nodeNumber = skin.boneNodeNumber[i];
-            if (nodeNumber == 0xffff) {
-                continue;
-            }
-            auto bone = _model.getNodeByNumber(nodeNumber);
-            if (!bone) {
-                continue;
-            }
-            bones[i] = _modelNode.absoluteTransformInverse(); // convert bone transform in model space to bone transform in this model node space
-            bones[i] *= _model.absoluteTransformInverse();    // convert bone transform in world space to bone transform in model space
-            bones[i] *= bone->absoluteTransform();
-            bones[i] *= skin.boneMatrices[skin.boneSerial[i]]; // extract changes to the bone transform in this model node space
+        if (!_bonesPrepared) {
+            prepareBones();
         }
-        pass.drawSkinned(*mesh->mesh, material, _absTransform, _absTransformInv, std::move(bones));
+        pass.drawSkinned(*mesh->mesh, material, _absTransform, _absTransformInv, _bones);
     } else if (_modelNode.isDanglymesh()) {
         std::vector<glm::vec4> positions;
         positions.reserve(_dangly.vertices.size());
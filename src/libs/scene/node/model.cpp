@@ -52,6 +52,7 @@ void ModelSceneNode::init() {
     if (_model->rootNode()) {
         buildNodeTree(*_model->rootNode(), *this);
     }
+    indexNodes();
     computeAABB();
     _point = _aabb.isDegenerate();
 }
@@ -97,15 +98,64 @@ void ModelSceneNode::buildNodeTree(ModelNode &node, SceneNode &parent) {
     }
 }
 
+void ModelSceneNode::indexNodes() {
+    const auto &nodes = _model->nodes();
+    _nodeByIndex.resize(nodes.size());
+    _skinMeshes.clear();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto sceneNode = getNodeByNumber(nodes[i]->number());
+        _nodeByIndex[i] = sceneNode;
+        if (sceneNode && sceneNode->type() == SceneNodeType::Mesh && nodes[i]->isSkinMesh()) {
+            _skinMeshes.push_back(static_cast<MeshSceneNode *>(sceneNode));
+        }
+    }
+}
+
+/**
+ * Model root whose update is in progress on this thread. Models nested in it,
+ * e.g. attachments, queue their animation events for that root to signal.
+ */
+static thread_local ModelSceneNode *g_updatingRoot {nullptr};
+
 void ModelSceneNode::update(float dt) {
+    if (g_updatingRoot) {
+        updateDeferringEvents(dt);
+        if (!_pendingEvents.empty()) {
+            g_updatingRoot->_nestedWithEvents.push_back(this);
+        }
+        return;
+    }
+    updateDeferringEvents(dt);
+    signalPendingEvents();
+}
+
+void ModelSceneNode::updateDeferringEvents(float dt) {
     // Optimization: skip invisible models
     if (!_enabled) {
         return;
     }
-    SceneNode::update(dt);
+    if (g_updatingRoot) {
+        SceneNode::update(dt);
+    } else {
+        g_updatingRoot = this;
+        SceneNode::update(dt);
+        g_updatingRoot = nullptr;
+    }
     updateAnimations(dt);
 }
 
+void ModelSceneNode::signalPendingEvents() {
+    // Nested models are updated before this one, so signal their events first
+    for (auto &model : _nestedWithEvents) {
+        model->signalPendingEvents();
+    }
+    _nestedWithEvents.clear();
+    for (auto &event : _pendingEvents) {
+        signalEvent(event);
+    }
+    _pendingEvents.clear();
+}
+
 void ModelSceneNode::renderLeafs(IRenderPass &pass, const std::vector<SceneNode *> &leafs) {
     for (auto &leaf : leafs) {
         static_cast<MeshSceneNode *>(leaf)->render(pass);
@@ -216,6 +266,7 @@ void ModelSceneNode::playAnimation(Animation &anim, LipAnimation *lipAnim, Anima
         // In Single mode, clear channels and add animation on top
         _animChannels.clear();
         _animChannels.push_front(AnimationChannel(anim, lipAnim, properties));
+        bindAnimationChannel(_animChannels.front());
         break;
 
     case AnimationBlendMode::Blend: {
@@ -229,6 +280,7 @@ void ModelSceneNode::playAnimation(Animation &anim, LipAnimation *lipAnim, Anima
         }
         // Add animation on top
         _animChannels.push_front(AnimationChannel(anim, lipAnim, properties));
+        bindAnimationChannel(_animChannels.front());
         if (transition) {
             _animChannels[0].transition = true;
             _animChannels[0].time = glm::max(0.0f, _animChannels[0].anim->transitionTime() - kTransitionLength);
@@ -246,6 +298,7 @@ void ModelSceneNode::playAnimation(Animation &anim, LipAnimation *lipAnim, Anima
             _animChannels.clear();
         }
         _animChannels.push_front(AnimationChannel(anim, lipAnim, properties));
+        bindAnimationChannel(_animChannels.front());
         break;
 
     default:
@@ -305,10 +358,19 @@ void ModelSceneNode::updateAnimations(float dt) {
 
     // Apply states and compute bone transforms only when this model is not culled
     if (!_culled) {
-        applyAnimationStates(*_model->rootNode());
+        applyAnimationStates();
+        for (auto &mesh : _skinMeshes) {
+            mesh->prepareBones();
+        }
     }
 }
 
+void ModelSceneNode::bindAnimationChannel(AnimationChannel &channel) {
+    channel.binding = &_model->bindAnimation(*channel.anim);
+    channel.cursors.resize(channel.binding->nodes.size());
+    channel.states.resize(_model->nodes().size());
+}
+
 void ModelSceneNode::updateAnimationChannel(AnimationChannel &channel, float dt) {
     // Take length from the lip animation, if any
     float length = channel.lipAnim ? channel.lipAnim->length() : channel.anim->length();
@@ -325,15 +387,14 @@ void ModelSceneNode::updateAnimationChannel(AnimationChannel &channel, float dt)
     // Signal events between previous and current time
     for (auto &event : channel.anim->events()) {
         if (event.time > oldTime && event.time <= channel.time) {
-            signalEvent(event.name);
+            _pendingEvents.push_back(event.name);
         }
     }
 
     // Compute animation states only when this model is not culled
     if (!_culled) {
         float time = channel.transition ? channel.anim->transitionTime() : channel.time;
-        channel.stateByNodeNumber.clear();
-        computeAnimationStates(channel, time, *_model->rootNode());
+        computeAnimationStates(channel, time);
     }
 
     bool lastFrame = channel.time == length;
@@ -347,28 +408,17 @@ void ModelSceneNode::updateAnimationChannel(AnimationChannel &channel, float dt)
     }
 }
 
-static bool doesNodeHaveAncestor(const ModelNode &node, const std::string &name) {
-    if (name.empty()) {
-        return true;
-    }
-    if (node.name() == name) {
-        return true;
-    }
-    auto parent = node.parent();
-    if (!parent) {
-        return false;
-    }
-    return doesNodeHaveAncestor(*parent, name);
-}
+void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float time) {
+    const auto &boundNodes = channel.binding->nodes;
+    for (size_t i = 0; i < boundNodes.size(); ++i) {
+        const auto &boundNode = boundNodes[i];
+        auto &cursors = channel.cursors[i];
 
-void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float time, const ModelNode &modelNode) {
-    std::shared_ptr<ModelNode> animNode(channel.anim->getNodeByName(modelNode.name()));
-    if (animNode && modelNode.isAnimated() && doesNodeHaveAncestor(modelNode, channel.anim->root())) {
         AnimationState state;
         state.flags = 0;
 
-        glm::vec3 position(modelNode.restPosition());
-        glm::quat orientation(modelNode.restOrientation());
+        glm::vec3 position(boundNode.restPosition);
+        glm::quat orientation(boundNode.restOrientation);
         float scale = 1.0f;
 
         if (channel.lipAnim) {
@@ -380,27 +430,29 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
                 float rightShapeTime = rightShape * oneOverNumShapes * channel.anim->length();
                 glm::vec3 leftShapePos, rightShapePos;
                 glm::quat leftShapeRot, rightShapeRot;
-                if (animNode->positionAtTime(leftShapeTime, leftShapePos) &&
-                    animNode->positionAtTime(rightShapeTime, rightShapePos)) {
+                if (boundNode.position &&
+                    boundNode.position->valueAtTime(leftShapeTime, leftShapePos) &&
+                    boundNode.position->valueAtTime(rightShapeTime, rightShapePos)) {
                     position += channel.properties.scale * glm::mix(leftShapePos, rightShapePos, factor);
                     state.flags |= AnimationStateFlags::transform;
                 }
-                if (animNode->orientationAtTime(leftShapeTime, leftShapeRot) &&
-                    animNode->orientationAtTime(rightShapeTime, rightShapeRot)) {
+                if (boundNode.orientation &&
+                    boundNode.orientation->valueAtTime(leftShapeTime, leftShapeRot) &&
+                    boundNode.orientation->valueAtTime(rightShapeTime, rightShapeRot)) {
                     orientation = glm::slerp(leftShapeRot, rightShapeRot, factor);
                     state.flags |= AnimationStateFlags::transform;
                 }
             }
         } else {
             glm::vec3 animPosition;
-            if (animNode->positionAtTime(time, animPosition)) {
+            if (boundNode.position && boundNode.position->valueAtTime(time, animPosition, cursors.position)) {
                 position += channel.properties.scale * animPosition;
                 state.flags |= AnimationStateFlags::transform;
             }
-            if (animNode->orientationAtTime(time, orientation)) {
+            if (boundNode.orientation && boundNode.orientation->valueAtTime(time, orientation, cursors.orientation)) {
                 state.flags |= AnimationStateFlags::transform;
             }
-            if (animNode->scaleAtTime(time, scale)) {
+            if (boundNode.scale && boundNode.scale->valueAtTime(time, scale, cursors.scale)) {
                 state.flags |= AnimationStateFlags::transform;
             }
         }
@@ -409,44 +461,34 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
             state.transform *= glm::translate(position);
             state.transform *= glm::mat4_cast(orientation);
         }
-        if (animNode->floatValueAtTime(ControllerTypes::alpha, time, state.alpha)) {
+        if (boundNode.alpha && boundNode.alpha->valueAtTime(time, state.alpha, cursors.alpha)) {
             state.flags |= AnimationStateFlags::alpha;
         }
-        if (animNode->vectorValueAtTime(ControllerTypes::selfIllumColor, time, state.selfIllumColor)) {
+        if (boundNode.selfIllumColor && boundNode.selfIllumColor->valueAtTime(time, state.selfIllumColor, cursors.selfIllumColor)) {
             state.flags |= AnimationStateFlags::selfIllumColor;
         }
-        if (animNode->vectorValueAtTime(ControllerTypes::color, time, state.color)) {
+        if (boundNode.color && boundNode.color->valueAtTime(time, state.color, cursors.color)) {
             state.flags |= AnimationStateFlags::color;
         }
-        channel.stateByNodeNumber[modelNode.number()] = std::move(state);
-    }
-
-    for (auto &child : modelNode.children()) {
-        computeAnimationStates(channel, time, *child);
+        channel.states[boundNode.index] = std::move(state);
     }
 }
 
-void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
-    auto maybeSceneNode = _nodeByNumber.find(modelNode.number());
-    if (maybeSceneNode != _nodeByNumber.end()) {
-        auto sceneNode = maybeSceneNode->second;
+void ModelSceneNode::applyAnimationStates() {
+    for (size_t i = 0; i < _nodeByIndex.size(); ++i) {
+        auto sceneNode = _nodeByIndex[i];
+        if (!sceneNode) {
+            continue;
+        }
         AnimationState combined;
 
         switch (_animBlendMode) {
         case AnimationBlendMode::Single:
         case AnimationBlendMode::Blend: {
-            AnimationState state1;
-            auto state1Iter = _animChannels[0].stateByNodeNumber.find(modelNode.number());
-            if (state1Iter != _animChannels[0].stateByNodeNumber.end()) {
-                state1 = state1Iter->second;
-            }
+            const AnimationState &state1 = _animChannels[0].states[i];
             bool blend = _animBlendMode == AnimationBlendMode::Blend && _animChannels[0].transition && _animChannels.size() > 1ll;
             if (blend) {
-                AnimationState state2;
-                auto state2Iter = _animChannels[1].stateByNodeNumber.find(modelNode.number());
-                if (state2Iter != _animChannels[1].stateByNodeNumber.end()) {
-                    state2 = state2Iter->second;
-                }
+                const AnimationState &state2 = _animChannels[1].states[i];
                 if (state1.flags & AnimationStateFlags::transform && state2.flags & AnimationStateFlags::transform) {
                     float factor = glm::min(1.0f, _animChannels[0].time / _animChannels[0].anim->transitionTime());
                     glm::vec3 scale1, scale2, translation1, translation2, skew;
@@ -485,11 +527,7 @@ void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
         }
         case AnimationBlendMode::Overlay:
             for (auto &channel : _animChannels) {
-                auto maybeState = channel.stateByNodeNumber.find(modelNode.number());
-                if (maybeState == channel.stateByNodeNumber.end()) {
-                    continue;
-                }
-                const AnimationState &state = maybeState->second;
+                const AnimationState &state = channel.states[i];
                 if ((state.flags & AnimationStateFlags::transform) && !(combined.flags & AnimationStateFlags::transform)) {
                     combined.flags |= AnimationStateFlags::transform;
                     combined.transform = state.transform;
@@ -525,10 +563,6 @@ void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
             static_cast<LightSceneNode *>(sceneNode)->setColor(combined.color);
         }
     }
-
-    for (auto &child : modelNode.children()) {
-        applyAnimationStates(*child);
-    }
 }
 
 void ModelSceneNode::pauseAnimation() {
@@ -589,6 +623,7 @@ void ModelSceneNode::setModel(Model &model) {
     _animBlendMode = AnimationBlendMode::Single;
 
     buildNodeTree(*_model->rootNode(), *this);
+    indexNodes();
     computeAABB();
 }
 
@@ -18,6 +18,7 @@
 #include "reone/script/program.h"
 
 #include "reone/script/instrutil.h"
+#include "reone/system/exception/validation.h"
 
 namespace reone {
 
@@ -34,6 +35,36 @@ void ScriptProgram::add(Instruction instr) {
     _length += size;
     _insIdxByOffset.insert(std::make_pair(instr.offset, static_cast<int>(_instructions.size())));
     _instructions.push_back(std::move(instr));
+    _linked = false;
+    _verified = false;
+}
+
+void ScriptProgram::link() {
+    auto numInstructions = static_cast<int>(_instructions.size());
+    auto resolve = [this, numInstructions](uint32_t offset) {
+        if (offset >= _length) {
+            return numInstructions;
+        }
+        int idx = getInstructionIndex(offset);
+        if (idx == -1) {
+            throw ValidationException(str(boost::format("Instruction not found at offset %04x in '%s'") % offset % _name));
+        }
+        return idx;
+    };
+    for (auto &ins : _instructions) {
+        ins.nextIdx = resolve(ins.nextOffset);
+        switch (ins.type) {
+        case InstructionType::JMP:
+        case InstructionType::JSR:
+        case InstructionType::JZ:
+        case InstructionType::JNZ:
+            ins.jumpIdx = resolve(ins.offset + ins.jumpOffset);
+            break;
+        default:
+            break;
+        }
+    }
+    _linked = true;
 }
 
 const Instruction &ScriptProgram::getInstruction(uint32_t offset) const {
@@ -41,6 +72,11 @@ const Instruction &ScriptProgram::getInstruction(uint32_t offset) const {
     return _instructions[idx];
 }
 
+int ScriptProgram::getInstructionIndex(uint32_t offset) const {
+    auto maybeIdx = _insIdxByOffset.find(offset);
+    return maybeIdx != _insIdxByOffset.end() ? maybeIdx->second : -1;
+}
+
 Instruction Instruction::newCPDOWNSP(int stackOffset, uint16_t size) {
     Instruction val;
     val.type = InstructionType::CPDOWNSP;
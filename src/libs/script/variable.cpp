@@ -42,17 +42,15 @@ Variable Variable::ofFloat(float value) {
 }
 
 Variable Variable::ofString(std::string value) {
-    Variable result;
-    result.type = VariableType::String;
-    result.strValue = std::move(value);
-    return result;
+    Payload payload;
+    payload.strValue = std::move(value);
+    return ofPayload(VariableType::String, std::move(payload));
 }
 
 Variable Variable::ofVector(glm::vec3 value) {
-    Variable result;
-    result.type = VariableType::Vector;
-    result.vecValue = std::move(value);
-    return result;
+    Payload payload;
+    payload.vecValue = std::move(value);
+    return ofPayload(VariableType::Vector, std::move(payload));
 }
 
 Variable Variable::ofObject(uint32_t objectId) {
@@ -63,40 +61,67 @@ Variable Variable::ofObject(uint32_t objectId) {
 }
 
 Variable Variable::ofEffect(std::shared_ptr<EngineType> engineType) {
-    Variable result;
-    result.type = VariableType::Effect;
-    result.engineType = std::move(engineType);
-    return result;
+    Payload payload;
+    payload.engineType = std::move(engineType);
+    return ofPayload(VariableType::Effect, std::move(payload));
 }
 
 Variable Variable::ofEvent(std::shared_ptr<EngineType> engineType) {
-    Variable result;
-    result.type = VariableType::Event;
-    result.engineType = std::move(engineType);
-    return result;
+    Payload payload;
+    payload.engineType = std::move(engineType);
+    return ofPayload(VariableType::Event, std::move(payload));
 }
 
 Variable Variable::ofLocation(std::shared_ptr<EngineType> engineType) {
-    Variable result;
-    result.type = VariableType::Location;
-    result.engineType = std::move(engineType);
-    return result;
+    Payload payload;
+    payload.engineType = std::move(engineType);
+    return ofPayload(VariableType::Location, std::move(payload));
 }
 
 Variable Variable::ofTalent(std::shared_ptr<EngineType> engineType) {
-    Variable result;
-    result.type = VariableType::Talent;
-    result.engineType = std::move(engineType);
-    return result;
+    Payload payload;
+    payload.engineType = std::move(engineType);
+    return ofPayload(VariableType::Talent, std::move(payload));
 }
 
 Variable Variable::ofAction(std::shared_ptr<ExecutionContext> context) {
+    Payload payload;
+    payload.context = std::move(context);
+    return ofPayload(VariableType::Action, std::move(payload));
+}
+
+Variable Variable::ofPayload(VariableType type, Payload payload) {
     Variable result;
-    result.type = VariableType::Action;
-    result.context = std::move(context);
+    result.type = type;
+    // Default values need no payload, e.g. those pushed by RSADDx
+    if (!payload.strValue.empty() ||
+        payload.vecValue != glm::vec3(0.0f) ||
+        payload.engineType ||
+        payload.context) {
+        result._payload = new Payload(std::move(payload));
+    }
     return result;
 }
 
+const std::string &Variable::strValue() const {
+    static const std::string kEmpty;
+    return _payload ? _payload->strValue : kEmpty;
+}
+
+glm::vec3 Variable::vecValue() const {
+    return _payload ? _payload->vecValue : glm::vec3(0.0f);
+}
+
+const std::shared_ptr<EngineType> &Variable::engineType() const {
+    static const std::shared_ptr<EngineType> kNull;
+    return _payload ? _payload->engineType : kNull;
+}
+
+const std::shared_ptr<ExecutionContext> &Variable::context() const {
+    static const std::shared_ptr<ExecutionContext> kNull;
+    return _payload ? _payload->context : kNull;
+}
+
 const std::string Variable::toString() const {
     switch (type) {
     case VariableType::Void:
@@ -106,11 +131,11 @@ const std::string Variable::toString() const {
     case VariableType::Float:
         return std::to_string(floatValue);
     case VariableType::String:
-        return str(boost::format("\"%s\"") % strValue);
+        return str(boost::format("\"%s\"") % strValue());
     case VariableType::Object:
         return std::to_string(objectId);
     case VariableType::Vector:
-        return str(boost::format("[%f,%f,%f]") % vecValue.x % vecValue.y % vecValue.z);
+        return str(boost::format("[%f,%f,%f]") % vecValue().x % vecValue().y % vecValue().z);
     case VariableType::Effect:
         return "effect";
     case VariableType::Event:
@@ -0,0 +1,553 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/script/verifier.h"
+
+#include "reone/script/program.h"
+#include "reone/script/routine.h"
+#include "reone/script/routines.h"
+#include "reone/system/exception/validation.h"
+
+namespace reone {
+
+namespace script {
+
+// Void never appears on the stack, so it denotes a slot of unknown type
+static constexpr VariableType kUnknownType = VariableType::Void;
+
+static constexpr int kResumeOffset = 0x10;
+
+struct TypedOperation {
+    std::vector<VariableType> operands; /**< bottom to top */
+    std::vector<VariableType> results;
+};
+
+static constexpr VariableType I = VariableType::Int;
+static constexpr VariableType F = VariableType::Float;
+static constexpr VariableType S = VariableType::String;
+static constexpr VariableType O = VariableType::Object;
+static constexpr VariableType EFF = VariableType::Effect;
+static constexpr VariableType EVT = VariableType::Event;
+static constexpr VariableType LOC = VariableType::Location;
+static constexpr VariableType TAL = VariableType::Talent;
+
+// Instructions whose operand types are checked by the virtual machine
+static const std::unordered_map<InstructionType, TypedOperation> g_operations {
+    {InstructionType::LOGANDII, {{I, I}, {I}}},
+    {InstructionType::LOGORII, {{I, I}, {I}}},
+    {InstructionType::INCORII, {{I, I}, {I}}},
+    {InstructionType::EXCORII, {{I, I}, {I}}},
+    {InstructionType::BOOLANDII, {{I, I}, {I}}},
+    {InstructionType::EQUALII, {{I, I}, {I}}},
+    {InstructionType::EQUALFF, {{F, F}, {I}}},
+    {InstructionType::EQUALSS, {{S, S}, {I}}},
+    {InstructionType::EQUALOO, {{O, O}, {I}}},
+    {InstructionType::EQUALEFFEFF, {{EFF, EFF}, {I}}},
+    {InstructionType::EQUALEVTEVT, {{EVT, EVT}, {I}}},
+    {InstructionType::EQUALLOCLOC, {{LOC, LOC}, {I}}},
+    {InstructionType::EQUALTALTAL, {{TAL, TAL}, {I}}},
+    {InstructionType::NEQUALII, {{I, I}, {I}}},
+    {InstructionType::NEQUALFF, {{F, F}, {I}}},
+    {InstructionType::NEQUALSS, {{S, S}, {I}}},
+    {InstructionType::NEQUALOO, {{O, O}, {I}}},
+    {InstructionType::NEQUALEFFEFF, {{EFF, EFF}, {I}}},
+    {InstructionType::NEQUALEVTEVT, {{EVT, EVT}, {I}}},
+    {InstructionType::NEQUALLOCLOC, {{LOC, LOC}, {I}}},
+    {InstructionType::NEQUALTALTAL, {{TAL, TAL}, {I}}},
+    {InstructionType::GEQII, {{I, I}, {I}}},
+    {InstructionType::GEQFF, {{F, F}, {I}}},
+    {InstructionType::GTII, {{I, I}, {I}}},
+    {InstructionType::GTFF, {{F, F}, {I}}},
+    {InstructionType::LTII, {{I, I}, {I}}},
+    {InstructionType::LTFF, {{F, F}, {I}}},
+    {InstructionType::LEQII, {{I, I}, {I}}},
+    {InstructionType::LEQFF, {{F, F}, {I}}},
+    {InstructionType::SHLEFTII, {{I, I}, {I}}},
+    {InstructionType::SHRIGHTII, {{I, I}, {I}}},
+    {InstructionType::USHRIGHTII, {{I, I}, {I}}},
+    {InstructionType::ADDII, {{I, I}, {I}}},
+    {InstructionType::ADDIF, {{I, F}, {F}}},
+    {InstructionType::ADDFI, {{F, I}, {F}}},
+    {InstructionType::ADDFF, {{F, F}, {F}}},
+    {InstructionType::ADDSS, {{S, S}, {S}}},
+    {InstructionType::ADDVV, {{F, F, F, F, F, F}, {F, F, F}}},
+    {InstructionType::SUBII, {{I, I}, {I}}},
+    {InstructionType::SUBIF, {{I, F}, {F}}},
+    {InstructionType::SUBFI, {{F, I}, {F}}},
+    {InstructionType::SUBFF, {{F, F}, {F}}},
+    {InstructionType::SUBVV, {{F, F, F, F, F, F}, {F, F, F}}},
+    {InstructionType::MULII, {{I, I}, {I}}},
+    {InstructionType::MULIF, {{I, F}, {F}}},
+    {InstructionType::MULFI, {{F, I}, {F}}},
+    {InstructionType::MULFF, {{F, F}, {F}}},
+    {InstructionType::MULVF, {{F, F, F, F}, {F, F, F}}},
+    {InstructionType::MULFV, {{F, F, F, F}, {F, F, F}}},
+    {InstructionType::DIVII, {{I, I}, {I}}},
+    {InstructionType::DIVIF, {{I, F}, {F}}},
+    {InstructionType::DIVFI, {{F, I}, {F}}},
+    {InstructionType::DIVFF, {{F, F}, {F}}},
+    {InstructionType::DIVVF, {{F, F, F, F}, {F, F, F}}},
+    {InstructionType::DIVFV, {{F, F, F, F}, {F, F, F}}},
+    {InstructionType::MODII, {{I, I}, {I}}},
+    {InstructionType::NOTI, {{I}, {I}}}};
+
+void ScriptVerifier::verify(ScriptProgram &program) {
+    if (!program.isLinked()) {
+        program.link();
+    }
+    _program = &program;
+
+    auto &instructions = program._instructions;
+    auto numInstructions = static_cast<int>(instructions.size());
+    for (auto &ins : instructions) {
+        ins.typesVerified = false;
+    }
+    program._verified = false;
+    program._maxStackSize = 0;
+
+    _owners.assign(numInstructions, -1);
+    _joins.assign(numInstructions, false);
+    _typesVerified.assign(numInstructions, false);
+    _subroutines.clear();
+    _joinFrames.clear();
+    _resumeEntries.clear();
+
+    for (auto &ins : instructions) {
+        switch (ins.type) {
+        case InstructionType::JMP:
+        case InstructionType::JZ:
+        case InstructionType::JNZ:
+            if (ins.jumpIdx < numInstructions) {
+                _joins[ins.jumpIdx] = true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    int maxStackSize = 0;
+    if (numInstructions > 0) {
+        auto &main = analyze(0);
+        if (main.minDepth < 0) {
+            throw ValidationException(str(boost::format("Stack underflow in '%s'") % program.name()));
+        }
+        maxStackSize = main.maxDepth;
+    }
+    // Resumed actions start with saved globals and locals on the stack
+    for (size_t i = 0; i < _resumeEntries.size(); ++i) {
+        auto entryIdx = _resumeEntries[i].first;
+        auto savedSize = _resumeEntries[i].second;
+        auto &resumed = analyze(entryIdx);
+        if (resumed.minDepth < -savedSize) {
+            throw ValidationException(str(boost::format("Stack underflow in '%s'") % program.name()));
+        }
+        maxStackSize = std::max(maxStackSize, savedSize + resumed.maxDepth);
+    }
+
+    for (int i = 0; i < numInstructions; ++i) {
+        instructions[i].typesVerified = _typesVerified[i];
+    }
+    program._maxStackSize = maxStackSize;
+    program._verified = true;
+}
+
+const ScriptVerifier::Subroutine &ScriptVerifier::analyze(int entryIdx) {
+    auto &sub = _subroutines[entryIdx];
+    if (sub.done) {
+        return sub;
+    }
+    if (sub.analyzing) {
+        throw ValidationException(str(boost::format("Recursive subroutine at %04x") % _program->instructions()[entryIdx].offset));
+    }
+    sub.analyzing = true;
+
+    std::vector<std::pair<int, Frame>> pending;
+    pending.push_back(std::make_pair(entryIdx, Frame()));
+    while (!pending.empty()) {
+        auto insIdx = pending.back().first;
+        auto frame = std::move(pending.back().second);
+        pending.pop_back();
+        while (step(entryIdx, insIdx, frame, sub, pending)) {
+        }
+    }
+
+    sub.analyzing = false;
+    sub.done = true;
+
+    return sub;
+}
+
+bool ScriptVerifier::step(int entryIdx, int &insIdx, Frame &frame, Subroutine &sub, std::vector<std::pair<int, Frame>> &pending) {
+    auto &instructions = _program->_instructions;
+    auto numInstructions = static_cast<int>(instructions.size());
+    if (insIdx >= numInstructions) {
+        ret(frame, sub);
+        return false;
+    }
+    if (_joins[insIdx] && !merge(insIdx, frame)) {
+        return false;
+    }
+    auto &ins = instructions[insIdx];
+    bool firstVisit = _owners[insIdx] == -1;
+    if (firstVisit) {
+        _owners[insIdx] = entryIdx;
+    } else if (_owners[insIdx] != entryIdx) {
+        throw ValidationException(str(boost::format("Instruction at %04x is shared between subroutines") % ins.offset));
+    }
+
+    bool typesKnown = true;
+    int nextIdx = ins.nextIdx;
+    int count = ins.size / 4;
+    int stackIdx = frame.depth + ins.stackOffset / 4;
+
+    switch (ins.type) {
+    case InstructionType::CPDOWNSP:
+        if (stackIdx + count > frame.depth) {
+            throw ValidationException(str(boost::format("Stack offset out of range at %04x") % ins.offset));
+        }
+        touch(sub, stackIdx);
+        for (int i = 0; i < count; ++i) {
+            poke(frame, sub, stackIdx + i, peek(frame, frame.depth - count + i));
+        }
+        break;
+    case InstructionType::CPTOPSP:
+        if (stackIdx + count > frame.depth) {
+            throw ValidationException(str(boost::format("Stack offset out of range at %04x") % ins.offset));
+        }
+        touch(sub, stackIdx);
+        for (int i = 0; i < count; ++i) {
+            push(frame, sub, peek(frame, stackIdx + i));
+        }
+        break;
+    case InstructionType::RSADDI:
+    case InstructionType::CONSTI:
+        push(frame, sub, VariableType::Int);
+        break;
+    case InstructionType::RSADDF:
+    case InstructionType::CONSTF:
+        push(frame, sub, VariableType::Float);
+        break;
+    case InstructionType::RSADDS:
+    case InstructionType::CONSTS:
+        push(frame, sub, VariableType::String);
+        break;
+    case InstructionType::RSADDO:
+    case InstructionType::CONSTO:
+        push(frame, sub, VariableType::Object);
+        break;
+    case InstructionType::RSADDEFF:
+        push(frame, sub, VariableType::Effect);
+        break;
+    case InstructionType::RSADDEVT:
+        push(frame, sub, VariableType::Event);
+        break;
+    case InstructionType::RSADDLOC:
+        push(frame, sub, VariableType::Location);
+        break;
+    case InstructionType::RSADDTAL:
+        push(frame, sub, VariableType::Talent);
+        break;
+    case InstructionType::ACTION: {
+        if (ins.routine < 0 || ins.routine >= _routines.getNumRoutines()) {
+            throw ValidationException(str(boost::format("Invalid routine at %04x") % ins.offset));
+        }
+        auto &routine = _routines.get(ins.routine);
+        if (ins.argCount > routine.getArgumentCount()) {
+            throw ValidationException(str(boost::format("Too many routine arguments at %04x") % ins.offset));
+        }
+        for (int i = 0; i < ins.argCount; ++i) {
+            auto type = routine.getArgumentType(i);
+            if (type == VariableType::Vector) {
+                for (int j = 0; j < 3; ++j) {
+                    typesKnown &= pop(frame, sub, VariableType::Float);
+                }
+            } else if (type != VariableType::Action) {
+                typesKnown &= pop(frame, sub, type);
+            }
+        }
+        switch (routine.returnType()) {
+        case VariableType::Void:
+            break;
+        case VariableType::Vector:
+            for (int i = 0; i < 3; ++i) {
+                push(frame, sub, VariableType::Float);
+            }
+            break;
+        default:
+            push(frame, sub, routine.returnType());
+            break;
+        }
+        break;
+    }
+    case InstructionType::EQUALTT:
+    case InstructionType::NEQUALTT:
+        for (int i = 0; i < 2 * count; ++i) {
+            pop(frame, sub);
+        }
+        push(frame, sub, VariableType::Int);
+        break;
+    case InstructionType::NEGI:
+    case InstructionType::NEGF:
+        touch(sub, frame.depth - 1);
+        break;
+    case InstructionType::DECISP:
+    case InstructionType::INCISP:
+        if (stackIdx >= frame.depth) {
+            throw ValidationException(str(boost::format("Stack offset out of range at %04x") % ins.offset));
+        }
+        touch(sub, stackIdx);
+        break;
+    case InstructionType::MOVSP:
+        if (ins.stackOffset > 0) {
+            throw ValidationException(str(boost::format("Stack offset out of range at %04x") % ins.offset));
+        }
+        for (int i = 0; i < -ins.stackOffset / 4; ++i) {
+            pop(frame, sub);
+        }
+        break;
+    case InstructionType::JMP:
+        insIdx = ins.jumpIdx;
+        return true;
+    case InstructionType::JSR: {
+        if (ins.jumpIdx >= numInstructions) {
+            throw ValidationException(str(boost::format("Invalid subroutine at %04x") % ins.offset));
+        }
+        auto &callee = analyze(ins.jumpIdx);
+        if (!callee.returns) {
+            _typesVerified[insIdx] = true;
+            return false;
+        }
+        if (callee.ambiguousReturn) {
+            throw ValidationException(str(boost::format("Inconsistent stack depth on return from subroutine at %04x") % instructions[ins.jumpIdx].offset));
+        }
+        touch(sub, frame.depth + callee.minDepth);
+        // Frame size of the callee is folded into that of the caller, so
+        // that the VM reserves the stack once per run rather than per JSR
+        sub.maxDepth = std::max(sub.maxDepth, frame.depth + callee.maxDepth);
+        for (auto &write : callee.writesBelowEntry) {
+            int idx = frame.depth + write.first;
+            poke(frame, sub, idx, peek(frame, idx) == write.second ? write.second : kUnknownType);
+        }
+        if (callee.writesGlobals) {
+            if (frame.bp) {
+                for (int i = frame.bottom; i < std::min(*frame.bp, frame.depth); ++i) {
+                    frame.slots[i - frame.bottom] = kUnknownType;
+                }
+            } else {
+                sub.writesGlobals = true;
+            }
+        }
+        for (int i = 0; i > callee.returnDepth; --i) {
+            pop(frame, sub);
+        }
+        for (int i = 0; i < callee.returnDepth; ++i) {
+            push(frame, sub, kUnknownType);
+        }
+        break;
+    }
+    case InstructionType::JZ:
+    case InstructionType::JNZ:
+        typesKnown = pop(frame, sub, VariableType::Int);
+        pending.push_back(std::make_pair(ins.jumpIdx, frame));
+        break;
+    case InstructionType::RETN:
+        _typesVerified[insIdx] = true;
+        ret(frame, sub);
+        return false;
+    case InstructionType::DESTRUCT: {
+        int startIdx = frame.depth - count;
+        int keepIdx = startIdx + ins.stackOffset / 4;
+        int keepCount = ins.sizeNoDestroy / 4;
+        if (startIdx > frame.depth || keepIdx < startIdx || keepIdx + keepCount > frame.depth) {
+            throw ValidationException(str(boost::format("Stack offset out of range at %04x") % ins.offset));
+        }
+        std::vector<VariableType> kept;
+        for (int i = 0; i < keepCount; ++i) {
+            kept.push_back(peek(frame, keepIdx + i));
+        }
+        for (int i = 0; i < count; ++i) {
+            pop(frame, sub);
+        }
+        for (auto type : kept) {
+            push(frame, sub, type);
+        }
+        break;
+    }
+    case InstructionType::CPDOWNBP:
+        touch(sub, frame.depth - count);
+        if (frame.bp) {
+            int dstIdx = *frame.bp + ins.stackOffset / 4;
+            for (int i = 0; i < count; ++i) {
+                poke(frame, sub, dstIdx + i, peek(frame, frame.depth - count + i));
+            }
+        } else {
+            sub.writesGlobals = true;
+        }
+        break;
+    case InstructionType::CPTOPBP:
+        for (int i = 0; i < count; ++i) {
+            push(frame, sub, frame.bp ? peek(frame, *frame.bp + ins.stackOffset / 4 + i) : kUnknownType);
+        }
+        break;
+    case InstructionType::SAVEBP:
+        frame.bp = frame.depth;
+        push(frame, sub, VariableType::Int);
+        break;
+    case InstructionType::RESTOREBP:
+        typesKnown = pop(frame, sub, VariableType::Int);
+        frame.bp.reset();
+        break;
+    case InstructionType::STORE_STATE: {
+        int resumeIdx = _program->getInstructionIndex(ins.offset + kResumeOffset);
+        if (resumeIdx == -1) {
+            throw ValidationException(str(boost::format("Invalid saved state at %04x") % ins.offset));
+        }
+        touch(sub, frame.depth - ins.sizeLocals / 4);
+        _resumeEntries.push_back(std::make_pair(resumeIdx, count + ins.sizeLocals / 4));
+        break;
+    }
+    case InstructionType::DECIBP:
+    case InstructionType::INCIBP:
+    case InstructionType::NOP:
+    case InstructionType::NOP2:
+        break;
+    default: {
+        auto maybeOperation = g_operations.find(ins.type);
+        if (maybeOperation == g_operations.end()) {
+            throw ValidationException(str(boost::format("Unsupported instruction at %04x") % ins.offset));
+        }
+        auto &operands = maybeOperation->second.operands;
+        for (auto it = operands.rbegin(); it != operands.rend(); ++it) {
+            typesKnown &= pop(frame, sub, *it);
+        }
+        for (auto type : maybeOperation->second.results) {
+            push(frame, sub, type);
+        }
+        break;
+    }
+    }
+
+    _typesVerified[insIdx] = typesKnown && (firstVisit || _typesVerified[insIdx]);
+    insIdx = nextIdx;
+
+    return true;
+}
+
+bool ScriptVerifier::merge(int insIdx, Frame &frame) {
+    auto maybeJoined = _joinFrames.find(insIdx);
+    if (maybeJoined == _joinFrames.end()) {
+        _joinFrames.insert(std::make_pair(insIdx, frame));
+        return true;
+    }
+    auto &joined = maybeJoined->second;
+    if (joined.depth != frame.depth) {
+        throw ValidationException(str(boost::format("Stack depth mismatch at %04x") % _program->instructions()[insIdx].offset));
+    }
+    bool changed = false;
+    if (frame.bottom > joined.bottom) {
+        joined.slots.erase(joined.slots.begin(), joined.slots.begin() + (frame.bottom - joined.bottom));
+        joined.bottom = frame.bottom;
+        changed = true;
+    }
+    for (int i = joined.bottom; i < joined.depth; ++i) {
+        auto &type = joined.slots[i - joined.bottom];
+        if (type != kUnknownType && type != peek(frame, i)) {
+            type = kUnknownType;
+            changed = true;
+        }
+    }
+    if (joined.bp && joined.bp != frame.bp) {
+        joined.bp.reset();
+        changed = true;
+    }
+    frame = joined;
+
+    return changed;
+}
+
+void ScriptVerifier::ret(const Frame &frame, Subroutine &sub) {
+    if (sub.returns && sub.returnDepth != frame.depth) {
+        sub.ambiguousReturn = true;
+    }
+    sub.returns = true;
+    sub.returnDepth = frame.depth;
+
+    // Slots below subroutine entry pushed after popping arguments are writes
+    // to the caller stack
+    for (int i = frame.bottom; i < std::min(0, frame.depth); ++i) {
+        write(sub, i, peek(frame, i));
+    }
+}
+
+VariableType ScriptVerifier::peek(const Frame &frame, int index) const {
+    if (index < frame.bottom || index >= frame.depth) {
+        return kUnknownType;
+    }
+    return frame.slots[index - frame.bottom];
+}
+
+void ScriptVerifier::poke(Frame &frame, Subroutine &sub, int index, VariableType type) {
+    touch(sub, index);
+    if (index < 0) {
+        write(sub, index, type);
+    }
+    if (index >= frame.bottom && index < frame.depth) {
+        frame.slots[index - frame.bottom] = type;
+    }
+}
+
+void ScriptVerifier::write(Subroutine &sub, int index, VariableType type) {
+    auto maybeWrite = sub.writesBelowEntry.find(index);
+    if (maybeWrite == sub.writesBelowEntry.end()) {
+        sub.writesBelowEntry.insert(std::make_pair(index, type));
+    } else if (maybeWrite->second != type) {
+        maybeWrite->second = kUnknownType;
+    }
+}
+
+void ScriptVerifier::push(Frame &frame, Subroutine &sub, VariableType type) {
+    frame.slots.push_back(type);
+    ++frame.depth;
+    sub.maxDepth = std::max(sub.maxDepth, frame.depth);
+}
+
+VariableType ScriptVerifier::pop(Frame &frame, Subroutine &sub) {
+    auto type = kUnknownType;
+    if (!frame.slots.empty()) {
+        type = frame.slots.back();
+        frame.slots.pop_back();
+    }
+    --frame.depth;
+    if (frame.slots.empty()) {
+        frame.bottom = frame.depth;
+    }
+    touch(sub, frame.depth);
+    return type;
+}
+
+bool ScriptVerifier::pop(Frame &frame, Subroutine &sub, VariableType expected) {
+    return pop(frame, sub) == expected;
+}
+
+void ScriptVerifier::touch(Subroutine &sub, int index) {
+    sub.minDepth = std::min(sub.minDepth, index);
+}
+
+} // namespace script
+
+} // namespace reone
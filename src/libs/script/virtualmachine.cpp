@@ -23,6 +23,9 @@
 #include "reone/script/routine.h"
 #include "reone/script/routines.h"
 #include "reone/script/variable.h"
+#include "reone/script/verifier.h"
+#include "reone/system/exception/notimplemented.h"
+#include "reone/system/exception/validation.h"
 #include "reone/system/logger.h"
 #include "reone/system/logutil.h"
 
@@ -33,108 +36,32 @@ namespace script {
 static constexpr int kStartInstructionOffset = 13;
 static constexpr float kFloatTolerance = 1e-5;
 
+static constexpr int kInitialStackSize = 64;
+static constexpr int kInitialReturnStackSize = 8;
+static constexpr int kMaxPooledStacks = 16;
+
+// Scripts are executed often and briefly, so stack storage is recycled
+// between virtual machines running on the same thread
+static thread_local std::vector<std::vector<Variable>> g_freeStacks;
+
 VirtualMachine::VirtualMachine(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context) :
     _context(std::move(context)),
     _program(std::move(program)) {
 
-    static std::unordered_map<InstructionType, std::function<void(VirtualMachine *, const Instruction &)>> g_handlers {
-        {InstructionType::CPDOWNSP, &VirtualMachine::executeCPDOWNSP},
-        {InstructionType::RSADDI, &VirtualMachine::executeRSADDI},
-        {InstructionType::RSADDF, &VirtualMachine::executeRSADDF},
-        {InstructionType::RSADDS, &VirtualMachine::executeRSADDS},
-        {InstructionType::RSADDO, &VirtualMachine::executeRSADDO},
-        {InstructionType::RSADDEFF, &VirtualMachine::executeRSADDEFF},
-        {InstructionType::RSADDEVT, &VirtualMachine::executeRSADDEVT},
-        {InstructionType::RSADDLOC, &VirtualMachine::executeRSADDLOC},
-        {InstructionType::RSADDTAL, &VirtualMachine::executeRSADDTAL},
-        {InstructionType::CPTOPSP, &VirtualMachine::executeCPTOPSP},
-        {InstructionType::CONSTI, &VirtualMachine::executeCONSTI},
-        {InstructionType::CONSTF, &VirtualMachine::executeCONSTF},
-        {InstructionType::CONSTS, &VirtualMachine::executeCONSTS},
-        {InstructionType::CONSTO, &VirtualMachine::executeCONSTO},
-        {InstructionType::ACTION, &VirtualMachine::executeACTION},
-        {InstructionType::LOGANDII, &VirtualMachine::executeLOGANDII},
-        {InstructionType::LOGORII, &VirtualMachine::executeLOGORII},
-        {InstructionType::INCORII, &VirtualMachine::executeINCORII},
-        {InstructionType::EXCORII, &VirtualMachine::executeEXCORII},
-        {InstructionType::BOOLANDII, &VirtualMachine::executeBOOLANDII},
-        {InstructionType::EQUALII, &VirtualMachine::executeEQUALII},
-        {InstructionType::EQUALFF, &VirtualMachine::executeEQUALFF},
-        {InstructionType::EQUALSS, &VirtualMachine::executeEQUALSS},
-        {InstructionType::EQUALOO, &VirtualMachine::executeEQUALOO},
-        {InstructionType::EQUALTT, &VirtualMachine::executeEQUALTT},
-        {InstructionType::EQUALEFFEFF, &VirtualMachine::executeEQUALEFFEFF},
-        {InstructionType::EQUALEVTEVT, &VirtualMachine::executeEQUALEVTEVT},
-        {InstructionType::EQUALLOCLOC, &VirtualMachine::executeEQUALLOCLOC},
-        {InstructionType::EQUALTALTAL, &VirtualMachine::executeEQUALTALTAL},
-        {InstructionType::NEQUALII, &VirtualMachine::executeNEQUALII},
-        {InstructionType::NEQUALFF, &VirtualMachine::executeNEQUALFF},
-        {InstructionType::NEQUALSS, &VirtualMachine::executeNEQUALSS},
-        {InstructionType::NEQUALOO, &VirtualMachine::executeNEQUALOO},
-        {InstructionType::NEQUALTT, &VirtualMachine::executeNEQUALTT},
-        {InstructionType::NEQUALEFFEFF, &VirtualMachine::executeNEQUALEFFEFF},
-        {InstructionType::NEQUALEVTEVT, &VirtualMachine::executeNEQUALEVTEVT},
-        {InstructionType::NEQUALLOCLOC, &VirtualMachine::executeNEQUALLOCLOC},
-        {InstructionType::NEQUALTALTAL, &VirtualMachine::executeNEQUALTALTAL},
-        {InstructionType::GEQII, &VirtualMachine::executeGEQII},
-        {InstructionType::GEQFF, &VirtualMachine::executeGEQFF},
-        {InstructionType::GTII, &VirtualMachine::executeGTII},
-        {InstructionType::GTFF, &VirtualMachine::executeGTFF},
-        {InstructionType::LTII, &VirtualMachine::executeLTII},
-        {InstructionType::LTFF, &VirtualMachine::executeLTFF},
-        {InstructionType::LEQII, &VirtualMachine::executeLEQII},
-        {InstructionType::LEQFF, &VirtualMachine::executeLEQFF},
-        {InstructionType::SHLEFTII, &VirtualMachine::executeSHLEFTII},
-        {InstructionType::SHRIGHTII, &VirtualMachine::executeSHRIGHTII},
-        {InstructionType::USHRIGHTII, &VirtualMachine::executeUSHRIGHTII},
-        {InstructionType::ADDII, &VirtualMachine::executeADDII},
-        {InstructionType::ADDIF, &VirtualMachine::executeADDIF},
-        {InstructionType::ADDFI, &VirtualMachine::executeADDFI},
-        {InstructionType::ADDFF, &VirtualMachine::executeADDFF},
-        {InstructionType::ADDSS, &VirtualMachine::executeADDSS},
-        {InstructionType::ADDVV, &VirtualMachine::executeADDVV},
-        {InstructionType::SUBII, &VirtualMachine::executeSUBII},
-        {InstructionType::SUBIF, &VirtualMachine::executeSUBIF},
-        {InstructionType::SUBFI, &VirtualMachine::executeSUBFI},
-        {InstructionType::SUBFF, &VirtualMachine::executeSUBFF},
-        {InstructionType::SUBVV, &VirtualMachine::executeSUBVV},
-        {InstructionType::MULII, &VirtualMachine::executeMULII},
-        {InstructionType::MULIF, &VirtualMachine::executeMULIF},
-        {InstructionType::MULFI, &VirtualMachine::executeMULFI},
-        {InstructionType::MULFF, &VirtualMachine::executeMULFF},
-        {InstructionType::MULVF, &VirtualMachine::executeMULVF},
-        {InstructionType::MULFV, &VirtualMachine::executeMULFV},
-        {InstructionType::DIVII, &VirtualMachine::executeDIVII},
-        {InstructionType::DIVIF, &VirtualMachine::executeDIVIF},
-        {InstructionType::DIVFI, &VirtualMachine::executeDIVFI},
-        {InstructionType::DIVFF, &VirtualMachine::executeDIVFF},
-        {InstructionType::DIVVF, &VirtualMachine::executeDIVVF},
-        {InstructionType::DIVFV, &VirtualMachine::executeDIVFV},
-        {InstructionType::MODII, &VirtualMachine::executeMODII},
-        {InstructionType::NEGI, &VirtualMachine::executeNEGI},
-        {InstructionType::NEGF, &VirtualMachine::executeNEGF},
-        {InstructionType::MOVSP, &VirtualMachine::executeMOVSP},
-        {InstructionType::JMP, &VirtualMachine::executeJMP},
-        {InstructionType::JSR, &VirtualMachine::executeJSR},
-        {InstructionType::JZ, &VirtualMachine::executeJZ},
-        {InstructionType::RETN, &VirtualMachine::executeRETN},
-        {InstructionType::DESTRUCT, &VirtualMachine::executeDESTRUCT},
-        {InstructionType::NOTI, &VirtualMachine::executeNOTI},
-        {InstructionType::DECISP, &VirtualMachine::executeDECISP},
-        {InstructionType::INCISP, &VirtualMachine::executeINCISP},
-        {InstructionType::JNZ, &VirtualMachine::executeJNZ},
-        {InstructionType::CPDOWNBP, &VirtualMachine::executeCPDOWNBP},
-        {InstructionType::CPTOPBP, &VirtualMachine::executeCPTOPBP},
-        {InstructionType::DECIBP, &VirtualMachine::executeDECIBP},
-        {InstructionType::INCIBP, &VirtualMachine::executeINCIBP},
-        {InstructionType::SAVEBP, &VirtualMachine::executeSAVEBP},
-        {InstructionType::RESTOREBP, &VirtualMachine::executeRESTOREBP},
-        {InstructionType::STORE_STATE, &VirtualMachine::executeSTORE_STATE}};
-    for (auto &pair : g_handlers) {
-        registerHandler(pair.first, pair.second);
+    if (!g_freeStacks.empty()) {
+        _stack = std::move(g_freeStacks.back());
+        g_freeStacks.pop_back();
+    } else {
+        _stack.reserve(kInitialStackSize);
+    }
+    _returnIndices.reserve(kInitialReturnStackSize);
+}
+
+VirtualMachine::~VirtualMachine() {
+    if (g_freeStacks.size() < kMaxPooledStacks) {
+        _stack.clear();
+        g_freeStacks.push_back(std::move(_stack));
     }
-    _handlers.insert(std::make_pair(InstructionType::NOP, [](auto &) {}));
-    _handlers.insert(std::make_pair(InstructionType::NOP2, [](auto &) {}));
 }
 
 int VirtualMachine::run() {
@@ -158,27 +85,50 @@ int VirtualMachine::run() {
               _context->triggererId),
           LogChannel::Script);
 
-    while (insOff < _program->length()) {
-        const Instruction &ins = _program->getInstruction(insOff);
-        auto handler = _handlers.find(ins.type);
-
-        if (handler == _handlers.end()) {
-            error(str(boost::format("Instruction not implemented: %04x") % static_cast<int>(ins.type)), LogChannel::Script);
+    if (!_program->isLinked()) {
+        try {
+            _program->link();
+        } catch (const std::exception &ex) {
+            error(str(boost::format("Link '%s': %s") % _program->name() % ex.what()), LogChannel::Script);
+            return -1;
+        }
+        // Programs that fail verification are executed with all runtime checks
+        if (_context->routines) {
+            try {
+                ScriptVerifier(*_context->routines).verify(*_program);
+            } catch (const ValidationException &ex) {
+                warn(str(boost::format("Verify '%s': %s") % _program->name() % ex.what()), LogChannel::Script);
+            }
+        }
+    }
+    _stack.reserve(_stack.size() + _program->maxStackSize());
+    const std::vector<Instruction> &instructions = _program->instructions();
+    auto numInstructions = static_cast<int>(instructions.size());
+    int insIdx = numInstructions;
+    if (insOff < _program->length()) {
+        insIdx = _program->getInstructionIndex(insOff);
+        if (insIdx == -1) {
+            error(str(boost::format("Instruction not found: %04x") % insOff), LogChannel::Script);
             return -1;
         }
-        _nextInstruction = ins.nextOffset;
+    }
+
+    while (insIdx < numInstructions) {
+        const Instruction &ins = instructions[insIdx];
+        _nextInstruction = ins.nextIdx;
+        _checkTypes = !ins.typesVerified;
 
         if (Logger::instance.isChannelEnabled(LogChannel::Script3)) {
             debug(str(boost::format("Instruction: %s") % describeInstruction(ins, *_context->routines)), LogChannel::Script3);
         }
         try {
-            handler->second(ins);
+            execute(ins);
         } catch (const std::exception &ex) {
             debug(str(boost::format("Halt '%s'") % _program->name()), LogChannel::Script);
             return -1;
         }
 
-        insOff = _nextInstruction;
+        insIdx = _nextInstruction;
     }
 
     if (!_stack.empty() && _stack.back().type == VariableType::Int) {
@@ -188,6 +138,116 @@ int VirtualMachine::run() {
     return -1;
 }
 
+#define R_INSTR_CASE(a)      \
+    case InstructionType::a: \
+        execute##a(ins);     \
+        break;
+
+void VirtualMachine::execute(const Instruction &ins) {
+    switch (ins.type) {
+    R_INSTR_CASE(CPDOWNSP)
+    R_INSTR_CASE(RSADDI)
+    R_INSTR_CASE(RSADDF)
+    R_INSTR_CASE(RSADDS)
+    R_INSTR_CASE(RSADDO)
+    R_INSTR_CASE(RSADDEFF)
+    R_INSTR_CASE(RSADDEVT)
+    R_INSTR_CASE(RSADDLOC)
+    R_INSTR_CASE(RSADDTAL)
+    R_INSTR_CASE(CPTOPSP)
+    R_INSTR_CASE(CONSTI)
+    R_INSTR_CASE(CONSTF)
+    R_INSTR_CASE(CONSTS)
+    R_INSTR_CASE(CONSTO)
+    R_INSTR_CASE(ACTION)
+    R_INSTR_CASE(LOGANDII)
+    R_INSTR_CASE(LOGORII)
+    R_INSTR_CASE(INCORII)
+    R_INSTR_CASE(EXCORII)
+    R_INSTR_CASE(BOOLANDII)
+    R_INSTR_CASE(EQUALII)
+    R_INSTR_CASE(EQUALFF)
+    R_INSTR_CASE(EQUALSS)
+    R_INSTR_CASE(EQUALOO)
+    R_INSTR_CASE(EQUALTT)
+    R_INSTR_CASE(EQUALEFFEFF)
+    R_INSTR_CASE(EQUALEVTEVT)
+    R_INSTR_CASE(EQUALLOCLOC)
+    R_INSTR_CASE(EQUALTALTAL)
+    R_INSTR_CASE(NEQUALII)
+    R_INSTR_CASE(NEQUALFF)
+    R_INSTR_CASE(NEQUALSS)
+    R_INSTR_CASE(NEQUALOO)
+    R_INSTR_CASE(NEQUALTT)
+    R_INSTR_CASE(NEQUALEFFEFF)
+    R_INSTR_CASE(NEQUALEVTEVT)
+    R_INSTR_CASE(NEQUALLOCLOC)
+    R_INSTR_CASE(NEQUALTALTAL)
+    R_INSTR_CASE(GEQII)
+    R_INSTR_CASE(GEQFF)
+    R_INSTR_CASE(GTII)
+    R_INSTR_CASE(GTFF)
+    R_INSTR_CASE(LTII)
+    R_INSTR_CASE(LTFF)
+    R_INSTR_CASE(LEQII)
+    R_INSTR_CASE(LEQFF)
+    R_INSTR_CASE(SHLEFTII)
+    R_INSTR_CASE(SHRIGHTII)
+    R_INSTR_CASE(USHRIGHTII)
+    R_INSTR_CASE(ADDII)
+    R_INSTR_CASE(ADDIF)
+    R_INSTR_CASE(ADDFI)
+    R_INSTR_CASE(ADDFF)
+    R_INSTR_CASE(ADDSS)
+    R_INSTR_CASE(ADDVV)
+    R_INSTR_CASE(SUBII)
+    R_INSTR_CASE(SUBIF)
+    R_INSTR_CASE(SUBFI)
+    R_INSTR_CASE(SUBFF)
+    R_INSTR_CASE(SUBVV)
+    R_INSTR_CASE(MULII)
+    R_INSTR_CASE(MULIF)
+    R_INSTR_CASE(MULFI)
+    R_INSTR_CASE(MULFF)
+    R_INSTR_CASE(MULVF)
+    R_INSTR_CASE(MULFV)
+    R_INSTR_CASE(DIVII)
+    R_INSTR_CASE(DIVIF)
+    R_INSTR_CASE(DIVFI)
+    R_INSTR_CASE(DIVFF)
+    R_INSTR_CASE(DIVVF)
+    R_INSTR_CASE(DIVFV)
+    R_INSTR_CASE(MODII)
+    R_INSTR_CASE(NEGI)
+    R_INSTR_CASE(NEGF)
+    R_INSTR_CASE(MOVSP)
+    R_INSTR_CASE(JMP)
+    R_INSTR_CASE(JSR)
+    R_INSTR_CASE(JZ)
+    R_INSTR_CASE(RETN)
+    R_INSTR_CASE(DESTRUCT)
+    R_INSTR_CASE(DECISP)
+    R_INSTR_CASE(INCISP)
+    R_INSTR_CASE(NOTI)
+    R_INSTR_CASE(JNZ)
+    R_INSTR_CASE(CPDOWNBP)
+    R_INSTR_CASE(CPTOPBP)
+    R_INSTR_CASE(DECIBP)
+    R_INSTR_CASE(INCIBP)
+    R_INSTR_CASE(SAVEBP)
+    R_INSTR_CASE(RESTOREBP)
+    R_INSTR_CASE(STORE_STATE)
+    case InstructionType::NOP:
+    case InstructionType::NOP2:
+        break;
+    default:
+        error(str(boost::format("Instruction not implemented: %04x") % static_cast<int>(ins.type)), LogChannel::Script);
+        throw NotImplementedException("Instruction not implemented");
+    }
+}
+
+#undef R_INSTR_CASE
+
 void VirtualMachine::executeCPDOWNSP(const Instruction &ins) {
     int count = ins.size / 4;
     int srcIdx = static_cast<int>(_stack.size()) - count;
@@ -262,35 +322,35 @@ void VirtualMachine::executeACTION(const Instruction &ins) {
         throw std::invalid_argument("Too many routine arguments");
     }
 
-    std::vector<Variable> args;
+    _args.clear();
     for (int i = 0; i < ins.argCount; ++i) {
         VariableType type = routine.getArgumentType(i);
         switch (type) {
         case VariableType::Vector:
-            args.push_back(Variable::ofVector(getVectorFromStack()));
+            _args.push_back(Variable::ofVector(getVectorFromStack()));
             break;
 
         case VariableType::Action: {
             auto ctx = std::make_shared<ExecutionContext>(*_context);
             ctx->savedState = std::make_shared<ExecutionState>(_savedState);
-            args.push_back(Variable::ofAction(std::move(ctx)));
+            _args.push_back(Variable::ofAction(std::move(ctx)));
             break;
         }
         default:
             Variable var(_stack.back());
-            if (var.type != type) {
+            if (_checkTypes && var.type != type) {
                 throw std::runtime_error("Invalid argument variable type");
             }
-            args.push_back(std::move(var));
+            _args.push_back(std::move(var));
             _stack.pop_back();
             break;
         }
     }
 
-    Variable retValue = routine.invoke(args, *_context);
+    Variable retValue = routine.invoke(_args, *_context);
     if (Logger::instance.isChannelEnabled(LogChannel::Script2)) {
         std::vector<std::string> argStrings;
-        for (auto &arg : args) {
+        for (auto &arg : _args) {
             argStrings.push_back(arg.toString());
         }
         std::string argsString(boost::join(argStrings, ", "));
@@ -300,9 +360,9 @@ void VirtualMachine::executeACTION(const Instruction &ins) {
     case VariableType::Void:
         break;
     case VariableType::Vector:
-        _stack.push_back(Variable::ofFloat(retValue.vecValue.z));
-        _stack.push_back(Variable::ofFloat(retValue.vecValue.y));
-        _stack.push_back(Variable::ofFloat(retValue.vecValue.x));
+        _stack.push_back(Variable::ofFloat(retValue.vecValue().z));
+        _stack.push_back(Variable::ofFloat(retValue.vecValue().y));
+        _stack.push_back(Variable::ofFloat(retValue.vecValue().x));
         break;
     default:
         _stack.push_back(retValue);
@@ -718,27 +778,27 @@ void VirtualMachine::executeMOVSP(const Instruction &ins) {
 }
 
 void VirtualMachine::executeJMP(const Instruction &ins) {
-    _nextInstruction = ins.offset + ins.jumpOffset;
+    _nextInstruction = ins.jumpIdx;
 }
 
 void VirtualMachine::executeJSR(const Instruction &ins) {
-    _returnOffsets.push_back(ins.nextOffset);
-    _nextInstruction = ins.offset + ins.jumpOffset;
+    _returnIndices.push_back(ins.nextIdx);
+    _nextInstruction = ins.jumpIdx;
 }
 
 void VirtualMachine::executeJZ(const Instruction &ins) {
     bool zero = getIntFromStack() == 0;
     if (zero) {
-        _nextInstruction = ins.offset + ins.jumpOffset;
+        _nextInstruction = ins.jumpIdx;
     }
 }
 
 void VirtualMachine::executeRETN(const Instruction &ins) {
-    if (_returnOffsets.empty()) {
-        _nextInstruction = _program->length();
+    if (_returnIndices.empty()) {
+        _nextInstruction = static_cast<int>(_program->instructions().size());
     } else {
-        _nextInstruction = _returnOffsets.back();
-        _returnOffsets.pop_back();
+        _nextInstruction = _returnIndices.back();
+        _returnIndices.pop_back();
     }
 }
 
@@ -771,7 +831,7 @@ void VirtualMachine::executeNOTI(const Instruction &ins) {
 void VirtualMachine::executeJNZ(const Instruction &ins) {
     bool notZero = getIntFromStack() != 0;
     if (notZero) {
-        _nextInstruction = ins.offset + ins.jumpOffset;
+        _nextInstruction = ins.jumpIdx;
     }
 }
 
@@ -906,7 +966,7 @@ void VirtualMachine::withStringsFromStack(const std::function<void(const std::st
     withStackVariables([this, &fn](auto &left, auto &right) {
         throwIfInvalidType(VariableType::String, left.type);
         throwIfInvalidType(VariableType::String, right.type);
-        fn(left.strValue, right.strValue);
+        fn(left.strValue(), right.strValue());
     });
 }
 
@@ -922,7 +982,7 @@ void VirtualMachine::withEffectsFromStack(const std::function<void(const std::sh
     withStackVariables([this, &fn](auto &left, auto &right) {
         throwIfInvalidType(VariableType::Effect, left.type);
         throwIfInvalidType(VariableType::Effect, right.type);
-        fn(left.engineType, right.engineType);
+        fn(left.engineType(), right.engineType());
     });
 }
 
@@ -930,7 +990,7 @@ void VirtualMachine::withEventsFromStack(const std::function<void(const std::sha
     withStackVariables([this, &fn](auto &left, auto &right) {
         throwIfInvalidType(VariableType::Event, left.type);
         throwIfInvalidType(VariableType::Event, right.type);
-        fn(left.engineType, right.engineType);
+        fn(left.engineType(), right.engineType());
     });
 }
 
@@ -938,7 +998,7 @@ void VirtualMachine::withLocationsFromStack(const std::function<void(const std::
     withStackVariables([this, &fn](auto &left, auto &right) {
         throwIfInvalidType(VariableType::Location, left.type);
         throwIfInvalidType(VariableType::Location, right.type);
-        fn(left.engineType, right.engineType);
+        fn(left.engineType(), right.engineType());
     });
 }
 
@@ -946,7 +1006,7 @@ void VirtualMachine::withTalentsFromStack(const std::function<void(const std::sh
     withStackVariables([this, &fn](auto &left, auto &right) {
         throwIfInvalidType(VariableType::Talent, left.type);
         throwIfInvalidType(VariableType::Talent, right.type);
-        fn(left.engineType, right.engineType);
+        fn(left.engineType(), right.engineType());
     });
 }
 
@@ -972,7 +1032,7 @@ void VirtualMachine::withVectorsFromStack(const std::function<void(const glm::ve
 }
 
 void VirtualMachine::throwIfInvalidType(VariableType expected, VariableType actual) {
-    if (actual != expected) {
+    if (_checkTypes && actual != expected) {
         throw std::runtime_error(str(boost::format("Invalid variable type: expected=%d, actual=%d") %
                                      static_cast<int>(expected) %
                                      static_cast<int>(actual)));
@@ -21,101 +21,91 @@
 namespace reone {
 
 uint8_t BinaryReader::readByte() {
-    return static_cast<uint8_t>(_stream.readByte());
+    return static_cast<uint8_t>(_memory ? _memory->readByte() : _stream.readByte());
 }
 
 char BinaryReader::readChar() {
     char val;
-    if (_stream.read(&val, 1) != 1) {
-        throw EndOfStreamException();
-    }
+    read(&val, 1);
     return val;
 }
 
 uint16_t BinaryReader::readUint16() {
-    uint16_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 2) != 2) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return val;
+    return readValue<uint16_t>();
 }
 
 uint32_t BinaryReader::readUint32() {
-    uint32_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 4) != 4) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return val;
+    return readValue<uint32_t>();
 }
 
 uint64_t BinaryReader::readUint64() {
-    uint64_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 8) != 8) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return val;
+    return readValue<uint64_t>();
 }
 
 int16_t BinaryReader::readInt16() {
-    int16_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 2) != 2) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return val;
+    return readValue<int16_t>();
 }
 
 int32_t BinaryReader::readInt32() {
-    int32_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 4) != 4) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return val;
+    return readValue<int32_t>();
 }
 
 int64_t BinaryReader::readInt64() {
-    int64_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 8) != 8) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return val;
+    return readValue<int64_t>();
 }
 
 float BinaryReader::readFloat() {
-    uint32_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 4) != 4) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return *reinterpret_cast<float *>(&val);
+    auto bits = readValue<uint32_t>();
+    float val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
 }
 
 double BinaryReader::readDouble() {
-    uint64_t val;
-    if (_stream.read(reinterpret_cast<char *>(&val), 8) != 8) {
-        throw EndOfStreamException();
-    }
-    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
-    return *reinterpret_cast<double *>(&val);
+    auto bits = readValue<uint64_t>();
+    double val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
 }
 
 std::string BinaryReader::readString(int len) {
+    if (_memory) {
+        return std::string(readStringView(len));
+    }
     std::vector<char> buf;
     buf.resize(len + 1, '\0');
-    if (_stream.read(&buf[0], len) != len) {
+    read(&buf[0], len);
+    return std::string(&buf[0]);
+}
+
+std::string_view BinaryReader::readStringView(int len) {
+    if (!_memory) {
+        throw std::logic_error("String views require a memory input stream");
+    }
+    auto data = _memory->consume(len);
+    if (!data) {
         throw EndOfStreamException();
     }
-    return std::string(&buf[0]);
+    auto term = static_cast<const char *>(std::memchr(data, '\0', len));
+    return std::string_view(data, term ? term - data : len);
 }
 
 std::string BinaryReader::readCString(int maxlen) {
     auto pos = _stream.position();
 
+    if (_memory) {
+        // Bytes past the end of stream are treated as null characters
+        auto available = static_cast<int>(std::min(_memory->available(), static_cast<size_t>(maxlen)));
+        auto data = _memory->consume(available);
+        auto term = data ? static_cast<const char *>(std::memchr(data, '\0', available)) : nullptr;
+        if (!term && available == maxlen) {
+            throw std::runtime_error("String not null-terminated");
+        }
+        auto len = term ? term - data : available;
+        _stream.seek(pos + len + 1);
+        return std::string(data, len);
+    }
+
     std::vector<char> buf;
     buf.resize(maxlen, '\0');
     _stream.read(&buf[0], maxlen);
@@ -133,10 +123,72 @@ std::string BinaryReader::readCString(int maxlen) {
 ByteBuffer BinaryReader::readBytes(int count) {
     ByteBuffer buf;
     buf.resize(count);
-    if (_stream.read(reinterpret_cast<char *>(&buf[0]), count) != count) {
+    read(reinterpret_cast<char *>(&buf[0]), count);
+    return buf;
+}
+
+std::vector<uint16_t> BinaryReader::readUint16Array(int count) {
+    return readValueArray<uint16_t>(count);
+}
+
+std::vector<uint32_t> BinaryReader::readUint32Array(int count) {
+    return readValueArray<uint32_t>(count);
+}
+
+std::vector<int32_t> BinaryReader::readInt32Array(int count) {
+    return readValueArray<int32_t>(count);
+}
+
+std::vector<float> BinaryReader::readFloatArray(int count) {
+    auto bits = readValueArray<uint32_t>(count);
+    std::vector<float> elems;
+    elems.resize(count);
+    if (count > 0) {
+        std::memcpy(&elems[0], &bits[0], count * sizeof(float));
+    }
+    return elems;
+}
+
+void BinaryReader::read(char *data, int len) {
+    if (len <= 0) {
+        return;
+    }
+    if (_memory) {
+        auto src = _memory->consume(len);
+        if (!src) {
+            throw EndOfStreamException();
+        }
+        std::memcpy(data, src, len);
+        return;
+    }
+    if (_stream.read(data, len) != len) {
         throw EndOfStreamException();
     }
-    return buf;
+}
+
+template <class T>
+T BinaryReader::readValue() {
+    T val;
+    read(reinterpret_cast<char *>(&val), sizeof(T));
+    boost::endian::conditional_reverse_inplace(val, _endianess, boost::endian::order::native);
+    return val;
+}
+
+template <class T>
+std::vector<T> BinaryReader::readValueArray(int count) {
+    std::vector<T> elems;
+    if (count <= 0) {
+        return elems;
+    }
+    elems.resize(count);
+    read(reinterpret_cast<char *>(&elems[0]), count * sizeof(T));
+    if (_endianess != boost::endian::order::native) {
+        // Simple loop over a contiguous array, which compilers vectorize
+        for (auto &elem : elems) {
+            boost::endian::endian_reverse_inplace(elem);
+        }
+    }
+    return elems;
 }
 
 } // namespace reone
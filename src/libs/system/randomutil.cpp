@@ -19,7 +19,11 @@
 
 namespace reone {
 
-static std::default_random_engine g_generator(static_cast<uint32_t>(time(nullptr)));
+// Scene nodes draw random numbers from concurrently updated models, so every
+// thread gets a generator of its own
+static thread_local std::default_random_engine g_generator(
+    static_cast<uint32_t>(time(nullptr)) ^
+    static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
 
 int randomInt(int min, int max) {
     std::uniform_int_distribution<int> dist(min, max);
@@ -23,10 +23,10 @@ void ThreadPool::init() {
     if (_numThreads == -1) {
         _numThreads = static_cast<int>(std::thread::hardware_concurrency());
     }
+    _running = true;
     for (auto i = 0; i < _numThreads; ++i) {
         _threads.emplace_back(std::bind(&ThreadPool::workerThreadFunc, this));
     }
-    _running = true;
 }
 
 void ThreadPool::deinit() {
@@ -43,4 +43,58 @@ void ThreadPool::deinit() {
     _threads.clear();
 }
 
+void parallelFor(IThreadPool *threadPool,
+                 int count,
+                 int chunkSize,
+                 int maxTasks,
+                 const std::function<void(int begin, int end)> &func) {
+    if (count <= 0) {
+        return;
+    }
+    if (chunkSize <= 0) {
+        throw std::invalid_argument("chunkSize");
+    }
+
+    struct Batch {
+        int count {0};
+        int chunkSize {0};
+        int numChunks {0};
+        const std::function<void(int, int)> *func {nullptr};
+        std::atomic_int nextChunk {0};
+        int numChunksDone {0};
+        std::mutex mutex;
+        std::condition_variable condVar;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->count = count;
+    batch->chunkSize = chunkSize;
+    batch->numChunks = (count + chunkSize - 1) / chunkSize;
+    batch->func = &func;
+
+    // Workers that start after all chunks are taken return without calling
+    // func, so it is safe for them to outlive this call
+    auto runChunks = [batch]() {
+        int chunk;
+        while ((chunk = batch->nextChunk++) < batch->numChunks) {
+            int begin = chunk * batch->chunkSize;
+            int end = std::min(begin + batch->chunkSize, batch->count);
+            (*batch->func)(begin, end);
+            std::lock_guard<std::mutex> lock(batch->mutex);
+            if (++batch->numChunksDone == batch->numChunks) {
+                batch->condVar.notify_all();
+            }
+        }
+    };
+    if (threadPool && batch->numChunks > 1) {
+        int numTasks = std::min(batch->numChunks, maxTasks) - 1;
+        for (int i = 0; i < numTasks; ++i) {
+            threadPool->enqueue([runChunks](const std::atomic_bool &) { runChunks(); });
+        }
+    }
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->condVar.wait(lock, [&batch]() { return batch->numChunksDone == batch->numChunks; });
+}
+
 } // namespace reone
@@ -426,7 +426,7 @@ std::string NssWriter::describeConstant(const Variable &value) {
     } else if (value.type == VariableType::Float) {
         return str(boost::format("%f") % value.floatValue);
     } else if (value.type == VariableType::String) {
-        return str(boost::format("\"%s\"") % value.strValue);
+        return str(boost::format("\"%s\"") % value.strValue());
     } else if (value.type == VariableType::Object) {
         return std::to_string(value.objectId);
     } else {
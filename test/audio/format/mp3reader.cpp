@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/audio/clip.h"
+#include "reone/audio/format/mp3reader.h"
+#include "reone/system/stream/memoryinput.h"
+
+using namespace reone;
+using namespace reone::audio;
+
+static constexpr int kNumFrames = 8;
+static constexpr int kSamplesPerFrame = 384;
+static constexpr int kSampleRate = 48000;
+static constexpr int kFrameSize = 448;
+
+/**
+ * Builds a sequence of MPEG-1 Layer I mono frames at 448 kbps and 48 kHz, with
+ * only the lowest subband allocated. Layer I frames are small enough to be
+ * written by hand, and go through the same reader and decoder code as
+ * Layer III frames.
+ */
+static ByteBuffer mpegFrames() {
+    ByteBuffer bytes;
+    for (int frame = 0; frame < kNumFrames; ++frame) {
+        size_t frameOffset = bytes.size();
+        bytes.resize(frameOffset + kFrameSize, '\0');
+        auto data = reinterpret_cast<uint8_t *>(&bytes[frameOffset]);
+        int bitOffset = 0;
+        auto write = [&data, &bitOffset](uint32_t value, int numBits) {
+            for (int i = numBits - 1; i >= 0; --i) {
+                if ((value >> i) & 1) {
+                    data[bitOffset / 8] |= 0x80 >> (bitOffset % 8);
+                }
+                ++bitOffset;
+            }
+        };
+        write(0xffffe4c0, 32); // sync, MPEG-1, Layer I, no CRC, 448 kbps, 48 kHz, mono
+        for (int subband = 0; subband < 32; ++subband) {
+            write(subband == 0 ? 3 : 0, 4); // allocation, 4 bits per sample in subband 0
+        }
+        write(8, 6); // scalefactor of subband 0
+        for (int sample = 0; sample < 12; ++sample) {
+            write((3 * frame + 5 * sample) % 15, 4);
+        }
+    }
+    // libmad only decodes a frame that is followed by MAD_BUFFER_GUARD bytes
+    bytes.resize(bytes.size() + 8, '\0');
+    return bytes;
+}
+
+static ByteBuffer decodeUpfront(ByteBuffer &bytes) {
+    auto mp3 = MemoryInputStream(bytes);
+    auto reader = Mp3Reader();
+    reader.load(mp3);
+    ByteBuffer samples;
+    auto stream = reader.stream();
+    for (int i = 0; i < stream->getFrameCount(); ++i) {
+        auto &frame = stream->getFrame(i);
+        samples.insert(samples.end(), frame.samples.begin(), frame.samples.end());
+    }
+    return samples;
+}
+
+static ByteBuffer decodeRemaining(IAudioDecoder &decoder, int chunkSize) {
+    ByteBuffer samples;
+    auto frame = AudioClip::Frame();
+    while (decoder.decode(frame, chunkSize)) {
+        samples.insert(samples.end(), frame.samples.begin(), frame.samples.end());
+    }
+    return samples;
+}
+
+TEST(Mp3Reader, should_stream_mp3_as_decoded_upfront) {
+    // given
+    auto bytes = mpegFrames();
+    auto expected = decodeUpfront(bytes);
+    auto mp3 = MemoryInputStream(bytes);
+    auto reader = Mp3Reader(true);
+
+    // when
+    reader.load(mp3);
+
+    // then
+    auto stream = reader.stream();
+    EXPECT_TRUE(stream->isStreaming());
+    EXPECT_EQ(0, stream->getFrameCount());
+    EXPECT_NEAR(kNumFrames * kSamplesPerFrame / static_cast<float>(kSampleRate), stream->duration(), 1e-6f);
+    auto decoder = stream->openDecoder();
+    auto frame = AudioClip::Frame();
+    ASSERT_TRUE(decoder->decode(frame, 100));
+    EXPECT_EQ(static_cast<int>(AudioFormat::Mono16), static_cast<int>(frame.format));
+    EXPECT_EQ(kSampleRate, frame.sampleRate);
+    EXPECT_EQ(200ll, frame.samples.size());
+    auto samples = frame.samples;
+    auto remaining = decodeRemaining(*decoder, 100);
+    samples.insert(samples.end(), remaining.begin(), remaining.end());
+    ASSERT_EQ(2ll * kNumFrames * kSamplesPerFrame, expected.size());
+    EXPECT_EQ(expected, samples);
+    EXPECT_NE(ByteBuffer(expected.size(), '\0'), expected);
+}
+
+TEST(Mp3Reader, should_seek_streamed_mp3_with_preroll) {
+    // given
+    auto bytes = mpegFrames();
+    auto expected = decodeUpfront(bytes);
+    auto mp3 = MemoryInputStream(bytes);
+    auto reader = Mp3Reader(true);
+    reader.load(mp3);
+    auto decoder = reader.stream()->openDecoder();
+    auto frame = AudioClip::Frame();
+    decoder->decode(frame, 100);
+
+    // when
+    int target = 5 * kSamplesPerFrame + 100;
+    decoder->seek((target + 0.5f) / kSampleRate);
+
+    // then
+    auto samples = decodeRemaining(*decoder, 100);
+    EXPECT_EQ(ByteBuffer(expected.begin() + 2 * target, expected.end()), samples);
+}
+
+TEST(Mp3Reader, should_seek_streamed_mp3_near_start_without_full_preroll) {
+    // given
+    auto bytes = mpegFrames();
+    auto expected = decodeUpfront(bytes);
+    auto mp3 = MemoryInputStream(bytes);
+    auto reader = Mp3Reader(true);
+    reader.load(mp3);
+    auto decoder = reader.stream()->openDecoder();
+
+    // when
+    int target = kSamplesPerFrame + 10;
+    decoder->seek((target + 0.5f) / kSampleRate);
+
+    // then
+    auto samples = decodeRemaining(*decoder, 100);
+    EXPECT_EQ(ByteBuffer(expected.begin() + 2 * target, expected.end()), samples);
+}
+
+TEST(Mp3Reader, should_restart_streamed_mp3_after_end_for_looping) {
+    // given
+    auto bytes = mpegFrames();
+    auto expected = decodeUpfront(bytes);
+    auto mp3 = MemoryInputStream(bytes);
+    auto reader = Mp3Reader(true);
+    reader.load(mp3);
+    auto decoder = reader.stream()->openDecoder();
+    decodeRemaining(*decoder, 1000);
+    auto frame = AudioClip::Frame();
+    ASSERT_FALSE(decoder->decode(frame, 1000));
+
+    // when
+    decoder->seek(0.0f);
+
+    // then
+    EXPECT_EQ(expected, decodeRemaining(*decoder, 1000));
+    decoder->seek(1.0f);
+    EXPECT_FALSE(decoder->decode(frame, 1000));
+}
@@ -157,3 +157,83 @@ TEST(WavReader, should_load_obfuscated_mp3) {
     // expect
     reader.load();
 }
+
+static std::string imaWavBytes() {
+    return StringBuilder()
+        // Header
+        .append("RIFF")                // signature
+        .append("\x00\x00\x00\x00", 4) // chunk size
+        .append("WAVE")                // format
+        // Fmt Chunk
+        .append("fmt ")                // chunk id
+        .append("\x10\x00\x00\x00", 4) // chunk size
+        .append("\x11\x00", 2)         // audio format
+        .append("\x01\x00", 2)         // number of channels
+        .append("\x22\x56\x00\x00", 4) // sample rate
+        .append("\x00\x00\x00\x00", 4) // byte rate
+        .append("\x08\x00", 2)         // block align
+        .append("\x04\x00", 2)         // bits per sample
+        // Data Chunk
+        .append("data")                // chunk id
+        .append("\x10\x00\x00\x00", 4) // chunk size
+        // IMA Blocks
+        .append("\x00\x00\x03\x00\x12\x34\x56\x78", 8)
+        .append("\x10\x00\x05\x00\x9a\xbc\xde\xf0", 8)
+        .string();
+}
+
+TEST(WavReader, should_stream_ima_adpcm_wav) {
+    // given
+    auto wavBytes = imaWavBytes();
+    auto wav = MemoryInputStream(wavBytes);
+    auto mp3ReaderFactory = MockMp3ReaderFactory();
+    auto reader = WavReader(wav, mp3ReaderFactory, true);
+
+    auto expectedWav = MemoryInputStream(wavBytes);
+    auto expectedReader = WavReader(expectedWav, mp3ReaderFactory);
+    expectedReader.load();
+    auto &expected = expectedReader.stream()->getFrame(0);
+
+    // when
+    reader.load();
+
+    // then
+    auto stream = reader.stream();
+    EXPECT_TRUE(stream->isStreaming());
+    EXPECT_EQ(0, stream->getFrameCount());
+    EXPECT_NEAR(16.0f / 22050.0f, stream->duration(), 1e-6f);
+    auto decoder = stream->openDecoder();
+    auto frame = AudioClip::Frame();
+    EXPECT_TRUE(decoder->decode(frame, 16));
+    EXPECT_EQ(static_cast<int>(AudioFormat::Mono16), static_cast<int>(frame.format));
+    EXPECT_EQ(22050, frame.sampleRate);
+    EXPECT_EQ(expected.samples, frame.samples);
+    EXPECT_FALSE(decoder->decode(frame, 16));
+}
+
+TEST(WavReader, should_seek_streamed_ima_adpcm_wav) {
+    // given
+    auto wavBytes = imaWavBytes();
+    auto wav = MemoryInputStream(wavBytes);
+    auto mp3ReaderFactory = MockMp3ReaderFactory();
+    auto reader = WavReader(wav, mp3ReaderFactory, true);
+    reader.load();
+
+    auto expectedWav = MemoryInputStream(wavBytes);
+    auto expectedReader = WavReader(expectedWav, mp3ReaderFactory);
+    expectedReader.load();
+    auto &expected = expectedReader.stream()->getFrame(0).samples;
+
+    auto decoder = reader.stream()->openDecoder();
+    auto frame = AudioClip::Frame();
+    decoder->decode(frame, 16);
+
+    // when
+    decoder->seek(10.5f / 22050.0f);
+
+    // then
+    EXPECT_TRUE(decoder->decode(frame, 16));
+    EXPECT_EQ(ByteBuffer(expected.begin() + 2 * 10, expected.end()), frame.samples);
+    decoder->seek(1.0f);
+    EXPECT_FALSE(decoder->decode(frame, 16));
+}
@@ -50,6 +50,8 @@ class MockGffs : public IGffs, boost::noncopyable {
 public:
     MOCK_METHOD(void, clear, (), (override));
     MOCK_METHOD(std::shared_ptr<Gff>, get, (const std::string &resRef, ResType type), (override));
+    MOCK_METHOD(GffView, getView, (const std::string &resRef, ResType type), (override));
+    MOCK_METHOD(void, prefetch, (const std::vector<ResourceId> &ids), (override));
 };
 
 class MockResources : public IResources, boost::noncopyable {
@@ -64,6 +66,10 @@ public:
 
     MOCK_METHOD(Resource, get, (const ResourceId &id), (override));
     MOCK_METHOD(std::optional<Resource>, find, (const ResourceId &id), (override));
+
+    MOCK_METHOD(ResourceView, getView, (const ResourceId &id), (override));
+    MOCK_METHOD(std::optional<ResourceView>, findView, (const ResourceId &id), (override));
+
 };
 
 class MockStrings : public IStrings, boost::noncopyable {
@@ -81,6 +87,7 @@ public:
 class MockScripts : public IScripts, boost::noncopyable {
 public:
     MOCK_METHOD(void, clear, (), (override));
+    MOCK_METHOD(void, setRoutines, (script::IRoutines & routines), (override));
     MOCK_METHOD(std::shared_ptr<script::ScriptProgram>, get, (const std::string &key), (override));
 };
 
@@ -123,6 +130,9 @@ public:
     MOCK_METHOD(void, clear, (), (override));
 
     MOCK_METHOD(std::shared_ptr<graphics::Texture>, get, (const std::string &resRef, graphics::TextureUsage usage), (override));
+    MOCK_METHOD(std::shared_ptr<graphics::Texture>, getAsync, (const std::string &resRef, graphics::TextureUsage usage), (override));
+
+    MOCK_METHOD(void, uploadPending, (), (override));
 };
 
 class MockWalkmeshes : public IWalkmeshes, boost::noncopyable {
@@ -19,10 +19,12 @@
 
 #include <gmock/gmock.h>
 
+#include "reone/scene/collision.h"
 #include "reone/scene/di/services.h"
 #include "reone/scene/graph.h"
 #include "reone/scene/graphs.h"
 #include "reone/scene/render/pipeline.h"
+#include "reone/system/threadpool.h"
 
 namespace reone {
 
@@ -30,7 +32,7 @@ namespace scene {
 
 class MockSceneGraph : public ISceneGraph, boost::noncopyable {
 public:
-    MOCK_METHOD(void, update, (float dt), (override));
+    MOCK_METHOD(void, update, (float dt, IThreadPool *threadPool), (override));
     MOCK_METHOD(graphics::Texture &, render, (const glm::ivec2 &dim), (override));
 
     MOCK_METHOD(void, clear, (), (override));
@@ -50,6 +52,7 @@ public:
     MOCK_METHOD(bool, testElevation, (const glm::vec2 &, Collision &), (const override));
     MOCK_METHOD(bool, testLineOfSight, (const glm::vec3 &, const glm::vec3 &, Collision &), (const override));
     MOCK_METHOD(bool, testWalk, (const glm::vec3 &, const glm::vec3 &, const IUser *, Collision &), (const override));
+    MOCK_METHOD(void, testCollisions, (const std::vector<CollisionQuery> &, std::vector<CollisionResult> &, IThreadPool *), (const override));
 
     MOCK_METHOD(ModelSceneNode *, pickModelAt, (int, int, IUser *), (const override));
     MOCK_METHOD(std::optional<std::reference_wrapper<ModelSceneNode>>, pickModelRay, (const glm::vec3 &, const glm::vec3 &), (const override));
@@ -80,7 +83,6 @@ public:
     MOCK_METHOD(std::shared_ptr<MeshSceneNode>, newMesh, (ModelSceneNode & model, graphics::ModelNode &modelNode), (override));
     MOCK_METHOD(std::shared_ptr<LightSceneNode>, newLight, (ModelSceneNode & model, graphics::ModelNode &modelNode), (override));
     MOCK_METHOD(std::shared_ptr<EmitterSceneNode>, newEmitter, (graphics::ModelNode & modelNode), (override));
-    MOCK_METHOD(std::shared_ptr<ParticleSceneNode>, newParticle, (EmitterSceneNode & emitter), (override));
     MOCK_METHOD(std::shared_ptr<GrassSceneNode>, newGrass, (GrassProperties properties, graphics::ModelNode &aabbNode), (override));
     MOCK_METHOD(std::shared_ptr<GrassClusterSceneNode>, newGrassCluster, (GrassSceneNode & grass), (override));
 
@@ -42,11 +42,11 @@ public:
             retType,
             retValue,
             std::move(argTypes),
-            [retValue](auto &args, auto &ctx) { return retValue; }) {
+            [retValue](auto args, auto &ctx) { return retValue; }) {
     }
 
-    Variable invoke(const std::vector<Variable> &args, ExecutionContext &ctx) override {
-        _invokeInvocations.push_back(std::make_tuple(args, ctx));
+    Variable invoke(Span<const Variable> args, ExecutionContext &ctx) override {
+        _invokeInvocations.push_back(std::make_tuple(std::vector<Variable>(args.begin(), args.end()), ctx));
         return Routine::invoke(args, ctx);
     }
 
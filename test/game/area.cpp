@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/console.h"
+#include "reone/game/game.h"
+#include "reone/game/object/area.h"
+#include "reone/game/object/creature.h"
+#include "reone/game/party.h"
+
+#include "../fixtures/engine.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::resource;
+using namespace reone::scene;
+
+using testing::_;
+using testing::ReturnRef;
+
+namespace {
+
+class MockConsole : public IConsole, boost::noncopyable {
+public:
+    MOCK_METHOD(void, registerCommand, (std::string name, std::string description, CommandHandler handler), (override));
+    MOCK_METHOD(void, printLine, (const std::string &text), (override));
+};
+
+} // namespace
+
+TEST(Area, should_keep_party_members_registered_when_unloading_party) {
+    // given
+    auto engine = TestEngine();
+    engine.init();
+    auto sceneGraph = MockSceneGraph();
+    EXPECT_CALL(engine.sceneModule().graphs(), get(_)).WillRepeatedly(ReturnRef(sceneGraph));
+    auto console = MockConsole();
+    auto game = Game(GameID::KotOR, "", engine.options(), engine.services(), console);
+    auto area = game.newArea();
+    auto player = game.newCreature();
+    auto companion = game.newCreature();
+    game.party().addMember(0, player);
+    game.party().addMember(1, companion);
+    area->loadParty(glm::vec3(0.0f), 0.0f);
+
+    // when
+    area->unloadParty();
+    area->loadParty(glm::vec3(1.0f), 0.0f);
+
+    // then
+    EXPECT_EQ(player, game.getObjectById(player->id()));
+    EXPECT_EQ(companion.get(), game.getObjectPtr<Creature>(companion->id()));
+    EXPECT_EQ(2ll, area->getObjectsByType(ObjectType::Creature).size());
+}
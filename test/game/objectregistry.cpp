@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/objectregistry.h"
+#include "reone/script/types.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::script;
+
+namespace {
+
+struct TestObject {
+    int value {0};
+};
+
+} // namespace
+
+TEST(ObjectRegistry, should_insert_and_get_objects) {
+    // given
+    auto registry = ObjectRegistry<TestObject>();
+    auto id1 = registry.reserve();
+    auto object1 = std::make_shared<TestObject>(TestObject {1});
+    registry.insert(id1, object1, ObjectType::Creature);
+    auto id2 = registry.reserve();
+    auto object2 = std::make_shared<TestObject>(TestObject {2});
+    registry.insert(id2, object2, ObjectType::Placeable);
+
+    // when
+    auto ptr1 = registry.get(id1);
+    auto typedPtr1 = registry.get(id1, ObjectType::Creature);
+    auto mismatchedPtr1 = registry.get(id1, ObjectType::Placeable);
+    auto shared2 = registry.getShared(id2);
+
+    // then
+    EXPECT_EQ(2, registry.size());
+    EXPECT_NE(id1, id2);
+    EXPECT_EQ(object1.get(), ptr1);
+    EXPECT_EQ(object1.get(), typedPtr1);
+    EXPECT_EQ(nullptr, mismatchedPtr1);
+    EXPECT_EQ(object2, shared2);
+}
+
+TEST(ObjectRegistry, should_detect_stale_ids_when_slot_is_reused) {
+    // given
+    auto registry = ObjectRegistry<TestObject>();
+    auto oldId = registry.reserve();
+    auto oldObject = std::make_shared<TestObject>(TestObject {1});
+    registry.insert(oldId, oldObject, ObjectType::Creature);
+    registry.remove(oldId);
+    auto newId = registry.reserve();
+    auto newObject = std::make_shared<TestObject>(TestObject {2});
+    registry.insert(newId, newObject, ObjectType::Creature);
+
+    // when
+    auto oldPtr = registry.get(oldId);
+    auto newPtr = registry.get(newId);
+    bool removedAgain = registry.remove(oldId);
+
+    // then
+    EXPECT_EQ(oldId & ObjectRegistry<TestObject>::kIndexMask, newId & ObjectRegistry<TestObject>::kIndexMask);
+    EXPECT_NE(oldId, newId);
+    EXPECT_EQ(nullptr, oldPtr);
+    EXPECT_EQ(newObject.get(), newPtr);
+    EXPECT_FALSE(removedAgain);
+    EXPECT_EQ(1, registry.size());
+    EXPECT_EQ(1l, oldObject.use_count());
+}
+
+TEST(ObjectRegistry, should_not_resolve_reserved_ids) {
+    // given
+    auto registry = ObjectRegistry<TestObject>();
+    for (int i = 0; i < 4; ++i) {
+        auto id = registry.reserve();
+        registry.insert(id, std::make_shared<TestObject>(), ObjectType::Creature);
+        EXPECT_NE(kObjectSelf, id);
+        EXPECT_NE(kObjectInvalid, id);
+    }
+
+    // when
+    auto self = registry.get(kObjectSelf);
+    auto invalid = registry.get(kObjectInvalid);
+
+    // then
+    EXPECT_EQ(nullptr, self);
+    EXPECT_EQ(nullptr, invalid);
+}
+
+TEST(ObjectRegistry, should_throw_when_inserting_into_unreserved_slot) {
+    // given
+    auto registry = ObjectRegistry<TestObject>();
+    auto id = registry.reserve();
+    registry.remove(id);
+
+    // when, then
+    EXPECT_THROW(registry.insert(id, std::make_shared<TestObject>(), ObjectType::Creature), std::invalid_argument);
+}
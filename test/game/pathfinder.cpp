@@ -75,3 +75,82 @@ TEST(Pathfinder, should_find_shortest_path) {
     EXPECT_EQ(path.at(3), (glm::vec3 {0.0f, 3.0f, 0.0f}));
     EXPECT_EQ(path.at(4), (glm::vec3 {1.0f, 3.0f, 0.0f}));
 }
+
+TEST(Pathfinder, should_find_shortest_path_in_large_grid) {
+    // given
+    const int size = 100;
+    std::vector<Path::Point> points;
+    std::unordered_map<int, float> pointToZ;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            Path::Point point {static_cast<float>(x), static_cast<float>(y), {}};
+            if (x > 0) {
+                point.adjPoints.push_back(y * size + x - 1);
+            }
+            if (x < size - 1) {
+                point.adjPoints.push_back(y * size + x + 1);
+            }
+            if (y > 0) {
+                point.adjPoints.push_back((y - 1) * size + x);
+            }
+            if (y < size - 1) {
+                point.adjPoints.push_back((y + 1) * size + x);
+            }
+            points.push_back(std::move(point));
+        }
+    }
+    // Wall across the grid, with a single gap at its end
+    for (int y = 0; y < size - 1; ++y) {
+        int left = y * size + size / 2 - 1;
+        int right = left + 1;
+        auto &leftAdj = points[left].adjPoints;
+        auto &rightAdj = points[right].adjPoints;
+        leftAdj.erase(std::remove(leftAdj.begin(), leftAdj.end(), right), leftAdj.end());
+        rightAdj.erase(std::remove(rightAdj.begin(), rightAdj.end(), left), rightAdj.end());
+    }
+
+    Pathfinder pathfinder;
+    pathfinder.load(points, pointToZ);
+
+    glm::vec3 from {0.1f, 0.2f, 0.0f};
+    glm::vec3 to {99.2f, 0.1f, 0.0f};
+
+    // when
+    auto path = pathfinder.findPath(from, to);
+    auto cachedPath = pathfinder.findPath(from, to);
+
+    // then
+    EXPECT_EQ(path.size(), 2 * (size - 1) + (size - 1) + 1);
+    EXPECT_EQ(path.front(), (glm::vec3 {0.0f, 0.0f, 0.0f}));
+    EXPECT_EQ(path.back(), (glm::vec3 {99.0f, 0.0f, 0.0f}));
+    for (size_t i = 1; i < path.size(); ++i) {
+        EXPECT_EQ(glm::distance2(path[i - 1], path[i]), 1.0f);
+    }
+    EXPECT_EQ(cachedPath, path);
+}
+
+TEST(Pathfinder, should_return_start_and_end_points_when_unreachable) {
+    // given
+    std::vector<Path::Point> points {{0.0f, 0.0f, {1}},
+                                     {1.0f, 0.0f, {0}},
+                                     {5.0f, 0.0f, {3}},
+                                     {6.0f, 0.0f, {2}}};
+    std::unordered_map<int, float> pointToZ;
+
+    Pathfinder pathfinder;
+    pathfinder.load(points, pointToZ);
+
+    glm::vec3 from {0.0f, 0.1f, 0.0f};
+    glm::vec3 to {6.0f, 0.1f, 0.0f};
+
+    // when
+    auto path = pathfinder.findPath(from, to);
+    auto pathAgain = pathfinder.findPath(from, to);
+
+    // then
+    EXPECT_EQ(path.size(), 2);
+    EXPECT_EQ(path.at(0), from);
+    EXPECT_EQ(path.at(1), to);
+    EXPECT_EQ(pathAgain, path);
+    EXPECT_EQ(1, pathfinder.numSearches());
+}
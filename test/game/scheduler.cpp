@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/scheduler.h"
+
+using namespace reone;
+using namespace reone::game;
+
+TEST(SlicedScheduler, should_service_every_object_once_per_interval) {
+    // given
+    auto scheduler = SlicedScheduler(1.0f, std::chrono::microseconds(0));
+    auto collect = [](std::vector<uint32_t> &ids) {
+        for (uint32_t id = 1; id <= 8; ++id) {
+            ids.push_back(id);
+        }
+    };
+    std::vector<uint32_t> serviced;
+    auto service = [&serviced](uint32_t id) {
+        serviced.push_back(id);
+    };
+
+    // when
+    scheduler.update(0.25f, collect, service);
+    auto firstStats = scheduler.stats();
+    scheduler.update(0.25f, collect, service);
+    scheduler.update(0.25f, collect, service);
+    scheduler.update(0.25f, collect, service);
+    auto lastStats = scheduler.stats();
+
+    // then
+    EXPECT_EQ((std::vector<uint32_t> {1, 2, 3, 4, 5, 6, 7, 8}), serviced);
+    EXPECT_EQ(2, firstStats.lastSliceCount);
+    EXPECT_EQ(6, firstStats.queueDepth);
+    EXPECT_EQ(2, lastStats.lastSliceCount);
+    EXPECT_EQ(0, lastStats.queueDepth);
+}
+
+TEST(SlicedScheduler, should_drain_queue_when_interval_ends) {
+    // given
+    auto scheduler = SlicedScheduler(1.0f, std::chrono::microseconds(0));
+    auto collect = [](std::vector<uint32_t> &ids) {
+        ids.insert(ids.end(), {1, 2, 3});
+    };
+    std::vector<uint32_t> serviced;
+    auto service = [&serviced](uint32_t id) {
+        serviced.push_back(id);
+    };
+
+    // when
+    scheduler.update(0.1f, collect, service);
+    scheduler.update(0.95f, collect, service);
+
+    // then
+    EXPECT_EQ((std::vector<uint32_t> {1, 2, 3}), serviced);
+    EXPECT_EQ(0, scheduler.stats().queueDepth);
+}
+
+TEST(SlicedScheduler, should_postpone_collection_on_reset) {
+    // given
+    auto scheduler = SlicedScheduler(1.0f, std::chrono::microseconds(0));
+    int numCollected = 0;
+    auto collect = [&numCollected](std::vector<uint32_t> &ids) {
+        ids.push_back(1);
+        ++numCollected;
+    };
+    auto service = [](uint32_t) {};
+
+    // when
+    scheduler.reset(0.5f);
+    scheduler.update(0.25f, collect, service);
+    int numCollectedBeforeDelay = numCollected;
+    scheduler.update(0.25f, collect, service);
+
+    // then
+    EXPECT_EQ(0, numCollectedBeforeDelay);
+    EXPECT_EQ(1, numCollected);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/spatialgrid.h"
+
+using namespace reone;
+using namespace reone::game;
+
+static std::vector<glm::vec3> makePositions(int count) {
+    std::vector<glm::vec3> positions;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> distribution(-200.0f, 200.0f);
+    for (int i = 0; i < count; ++i) {
+        positions.push_back(glm::vec3(distribution(random), distribution(random), 0.25f * distribution(random)));
+    }
+    return positions;
+}
+
+TEST(SpatialGrid, should_find_nearest_values_among_many) {
+    // given
+    auto positions = makePositions(1500);
+    auto grid = SpatialGrid<int>();
+    for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+        grid.add(i, i, positions[i]);
+    }
+    auto isEven = [](const int &value) { return value % 2 == 0; };
+    auto origins = std::vector<glm::vec3> {glm::vec3(0.0f), glm::vec3(150.0f, -75.0f, 0.0f), glm::vec3(1000.0f, 1000.0f, 0.0f)};
+
+    for (auto &origin : origins) {
+        std::vector<std::pair<int, float>> expected;
+        for (int i = 0; i < static_cast<int>(positions.size()); i += 2) {
+            expected.push_back(std::make_pair(i, glm::distance2(positions[i], origin)));
+        }
+        std::sort(expected.begin(), expected.end(), [](auto &left, auto &right) { return left.second < right.second; });
+        expected.resize(10);
+
+        // when
+        std::vector<std::pair<int, float>> values;
+        grid.findNearest(origin, 10, isEven, values);
+
+        // then
+        EXPECT_EQ(expected, values);
+    }
+}
+
+TEST(SpatialGrid, should_find_values_in_radius) {
+    // given
+    auto positions = makePositions(1500);
+    auto grid = SpatialGrid<int>();
+    for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+        grid.add(i, i, positions[i]);
+    }
+    auto origin = glm::vec3(10.0f, 20.0f, 0.0f);
+    std::vector<int> expected;
+    for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+        if (glm::distance2(positions[i], origin) <= 30.0f * 30.0f) {
+            expected.push_back(i);
+        }
+    }
+
+    // when
+    std::vector<int> values;
+    grid.findInRadius(origin, 30.0f, [](auto &) { return true; }, values);
+
+    // then
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(expected, values);
+}
+
+TEST(SpatialGrid, should_track_updated_and_removed_values) {
+    // given
+    auto grid = SpatialGrid<int>();
+    grid.add(1, 1, glm::vec3(0.0f));
+    grid.add(2, 2, glm::vec3(5.0f, 0.0f, 0.0f));
+    grid.add(3, 3, glm::vec3(100.0f, 0.0f, 0.0f));
+    auto any = [](auto &) { return true; };
+
+    // when
+    grid.update(3, glm::vec3(-1.0f, 0.0f, 0.0f));
+    grid.remove(1);
+    std::vector<std::pair<int, float>> values;
+    grid.findNearest(glm::vec3(0.0f), 2, any, values);
+
+    // then
+    EXPECT_EQ(2, grid.size());
+    ASSERT_EQ(2ll, values.size());
+    EXPECT_EQ(3, values[0].first);
+    EXPECT_EQ(2, values[1].first);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/timerwheel.h"
+
+using namespace reone;
+using namespace reone::game;
+
+TEST(TimerWheel, should_fire_timers_with_equal_deadlines_in_order_of_scheduling) {
+    // given
+    auto timers = TimerWheel();
+    std::vector<int> fired;
+    timers.schedule(0.5f, [&fired]() { fired.push_back(1); });
+    timers.schedule(0.25f, [&fired]() { fired.push_back(2); });
+    timers.schedule(0.5f, [&fired]() { fired.push_back(3); });
+    timers.schedule(0.0f, [&fired]() { fired.push_back(4); });
+
+    // when
+    timers.update(0.2f);
+    auto firedEarly = fired;
+    timers.update(1.0f);
+
+    // then
+    EXPECT_EQ((std::vector<int> {4}), firedEarly);
+    EXPECT_EQ((std::vector<int> {4, 2, 1, 3}), fired);
+    EXPECT_EQ(0, timers.size());
+}
+
+TEST(TimerWheel, should_not_fire_timers_scheduled_from_callback_within_same_update) {
+    // given
+    auto timers = TimerWheel();
+    int numFired = 0;
+    timers.schedule(0.0f, [&timers, &numFired]() {
+        ++numFired;
+        timers.schedule(0.0f, [&numFired]() { ++numFired; });
+    });
+
+    // when
+    timers.update(1.0f);
+    int numFiredFirst = numFired;
+    timers.update(1.0f);
+
+    // then
+    EXPECT_EQ(1, numFiredFirst);
+    EXPECT_EQ(2, numFired);
+}
+
+TEST(TimerWheel, should_fire_many_timers_once_and_in_order_of_deadlines) {
+    // given
+    const int numTimers = 100000;
+    const double frameTime = 1.0 / 60.0;
+    auto timers = TimerWheel();
+    auto random = std::mt19937(1234);
+    auto delay = std::uniform_real_distribution<float>(0.0f, 600.0f);
+    std::vector<float> delays(numTimers);
+    std::vector<double> firedAt(numTimers, -1.0);
+    std::vector<int> fired;
+    fired.reserve(numTimers);
+    double time = 0.0;
+    for (int i = 0; i < numTimers; ++i) {
+        delays[i] = i % 100 == 0 ? 0.0f : delay(random);
+        timers.schedule(delays[i], [i, &time, &fired, &firedAt]() {
+            firedAt[i] = time;
+            fired.push_back(i);
+        });
+    }
+
+    // when
+    while (timers.size() > 0 && time < 700.0) {
+        time += frameTime;
+        timers.update(static_cast<float>(frameTime));
+    }
+
+    // then
+    ASSERT_EQ(numTimers, static_cast<int>(fired.size()));
+    for (int i = 0; i < numTimers; ++i) {
+        EXPECT_GE(firedAt[i] + 2.0f * TimerWheel::kTickLength, delays[i]) << "timer " << i;
+        EXPECT_LE(firedAt[i], delays[i] + frameTime + 2.0f * TimerWheel::kTickLength) << "timer " << i;
+    }
+    for (int i = 1; i < numTimers; ++i) {
+        int left = fired[i - 1];
+        int right = fired[i];
+        bool ordered = firedAt[left] < firedAt[right] ||
+                       delays[left] <= delays[right] + 2.0f * TimerWheel::kTickLength;
+        EXPECT_TRUE(ordered) << "timers " << left << " and " << right;
+    }
+}
+
+TEST(TimerWheel, should_cancel_timers_of_matching_owners) {
+    // given
+    auto timers = TimerWheel();
+    std::vector<uint32_t> fired;
+    timers.schedule(0.1f, [&fired]() { fired.push_back(1); }, 1);
+    timers.schedule(0.5f, [&fired]() { fired.push_back(2); }, 2);
+    timers.schedule(1000.0f, [&fired]() { fired.push_back(3); }, 1);
+    timers.schedule(0.2f, [&fired]() { fired.push_back(4); }, 3);
+
+    // when
+    timers.cancelIf([](uint32_t owner) { return owner != 2; });
+    int sizeAfterCancel = timers.size();
+    timers.update(2000.0f);
+
+    // then
+    EXPECT_EQ(1, sizeAfterCancel);
+    EXPECT_EQ((std::vector<uint32_t> {2}), fired);
+    EXPECT_EQ(0, timers.size());
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "reone/graphics/dxtutil.h"
+#include "reone/system/threadpool.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+// Per-pixel reference decoder, used to verify that block decoders are bit-exact
+static uint32_t decodeReferencePixel(const uint8_t *block, bool hasAlpha, int i, int j) {
+    uint8_t alphas[2] {0, 0};
+    uint64_t alphaCodes = 0;
+    const uint8_t *colorBlock = block;
+    if (hasAlpha) {
+        alphas[0] = block[0];
+        alphas[1] = block[1];
+        for (int k = 0; k < 6; ++k) {
+            alphaCodes |= static_cast<uint64_t>(block[2 + k]) << (8 * k);
+        }
+        colorBlock = block + 8;
+    }
+    uint16_t colors[2] {
+        static_cast<uint16_t>(colorBlock[0] | (colorBlock[1] << 8)),
+        static_cast<uint16_t>(colorBlock[2] | (colorBlock[3] << 8))};
+    uint32_t colorCodes = colorBlock[4] | (colorBlock[5] << 8) | (colorBlock[6] << 16) | (static_cast<uint32_t>(colorBlock[7]) << 24);
+
+    int r[2], g[2], b[2];
+    for (int k = 0; k < 2; ++k) {
+        uint32_t temp = (colors[k] >> 11) * 255 + 16;
+        r[k] = (temp / 32 + temp) / 32;
+        temp = ((colors[k] & 0x07e0) >> 5) * 255 + 32;
+        g[k] = (temp / 64 + temp) / 64;
+        temp = (colors[k] & 0x001f) * 255 + 16;
+        b[k] = (temp / 32 + temp) / 32;
+    }
+
+    int alpha = 255;
+    if (hasAlpha) {
+        int code = (alphaCodes >> (3 * (4 * j + i))) & 7;
+        if (code == 0) {
+            alpha = alphas[0];
+        } else if (code == 1) {
+            alpha = alphas[1];
+        } else if (alphas[0] > alphas[1]) {
+            alpha = ((8 - code) * alphas[0] + (code - 1) * alphas[1]) / 7;
+        } else if (code == 6) {
+            alpha = 0;
+        } else if (code == 7) {
+            alpha = 255;
+        } else {
+            alpha = ((6 - code) * alphas[0] + (code - 1) * alphas[1]) / 5;
+        }
+    }
+
+    int code = (colorCodes >> (2 * (4 * j + i))) & 3;
+    int cr, cg, cb;
+    if (code < 2) {
+        cr = r[code];
+        cg = g[code];
+        cb = b[code];
+    } else if (hasAlpha || colors[0] > colors[1]) {
+        int w0 = code == 2 ? 2 : 1;
+        int w1 = 3 - w0;
+        cr = (w0 * r[0] + w1 * r[1]) / 3;
+        cg = (w0 * g[0] + w1 * g[1]) / 3;
+        cb = (w0 * b[0] + w1 * b[1]) / 3;
+    } else if (code == 2) {
+        cr = (r[0] + r[1]) / 2;
+        cg = (g[0] + g[1]) / 2;
+        cb = (b[0] + b[1]) / 2;
+    } else {
+        cr = cg = cb = 0;
+    }
+
+    return (cr << 24) | (cg << 16) | (cb << 8) | alpha;
+}
+
+static std::vector<uint8_t> makeRandomBlocks(uint32_t width, uint32_t height, int blockSize) {
+    std::vector<uint8_t> blocks(((width + 3) / 4) * ((height + 3) / 4) * blockSize);
+    uint32_t state = 0x12345678;
+    for (auto &byte : blocks) {
+        state = state * 1664525 + 1013904223;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return blocks;
+}
+
+static void expectMatchesReference(uint32_t width, uint32_t height, const std::vector<uint8_t> &blocks, bool hasAlpha, const std::vector<uint32_t> &image) {
+    int blockSize = hasAlpha ? 16 : 8;
+    uint32_t blockCountX = (width + 3) / 4;
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint8_t *block = &blocks[((y / 4) * blockCountX + x / 4) * blockSize];
+            auto expected = decodeReferencePixel(block, hasAlpha, x % 4, y % 4);
+            ASSERT_EQ(expected, image[y * width + x]) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST(DxtUtil, should_decompress_dxt1_bit_exact) {
+    // given
+    uint32_t width = 37;
+    uint32_t height = 22;
+    auto blocks = makeRandomBlocks(width, height, 8);
+    std::vector<uint32_t> image(width * height, 0xdeadbeef);
+
+    // when
+    decompressDXT1(width, height, blocks.data(), image.data());
+
+    // then
+    expectMatchesReference(width, height, blocks, false, image);
+}
+
+TEST(DxtUtil, should_decompress_dxt5_bit_exact) {
+    // given
+    uint32_t width = 64;
+    uint32_t height = 19;
+    auto blocks = makeRandomBlocks(width, height, 16);
+    std::vector<uint32_t> image(width * height, 0xdeadbeef);
+
+    // when
+    decompressDXT5(width, height, blocks.data(), image.data());
+
+    // then
+    expectMatchesReference(width, height, blocks, true, image);
+}
+
+TEST(DxtUtil, should_decompress_on_thread_pool_bit_exact) {
+    // given
+    uint32_t width = 130;
+    uint32_t height = 301;
+    auto dxt1Blocks = makeRandomBlocks(width, height, 8);
+    auto dxt5Blocks = makeRandomBlocks(width, height, 16);
+    std::vector<uint32_t> dxt1Image(width * height, 0xdeadbeef);
+    std::vector<uint32_t> dxt5Image(width * height, 0xdeadbeef);
+    auto threadPool = ThreadPool(4);
+    threadPool.init();
+
+    // when
+    decompressDXT1(width, height, dxt1Blocks.data(), dxt1Image.data(), &threadPool);
+    decompressDXT5(width, height, dxt5Blocks.data(), dxt5Image.data(), &threadPool);
+
+    // then
+    expectMatchesReference(width, height, dxt1Blocks, false, dxt1Image);
+    expectMatchesReference(width, height, dxt5Blocks, true, dxt5Image);
+}
@@ -55,3 +55,33 @@ TEST(TpcReader, should_load_tpc) {
     auto pixels = reinterpret_cast<unsigned char *>(texture->layers()[0].pixels->data());
     EXPECT_EQ(255, pixels[0]);
 }
+
+TEST(TpcReader, should_load_tpc_header_and_features_without_pixels) {
+    // given
+    auto tpcBytes = StringBuilder()
+                        // Header
+                        .append("\x00\x00\x00\x00", 4) // data size
+                        .append("\x00\x00\x00\x00", 4) // unknown
+                        .append("\x02\x00", 2)         // width
+                        .append("\x0c\x00", 2)         // height
+                        .append("\x01\x02", 2)         // encoding, number of mip maps
+                        .append('\x00', 114)           // padding
+                        // Layers
+                        .append('\xff', 6 * (4 + 1))
+                        // TXI
+                        .append("proceduretype cycle\r\nnumx 2\r\nnumy 1\r\n")
+                        .string();
+    auto tpc = MemoryInputStream(tpcBytes);
+    auto reader = TpcReader(tpc, "some_texture", TextureUsage::Default);
+
+    // when
+    reader.loadHeaderAndFeatures();
+
+    // then
+    EXPECT_TRUE(reader.isCubeMap());
+    EXPECT_FALSE(static_cast<bool>(reader.texture()));
+    auto &features = reader.features();
+    EXPECT_EQ(static_cast<int>(Texture::ProcedureType::Cycle), static_cast<int>(features.procedureType));
+    EXPECT_EQ(2, features.numX);
+    EXPECT_EQ(1, features.numY);
+}
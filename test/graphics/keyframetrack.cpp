@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "reone/graphics/keyframetrack.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(KeyframeTrack, should_interpolate_between_keyframes) {
+    // given
+    auto track = KeyframeTrack<float>();
+    track.add(1.0f, 10.0f);
+    track.add(0.0f, 0.0f);
+    track.add(2.0f, 30.0f);
+    track.update();
+
+    // when
+    float before, middle, after;
+    bool sampled = track.valueAtTime(-1.0f, before) &&
+                   track.valueAtTime(1.5f, middle) &&
+                   track.valueAtTime(2.0f, after);
+
+    // then
+    EXPECT_TRUE(sampled);
+    EXPECT_EQ(0.0f, before);
+    EXPECT_NEAR(20.0f, middle, 1e-5);
+    EXPECT_EQ(30.0f, after);
+}
+
+TEST(KeyframeTrack, should_sample_same_values_with_cursor_as_without) {
+    // given
+    auto track = KeyframeTrack<float>();
+    for (int i = 0; i < 50; ++i) {
+        float time = 0.1f * i;
+        track.add(time, time * time);
+    }
+    track.add(2.5f, -1.0f); // duplicate keyframe time
+    track.update();
+
+    // when
+    int cursor = 0;
+    std::vector<std::pair<float, float>> samples;
+    for (int loop = 0; loop < 2; ++loop) {
+        for (float time = 0.0f; time < 5.5f; time += 0.0137f) {
+            float withCursor, withoutCursor;
+            track.valueAtTime(time, withCursor, cursor);
+            track.valueAtTime(time, withoutCursor);
+            samples.push_back(std::make_pair(withCursor, withoutCursor));
+        }
+    }
+    float jumped, expected;
+    track.valueAtTime(0.55f, jumped, cursor);
+    track.valueAtTime(0.55f, expected);
+
+    // then
+    for (auto &sample : samples) {
+        EXPECT_EQ(sample.second, sample.first);
+    }
+    EXPECT_EQ(expected, jumped);
+}
@@ -116,3 +116,93 @@ TEST(Walkmesh, should_find_ray_walkmesh_intersection__no_intersection) {
     // then
     EXPECT_TRUE(!static_cast<bool>(face));
 }
+
+TEST(Walkmesh, should_find_nearest_ray_walkmesh_intersection) {
+    // given
+    auto walkmesh = Walkmesh();
+    walkmesh.add(Walkmesh::Face {0, 0, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh.add(Walkmesh::Face {1, 0, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 1.0f), glm::vec3(1.0f, -1.0f, 1.0f), glm::vec3(0.0f, 1.0f, 1.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh.add(Walkmesh::Face {2, 1, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 2.0f), glm::vec3(1.0f, -1.0f, 2.0f), glm::vec3(0.0f, 1.0f, 2.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    auto rootAabb = std::make_shared<Walkmesh::AABB>();
+    rootAabb->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 2.0f));
+    rootAabb->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->faceIdx = 0;
+    rootAabb->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->value = AABB(glm::vec3(-1.0f, -1.0f, 1.0f), glm::vec3(1.0f, 1.0f, 2.0f));
+    rootAabb->right->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->left->faceIdx = 1;
+    rootAabb->right->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->right->faceIdx = 2;
+    walkmesh.setRootAABB(rootAabb);
+
+    // when
+    float distanceDown = -1.0f;
+    auto faceDown = walkmesh.raycast(std::set<uint32_t> {0}, glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distanceDown);
+    float distanceUp = -1.0f;
+    auto faceUp = walkmesh.raycast(Walkmesh::surfaceMask(std::set<uint32_t> {0, 1}), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 0.0f, 1.0f), 10.0f, distanceUp);
+
+    // then
+    EXPECT_TRUE(static_cast<bool>(faceDown));
+    EXPECT_EQ(1, faceDown->index);
+    EXPECT_NEAR(2.0f, distanceDown, 1e-5);
+    EXPECT_TRUE(static_cast<bool>(faceUp));
+    EXPECT_EQ(0, faceUp->index);
+    EXPECT_NEAR(1.0f, distanceUp, 1e-5);
+}
+
+TEST(Walkmesh, should_find_ray_walkmesh_intersection__excluded_surface) {
+    // given
+    auto walkmesh = Walkmesh();
+    walkmesh.add(Walkmesh::Face {0, 3, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    auto rootAabb = std::make_shared<Walkmesh::AABB>();
+    rootAabb->faceIdx = 0;
+    walkmesh.setRootAABB(rootAabb);
+
+    // when
+    float distance = -1.0f;
+    auto excluded = walkmesh.raycast(std::set<uint32_t> {0, 1, 2}, glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+    auto included = walkmesh.raycast(std::set<uint32_t> {3}, glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+
+    // then
+    EXPECT_FALSE(static_cast<bool>(excluded));
+    EXPECT_TRUE(static_cast<bool>(included));
+    EXPECT_NEAR(1.0f, distance, 1e-5);
+}
+
+TEST(Walkmesh, should_find_nearest_ray_walkmesh_intersection__deep_tree) {
+    // given
+    auto walkmesh = Walkmesh();
+    std::vector<std::shared_ptr<Walkmesh::AABB>> aabbs;
+    for (int i = 0; i < 8; ++i) {
+        auto z = static_cast<float>(i);
+        walkmesh.add(Walkmesh::Face {i, 0, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, z), glm::vec3(1.0f, -1.0f, z), glm::vec3(0.0f, 1.0f, z)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+        auto aabb = std::make_shared<Walkmesh::AABB>();
+        aabb->faceIdx = i;
+        aabbs.push_back(std::move(aabb));
+    }
+    while (aabbs.size() > 1) {
+        std::vector<std::shared_ptr<Walkmesh::AABB>> parents;
+        for (size_t i = 0; i < aabbs.size(); i += 2) {
+            auto parent = std::make_shared<Walkmesh::AABB>();
+            parent->left = aabbs[i];
+            parent->right = aabbs[i + 1];
+            parents.push_back(std::move(parent));
+        }
+        int span = 8 / static_cast<int>(parents.size());
+        for (size_t i = 0; i < parents.size(); ++i) {
+            auto minZ = static_cast<float>(i * span);
+            parents[i]->value = AABB(glm::vec3(-1.0f, -1.0f, minZ), glm::vec3(1.0f, 1.0f, minZ + span - 1.0f));
+        }
+        aabbs = std::move(parents);
+    }
+    walkmesh.setRootAABB(aabbs[0]);
+
+    // when
+    float distance = -1.0f;
+    auto face = walkmesh.raycast(std::set<uint32_t> {0}, glm::vec3(0.0f, 0.0f, 5.5f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+
+    // then
+    EXPECT_TRUE(static_cast<bool>(face));
+    EXPECT_EQ(5, face->index);
+    EXPECT_NEAR(0.5f, distance, 1e-5);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/movie/framequeue.h"
+
+using namespace reone;
+using namespace reone::movie;
+
+TEST(VideoFrameQueue, should_pick_latest_due_frame_and_recycle_skipped) {
+    // given
+    VideoFrameQueue queue(4, 3);
+    auto first = queue.acquire();
+    queue.push(0.0f, first);
+    auto second = queue.acquire();
+    queue.push(0.1f, second);
+    auto third = queue.acquire();
+    queue.push(0.2f, third);
+
+    // when
+    auto notDue = queue.pickDue(-1.0f);
+    auto picked = queue.pickDue(0.15f);
+    auto pickedAgain = queue.pickDue(0.15f);
+
+    // then
+    EXPECT_FALSE(static_cast<bool>(notDue));
+    EXPECT_EQ(second, picked);
+    EXPECT_FALSE(static_cast<bool>(pickedAgain));
+    EXPECT_EQ(3ll, picked->size());
+    auto recycled = queue.acquire();
+    EXPECT_EQ(first, recycled);
+}
+
+TEST(VideoFrameQueue, should_block_producer_until_frame_is_picked) {
+    // given
+    VideoFrameQueue queue(1, 1);
+    queue.push(0.0f, queue.acquire());
+    queue.push(0.1f, queue.acquire());
+    queue.push(0.2f, queue.acquire());
+
+    // when
+    std::atomic_bool acquired {false};
+    auto producer = std::thread([&queue, &acquired]() {
+        auto pixels = queue.acquire();
+        acquired = static_cast<bool>(pixels);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    bool acquiredBeforePick = acquired;
+    queue.pickDue(0.0f);
+    queue.pickDue(0.1f);
+    producer.join();
+
+    // then
+    EXPECT_FALSE(acquiredBeforePick);
+    EXPECT_TRUE(acquired);
+}
+
+TEST(VideoFrameQueue, should_wake_producer_when_closed) {
+    // given
+    VideoFrameQueue queue(1, 1);
+    queue.push(0.0f, queue.acquire());
+    queue.push(0.1f, queue.acquire());
+    queue.push(0.2f, queue.acquire());
+
+    // when
+    std::shared_ptr<ByteBuffer> pixels = std::make_shared<ByteBuffer>();
+    auto producer = std::thread([&queue, &pixels]() {
+        pixels = queue.acquire();
+    });
+    queue.close();
+    producer.join();
+
+    // then
+    EXPECT_FALSE(static_cast<bool>(pixels));
+}
+
+TEST(VideoFrameQueue, should_be_drained_when_finished_and_all_frames_picked) {
+    // given
+    VideoFrameQueue queue(2, 1);
+    queue.push(0.0f, queue.acquire());
+    queue.finish();
+
+    // when
+    bool drainedBeforePick = queue.isDrained();
+    queue.pickDue(0.0f);
+
+    // then
+    EXPECT_FALSE(drainedBeforePick);
+    EXPECT_TRUE(queue.isDrained());
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/2da.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static std::unique_ptr<TwoDA> makeTwoDA() {
+    return TwoDA::Builder()
+        .columns({"label", "int", "hex", "float", "bool"})
+        .row({"first", "1", "0x1f", "1.5", "1"})
+        .row({"second", "****", "ff", "", "0"})
+        .row({"first", "abc", "", "2.0", "****"})
+        .row({"third", "-4", "10", "abc", ""})
+        .build();
+}
+
+TEST(TwoDA, should_get_typed_values) {
+    // given
+
+    auto twoDa = makeTwoDA();
+
+    // expect
+
+    EXPECT_EQ(5, twoDa->getColumnCount());
+    EXPECT_EQ(4, twoDa->getRowCount());
+    EXPECT_EQ("second", twoDa->getString(1, "label"));
+    EXPECT_EQ(1, twoDa->getInt(0, "int"));
+    EXPECT_EQ(-4, twoDa->getInt(3, "int"));
+    EXPECT_EQ(7, twoDa->getInt(1, "int", 7));
+    EXPECT_EQ(0x1fu, twoDa->getHexInt(0, "hex"));
+    EXPECT_EQ(0xffu, twoDa->getHexInt(1, "hex"));
+    EXPECT_FALSE(twoDa->getHexIntOpt(2, "hex").has_value());
+    EXPECT_EQ(1.5f, twoDa->getFloat(0, "float"));
+    EXPECT_EQ(3.0f, twoDa->getFloat(1, "float", 3.0f));
+    EXPECT_TRUE(twoDa->getBool(0, "bool"));
+    EXPECT_EQ(std::optional<bool>(false), twoDa->getBoolOpt(1, "bool"));
+    EXPECT_FALSE(twoDa->getBoolOpt(2, "bool").has_value());
+    EXPECT_FALSE(twoDa->getStringOpt(1, "int").has_value());
+    EXPECT_EQ("****", twoDa->getCell(1, 1));
+    EXPECT_FALSE(twoDa->getIntOpt(4, "int").has_value());
+    EXPECT_FALSE(twoDa->getIntOpt(0, "missing").has_value());
+}
+
+TEST(TwoDA, should_throw_on_access_to_invalid_typed_value) {
+    // given
+
+    auto twoDa = makeTwoDA();
+
+    // expect
+
+    EXPECT_EQ(1, twoDa->getInt(0, "int"));
+    EXPECT_THROW(twoDa->getInt(2, "int"), std::invalid_argument);
+    EXPECT_THROW(twoDa->getFloat(3, "float"), std::invalid_argument);
+    EXPECT_EQ(2.0f, twoDa->getFloat(2, "float"));
+}
+
+TEST(TwoDA, should_index_by_cell_values) {
+    // given
+
+    auto twoDa = makeTwoDA();
+
+    // expect
+
+    EXPECT_EQ(0, twoDa->indexByCellValue("label", "first"));
+    EXPECT_EQ(3, twoDa->indexByCellValue("label", "third"));
+    EXPECT_EQ(-1, twoDa->indexByCellValue("label", "fourth"));
+    EXPECT_EQ(-1, twoDa->indexByCellValue("missing", "first"));
+    EXPECT_EQ(2, twoDa->indexByCellValues({{"label", "first"}, {"float", "2.0"}}));
+    EXPECT_EQ(-1, twoDa->indexByCellValues({{"label", "second"}, {"float", "2.0"}}));
+    EXPECT_THROW(twoDa->indexByCellValues({{"missing", "first"}}), std::logic_error);
+}
+
+TEST(TwoDA, should_throw_on_row_with_unexpected_number_of_values) {
+    // expect
+
+    EXPECT_THROW(TwoDA::Builder()
+                     .columns({"label", "int"})
+                     .row({"first"})
+                     .build(),
+                 ValidationException);
+}
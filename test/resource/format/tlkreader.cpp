@@ -19,41 +19,46 @@
 
 #include "reone/resource/format/tlkreader.h"
 #include "reone/resource/talktable.h"
+#include "reone/system/exception/validation.h"
 #include "reone/system/stream/memoryinput.h"
 #include "reone/system/stringbuilder.h"
 
 using namespace reone;
 using namespace reone::resource;
 
+static std::string makeTlk() {
+    return StringBuilder()
+               // header
+               .append("TLK V3.0", 8)
+               .append("\x00\x00\x00\x00", 4) // language id
+               .append("\x02\x00\x00\x00", 4) // number of strings
+               .append("\x64\x00\x00\x00", 4) // offset to std::string entries
+               // std::string data 0
+               .append("\x07\x00\x00\x00", 4)                                                  // flags
+               .append("\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16) // sound res ref
+               .append("\x00\x00\x00\x00", 4)                                                  // volume variance
+               .append("\x00\x00\x00\x00", 4)                                                  // pitch variance
+               .append("\x00\x00\x00\x00", 4)                                                  // offset to string
+               .append("\x04\x00\x00\x00", 4)                                                  // std::string size
+               .append("\x00\x00\x00\x00", 4)                                                  // sound length
+               // std::string data 1
+               .append("\x07\x00\x00\x00", 4)                                      // flags
+               .append("jane\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16) // sound res ref
+               .append("\x00\x00\x00\x00", 4)                                      // volume variance
+               .append("\x00\x00\x00\x00", 4)                                      // pitch variance
+               .append("\x04\x00\x00\x00", 4)                                      // offset to string
+               .append("\x04\x00\x00\x00", 4)                                      // std::string size
+               .append("\x00\x00\x00\x00", 4)                                      // sound length
+               // std::string entries
+               .append("John")
+               .append("Jane")
+               .string();
+}
+
 TEST(TlkReader, should_read_tlk) {
     // given
 
-    auto input = StringBuilder()
-                     // header
-                     .append("TLK V3.0", 8)
-                     .append("\x00\x00\x00\x00", 4) // language id
-                     .append("\x02\x00\x00\x00", 4) // number of strings
-                     .append("\x64\x00\x00\x00", 4) // offset to std::string entries
-                     // std::string data 0
-                     .append("\x07\x00\x00\x00", 4)                                                  // flags
-                     .append("\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16) // sound res ref
-                     .append("\x00\x00\x00\x00", 4)                                                  // volume variance
-                     .append("\x00\x00\x00\x00", 4)                                                  // pitch variance
-                     .append("\x00\x00\x00\x00", 4)                                                  // offset to string
-                     .append("\x04\x00\x00\x00", 4)                                                  // std::string size
-                     .append("\x00\x00\x00\x00", 4)                                                  // sound length
-                     // std::string data 1
-                     .append("\x07\x00\x00\x00", 4)                                      // flags
-                     .append("jane\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16) // sound res ref
-                     .append("\x00\x00\x00\x00", 4)                                      // volume variance
-                     .append("\x00\x00\x00\x00", 4)                                      // pitch variance
-                     .append("\x04\x00\x00\x00", 4)                                      // offset to string
-                     .append("\x04\x00\x00\x00", 4)                                      // std::string size
-                     .append("\x00\x00\x00\x00", 4)                                      // sound length
-                     // std::string entries
-                     .append("John")
-                     .append("Jane")
-                     .string();
+    auto input = makeTlk();
 
     auto stream = MemoryInputStream(input);
     auto reader = TlkReader(stream);
@@ -71,3 +76,37 @@ TEST(TlkReader, should_read_tlk) {
     EXPECT_EQ("Jane", table->getString(1).text);
     EXPECT_EQ("jane", table->getString(1).soundResRef);
 }
+
+TEST(TlkReader, should_read_tlk_lazily) {
+    // given
+
+    auto input = std::make_shared<std::string>(makeTlk());
+    auto reader = TlkReader(input->data(), input->size(), input);
+
+    // when
+
+    reader.load();
+    auto table = reader.table();
+    input.reset();
+
+    // then
+
+    EXPECT_EQ(2, table->getStringCount());
+    EXPECT_EQ("Jane", table->getString(1).text);
+    EXPECT_EQ("jane", table->getString(1).soundResRef);
+    EXPECT_EQ("John", table->getString(0).text);
+    EXPECT_EQ("", table->getString(0).soundResRef);
+    EXPECT_EQ("Jane", table->getString(1).text);
+    EXPECT_THROW(table->getString(2), std::out_of_range);
+}
+
+TEST(TlkReader, should_throw_when_lazy_tlk_entries_are_truncated) {
+    // given
+
+    auto input = std::make_shared<std::string>(makeTlk().substr(0, 60));
+    auto reader = TlkReader(input->data(), input->size(), input);
+
+    // expect
+
+    EXPECT_THROW(reader.load(), ValidationException);
+}
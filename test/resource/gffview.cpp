@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/resource/gffview.h"
+#include "reone/resource/parser/gff/git.h"
+#include "reone/resource/parser/gff/utc.h"
+#include "reone/resource/parser/gff/utw.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static std::shared_ptr<ByteBuffer> writeGff(const Gff &root) {
+    auto bytes = std::make_shared<ByteBuffer>();
+    auto stream = MemoryOutputStream(*bytes);
+    GffWriter(ResType::Res, root).save(stream);
+    return bytes;
+}
+
+static std::shared_ptr<Gff> makeUTC(int numItems) {
+    auto knownList = std::vector<std::shared_ptr<Gff>>();
+    for (int i = 0; i < 3; ++i) {
+        knownList.push_back(Gff::Builder()
+                                .field(Gff::Field::newWord("Spell", 10 + i))
+                                .field(Gff::Field::newByte("SpellFlags", 1))
+                                .build());
+    }
+    auto classList = std::vector<std::shared_ptr<Gff>> {
+        Gff::Builder()
+            .type(2)
+            .field(Gff::Field::newInt("Class", 4))
+            .field(Gff::Field::newShort("ClassLevel", 7))
+            .field(Gff::Field::newList("KnownList0", knownList))
+            .build()};
+    auto itemList = std::vector<std::shared_ptr<Gff>>();
+    for (int i = 0; i < numItems; ++i) {
+        itemList.push_back(Gff::Builder()
+                               .type(i)
+                               .field(Gff::Field::newByte("Dropable", i % 2))
+                               .field(Gff::Field::newResRef("InventoryRes", "g_i_item" + std::to_string(i)))
+                               .field(Gff::Field::newWord("Repos_PosX", i))
+                               .field(Gff::Field::newWord("Repos_Posy", 0))
+                               .build());
+    }
+    return Gff::Builder()
+        .type(0xffffffff)
+        .field(Gff::Field::newWord("Appearance_Type", 123))
+        .field(Gff::Field::newFloat("ChallengeRating", 1.5f))
+        .field(Gff::Field::newList("ClassList", classList))
+        .field(Gff::Field::newResRef("Conversation", "n_commoner"))
+        .field(Gff::Field::newCExoLocString("FirstName", 1234, ""))
+        .field(Gff::Field::newShort("HitPoints", 20))
+        .field(Gff::Field::newList("ItemList", itemList))
+        .field(Gff::Field::newWord("PortraitId", 5))
+        .field(Gff::Field::newResRef("ScriptHeartbeat", "k_def_heartbt01"))
+        .field(Gff::Field::newCExoString("Tag", "n_commoner01"))
+        .field(Gff::Field::newResRef("TemplateResRef", "n_commoner01"))
+        .build();
+}
+
+static std::shared_ptr<Gff> makeGIT(int numCreatures) {
+    auto creatures = std::vector<std::shared_ptr<Gff>>();
+    for (int i = 0; i < numCreatures; ++i) {
+        creatures.push_back(Gff::Builder()
+                                .type(4)
+                                .field(Gff::Field::newResRef("TemplateResRef", "n_creature" + std::to_string(i)))
+                                .field(Gff::Field::newFloat("XOrientation", 1.0f))
+                                .field(Gff::Field::newFloat("XPosition", static_cast<float>(i)))
+                                .field(Gff::Field::newFloat("YOrientation", 0.0f))
+                                .field(Gff::Field::newFloat("YPosition", 2.0f * i))
+                                .field(Gff::Field::newFloat("ZPosition", 0.5f))
+                                .build());
+    }
+    auto cameras = std::vector<std::shared_ptr<Gff>> {
+        Gff::Builder()
+            .type(14)
+            .field(Gff::Field::newInt("CameraID", 1))
+            .field(Gff::Field::newFloat("FieldOfView", 55.0f))
+            .field(Gff::Field::newOrientation("Orientation", glm::quat(0.5f, 0.5f, 0.5f, 0.5f)))
+            .field(Gff::Field::newVector("Position", glm::vec3(1.0f, 2.0f, 3.0f)))
+            .build()};
+    auto areaProperties = Gff::Builder()
+                              .type(100)
+                              .field(Gff::Field::newInt("AmbientSndDay", 3))
+                              .field(Gff::Field::newInt("MusicBattle", 8))
+                              .build();
+    return Gff::Builder()
+        .type(0xffffffff)
+        .field(Gff::Field::newStruct("AreaProperties", areaProperties))
+        .field(Gff::Field::newList("CameraList", cameras))
+        .field(Gff::Field::newList("Creature List", creatures))
+        .build();
+}
+
+TEST(GffView, should_read_fields_of_written_gff) {
+    // given
+
+    auto child = Gff::Builder()
+                     .type(1)
+                     .field(Gff::Field::newInt("Int", 2))
+                     .build();
+    auto item1 = Gff::Builder()
+                     .type(2)
+                     .field(Gff::Field::newInt("Int", 3))
+                     .build();
+    auto item2 = Gff::Builder()
+                     .type(3)
+                     .field(Gff::Field::newCExoString("CExoString", "Item"))
+                     .build();
+    auto root = Gff::Builder()
+                    .type(0xffffffff)
+                    .field(Gff::Field::newByte("Byte", 1))
+                    .field(Gff::Field::newChar("Char", -2))
+                    .field(Gff::Field::newWord("Word", 3))
+                    .field(Gff::Field::newShort("Short", -4))
+                    .field(Gff::Field::newDword("Dword", 0x00ff8000))
+                    .field(Gff::Field::newInt("Int", -6))
+                    .field(Gff::Field::newDword64("Dword64", 0x1122334455667788ull))
+                    .field(Gff::Field::newInt64("Int64", -8))
+                    .field(Gff::Field::newFloat("Float", 9.5f))
+                    .field(Gff::Field::newDouble("Double", 10.25))
+                    .field(Gff::Field::newCExoString("CExoString", "Hello"))
+                    .field(Gff::Field::newResRef("ResRef", "world"))
+                    .field(Gff::Field::newCExoLocString("CExoLocString", 13, "Loc"))
+                    .field(Gff::Field::newVoid("Void", ByteBuffer {'\x01', '\x02', '\x03'}))
+                    .field(Gff::Field::newStruct("Struct", child))
+                    .field(Gff::Field::newList("List", std::vector<std::shared_ptr<Gff>> {item1, item2}))
+                    .field(Gff::Field::newOrientation("Orientation", glm::quat(1.0f, 2.0f, 3.0f, 4.0f)))
+                    .field(Gff::Field::newVector("Vector", glm::vec3(1.0f, 2.0f, 3.0f)))
+                    .field(Gff::Field::newStrRef("StrRef", 19))
+                    .build();
+
+    // when
+
+    auto view = GffView::load(writeGff(*root));
+
+    // then
+
+    EXPECT_TRUE(static_cast<bool>(view));
+    EXPECT_EQ(0xffffffff, view.type());
+    EXPECT_EQ(1u, view.getUint("Byte"));
+    EXPECT_TRUE(view.getBool("Byte"));
+    EXPECT_EQ(-2, view.getInt("Char"));
+    EXPECT_EQ(3u, view.getUint("Word"));
+    EXPECT_EQ(-4, view.getInt("Short"));
+    EXPECT_EQ(0x00ff8000u, view.getUint("Dword"));
+    EXPECT_EQ(glm::vec3(0.0f, 128.0f / 255.0f, 1.0f), view.getColor("Dword"));
+    EXPECT_EQ(-6, view.getInt("Int"));
+    EXPECT_EQ(0x1122334455667788ull, view.readUint64("Dword64"));
+    EXPECT_EQ(-8ll, view.readInt64("Int64"));
+    EXPECT_EQ(9.5f, view.getFloat("Float"));
+    EXPECT_EQ(10.25, view.getDouble("Double"));
+    EXPECT_EQ("Hello", view.getString("CExoString"));
+    EXPECT_EQ("world", view.getString("ResRef"));
+    EXPECT_EQ(13, view.getInt("CExoLocString"));
+    EXPECT_EQ("Loc", view.getString("CExoLocString"));
+    EXPECT_EQ((ByteBuffer {'\x01', '\x02', '\x03'}), view.getData("Void"));
+    EXPECT_EQ(glm::quat(1.0f, 2.0f, 3.0f, 4.0f), view.getOrientation("Orientation"));
+    EXPECT_EQ(glm::vec3(1.0f, 2.0f, 3.0f), view.getVector("Vector"));
+    EXPECT_EQ(19, view.getInt("StrRef"));
+
+    auto strct = view.findStruct("Struct");
+    EXPECT_TRUE(static_cast<bool>(strct));
+    EXPECT_EQ(1u, strct->type());
+    EXPECT_EQ(2, strct->getInt("Int"));
+
+    auto list = view.getList("List");
+    EXPECT_EQ(2ll, list.size());
+    EXPECT_EQ(2u, list[0].type());
+    EXPECT_EQ(3, list[0].getInt("Int"));
+    EXPECT_EQ(3u, list[1].type());
+    EXPECT_EQ("Item", list[1].getString("CExoString"));
+    EXPECT_FALSE(list[1].getBool("Int", false));
+}
+
+TEST(GffView, should_return_defaults_for_missing_fields) {
+    // given
+
+    auto root = Gff::Builder()
+                    .type(0xffffffff)
+                    .field(Gff::Field::newInt("Int", 1))
+                    .field(Gff::Field::newCExoString("CExoString", "Hello"))
+                    .build();
+
+    // when
+
+    auto view = GffView::load(writeGff(*root));
+
+    // then
+
+    EXPECT_EQ(2, view.getInt("Missing", 2));
+    EXPECT_EQ("default", view.getString("Missing", "default"));
+    EXPECT_EQ(glm::vec3(1.0f), view.getVector("Missing", glm::vec3(1.0f)));
+    EXPECT_FALSE(static_cast<bool>(view.findStruct("Missing")));
+    EXPECT_TRUE(view.getList("Missing").empty());
+    EXPECT_TRUE(view.getData("Missing").empty());
+    EXPECT_EQ("", view.getString("Int"));
+    EXPECT_EQ(0, view.getInt("CExoString"));
+}
+
+TEST(GffView, should_parse_same_as_gff) {
+    // given
+
+    auto root = Gff::Builder()
+                    .type(0xffffffff)
+                    .field(Gff::Field::newByte("Appearance", 2))
+                    .field(Gff::Field::newCExoLocString("LocalizedName", 42, "Waypoint"))
+                    .field(Gff::Field::newCExoString("Tag", "wp_test"))
+                    .field(Gff::Field::newResRef("TemplateResRef", "wp_test"))
+                    .build();
+    auto bytes = writeGff(*root);
+
+    // when
+
+    auto fromGff = generated::parseUTW(*root);
+    auto fromView = generated::parseUTW(GffView::load(bytes));
+
+    // then
+
+    EXPECT_EQ(fromGff.Appearance, fromView.Appearance);
+    EXPECT_EQ(fromGff.LocalizedName, fromView.LocalizedName);
+    EXPECT_EQ(fromGff.Tag, fromView.Tag);
+    EXPECT_EQ(fromGff.TemplateResRef, fromView.TemplateResRef);
+    EXPECT_EQ(fromGff.Comment, fromView.Comment);
+    EXPECT_EQ(fromGff.MapNote, fromView.MapNote);
+}
+
+TEST(GffView, should_read_loc_string_with_many_substrings_same_as_gff_reader) {
+    // given
+
+    auto root = Gff::Builder()
+                    .type(0xffffffff)
+                    .field(Gff::Field::newCExoLocString("LocString", 13, "Loc"))
+                    .build();
+    auto bytes = writeGff(*root);
+    uint32_t fieldDataOffset;
+    std::memcpy(&fieldDataOffset, bytes->data() + 0x20, sizeof(uint32_t));
+    (*bytes)[fieldDataOffset + 8] = 2; // substring count
+
+    // when
+
+    auto stream = MemoryInputStream(*bytes);
+    auto reader = GffReader(stream);
+    reader.load();
+    auto view = GffView::load(bytes);
+
+    // then
+
+    EXPECT_EQ("", reader.root()->getString("LocString"));
+    EXPECT_EQ(reader.root()->getString("LocString"), view.getString("LocString"));
+    EXPECT_EQ(reader.root()->getInt("LocString"), view.getInt("LocString"));
+}
+
+TEST(GffView, should_throw_on_truncated_gff) {
+    // given
+
+    auto root = Gff::Builder()
+                    .type(0xffffffff)
+                    .field(Gff::Field::newInt("Int", 1))
+                    .build();
+    auto bytes = writeGff(*root);
+    bytes->resize(bytes->size() - 4);
+
+    // expect
+
+    EXPECT_THROW(GffView::load(bytes), ValidationException);
+}
+
+TEST(GffView, should_parse_utc_same_as_gff) {
+    // given
+
+    auto root = makeUTC(20);
+    auto bytes = writeGff(*root);
+
+    // when
+
+    auto fromGff = generated::parseUTC(*root);
+    auto fromView = generated::parseUTC(GffView::load(bytes));
+
+    // then
+
+    EXPECT_EQ(fromGff.Appearance_Type, fromView.Appearance_Type);
+    EXPECT_EQ(fromGff.ChallengeRating, fromView.ChallengeRating);
+    EXPECT_EQ(fromGff.Conversation, fromView.Conversation);
+    EXPECT_EQ(fromGff.FirstName, fromView.FirstName);
+    EXPECT_EQ(fromGff.HitPoints, fromView.HitPoints);
+    EXPECT_EQ(fromGff.PortraitId, fromView.PortraitId);
+    EXPECT_EQ(fromGff.ScriptHeartbeat, fromView.ScriptHeartbeat);
+    EXPECT_EQ(fromGff.Tag, fromView.Tag);
+    EXPECT_EQ(fromGff.TemplateResRef, fromView.TemplateResRef);
+    EXPECT_EQ(fromGff.LastName, fromView.LastName);
+    ASSERT_EQ(1ll, fromView.ClassList.size());
+    EXPECT_EQ(fromGff.ClassList[0].Class, fromView.ClassList[0].Class);
+    EXPECT_EQ(fromGff.ClassList[0].ClassLevel, fromView.ClassList[0].ClassLevel);
+    ASSERT_EQ(3ll, fromView.ClassList[0].KnownList0.size());
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(fromGff.ClassList[0].KnownList0[i].Spell, fromView.ClassList[0].KnownList0[i].Spell);
+        EXPECT_EQ(fromGff.ClassList[0].KnownList0[i].SpellFlags, fromView.ClassList[0].KnownList0[i].SpellFlags);
+    }
+    ASSERT_EQ(20ll, fromView.ItemList.size());
+    for (size_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(fromGff.ItemList[i].Dropable, fromView.ItemList[i].Dropable);
+        EXPECT_EQ(fromGff.ItemList[i].InventoryRes, fromView.ItemList[i].InventoryRes);
+        EXPECT_EQ(fromGff.ItemList[i].Repos_PosX, fromView.ItemList[i].Repos_PosX);
+    }
+}
+
+TEST(GffView, should_parse_git_same_as_gff) {
+    // given
+
+    auto root = makeGIT(50);
+    auto bytes = writeGff(*root);
+
+    // when
+
+    auto fromGff = generated::parseGIT(*root);
+    auto fromView = generated::parseGIT(GffView::load(bytes));
+
+    // then
+
+    EXPECT_EQ(fromGff.AreaProperties.AmbientSndDay, fromView.AreaProperties.AmbientSndDay);
+    EXPECT_EQ(fromGff.AreaProperties.MusicBattle, fromView.AreaProperties.MusicBattle);
+    EXPECT_EQ(fromGff.AreaProperties.MusicDay, fromView.AreaProperties.MusicDay);
+    ASSERT_EQ(1ll, fromView.CameraList.size());
+    EXPECT_EQ(fromGff.CameraList[0].CameraID, fromView.CameraList[0].CameraID);
+    EXPECT_EQ(fromGff.CameraList[0].FieldOfView, fromView.CameraList[0].FieldOfView);
+    EXPECT_EQ(fromGff.CameraList[0].Orientation, fromView.CameraList[0].Orientation);
+    EXPECT_EQ(fromGff.CameraList[0].Position, fromView.CameraList[0].Position);
+    ASSERT_EQ(50ll, fromView.Creature_List.size());
+    for (size_t i = 0; i < 50; ++i) {
+        EXPECT_EQ(fromGff.Creature_List[i].TemplateResRef, fromView.Creature_List[i].TemplateResRef);
+        EXPECT_EQ(fromGff.Creature_List[i].XOrientation, fromView.Creature_List[i].XOrientation);
+        EXPECT_EQ(fromGff.Creature_List[i].XPosition, fromView.Creature_List[i].XPosition);
+        EXPECT_EQ(fromGff.Creature_List[i].YPosition, fromView.Creature_List[i].YPosition);
+        EXPECT_EQ(fromGff.Creature_List[i].ZPosition, fromView.Creature_List[i].ZPosition);
+    }
+    EXPECT_TRUE(fromView.Door_List.empty());
+}
+
+TEST(GffView, should_visit_fields_in_schema) {
+    // given
+
+    static const GffSchema schema {"Int", "Missing", "CExoString"};
+    auto root = Gff::Builder()
+                    .type(0xffffffff)
+                    .field(Gff::Field::newCExoString("CExoString", "Hello"))
+                    .field(Gff::Field::newFloat("Float", 1.0f))
+                    .field(Gff::Field::newInt("Int", 1))
+                    .field(Gff::Field::newInt("Int", 2))
+                    .build();
+    auto view = GffView::load(writeGff(*root));
+    auto visited = std::vector<std::pair<int, std::string>>();
+
+    // when
+
+    view.visitFields(schema, [&visited](int member, const GffView::FieldValue &field) {
+        visited.push_back(std::make_pair(member, member == 0 ? std::to_string(field.getInt()) : field.getString()));
+    });
+
+    // then
+
+    std::sort(visited.begin(), visited.end());
+    EXPECT_EQ(2ll, visited.size());
+    EXPECT_EQ(std::make_pair(0, std::string("1")), visited[0]);
+    EXPECT_EQ(std::make_pair(2, std::string("Hello")), visited[1]);
+}
@@ -21,6 +21,7 @@
 #include "reone/resource/provider/gffs.h"
 #include "reone/resource/resources.h"
 #include "reone/system/stream/memoryoutput.h"
+#include "reone/system/threadpool.h"
 
 using namespace reone;
 using namespace reone::resource;
@@ -65,3 +66,57 @@ TEST(Gffs, should_get_gff_with_caching) {
     EXPECT_TRUE(static_cast<bool>(gff2));
     EXPECT_EQ(gff1.get(), gff2.get());
 }
+
+TEST(Gffs, should_prefetch_gffs_in_parallel) {
+    // given
+
+    auto resBytes = ByteBuffer();
+    auto res = MemoryOutputStream(resBytes);
+    res.write("GFF V3.2", 8);
+    res.write("\x38\x00\x00\x00", 4); // offset to structs
+    res.write("\x01\x00\x00\x00", 4); // number of structs
+    for (int i = 0; i < 5; ++i) {
+        res.write("\x44\x00\x00\x00", 4); // offset to table
+        res.write("\x00\x00\x00\x00", 4); // size of table
+    }
+    res.write("\xff\xff\xff\xff", 4); // root struct type
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+
+    auto threadPool = ThreadPool(2);
+    threadPool.init();
+
+    auto resources = Resources();
+    auto provider = std::make_unique<MemoryResourceContainer>();
+    for (int i = 0; i < 100; ++i) {
+        provider->add(ResourceId("sample" + std::to_string(i), ResType::Utc), resBytes);
+    }
+    resources.add(std::move(provider));
+
+    auto gffs = Gffs(resources, threadPool);
+
+    auto ids = std::vector<ResourceId>();
+    for (int i = 0; i < 100; ++i) {
+        ids.push_back(ResourceId("sample" + std::to_string(i), ResType::Utc));
+    }
+    ids.push_back(ResourceId("sample0", ResType::Utc));
+    ids.push_back(ResourceId("missing", ResType::Utc));
+
+    // when
+
+    gffs.prefetch(ids);
+
+    resources.clear();
+
+    auto gff1 = gffs.getView("sample0", ResType::Utc);
+    auto gff2 = gffs.getView("sample99", ResType::Utc);
+    auto gff3 = gffs.getView("missing", ResType::Utc);
+
+    // then
+
+    EXPECT_TRUE(static_cast<bool>(gff1));
+    EXPECT_TRUE(static_cast<bool>(gff2));
+    EXPECT_FALSE(static_cast<bool>(gff3));
+    EXPECT_EQ(0xffffffff, gff1.type());
+    EXPECT_EQ(101ll, resources.numHits() + resources.numMisses());
+}
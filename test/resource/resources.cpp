@@ -17,7 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include "reone/resource/container/memory.h"
 #include "reone/resource/resources.h"
+#include "reone/system/binarywriter.h"
 #include "reone/system/logutil.h"
 #include "reone/system/stream/fileoutput.h"
 
@@ -110,3 +112,151 @@ TEST(Resources, should_index_providers_and_get_resources_without_caching) {
 
     std::filesystem::remove_all(tmpDirPath);
 }
+
+TEST(Resources, should_find_resource_views_into_mapped_archives) {
+    // given
+
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_resources_views");
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto erfPath = tmpDirPath;
+    erfPath.append("sample.erf");
+    auto erf = FileOutputStream(erfPath);
+    erf.write("ERF V1.0", 8);
+    erf.write("\x00\x00\x00\x00", 4);
+    erf.write("\x00\x00\x00\x00", 4);
+    erf.write("\x01\x00\x00\x00", 4);
+    erf.write("\x00\x00\x00\x00", 4);
+    erf.write("\xa0\x00\x00\x00", 4);
+    erf.write("\xb8\x00\x00\x00", 4);
+    erf.write("\x00\x00\x00\x00", 4);
+    erf.write("\x00\x00\x00\x00", 4);
+    erf.write("\x00\x00\x00\x00", 4);
+    auto erfPadding = ByteBuffer(116, '\0');
+    erf.write(&erfPadding[0], erfPadding.size());
+    erf.write("sample\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16);
+    erf.write("\x00\x00\x00\x00", 4);
+    erf.write("\x0a\x00\x00\x00", 4);
+    erf.write("\xc0\x00\x00\x00", 4);
+    erf.write("\x0d\x00\x00\x00", 4);
+    erf.write("Hello, world!", 13);
+    erf.close();
+
+    auto resources = Resources();
+
+    auto expectedResData = std::string("Hello, world!");
+
+    // when
+
+    resources.addERF(erfPath, true);
+
+    auto view = resources.findView(ResourceId("sample", ResType::Txt));
+    auto res = resources.find(ResourceId("sample", ResType::Txt));
+    resources.clear();
+    auto actualViewData = view ? std::string(view->data, view->size) : std::string();
+    auto actualResData = res ? std::string(res->data.begin(), res->data.end()) : std::string();
+
+    // then
+
+    EXPECT_TRUE(static_cast<bool>(view));
+    EXPECT_TRUE(view->local);
+    EXPECT_EQ(expectedResData, actualViewData) << notEqualMessage(expectedResData, actualViewData);
+    EXPECT_EQ(expectedResData, actualResData) << notEqualMessage(expectedResData, actualResData);
+
+    // cleanup
+
+    view.reset();
+    std::filesystem::remove_all(tmpDirPath);
+}
+
+TEST(Resources, should_index_large_key_bif_and_respect_precedence) {
+    // given
+
+    static constexpr int kNumResources = 50000;
+
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_resources_index");
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto bifPath = tmpDirPath;
+    bifPath.append("sample.bif");
+    auto bif = FileOutputStream(bifPath);
+    auto bifWriter = BinaryWriter(bif);
+    bifWriter.writeString("BIFFV1  ");
+    bifWriter.writeUint32(kNumResources);
+    bifWriter.writeUint32(0);
+    bifWriter.writeUint32(20);
+    for (auto i = 0; i < kNumResources; ++i) {
+        bifWriter.writeUint32(i);
+        bifWriter.writeUint32(20 + 16 * kNumResources + 4 * i);
+        bifWriter.writeUint32(4);
+        bifWriter.writeUint32(static_cast<uint32_t>(ResType::Txt));
+    }
+    for (auto i = 0; i < kNumResources; ++i) {
+        bifWriter.writeInt32(i);
+    }
+    bif.close();
+
+    auto keyPath = tmpDirPath;
+    keyPath.append("sample.key");
+    auto key = FileOutputStream(keyPath);
+    auto keyWriter = BinaryWriter(key);
+    keyWriter.writeString("KEY V1  ");
+    keyWriter.writeUint32(1);
+    keyWriter.writeUint32(kNumResources);
+    keyWriter.writeUint32(64);
+    keyWriter.writeUint32(87);
+    keyWriter.write(40, 0);
+    keyWriter.writeUint32(static_cast<uint32_t>(std::filesystem::file_size(bifPath)));
+    keyWriter.writeUint32(76);
+    keyWriter.writeUint16(11);
+    keyWriter.writeUint16(0);
+    keyWriter.writeCString("sample.bif");
+    for (auto i = 0; i < kNumResources; ++i) {
+        auto resRef = "res" + std::to_string(i);
+        keyWriter.writeString(resRef);
+        keyWriter.write(16 - static_cast<int>(resRef.size()), 0);
+        keyWriter.writeUint16(static_cast<uint16_t>(ResType::Txt));
+        keyWriter.writeUint32(i);
+    }
+    key.close();
+
+    auto overrides = std::make_unique<MemoryResourceContainer>();
+    overrides->add(ResourceId("res42", ResType::Txt), ByteBuffer {'4', '2'});
+
+    auto resources = Resources();
+
+    auto expectedOverrideData = ByteBuffer {'4', '2'};
+    auto expectedBifData = ByteBuffer {'\x2a', '\x00', '\x00', '\x00'};
+    auto expectedLastData = ByteBuffer {'\x4f', '\xc3', '\x00', '\x00'};
+
+    // when
+
+    resources.addKEY(keyPath);
+    resources.add(std::move(overrides), true);
+
+    auto actualRes1 = resources.find(ResourceId("res42", ResType::Txt));
+    auto actualRes2 = resources.find(ResourceId(std::string("res") + std::to_string(kNumResources - 1), ResType::Txt));
+    auto actualRes3 = resources.find(ResourceId("missing", ResType::Txt));
+    resources.clearLocal();
+    auto actualRes4 = resources.find(ResourceId("res42", ResType::Txt));
+
+    // then
+
+    EXPECT_TRUE(static_cast<bool>(actualRes1));
+    EXPECT_TRUE(actualRes1->local);
+    EXPECT_EQ(expectedOverrideData, actualRes1->data) << notEqualMessage(expectedOverrideData, actualRes1->data);
+    EXPECT_TRUE(static_cast<bool>(actualRes2));
+    EXPECT_EQ(expectedLastData, actualRes2->data) << notEqualMessage(expectedLastData, actualRes2->data);
+    EXPECT_FALSE(static_cast<bool>(actualRes3));
+    EXPECT_TRUE(static_cast<bool>(actualRes4));
+    EXPECT_FALSE(actualRes4->local);
+    EXPECT_EQ(expectedBifData, actualRes4->data) << notEqualMessage(expectedBifData, actualRes4->data);
+    EXPECT_EQ(3ll, resources.numHits());
+    EXPECT_EQ(1ll, resources.numMisses());
+
+    // cleanup
+
+    std::filesystem::remove_all(tmpDirPath);
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/modelnode.h"
+#include "reone/graphics/options.h"
+#include "reone/scene/graph.h"
+#include "reone/scene/node/dummy.h"
+#include "reone/scene/node/emitter.h"
+
+#include "../fixtures/audio.h"
+#include "../fixtures/graphics.h"
+#include "../fixtures/resource.h"
+#include "../fixtures/scene.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::scene;
+
+class EmitterSceneNodeTest : public testing::Test {
+protected:
+    GraphicsOptions _graphicsOpt;
+    MockRenderPipelineFactory _pipelineFactory;
+    TestGraphicsModule _graphicsModule;
+    TestAudioModule _audioModule;
+    TestResourceModule _resourceModule;
+
+    std::unique_ptr<SceneGraph> _scene;
+    std::vector<std::shared_ptr<ModelNode>> _modelNodes;
+
+    void SetUp() override {
+        _graphicsModule.init();
+        _audioModule.init();
+        _resourceModule.init();
+
+        _scene = std::make_unique<SceneGraph>("test", _pipelineFactory, _graphicsOpt, _graphicsModule.services(), _audioModule.services(), _resourceModule.services());
+    }
+
+    std::shared_ptr<EmitterSceneNode> newEmitter(
+        ModelNode::Emitter::UpdateMode updateMode,
+        const std::map<ControllerType, float> &controllers,
+        bool loop = false) {
+
+        auto emitter = std::make_shared<ModelNode::Emitter>();
+        emitter->updateMode = updateMode;
+        emitter->loop = loop;
+        auto modelNode = std::make_shared<ModelNode>(0, "emitter", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+        modelNode->setEmitter(std::move(emitter));
+        for (auto &[type, value] : controllers) {
+            auto &track = modelNode->floatTracks()[type];
+            track.add(0.0f, value);
+            track.update();
+        }
+        auto node = _scene->newEmitter(*modelNode);
+        _modelNodes.push_back(std::move(modelNode));
+        return node;
+    }
+};
+
+TEST_F(EmitterSceneNodeTest, should_remove_expired_fountain_particles) {
+    // given
+    auto emitter = newEmitter(
+        ModelNode::Emitter::UpdateMode::Fountain,
+        {{ControllerTypes::birthrate, 10.0f},
+         {ControllerTypes::lifeExp, 0.35f},
+         {ControllerTypes::velocity, 1.0f}});
+
+    // when
+    for (int frame = 0; frame < 20; ++frame) {
+        emitter->update(0.1f);
+    }
+
+    // then
+    ASSERT_EQ(4, emitter->numParticles());
+    std::vector<float> distances;
+    for (int i = 0; i < emitter->numParticles(); ++i) {
+        auto &position = emitter->particlePosition(i);
+        EXPECT_EQ(0.0f, position.x);
+        EXPECT_EQ(0.0f, position.y);
+        distances.push_back(position.z);
+    }
+    std::sort(distances.begin(), distances.end());
+    EXPECT_NEAR(0.1f, distances[0], 1e-5f);
+    EXPECT_NEAR(0.2f, distances[1], 1e-5f);
+    EXPECT_NEAR(0.3f, distances[2], 1e-5f);
+    EXPECT_NEAR(0.3f, distances[3], 1e-5f);
+}
+
+TEST_F(EmitterSceneNodeTest, should_not_exceed_max_particles) {
+    // given
+    auto fountain = newEmitter(ModelNode::Emitter::UpdateMode::Fountain, {{ControllerTypes::lifeExp, -1.0f}});
+    auto single = newEmitter(ModelNode::Emitter::UpdateMode::Single, {{ControllerTypes::lifeExp, -1.0f}});
+
+    // when
+    for (int i = 0; i < kMaxParticles + 10; ++i) {
+        fountain->detonate();
+        single->detonate();
+    }
+
+    // then
+    EXPECT_EQ(kMaxParticles, fountain->numParticles());
+    EXPECT_EQ(1, single->numParticles());
+}
+
+TEST_F(EmitterSceneNodeTest, should_spawn_single_particle_once_unless_looping) {
+    // given
+    auto once = newEmitter(ModelNode::Emitter::UpdateMode::Single, {{ControllerTypes::lifeExp, 0.5f}});
+    auto looping = newEmitter(ModelNode::Emitter::UpdateMode::Single, {{ControllerTypes::lifeExp, 0.5f}}, true);
+
+    // when
+    once->update(0.1f);
+    looping->update(0.1f);
+    int numSpawnedOnce = once->numParticles();
+    int numSpawnedLooping = looping->numParticles();
+    for (int frame = 0; frame < 10; ++frame) {
+        once->update(0.1f);
+        looping->update(0.1f);
+    }
+
+    // then
+    EXPECT_EQ(1, numSpawnedOnce);
+    EXPECT_EQ(1, numSpawnedLooping);
+    EXPECT_EQ(0, once->numParticles());
+    EXPECT_EQ(1, looping->numParticles());
+}
+
+TEST_F(EmitterSceneNodeTest, should_spawn_lightning_segments_towards_reference_node) {
+    // given
+    auto emitter = newEmitter(
+        ModelNode::Emitter::UpdateMode::Lightning,
+        {{ControllerTypes::lightingDelay, 1.0f},
+         {ControllerTypes::lightingSubDiv, 3.0f},
+         {ControllerTypes::lightingScale, 0.5f}});
+    auto refModelNode = std::make_shared<ModelNode>(1, "ref", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+    auto ref = _scene->newDummy(*refModelNode);
+    ref->setLocalTransform(glm::translate(glm::vec3(0.0f, 0.0f, 4.0f)));
+    emitter->addChild(*ref);
+
+    // when
+    emitter->update(0.1f);
+
+    // then
+    ASSERT_EQ(4, emitter->numParticles());
+    for (int i = 0; i < 4; ++i) {
+        auto &position = emitter->particlePosition(i);
+        EXPECT_NEAR(0.0f, position.x, 1e-5f) << "segment " << i;
+        EXPECT_NEAR(0.0f, position.y, 1e-5f) << "segment " << i;
+        EXPECT_NEAR(0.5f + i, position.z, 1e-5f) << "segment " << i;
+    }
+}
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/animation.h"
+#include "reone/graphics/options.h"
+#include "reone/graphics/walkmesh.h"
+#include "reone/scene/collision.h"
+#include "reone/scene/graph.h"
+#include "reone/scene/node/model.h"
+#include "reone/scene/node/walkmesh.h"
+#include "reone/system/threadpool.h"
+
+#include "../fixtures/audio.h"
+#include "../fixtures/graphics.h"
+#include "../fixtures/resource.h"
+#include "../fixtures/scene.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::scene;
+
+static constexpr uint32_t kFloorMaterial = 1;
+static constexpr uint32_t kWallMaterial = 2;
+
+static constexpr int kNumAnimatedNodes = 6;
+static constexpr int kNumAnimatedModels = 50;
+
+static constexpr int kGridSize = 20;
+static constexpr float kGridSpacing = 4.0f;
+
+namespace {
+
+struct TestUser : IUser {
+};
+
+} // namespace
+
+static std::unique_ptr<Walkmesh> makeFloorAndWall() {
+    auto walkmesh = std::make_unique<Walkmesh>();
+    walkmesh->add(Walkmesh::Face {0, kFloorMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh->add(Walkmesh::Face {1, kFloorMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh->add(Walkmesh::Face {2, kWallMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 2.0f)}, glm::vec3(0.0f, -1.0f, 0.0f)});
+    walkmesh->add(Walkmesh::Face {3, kWallMaterial, std::vector<glm::vec3> {glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 2.0f), glm::vec3(-1.0f, 0.0f, 2.0f)}, glm::vec3(0.0f, -1.0f, 0.0f)});
+    auto rootAabb = std::make_shared<Walkmesh::AABB>();
+    rootAabb->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 2.0f));
+    rootAabb->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
+    rootAabb->left->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->left->faceIdx = 0;
+    rootAabb->left->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->left->right->faceIdx = 1;
+    rootAabb->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->value = AABB(glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 2.0f));
+    rootAabb->right->left = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->left->faceIdx = 2;
+    rootAabb->right->right = std::make_shared<Walkmesh::AABB>();
+    rootAabb->right->right->faceIdx = 3;
+    walkmesh->setRootAABB(rootAabb);
+    return walkmesh;
+}
+
+static std::vector<CollisionQuery> makeQueries(const std::vector<TestUser> &users, int count) {
+    auto random = std::mt19937(1234);
+    auto extent = std::uniform_real_distribution<float>(-2.0f, kGridSize * kGridSpacing + 2.0f);
+    auto offset = std::uniform_real_distribution<float>(-10.0f, 10.0f);
+    auto userIdx = std::uniform_int_distribution<int>(0, static_cast<int>(users.size()) - 1);
+
+    std::vector<CollisionQuery> queries;
+    for (int i = 0; i < count; ++i) {
+        CollisionQuery query;
+        query.type = static_cast<CollisionTestType>(i % 3);
+        query.origin = glm::vec3(extent(random), extent(random), 1.0f);
+        query.dest = query.origin + glm::vec3(offset(random), offset(random), 0.0f);
+        if (query.type == CollisionTestType::Walk && i % 2 == 0) {
+            query.excludeUser = &users[userIdx(random)];
+        }
+        queries.push_back(query);
+    }
+    return queries;
+}
+
+static void expectResultsEqual(const ISceneGraph &scene, const std::vector<CollisionQuery> &queries, const std::vector<CollisionResult> &results) {
+    ASSERT_EQ(queries.size(), results.size());
+    int numCollided = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto &query = queries[i];
+        Collision collision;
+        bool collided = false;
+        switch (query.type) {
+        case CollisionTestType::Elevation:
+            collided = scene.testElevation(glm::vec2(query.origin), collision);
+            break;
+        case CollisionTestType::LineOfSight:
+            collided = scene.testLineOfSight(query.origin, query.dest, collision);
+            break;
+        case CollisionTestType::Walk:
+            collided = scene.testWalk(query.origin, query.dest, query.excludeUser, collision);
+            break;
+        }
+        EXPECT_EQ(collided, results[i].collided) << "query " << i;
+        if (collided && results[i].collided) {
+            ++numCollided;
+            EXPECT_EQ(collision.user, results[i].collision.user) << "query " << i;
+            EXPECT_EQ(collision.material, results[i].collision.material) << "query " << i;
+            EXPECT_TRUE(collision.intersection == results[i].collision.intersection) << "query " << i;
+            EXPECT_TRUE(collision.normal == results[i].collision.normal) << "query " << i;
+        }
+    }
+    EXPECT_GT(numCollided, 0);
+}
+
+static std::unique_ptr<Model> makeAnimatedModel(std::vector<Animation::Event> events = {}) {
+    auto rootNode = std::make_shared<ModelNode>(0, "node0", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+    auto animRootNode = std::make_shared<ModelNode>(0, "node0", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), false, nullptr);
+    auto parent = rootNode;
+    auto animParent = animRootNode;
+    for (int i = 0; i < kNumAnimatedNodes; ++i) {
+        auto name = "node" + std::to_string(i + 1);
+        auto node = std::make_shared<ModelNode>(i + 1, name, glm::vec3(0.0f, 0.0f, 1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, parent.get());
+        parent->addChild(node);
+        parent = node;
+
+        auto animNode = std::make_shared<ModelNode>(i + 1, name, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), false, animParent.get());
+        auto &position = animNode->vectorTracks()[ControllerTypes::position];
+        auto &orientation = animNode->quaternionTracks()[ControllerTypes::orientation];
+        for (int kf = 0; kf <= 4; ++kf) {
+            float time = 0.5f * kf;
+            position.add(time, glm::vec3(0.1f * kf, 0.05f * i, 0.0f));
+            orientation.add(time, glm::angleAxis(0.2f * kf + 0.1f * i, glm::vec3(0.0f, 0.0f, 1.0f)));
+        }
+        position.update();
+        orientation.update();
+        animParent->addChild(animNode);
+        animParent = animNode;
+    }
+
+    auto animations = std::vector<std::shared_ptr<Animation>> {
+        std::make_shared<Animation>("some_animation", 2.0f, 0.25f, "", animRootNode, std::move(events))};
+
+    return std::make_unique<Model>("some_model", 0, rootNode, animations, "", 1.0f);
+}
+
+class ThreadRecordingEventListener : public IAnimationEventListener {
+public:
+    void onEventSignalled(const std::string &name) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _threadIds.push_back(std::this_thread::get_id());
+    }
+
+    const std::vector<std::thread::id> &threadIds() const { return _threadIds; }
+
+private:
+    std::vector<std::thread::id> _threadIds;
+    std::mutex _mutex;
+};
+
+class SceneGraphUpdateTest : public testing::Test {
+protected:
+    GraphicsOptions _graphicsOpt;
+    MockRenderPipelineFactory _pipelineFactory;
+    TestGraphicsModule _graphicsModule;
+    TestAudioModule _audioModule;
+    TestResourceModule _resourceModule;
+
+    std::unique_ptr<Model> _model;
+
+    void SetUp() override {
+        _graphicsModule.init();
+        _audioModule.init();
+        _resourceModule.init();
+
+        _model = makeAnimatedModel();
+    }
+
+    std::unique_ptr<SceneGraph> makeScene(std::vector<std::shared_ptr<ModelSceneNode>> &outRoots) {
+        auto scene = std::make_unique<SceneGraph>("test", _pipelineFactory, _graphicsOpt, _graphicsModule.services(), _audioModule.services(), _resourceModule.services());
+        for (int i = 0; i < kNumAnimatedModels; ++i) {
+            auto root = scene->newModel(*_model, ModelUsage::Creature);
+            root->setLocalTransform(glm::translate(glm::vec3(2.0f * i, 0.0f, 0.0f)));
+            root->setEnabled(i % 9 != 0);
+            root->playAnimation("some_animation", nullptr, AnimationProperties::fromFlags(AnimationFlags::loop));
+            root->setAnimationTime(0.03f * i);
+            scene->addRoot(root);
+            outRoots.push_back(std::move(root));
+        }
+        return scene;
+    }
+};
+
+TEST_F(SceneGraphUpdateTest, should_update_model_roots_on_thread_pool_as_serially) {
+    // given
+    std::vector<std::shared_ptr<ModelSceneNode>> serialRoots;
+    auto serialScene = makeScene(serialRoots);
+    std::vector<std::shared_ptr<ModelSceneNode>> parallelRoots;
+    auto parallelScene = makeScene(parallelRoots);
+    auto threadPool = ThreadPool(4);
+    threadPool.init();
+
+    // when
+    for (int frame = 0; frame < 30; ++frame) {
+        float dt = 0.016f + 0.001f * (frame % 5);
+        serialScene->update(dt);
+        parallelScene->update(dt, &threadPool);
+    }
+
+    // then
+    for (int i = 0; i < kNumAnimatedModels; ++i) {
+        auto &serialChannels = serialRoots[i]->animationChannels();
+        auto &parallelChannels = parallelRoots[i]->animationChannels();
+        ASSERT_EQ(serialChannels.size(), parallelChannels.size()) << "model " << i;
+        EXPECT_EQ(serialChannels[0].time, parallelChannels[0].time) << "model " << i;
+        for (int number = 0; number <= kNumAnimatedNodes; ++number) {
+            auto serialNode = serialRoots[i]->getNodeByNumber(number);
+            auto parallelNode = parallelRoots[i]->getNodeByNumber(number);
+            ASSERT_TRUE(serialNode && parallelNode) << "model " << i << ", node " << number;
+            EXPECT_TRUE(serialNode->absoluteTransform() == parallelNode->absoluteTransform()) << "model " << i << ", node " << number;
+        }
+    }
+    auto leaf = serialRoots[1]->getNodeByNumber(kNumAnimatedNodes);
+    EXPECT_FALSE(leaf->localTransform() == _model->getNodeByNumber(kNumAnimatedNodes)->localTransform());
+}
+
+class SceneGraphCollisionTest : public testing::Test {
+protected:
+    GraphicsOptions _graphicsOpt;
+    MockRenderPipelineFactory _pipelineFactory;
+    TestGraphicsModule _graphicsModule;
+    TestAudioModule _audioModule;
+    TestResourceModule _resourceModule;
+
+    std::unique_ptr<Walkmesh> _walkmesh;
+    std::vector<TestUser> _users;
+    std::unique_ptr<SceneGraph> _scene;
+
+    void SetUp() override {
+        _graphicsModule.init();
+        _audioModule.init();
+        _resourceModule.init();
+
+        _scene = std::make_unique<SceneGraph>("test", _pipelineFactory, _graphicsOpt, _graphicsModule.services(), _audioModule.services(), _resourceModule.services());
+        _scene->setWalkableSurfaces(std::set<uint32_t> {kFloorMaterial});
+        _scene->setWalkcheckSurfaces(std::set<uint32_t> {kFloorMaterial, kWallMaterial});
+        _scene->setLineOfSightSurfaces(std::set<uint32_t> {kWallMaterial});
+
+        _walkmesh = makeFloorAndWall();
+        _users.resize(kGridSize * kGridSize);
+        for (int y = 0; y < kGridSize; ++y) {
+            for (int x = 0; x < kGridSize; ++x) {
+                int idx = y * kGridSize + x;
+                auto node = std::make_shared<WalkmeshSceneNode>(*_walkmesh, *_scene, _graphicsModule.services(), _audioModule.services(), _resourceModule.services());
+                auto transform = glm::translate(glm::vec3(x * kGridSpacing, y * kGridSpacing, 0.0f));
+                transform *= glm::rotate(0.1f * idx, glm::vec3(0.0f, 0.0f, 1.0f));
+                node->setLocalTransform(transform);
+                node->setUser(_users[idx]);
+                node->setEnabled(idx % 7 != 0);
+                _scene->addRoot(node);
+            }
+        }
+    }
+};
+
+TEST_F(SceneGraphCollisionTest, should_test_collisions_in_batch_as_one_by_one) {
+    // given
+    auto queries = makeQueries(_users, 600);
+    std::vector<CollisionResult> results;
+
+    // when
+    _scene->testCollisions(queries, results);
+
+    // then
+    expectResultsEqual(*_scene, queries, results);
+}
+
+TEST_F(SceneGraphCollisionTest, should_test_collisions_in_batch_on_thread_pool_as_one_by_one) {
+    // given
+    auto queries = makeQueries(_users, 600);
+    std::vector<CollisionResult> results;
+    auto threadPool = ThreadPool(4);
+    threadPool.init();
+
+    // when
+    _scene->testCollisions(queries, results, &threadPool);
+
+    // then
+    expectResultsEqual(*_scene, queries, results);
+}
+
+TEST_F(SceneGraphUpdateTest, should_signal_events_of_attached_models_on_calling_thread) {
+    // given
+    auto eventModel = makeAnimatedModel({{0.1f, "some_event"}});
+    auto listener = ThreadRecordingEventListener();
+    auto scene = SceneGraph("test", _pipelineFactory, _graphicsOpt, _graphicsModule.services(), _audioModule.services(), _resourceModule.services());
+    std::vector<std::shared_ptr<ModelSceneNode>> models;
+    for (int i = 0; i < kNumAnimatedModels; ++i) {
+        auto root = scene.newModel(*_model, ModelUsage::Creature);
+        auto attachment = scene.newModel(*eventModel, ModelUsage::Equipment);
+        attachment->setAnimationEventListener(&listener);
+        attachment->playAnimation("some_animation", nullptr, AnimationProperties::fromFlags(AnimationFlags::loop));
+        root->attach("node" + std::to_string(kNumAnimatedNodes), *attachment);
+        scene.addRoot(root);
+        models.push_back(std::move(root));
+        models.push_back(std::move(attachment));
+    }
+    auto threadPool = ThreadPool(4);
+    threadPool.init();
+
+    // when
+    for (int frame = 0; frame < 30; ++frame) {
+        scene.update(0.016f, &threadPool);
+    }
+
+    // then
+    auto &threadIds = listener.threadIds();
+    EXPECT_EQ(static_cast<size_t>(kNumAnimatedModels), threadIds.size());
+    for (auto &threadId : threadIds) {
+        EXPECT_EQ(std::this_thread::get_id(), threadId);
+    }
+}
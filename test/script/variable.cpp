@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/script/variable.h"
+
+using namespace reone;
+using namespace reone::script;
+
+TEST(Variable, should_share_payload_between_copies) {
+    // given
+    auto original = Variable::ofString("some_string");
+
+    // when
+    auto copy = original;
+
+    // then
+    EXPECT_EQ(&original.strValue(), &copy.strValue());
+    EXPECT_EQ("some_string", copy.strValue());
+    EXPECT_TRUE(original == copy);
+}
+
+TEST(Variable, should_compare_default_and_explicit_values) {
+    // given
+    auto defaultString = Variable::ofString("");
+    auto emptyString = Variable::ofString(std::string());
+    auto someString = Variable::ofString("some_string");
+    auto zeroVector = Variable::ofVector(glm::vec3(0.0f));
+    auto someVector = Variable::ofVector(glm::vec3(1.0f, 2.0f, 3.0f));
+
+    // then
+    EXPECT_TRUE(defaultString == emptyString);
+    EXPECT_FALSE(defaultString == someString);
+    EXPECT_EQ(glm::vec3(0.0f), zeroVector.vecValue());
+    EXPECT_FALSE(zeroVector == someVector);
+    EXPECT_EQ(glm::vec3(1.0f, 2.0f, 3.0f), someVector.vecValue());
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/script/program.h"
+#include "reone/script/verifier.h"
+#include "reone/system/exception/validation.h"
+
+#include "../fixtures/script.h"
+
+using namespace reone;
+using namespace reone::script;
+
+using testing::Return;
+using testing::ReturnRef;
+
+TEST(ScriptVerifier, should_verify_loop) {
+    // given
+    ScriptProgram program("some_program");
+    program.add(Instruction::newCONSTI(0));
+    program.add(Instruction::newCONSTI(10));
+    program.add(Instruction::newCPTOPSP(-8, 8));
+    program.add(Instruction(InstructionType::LTII));
+    program.add(Instruction::newJZ(18));
+    program.add(Instruction::newINCISP(-8));
+    program.add(Instruction::newJMP(-22));
+    program.add(Instruction::newMOVSP(-4));
+
+    auto routines = MockRoutines();
+
+    // when
+    ScriptVerifier(routines).verify(program);
+
+    // then
+    EXPECT_TRUE(program.isLinked());
+    EXPECT_TRUE(program.isVerified());
+    EXPECT_EQ(4, program.maxStackSize());
+    auto &instructions = program.instructions();
+    EXPECT_TRUE(instructions[3].typesVerified);
+    EXPECT_TRUE(instructions[4].typesVerified);
+}
+
+TEST(ScriptVerifier, should_verify_subroutine) {
+    // given
+    ScriptProgram program("some_program");
+    program.add(Instruction(InstructionType::RSADDI));
+    program.add(Instruction::newCONSTI(21));
+    program.add(Instruction::newJSR(24));
+    program.add(Instruction::newCPTOPSP(-4, 4));
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction(InstructionType::ADDII));
+    program.add(Instruction(InstructionType::RETN));
+    program.add(Instruction::newCPTOPSP(-4, 4));
+    program.add(Instruction::newCPTOPSP(-4, 4));
+    program.add(Instruction(InstructionType::ADDII));
+    program.add(Instruction::newCPDOWNSP(-12, 4));
+    program.add(Instruction::newMOVSP(-8));
+    program.add(Instruction(InstructionType::RETN));
+
+    auto routines = MockRoutines();
+
+    // when
+    ScriptVerifier(routines).verify(program);
+
+    // then
+    EXPECT_TRUE(program.isVerified());
+    EXPECT_EQ(4, program.maxStackSize());
+    auto &instructions = program.instructions();
+    EXPECT_TRUE(instructions[5].typesVerified);  // return value is known to be int
+    EXPECT_FALSE(instructions[9].typesVerified); // arguments are unknown to the subroutine
+}
+
+TEST(ScriptVerifier, should_verify_action) {
+    // given
+    ScriptProgram program("some_program");
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction::newCONSTS("some_tag"));
+    program.add(Instruction::newACTION(0, 2));
+    program.add(Instruction::newCONSTO(2));
+    program.add(Instruction(InstructionType::EQUALOO));
+
+    auto routine = std::make_shared<MockRoutine>(
+        "SomeAction",
+        VariableType::Object,
+        Variable::ofObject(kObjectInvalid),
+        std::vector<VariableType> {VariableType::String, VariableType::Int});
+    auto routines = MockRoutines();
+    EXPECT_CALL(routines, getNumRoutines())
+        .WillRepeatedly(Return(1));
+    EXPECT_CALL(routines, get(0))
+        .WillRepeatedly(ReturnRef(*routine));
+
+    // when
+    ScriptVerifier(routines).verify(program);
+
+    // then
+    EXPECT_TRUE(program.isVerified());
+    auto &instructions = program.instructions();
+    EXPECT_TRUE(instructions[2].typesVerified);
+    EXPECT_TRUE(instructions[4].typesVerified);
+}
+
+TEST(ScriptVerifier, should_keep_checks_for_mismatching_types) {
+    // given
+    ScriptProgram program("some_program");
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction::newCONSTF(2.0f));
+    program.add(Instruction(InstructionType::ADDII));
+
+    auto routines = MockRoutines();
+
+    // when
+    ScriptVerifier(routines).verify(program);
+
+    // then
+    EXPECT_TRUE(program.isVerified());
+    EXPECT_FALSE(program.instructions()[2].typesVerified);
+}
+
+TEST(ScriptVerifier, should_not_verify_program_with_stack_underflow) {
+    // given
+    ScriptProgram program("some_program");
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction::newMOVSP(-8));
+
+    auto routines = MockRoutines();
+
+    // when
+    EXPECT_THROW(ScriptVerifier(routines).verify(program), ValidationException);
+
+    // then
+    EXPECT_FALSE(program.isVerified());
+}
+
+TEST(ScriptVerifier, should_not_verify_program_with_inconsistent_stack_depth) {
+    // given
+    ScriptProgram program("some_program");
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction::newJZ(12));
+    program.add(Instruction::newCONSTI(2));
+    program.add(Instruction::newCONSTI(3));
+    program.add(Instruction(InstructionType::ADDII));
+
+    auto routines = MockRoutines();
+
+    // when
+    EXPECT_THROW(ScriptVerifier(routines).verify(program), ValidationException);
+
+    // then
+    EXPECT_FALSE(program.isVerified());
+}
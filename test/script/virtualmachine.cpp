@@ -203,6 +203,100 @@ TEST(VirtualMachine, should_run_script_program__loop) {
     EXPECT_EQ(10, result);
 }
 
+TEST(VirtualMachine, should_link_script_program_once_and_reuse_it) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(0));
+    program->add(Instruction::newCONSTI(10));
+    program->add(Instruction::newCPTOPSP(-8, 8));
+    program->add(Instruction(InstructionType::LTII));
+    program->add(Instruction::newJZ(18));
+    program->add(Instruction::newINCISP(-8));
+    program->add(Instruction::newJMP(-22));
+    program->add(Instruction::newMOVSP(-4));
+
+    // when
+    auto result1 = VirtualMachine(program, std::make_unique<ExecutionContext>()).run();
+    auto result2 = VirtualMachine(program, std::make_unique<ExecutionContext>()).run();
+
+    // then
+    EXPECT_TRUE(program->isLinked());
+    auto &instructions = program->instructions();
+    EXPECT_EQ(7, instructions[4].jumpIdx);
+    EXPECT_EQ(2, instructions[6].jumpIdx);
+    EXPECT_EQ(8, instructions[7].nextIdx);
+    EXPECT_EQ(10, result1);
+    EXPECT_EQ(10, result2);
+}
+
+TEST(VirtualMachine, should_verify_script_program_once_and_reuse_it) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(0));
+    program->add(Instruction::newCONSTI(10));
+    program->add(Instruction::newCPTOPSP(-8, 8));
+    program->add(Instruction(InstructionType::LTII));
+    program->add(Instruction::newJZ(18));
+    program->add(Instruction::newINCISP(-8));
+    program->add(Instruction::newJMP(-22));
+    program->add(Instruction::newMOVSP(-4));
+
+    auto routines = MockRoutines();
+    auto newContext = [&routines]() {
+        auto context = std::make_unique<ExecutionContext>();
+        context->routines = &routines;
+        return context;
+    };
+
+    // when
+    auto result1 = VirtualMachine(program, newContext()).run();
+    auto result2 = VirtualMachine(program, newContext()).run();
+
+    // then
+    EXPECT_TRUE(program->isVerified());
+    EXPECT_TRUE(program->instructions()[3].typesVerified);
+    EXPECT_EQ(10, result1);
+    EXPECT_EQ(10, result2);
+}
+
+TEST(VirtualMachine, should_halt_verified_script_program_on_invalid_type) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(1));
+    program->add(Instruction::newCONSTF(2.0f));
+    program->add(Instruction(InstructionType::ADDII));
+
+    auto routines = MockRoutines();
+    auto context = std::make_unique<ExecutionContext>();
+    context->routines = &routines;
+
+    auto machine = VirtualMachine(program, std::move(context));
+
+    // when
+    auto result = machine.run();
+
+    // then
+    EXPECT_TRUE(program->isVerified());
+    EXPECT_EQ(-1, result);
+}
+
+TEST(VirtualMachine, should_not_run_script_program_with_invalid_jump_target) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(1));
+    program->add(Instruction::newJMP(-3));
+
+    auto context = std::make_unique<ExecutionContext>();
+    auto machine = VirtualMachine(program, std::move(context));
+
+    // when
+    auto result = machine.run();
+
+    // then
+    EXPECT_EQ(-1, result);
+    EXPECT_EQ(0, machine.getStackSize());
+}
+
 TEST(VirtualMachine, should_run_script_program__action) {
     // given
     auto program = std::make_shared<ScriptProgram>("some_program");
@@ -231,7 +325,7 @@ TEST(VirtualMachine, should_run_script_program__action) {
     EXPECT_EQ(-1, result);
     EXPECT_EQ(1ll, routine->invokeInvocations().size());
     auto &invocation = routine->invokeInvocations();
-    EXPECT_EQ(std::string("some_tag"), std::get<0>(invocation[0])[0].strValue);
+    EXPECT_EQ(std::string("some_tag"), std::get<0>(invocation[0])[0].strValue());
     EXPECT_EQ(1, std::get<0>(invocation[0])[1].intValue);
 }
 
@@ -269,7 +363,7 @@ TEST(VirtualMachine, should_run_script_program__action_with_vectors) {
     EXPECT_NEAR(5.0f, machine.getStackVariable(2).floatValue, 1e-5);
     EXPECT_EQ(1ll, routine->invokeInvocations().size());
     auto &invocation = routine->invokeInvocations();
-    auto inVecValue = std::get<0>(invocation[0])[0].vecValue;
+    auto inVecValue = std::get<0>(invocation[0])[0].vecValue();
     EXPECT_NEAR(2.0f, inVecValue.x, 1e-5);
     EXPECT_NEAR(3.0f, inVecValue.y, 1e-5);
     EXPECT_NEAR(4.0f, inVecValue.z, 1e-5);
@@ -314,7 +408,7 @@ TEST(VirtualMachine, should_run_script_program__action_with_store_state) {
     EXPECT_EQ(0, machine.getStackSize());
     EXPECT_EQ(1ll, routine->invokeInvocations().size());
     auto &routineInvocation = routine->invokeInvocations()[0];
-    auto &actionContext = std::get<0>(routineInvocation)[0].context;
+    auto &actionContext = std::get<0>(routineInvocation)[0].context();
     EXPECT_TRUE(static_cast<bool>(actionContext));
     EXPECT_TRUE(static_cast<bool>(actionContext->savedState));
     EXPECT_EQ(2, actionContext->savedState->globals.size());
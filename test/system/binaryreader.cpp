@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 
 #include "reone/system/binaryreader.h"
+#include "reone/system/exception/endofstream.h"
+#include "reone/system/stream/fileinput.h"
 #include "reone/system/stream/memoryinput.h"
 #include "reone/system/stringbuilder.h"
 
@@ -150,3 +152,84 @@ TEST(BinaryReader, should_read_from_big_endian_stream) {
     EXPECT_EQ(expectedFloat, actualFloat);
     EXPECT_EQ(expectedDouble, actualDouble);
 }
+
+TEST(BinaryReader, should_read_arrays_from_big_endian_stream) {
+    // given
+    auto input = StringBuilder()
+                     .append("\xff\x01\x00\x02", 4)
+                     .append("\xff\xff\xff\x02\x00\x00\x00\x03", 8)
+                     .append("\xff\xff\xff\xfe", 4)
+                     .append("\x3f\x80\x00\x00\xbf\x80\x00\x00", 8)
+                     .string();
+    auto stream = MemoryInputStream(input);
+    auto reader = BinaryReader(stream, boost::endian::order::big);
+    auto expectedUint16s = std::vector<uint16_t> {65281u, 2u};
+    auto expectedUint32s = std::vector<uint32_t> {4294967042u, 3u};
+    auto expectedInt32s = std::vector<int32_t> {-2};
+    auto expectedFloats = std::vector<float> {1.0f, -1.0f};
+
+    // when
+    auto actualUint16s = reader.readUint16Array(2);
+    auto actualUint32s = reader.readUint32Array(2);
+    auto actualInt32s = reader.readInt32Array(1);
+    auto actualFloats = reader.readFloatArray(2);
+
+    // then
+    EXPECT_EQ(expectedUint16s, actualUint16s);
+    EXPECT_EQ(expectedUint32s, actualUint32s);
+    EXPECT_EQ(expectedInt32s, actualInt32s);
+    EXPECT_EQ(expectedFloats, actualFloats);
+    EXPECT_EQ(24ll, reader.position());
+}
+
+TEST(BinaryReader, should_read_string_views_from_memory_stream) {
+    // given
+    auto input = std::string("Hello\x00\x00\x00world!", 14);
+    auto stream = MemoryInputStream(input);
+    auto reader = BinaryReader(stream);
+
+    // when
+    auto hello = reader.readStringView(8);
+    auto world = reader.readStringView(6);
+
+    // then
+    EXPECT_EQ(std::string_view("Hello"), hello);
+    EXPECT_EQ(std::string_view("world!"), world);
+    EXPECT_EQ(&input[8], world.data());
+}
+
+TEST(BinaryReader, should_throw_on_reading_past_end_of_memory_stream) {
+    // given
+    auto input = std::string("\x01\x02\x03", 3);
+    auto stream = MemoryInputStream(input);
+    auto reader = BinaryReader(stream);
+
+    // when
+    reader.readUint16();
+
+    // then
+    EXPECT_THROW(reader.readUint16(), EndOfStreamException);
+    EXPECT_THROW(reader.readFloatArray(1), EndOfStreamException);
+}
+
+TEST(BinaryReader, should_read_arrays_from_file_stream) {
+    // given
+    auto tmpPath = std::filesystem::temp_directory_path();
+    tmpPath.append("reone_test_binary_reader");
+    auto tmpFile = std::ofstream(tmpPath, std::ios::binary);
+    tmpFile.write("\x00\x00\x00\x01\x00\x00\x00\x02Hello\x00", 14);
+    tmpFile.close();
+    auto stream = FileInputStream(tmpPath);
+    auto reader = BinaryReader(stream, boost::endian::order::big);
+    auto expectedUint32s = std::vector<uint32_t> {1u, 2u};
+    auto expectedCStr = std::string("Hello");
+
+    // when
+    auto actualUint32s = reader.readUint32Array(2);
+    auto actualCStr = reader.readCString(16);
+    stream.close();
+
+    // then
+    EXPECT_EQ(expectedUint32s, actualUint32s);
+    EXPECT_EQ(expectedCStr, actualCStr) << notEqualMessage(expectedCStr, actualCStr);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/lrucache.h"
+
+using namespace reone;
+
+TEST(LruCache, should_create_and_cache_value_when_get_called_twice_with_the_same_key) {
+    // given
+    LruCache<int, std::string> cache(2);
+    int counter = 0;
+    auto valueFactory = [&counter]() { return std::to_string(counter++); };
+
+    // when
+    auto value1 = cache.getOrAdd(1, valueFactory);
+    auto value2 = cache.getOrAdd(1, valueFactory);
+
+    // then
+    EXPECT_EQ("0", value1);
+    EXPECT_EQ("0", value2);
+    EXPECT_EQ(1, counter);
+    EXPECT_EQ(1ll, cache.size());
+}
+
+TEST(LruCache, should_evict_least_recently_used_item) {
+    // given
+    LruCache<int, std::string> cache(2);
+    int counter = 0;
+    auto valueFactory = [&counter]() { return std::to_string(counter++); };
+
+    // when
+    cache.getOrAdd(1, valueFactory);
+    cache.getOrAdd(2, valueFactory);
+    cache.getOrAdd(1, valueFactory);
+    cache.getOrAdd(3, valueFactory);
+
+    // then
+    EXPECT_EQ(2ll, cache.size());
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(3));
+    EXPECT_EQ("3", cache.getOrAdd(2, valueFactory));
+    EXPECT_FALSE(cache.contains(1));
+}
+
+TEST(LruCache, should_not_cache_items_when_capacity_is_zero) {
+    // given
+    LruCache<int, std::string> cache(0);
+    int counter = 0;
+    auto valueFactory = [&counter]() { return std::to_string(counter++); };
+
+    // when
+    auto value1 = cache.getOrAdd(1, valueFactory);
+    auto value2 = cache.getOrAdd(1, valueFactory);
+
+    // then
+    EXPECT_EQ("0", value1);
+    EXPECT_EQ("1", value2);
+    EXPECT_EQ(0ll, cache.size());
+}
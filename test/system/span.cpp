@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/span.h"
+
+using namespace reone;
+
+static_assert(std::is_constructible_v<Span<const int>, std::vector<int> &>);
+static_assert(std::is_constructible_v<Span<const int>, const std::vector<int> &>);
+static_assert(std::is_constructible_v<Span<int>, std::array<int, 2> &>);
+static_assert(!std::is_constructible_v<Span<int>, const std::vector<int> &>);
+static_assert(!std::is_constructible_v<Span<const int>, std::vector<int>>);
+static_assert(!std::is_constructible_v<Span<const int>, std::vector<float> &>);
+
+TEST(Span, should_view_lvalue_container) {
+    // given
+    auto values = std::vector<int> {1, 2, 3};
+
+    // when
+    auto span = Span<const int>(values);
+
+    // then
+    EXPECT_EQ(values.data(), span.data());
+    EXPECT_EQ(3ll, span.size());
+    EXPECT_EQ(1, span.front());
+    EXPECT_EQ(3, span.back());
+}
+
+TEST(Span, should_copy_view_instead_of_viewing_span_as_container) {
+    // given
+    auto values = std::vector<int> {1, 2, 3};
+    auto span = Span<int>(values).subspan(1, 2);
+
+    // when
+    auto copy = span;
+
+    // then
+    EXPECT_EQ(span.data(), copy.data());
+    EXPECT_EQ(2ll, copy.size());
+    EXPECT_EQ(2, copy[0]);
+}
@@ -75,3 +75,47 @@ TEST(ThreadPool, should_cancel_enqueued_task) {
     // then
     EXPECT_TRUE(exited);
 }
+
+TEST(ThreadPool, should_cover_range_in_chunks_with_parallel_for) {
+    // given
+    ThreadPool pool(4);
+    pool.init();
+    std::vector<std::atomic_int> visits(1000);
+    std::atomic_int numChunks {0};
+
+    // when
+    parallelFor(&pool, 1000, 64, 8, [&visits, &numChunks](int begin, int end) {
+        EXPECT_LE(end - begin, 64);
+        for (int i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+        ++numChunks;
+    });
+
+    // then
+    EXPECT_EQ(16, numChunks);
+    for (auto &count : visits) {
+        EXPECT_EQ(1, count);
+    }
+}
+
+TEST(ThreadPool, should_not_deadlock_on_parallel_for_from_worker_thread) {
+    // given
+    ThreadPool pool(1);
+    pool.init();
+    std::atomic_int sum {0};
+    auto done = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+
+    // when
+    pool.enqueue([&pool, &sum, done](auto &) {
+        parallelFor(&pool, 100, 10, 8, [&sum](int begin, int end) {
+            sum += end - begin;
+        });
+        done->set_value();
+    });
+
+    // then
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+    EXPECT_EQ(100, sum);
+}